@@ -0,0 +1,297 @@
+// Async I/O throughput benchmark
+//
+// Reads a directory of many small files and a few large files with plain
+// blocking pread, then with each AsyncIOService backend, buffered and with
+// O_DIRECT. The page cache is dropped for the data set before every pass so
+// buffered passes measure the device rather than memory.
+//
+// Usage: async_io_bench [directory] [small-file-count] [large-file-MB] [large-file-count]
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#include "utils/async_io.h"
+
+using namespace VortexEngine;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr uint32_t SMALL_FILE_SIZE = 4096;
+constexpr uint32_t SMALL_BATCH = 64;
+constexpr uint32_t LARGE_CHUNK_SIZE = 1024 * 1024;
+constexpr uint32_t LARGE_READS_IN_FLIGHT = 32;
+
+struct DataSet {
+    std::vector<std::string> smallFiles;
+    std::vector<std::string> largeFiles;
+    uint64_t largeFileSize = 0;
+};
+
+double secondsSince(Clock::time_point start) {
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+bool writeFile(const std::string& path, uint64_t size) {
+    if (std::filesystem::exists(path) && std::filesystem::file_size(path) == size) {
+        return true;
+    }
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+        std::cerr << "Failed to create " << path << std::endl;
+        return false;
+    }
+
+    std::vector<char> chunk(LARGE_CHUNK_SIZE);
+    for (size_t i = 0; i < chunk.size(); ++i) {
+        chunk[i] = static_cast<char>(i * 31 + size);
+    }
+
+    for (uint64_t written = 0; written < size;) {
+        uint64_t count = std::min<uint64_t>(chunk.size(), size - written);
+        file.write(chunk.data(), static_cast<std::streamsize>(count));
+        written += count;
+    }
+    return file.good();
+}
+
+bool prepareDataSet(DataSet& dataSet, const std::string& directory, uint32_t smallCount, uint64_t largeMegabytes, uint32_t largeCount) {
+    std::filesystem::create_directories(directory + "/small");
+
+    std::cout << "Preparing data set in " << directory << "..." << std::endl;
+    for (uint32_t i = 0; i < smallCount; ++i) {
+        std::string path = directory + "/small/" + std::to_string(i) + ".bin";
+        if (!writeFile(path, SMALL_FILE_SIZE)) {
+            return false;
+        }
+        dataSet.smallFiles.push_back(path);
+    }
+
+    dataSet.largeFileSize = largeMegabytes * 1024 * 1024;
+    for (uint32_t i = 0; i < largeCount; ++i) {
+        std::string path = directory + "/large_" + std::to_string(i) + ".bin";
+        if (!writeFile(path, dataSet.largeFileSize)) {
+            return false;
+        }
+        dataSet.largeFiles.push_back(path);
+    }
+    return true;
+}
+
+// Evicts the data set from the page cache (best effort)
+void dropCache(const DataSet& dataSet) {
+#if defined(__linux__)
+    auto drop = [](const std::string& path) {
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd >= 0) {
+            fdatasync(fd);
+            posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+            ::close(fd);
+        }
+    };
+    for (const auto& path : dataSet.smallFiles) {
+        drop(path);
+    }
+    for (const auto& path : dataSet.largeFiles) {
+        drop(path);
+    }
+#else
+    (void)dataSet;
+#endif
+}
+
+void report(const char* name, uint64_t files, uint64_t bytes, double seconds) {
+    std::cout << "  " << name << ": " << seconds * 1000.0 << " ms, "
+              << static_cast<uint64_t>(files / seconds) << " files/s, "
+              << (bytes / (1024.0 * 1024.0)) / seconds << " MB/s" << std::endl;
+}
+
+#ifndef _WIN32
+void benchmarkBlocking(const DataSet& dataSet) {
+    std::cout << "blocking pread" << std::endl;
+    std::vector<char> buffer(LARGE_CHUNK_SIZE);
+
+    dropCache(dataSet);
+    uint64_t bytes = 0;
+    auto start = Clock::now();
+    for (const auto& path : dataSet.smallFiles) {
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd >= 0) {
+            ssize_t result = pread(fd, buffer.data(), SMALL_FILE_SIZE, 0);
+            bytes += result > 0 ? static_cast<uint64_t>(result) : 0;
+            ::close(fd);
+        }
+    }
+    report("small files", dataSet.smallFiles.size(), bytes, secondsSince(start));
+
+    if (dataSet.largeFiles.empty()) {
+        return;
+    }
+
+    bytes = 0;
+    start = Clock::now();
+    for (const auto& path : dataSet.largeFiles) {
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            continue;
+        }
+        for (uint64_t offset = 0;; offset += LARGE_CHUNK_SIZE) {
+            ssize_t result = pread(fd, buffer.data(), LARGE_CHUNK_SIZE, static_cast<off_t>(offset));
+            if (result <= 0) {
+                break;
+            }
+            bytes += static_cast<uint64_t>(result);
+        }
+        ::close(fd);
+    }
+    report("large files", dataSet.largeFiles.size(), bytes, secondsSince(start));
+}
+#endif
+
+void benchmarkSmallFiles(AsyncIOService& service, const DataSet& dataSet, bool direct) {
+    size_t count = dataSet.smallFiles.size();
+    uint8_t* slab = static_cast<uint8_t*>(AsyncIOService::allocateAligned(count * SMALL_FILE_SIZE));
+    std::vector<AsyncFile> files(count);
+    std::atomic<uint64_t> bytes{0};
+
+    dropCache(dataSet);
+    auto start = Clock::now();
+    for (size_t i = 0; i < count; ++i) {
+        files[i] = service.openFile(dataSet.smallFiles[i], direct);
+
+        AsyncReadRequest request;
+        request.file = files[i];
+        request.buffer = slab + i * SMALL_FILE_SIZE;
+        request.size = SMALL_FILE_SIZE;
+        request.callback = [&bytes](const AsyncReadResult& result) {
+            if (result.succeeded()) {
+                bytes.fetch_add(static_cast<uint64_t>(result.bytesRead), std::memory_order_relaxed);
+            }
+        };
+        service.read(std::move(request));
+
+        if ((i + 1) % SMALL_BATCH == 0) {
+            service.submit();
+        }
+    }
+    service.waitIdle();
+    double seconds = secondsSince(start);
+
+    for (auto& file : files) {
+        service.closeFile(file);
+    }
+    AsyncIOService::freeAligned(slab);
+
+    report("small files", count, bytes.load(), seconds);
+}
+
+void benchmarkLargeFiles(AsyncIOService& service, const DataSet& dataSet, bool direct) {
+    if (dataSet.largeFiles.empty()) {
+        return;
+    }
+
+    std::vector<uint8_t*> buffers(LARGE_READS_IN_FLIGHT);
+    for (auto& buffer : buffers) {
+        buffer = static_cast<uint8_t*>(AsyncIOService::allocateAligned(LARGE_CHUNK_SIZE));
+    }
+
+    std::atomic<uint64_t> bytes{0};
+    dropCache(dataSet);
+    auto start = Clock::now();
+
+    for (const auto& path : dataSet.largeFiles) {
+        AsyncFile file = service.openFile(path, direct);
+        uint64_t chunkCount = (file.size + LARGE_CHUNK_SIZE - 1) / LARGE_CHUNK_SIZE;
+        std::atomic<uint64_t> nextChunk{0};
+
+        // Each buffer slot issues its next chunk as soon as its last read lands
+        std::function<void(uint8_t*)> issue = [&](uint8_t* buffer) {
+            uint64_t chunk = nextChunk.fetch_add(1);
+            if (chunk >= chunkCount) {
+                return;
+            }
+
+            AsyncReadRequest request;
+            request.file = file;
+            request.offset = chunk * LARGE_CHUNK_SIZE;
+            request.buffer = buffer;
+            request.size = LARGE_CHUNK_SIZE;
+            request.callback = [&, buffer](const AsyncReadResult& result) {
+                if (result.succeeded()) {
+                    bytes.fetch_add(static_cast<uint64_t>(result.bytesRead), std::memory_order_relaxed);
+                }
+                issue(buffer);
+            };
+            service.read(std::move(request));
+            service.submit();
+        };
+
+        for (uint8_t* buffer : buffers) {
+            issue(buffer);
+        }
+        service.waitIdle();
+        service.closeFile(file);
+    }
+
+    double seconds = secondsSince(start);
+    for (uint8_t* buffer : buffers) {
+        AsyncIOService::freeAligned(buffer);
+    }
+
+    report("large files", dataSet.largeFiles.size(), bytes.load(), seconds);
+}
+
+void benchmarkBackend(AsyncIOBackend backend, const DataSet& dataSet) {
+    for (bool direct : {false, true}) {
+        AsyncIOService service;
+        if (!service.initialize(nullptr, backend)) {
+            std::cout << AsyncIOService::backendToString(backend) << ": not available" << std::endl;
+            return;
+        }
+
+        std::cout << AsyncIOService::backendToString(service.getBackend()) << (direct ? " (O_DIRECT)" : " (buffered)") << std::endl;
+        benchmarkSmallFiles(service, dataSet, direct);
+        benchmarkLargeFiles(service, dataSet, direct);
+
+        AsyncIOStats stats = service.getStats();
+        std::cout << "  reads: " << stats.readsCompleted << ", failed: " << stats.readsFailed
+                  << ", submit calls: " << stats.submitCalls << std::endl;
+        service.shutdown();
+    }
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    std::string directory = argc > 1 ? argv[1] : "async_io_bench_data";
+    uint32_t smallCount = argc > 2 ? static_cast<uint32_t>(std::atoi(argv[2])) : 10000;
+    uint64_t largeMegabytes = argc > 3 ? static_cast<uint64_t>(std::atoll(argv[3])) : 2048;
+    uint32_t largeCount = argc > 4 ? static_cast<uint32_t>(std::atoi(argv[4])) : 2;
+
+    DataSet dataSet;
+    if (!prepareDataSet(dataSet, directory, smallCount, largeMegabytes, largeCount)) {
+        return 1;
+    }
+
+#ifndef _WIN32
+    benchmarkBlocking(dataSet);
+#endif
+    benchmarkBackend(AsyncIOBackend::ThreadPool, dataSet);
+    benchmarkBackend(AsyncIOBackend::IoUring, dataSet);
+    return 0;
+}
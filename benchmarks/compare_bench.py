@@ -0,0 +1,106 @@
+#!/usr/bin/env python3
+"""Compare two vortex_bench runs and fail on regressions.
+
+Both inputs are Google Benchmark JSON files, written with
+
+    vortex_bench --benchmark_out=results.json --benchmark_out_format=json
+
+Benchmarks are matched by name. With --benchmark_repetitions the chosen
+aggregate (median by default) is compared; otherwise repeated entries of a
+name are reduced to their median. The script exits with status 1 if any
+benchmark got slower than the threshold, so it can gate CI.
+
+Usage: compare_bench.py baseline.json contender.json [--threshold 10]
+"""
+
+import argparse
+import json
+import re
+import statistics
+import sys
+
+TIME_UNIT_NS = {"ns": 1.0, "us": 1e3, "ms": 1e6, "s": 1e9}
+
+
+def load_times(path, metric, aggregate):
+    with open(path, encoding="utf-8") as file:
+        data = json.load(file)
+
+    iterations = {}
+    aggregates = {}
+    for entry in data.get("benchmarks", []):
+        if entry.get("error_occurred"):
+            continue
+        name = entry.get("run_name", entry["name"])
+        time_ns = entry[metric] * TIME_UNIT_NS[entry.get("time_unit", "ns")]
+        if entry.get("run_type") == "aggregate":
+            if entry.get("aggregate_name") == aggregate:
+                aggregates[name] = time_ns
+        else:
+            iterations.setdefault(name, []).append(time_ns)
+
+    times = {name: statistics.median(values) for name, values in iterations.items()}
+    times.update(aggregates)
+    return times
+
+
+def format_time(time_ns):
+    for unit, scale in (("s", 1e9), ("ms", 1e6), ("us", 1e3)):
+        if time_ns >= scale:
+            return f"{time_ns / scale:.3g} {unit}"
+    return f"{time_ns:.3g} ns"
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Compare two Google Benchmark JSON results.")
+    parser.add_argument("baseline", help="results of the reference commit")
+    parser.add_argument("contender", help="results of the commit under test")
+    parser.add_argument("--threshold", type=float, default=10.0,
+                        help="allowed slowdown in percent before a benchmark counts as regressed (default 10)")
+    parser.add_argument("--metric", choices=("real_time", "cpu_time"), default="real_time",
+                        help="time to compare (default real_time)")
+    parser.add_argument("--aggregate", default="median",
+                        help="aggregate to use when the runs have repetitions (default median)")
+    parser.add_argument("--filter", default=None, help="only compare benchmarks whose name matches this regex")
+    args = parser.parse_args()
+
+    baseline = load_times(args.baseline, args.metric, args.aggregate)
+    contender = load_times(args.contender, args.metric, args.aggregate)
+    name_filter = re.compile(args.filter) if args.filter else None
+
+    names = sorted(set(baseline) | set(contender))
+    if name_filter:
+        names = [name for name in names if name_filter.search(name)]
+    if not names:
+        print("No benchmarks to compare", file=sys.stderr)
+        return 2
+
+    width = max(len(name) for name in names)
+    print(f"{'Benchmark':<{width}}  {'Baseline':>10}  {'Contender':>10}  {'Change':>8}")
+
+    regressions = []
+    for name in names:
+        if name not in baseline or name not in contender:
+            side = "baseline" if name not in baseline else "contender"
+            print(f"{name:<{width}}  {'(missing from ' + side + ')':>32}")
+            continue
+
+        before = baseline[name]
+        after = contender[name]
+        change = (after - before) / before * 100.0 if before > 0 else 0.0
+        status = ""
+        if change > args.threshold:
+            status = "  REGRESSION"
+            regressions.append(name)
+        elif change < -args.threshold:
+            status = "  improved"
+        print(f"{name:<{width}}  {format_time(before):>10}  {format_time(after):>10}  {change:>+7.1f}%{status}")
+
+    if regressions:
+        print(f"\n{len(regressions)} benchmark(s) regressed by more than {args.threshold:g}%")
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
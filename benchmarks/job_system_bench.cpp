@@ -0,0 +1,133 @@
+// Job system microbenchmark
+//
+// Measures the cost of spawning and waiting on jobs: empty jobs from the main
+// thread (in batches that fit the worker deque), parallelFor batches and jobs
+// that spawn and wait on child jobs.
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+
+#include "core/job_system.h"
+
+using namespace VortexEngine;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr uint32_t JOB_COUNT = 100000;
+constexpr int ITERATIONS = 10;
+
+// Kept well below the 4096-slot worker deque; a fuller deque makes run()
+// execute jobs inline and the timing would no longer measure the queues
+constexpr uint32_t SPAWN_BATCH = 2048;
+
+double nanosecondsPer(Clock::duration duration, uint64_t count) {
+    return std::chrono::duration<double, std::nano>(duration).count() / static_cast<double>(count);
+}
+
+void benchmarkSpawnWait(JobSystem& jobSystem) {
+    uint64_t inlineBefore = jobSystem.getStats().jobsRunInline;
+    Clock::duration total{};
+    for (int i = 0; i < ITERATIONS; ++i) {
+        JobCounter counter;
+        auto start = Clock::now();
+        for (uint32_t j = 0; j < JOB_COUNT; j += SPAWN_BATCH) {
+            uint32_t batchEnd = std::min(j + SPAWN_BATCH, JOB_COUNT);
+            for (uint32_t k = j; k < batchEnd; ++k) {
+                jobSystem.run([]() {}, &counter);
+            }
+            jobSystem.wait(&counter);
+        }
+        total += Clock::now() - start;
+    }
+
+    std::cout << "spawn+wait (empty job):  " << nanosecondsPer(total, uint64_t(JOB_COUNT) * ITERATIONS) << " ns/job"
+              << " (" << jobSystem.getStats().jobsRunInline - inlineBefore << " run inline)" << std::endl;
+}
+
+void benchmarkSingleWait(JobSystem& jobSystem) {
+    Clock::duration total{};
+    for (uint32_t i = 0; i < JOB_COUNT; ++i) {
+        JobCounter counter;
+        auto start = Clock::now();
+        jobSystem.run([]() {}, &counter);
+        jobSystem.wait(&counter);
+        total += Clock::now() - start;
+    }
+
+    std::cout << "round trip (1 job):      " << nanosecondsPer(total, JOB_COUNT) << " ns" << std::endl;
+}
+
+void benchmarkParallelFor(JobSystem& jobSystem) {
+    std::atomic<uint64_t> sum{0};
+    Clock::duration total{};
+    for (int i = 0; i < ITERATIONS; ++i) {
+        JobCounter counter;
+        auto start = Clock::now();
+        jobSystem.parallelFor(JOB_COUNT, 0, [&sum](uint32_t begin, uint32_t end) {
+            uint64_t local = 0;
+            for (uint32_t k = begin; k < end; ++k) {
+                local += k;
+            }
+            sum.fetch_add(local, std::memory_order_relaxed);
+        }, &counter);
+        jobSystem.wait(&counter);
+        total += Clock::now() - start;
+    }
+
+    std::cout << "parallelFor:             " << nanosecondsPer(total, uint64_t(JOB_COUNT) * ITERATIONS) << " ns/element"
+              << " (checksum " << sum.load() << ")" << std::endl;
+}
+
+void benchmarkNested(JobSystem& jobSystem) {
+    constexpr uint32_t PARENTS = 256;
+    constexpr uint32_t CHILDREN = 64;
+
+    Clock::duration total{};
+    for (int i = 0; i < ITERATIONS; ++i) {
+        JobCounter counter;
+        auto start = Clock::now();
+        for (uint32_t p = 0; p < PARENTS; ++p) {
+            jobSystem.run([&jobSystem]() {
+                JobCounter children;
+                for (uint32_t c = 0; c < CHILDREN; ++c) {
+                    jobSystem.run([]() {}, &children);
+                }
+                jobSystem.wait(&children);
+            }, &counter);
+        }
+        jobSystem.wait(&counter);
+        total += Clock::now() - start;
+    }
+
+    std::cout << "nested spawn+wait:       " << nanosecondsPer(total, uint64_t(PARENTS) * CHILDREN * ITERATIONS) << " ns/job" << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    uint32_t workerCount = argc > 1 ? static_cast<uint32_t>(std::atoi(argv[1])) : 0;
+
+    JobSystem jobSystem;
+    if (!jobSystem.initialize(workerCount)) {
+        std::cerr << "Failed to initialize job system" << std::endl;
+        return 1;
+    }
+
+    benchmarkSpawnWait(jobSystem);
+    benchmarkSingleWait(jobSystem);
+    benchmarkParallelFor(jobSystem);
+    benchmarkNested(jobSystem);
+
+    JobSystemStats stats = jobSystem.getStats();
+    std::cout << "jobs executed: " << stats.jobsExecuted
+              << ", stolen: " << stats.jobsStolen
+              << ", run inline: " << stats.jobsRunInline << std::endl;
+
+    jobSystem.shutdown();
+    return 0;
+}
@@ -0,0 +1,114 @@
+// Python engine value type benchmark
+//
+// Runs the same vector math from Python with three Vec3 implementations:
+//   dict   - plain Python class (instance __dict__)
+//   slots  - Python class with __slots__
+//   native - vortex.Vec3 (fixed layout, vectorcall, arena allocated)
+//
+// Usage: python_types_bench [iterations]
+
+#include <Python.h>
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+#include "scripting/native_types.h"
+
+using namespace VortexEngine;
+
+namespace {
+
+const char* BENCH_SOURCE = R"PY(
+import time
+
+class DictVec3:
+    def __init__(self, x, y, z):
+        self.x = x; self.y = y; self.z = z
+    def __add__(self, o):
+        return DictVec3(self.x + o.x, self.y + o.y, self.z + o.z)
+    def __mul__(self, s):
+        return DictVec3(self.x * s, self.y * s, self.z * s)
+    def dot(self, o):
+        return self.x * o.x + self.y * o.y + self.z * o.z
+
+class SlotsVec3:
+    __slots__ = ("x", "y", "z")
+    def __init__(self, x, y, z):
+        self.x = x; self.y = y; self.z = z
+    def __add__(self, o):
+        return SlotsVec3(self.x + o.x, self.y + o.y, self.z + o.z)
+    def __mul__(self, s):
+        return SlotsVec3(self.x * s, self.y * s, self.z * s)
+    def dot(self, o):
+        return self.x * o.x + self.y * o.y + self.z * o.z
+
+def integrate(Vec3, n):
+    p = Vec3(0.0, 0.0, 0.0)
+    v = Vec3(1.0, 2.0, 3.0)
+    dt = 1.0 / 60.0
+    start = time.perf_counter()
+    for _ in range(n):
+        p = p + v * dt
+    return (time.perf_counter() - start) / n * 1e9
+
+def read_fields(Vec3, n):
+    v = Vec3(1.0, 2.0, 3.0)
+    total = 0.0
+    start = time.perf_counter()
+    for _ in range(n):
+        total += v.x + v.y + v.z
+    return (time.perf_counter() - start) / n * 1e9
+
+def dot(Vec3, n):
+    a = Vec3(1.0, 2.0, 3.0)
+    b = Vec3(4.0, 5.0, 6.0)
+    start = time.perf_counter()
+    for _ in range(n):
+        a.dot(b)
+    return (time.perf_counter() - start) / n * 1e9
+
+def run(n):
+    from vortex import Vec3
+    kinds = (("dict  ", DictVec3), ("slots ", SlotsVec3), ("native", Vec3))
+    for name, bench in (("p = p + v * dt", integrate), ("v.x + v.y + v.z", read_fields), ("a.dot(b)", dot)):
+        print(" ", name)
+        for kind, Vec3 in kinds:
+            print("    %s: %7.1f ns" % (kind, bench(Vec3, n)))
+)PY";
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    long iterations = argc > 1 ? std::atol(argv[1]) : 1000000;
+
+    Py_Initialize();
+
+    PyObject* module = PyImport_AddModule("vortex");
+    if (!module || !NativeTypes::registerTypes(module)) {
+        Py_Finalize();
+        return 1;
+    }
+    Py_INCREF(module);
+    PyDict_SetItemString(PyImport_GetModuleDict(), "vortex", module);
+    Py_DECREF(module);
+
+    std::cout << iterations << " iterations (Python " << PY_MAJOR_VERSION << "." << PY_MINOR_VERSION << ")" << std::endl;
+
+    PyObject* globals = PyModule_GetDict(PyImport_AddModule("__main__"));
+    std::string source = std::string(BENCH_SOURCE) + "\nrun(" + std::to_string(iterations) + ")\n";
+    PyObject* result = PyRun_String(source.c_str(), Py_file_input, globals, globals);
+    if (!result) {
+        PyErr_Print();
+        Py_Finalize();
+        return 1;
+    }
+    Py_DECREF(result);
+
+    NativeArenaStats stats = NativeTypes::getArenaStats();
+    std::cout << "  arena: " << stats.totalAllocations << " allocations served from " << stats.chunkAllocations
+              << " chunks (" << stats.reservedBytes / 1024 << " KiB)" << std::endl;
+
+    Py_Finalize();
+    return 0;
+}
@@ -0,0 +1,18 @@
+#include "bench_device.h"
+
+namespace VortexEngine {
+
+MockVulkanDevice& getBenchDevice() {
+    static MockVulkanDevice* device = [] {
+        MockVulkanConfig config = MockVulkanConfig::discreteGpu();
+        config.recordCalls = false;
+        // The live-set benchmark holds more dedicated allocations than drivers allow
+        config.properties.limits.maxMemoryAllocationCount = 1 << 20;
+        auto* mock = new MockVulkanDevice(config);
+        mock->install();
+        return mock;
+    }();
+    return *device;
+}
+
+} // namespace VortexEngine
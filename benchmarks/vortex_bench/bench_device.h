@@ -0,0 +1,13 @@
+#pragma once
+
+#include "core/mock_vulkan_device.h"
+
+namespace VortexEngine {
+
+// The mock device every GPU-facing benchmark runs on
+//
+// Installed on first use and never destroyed, so it outlives every fixture.
+// Call recording is off: the engine's own cost is what is being measured.
+MockVulkanDevice& getBenchDevice();
+
+} // namespace VortexEngine
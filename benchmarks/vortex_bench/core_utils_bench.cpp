@@ -0,0 +1,109 @@
+// Hot-path utilities: block compression, string interning and metrics updates
+
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "utils/compression.h"
+#include "utils/metrics.h"
+#include "utils/string_id.h"
+
+using namespace VortexEngine;
+
+namespace {
+
+// Mesh-like data: repeated structure with small variations, so it compresses
+// roughly the way vertex and index streams do
+std::vector<std::byte> makeCompressibleData(size_t size) {
+    std::vector<std::byte> data(size);
+    uint32_t state = 0x9E3779B9u;
+    for (size_t i = 0; i < size; ++i) {
+        state = state * 1664525u + 1013904223u;
+        data[i] = static_cast<std::byte>((i % 64 < 48) ? (i & 0x3F) : (state >> 24));
+    }
+    return data;
+}
+
+void BM_CompressLZ4(benchmark::State& state) {
+    std::vector<std::byte> input = makeCompressibleData(static_cast<size_t>(state.range(0)));
+    std::vector<uint8_t> output;
+
+    size_t compressedSize = 0;
+    for (auto _ : state) {
+        compressedSize = Compression::compressLZ4(input, output);
+        benchmark::DoNotOptimize(output.data());
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+    state.counters["ratio"] = static_cast<double>(input.size()) / static_cast<double>(compressedSize);
+}
+BENCHMARK(BM_CompressLZ4)->Arg(64 * 1024)->Arg(4 * 1024 * 1024);
+
+void BM_DecompressLZ4(benchmark::State& state) {
+    std::vector<std::byte> input = makeCompressibleData(static_cast<size_t>(state.range(0)));
+    std::vector<uint8_t> compressed;
+    Compression::compressLZ4(input, compressed);
+    std::vector<std::byte> output(input.size());
+
+    for (auto _ : state) {
+        if (!Compression::decompressLZ4(std::as_bytes(std::span<const uint8_t>(compressed)), output)) {
+            state.SkipWithError("decompressLZ4 failed");
+            break;
+        }
+        benchmark::DoNotOptimize(output.data());
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_DecompressLZ4)->Arg(64 * 1024)->Arg(4 * 1024 * 1024);
+
+void BM_CompressZlib(benchmark::State& state) {
+    std::vector<std::byte> input = makeCompressibleData(static_cast<size_t>(state.range(0)));
+    std::vector<uint8_t> output;
+
+    for (auto _ : state) {
+        Compression::compressZlib(input, output);
+        benchmark::DoNotOptimize(output.data());
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_CompressZlib)->Arg(4 * 1024 * 1024);
+
+// Interning a string that is already in the table (the common case)
+void BM_StringIdInternExisting(benchmark::State& state) {
+    std::vector<std::string> names;
+    for (int i = 0; i < 1024; ++i) {
+        names.push_back("materials/terrain/layer_" + std::to_string(i));
+        StringId::intern(names.back());
+    }
+
+    size_t index = 0;
+    for (auto _ : state) {
+        StringId id = StringId::intern(names[index++ & 1023]);
+        benchmark::DoNotOptimize(id);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_StringIdInternExisting)->Threads(1)->Threads(4);
+
+void BM_MetricsCounterAdd(benchmark::State& state) {
+    static Counter& counter = MetricsRegistry::getInstance().counter("bench.counter");
+    for (auto _ : state) {
+        counter.add();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_MetricsCounterAdd)->Threads(1)->Threads(4);
+
+void BM_MetricsHistogramRecord(benchmark::State& state) {
+    static Histogram& histogram = MetricsRegistry::getInstance().histogram("bench.histogram_ms");
+    double value = 0.0;
+    for (auto _ : state) {
+        histogram.record(value);
+        value = value < 40.0 ? value + 0.37 : 0.0;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_MetricsHistogramRecord)->Threads(1)->Threads(4);
+
+} // namespace
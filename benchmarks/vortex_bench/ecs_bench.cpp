@@ -0,0 +1,144 @@
+// ECS hot paths: entity churn, component add/remove, signature queries and
+// dense iteration over a component pool
+
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <vector>
+
+#include "ecs/ecs_manager.h"
+
+using namespace VortexEngine;
+
+namespace {
+
+// Plain float components, the size of the engine's transform data
+struct Position {
+    float x, y, z;
+};
+
+struct Velocity {
+    float x, y, z;
+};
+
+struct Health {
+    float value;
+};
+
+// Every entity has a Position, half have a Velocity, a quarter a Health
+void populate(ECSManager& ecs, int64_t count, std::vector<Entity>& entities) {
+    entities.clear();
+    for (int64_t i = 0; i < count; ++i) {
+        Entity entity = ecs.createEntity();
+        float f = static_cast<float>(i);
+        ecs.addComponent<Position>(entity, Position{f, f, f});
+        if (i % 2 == 0) {
+            ecs.addComponent<Velocity>(entity, Velocity{1.0f, 0.5f, 0.25f});
+        }
+        if (i % 4 == 0) {
+            ecs.addComponent<Health>(entity, Health{100.0f});
+        }
+        entities.push_back(entity);
+    }
+}
+
+void BM_ECSCreateDestroy(benchmark::State& state) {
+    ECSManager ecs;
+    ecs.initialize();
+    std::vector<Entity> entities;
+    entities.reserve(static_cast<size_t>(state.range(0)));
+
+    for (auto _ : state) {
+        for (int64_t i = 0; i < state.range(0); ++i) {
+            entities.push_back(ecs.createEntity());
+        }
+        for (Entity entity : entities) {
+            ecs.destroyEntity(entity);
+        }
+        entities.clear();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ECSCreateDestroy)->Arg(1024)->Arg(16384);
+
+void BM_ECSAddRemoveComponent(benchmark::State& state) {
+    ECSManager ecs;
+    ecs.initialize();
+    std::vector<Entity> entities;
+    populate(ecs, state.range(0), entities);
+
+    for (auto _ : state) {
+        for (Entity entity : entities) {
+            ecs.addComponent<Health>(entity, Health{50.0f});
+        }
+        for (Entity entity : entities) {
+            ecs.removeComponent<Health>(entity);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ECSAddRemoveComponent)->Arg(1024)->Arg(16384);
+
+// Signature match over every live entity
+void BM_ECSQueryComponents(benchmark::State& state) {
+    ECSManager ecs;
+    ecs.initialize();
+    std::vector<Entity> entities;
+    populate(ecs, state.range(0), entities);
+
+    std::vector<ComponentType> types = {
+        ComponentRegistry::GetComponentType<Position>(),
+        ComponentRegistry::GetComponentType<Velocity>()
+    };
+
+    for (auto _ : state) {
+        std::vector<Entity> result = ecs.getEntitiesWithComponents(types);
+        benchmark::DoNotOptimize(result.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ECSQueryComponents)->Arg(1024)->Arg(65536);
+
+// Position += Velocity through per-entity getComponent lookups
+void BM_ECSIterateLookup(benchmark::State& state) {
+    ECSManager ecs;
+    ecs.initialize();
+    std::vector<Entity> entities;
+    populate(ecs, state.range(0), entities);
+
+    ComponentPool<Velocity>* velocities = ecs.getComponentPool<Velocity>();
+    for (auto _ : state) {
+        for (Entity entity : velocities->getEntities()) {
+            const Velocity& velocity = ecs.getComponent<Velocity>(entity);
+            Position& position = ecs.getComponent<Position>(entity);
+            position.x += velocity.x;
+            position.y += velocity.y;
+            position.z += velocity.z;
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(velocities->size()));
+}
+BENCHMARK(BM_ECSIterateLookup)->Arg(1024)->Arg(65536);
+
+// The same update walking the dense Position column directly
+void BM_ECSIterateDense(benchmark::State& state) {
+    ECSManager ecs;
+    ecs.initialize();
+    std::vector<Entity> entities;
+    populate(ecs, state.range(0), entities);
+
+    ComponentPool<Position>* positions = ecs.getComponentPool<Position>();
+    for (auto _ : state) {
+        for (Position& position : positions->getComponents()) {
+            position.x += 1.0f;
+            position.y += 0.5f;
+            position.z += 0.25f;
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.SetBytesProcessed(state.iterations() * state.range(0) * static_cast<int64_t>(sizeof(Position)));
+}
+BENCHMARK(BM_ECSIterateDense)->Arg(1024)->Arg(65536);
+
+} // namespace
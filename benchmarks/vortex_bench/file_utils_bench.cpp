@@ -0,0 +1,90 @@
+// FileUtils read throughput
+//
+// Files are written once to the temp directory and stay in the page cache,
+// so this measures the read path (allocation, copies, syscalls) rather than
+// the device. async_io_bench covers cold reads.
+
+#include <benchmark/benchmark.h>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "utils/file_utils.h"
+
+using namespace VortexEngine;
+
+namespace {
+
+const std::string& getTestFile(int64_t size) {
+    static std::map<int64_t, std::string> files;
+    auto it = files.find(size);
+    if (it != files.end()) {
+        return it->second;
+    }
+
+    std::string path = (std::filesystem::temp_directory_path() /
+                        ("vortex_bench_" + std::to_string(size) + ".bin")).string();
+    std::vector<char> data(static_cast<size_t>(size));
+    for (size_t i = 0; i < data.size(); ++i) {
+        data[i] = static_cast<char>(i * 31 + (i >> 8));
+    }
+    std::ofstream(path, std::ios::binary | std::ios::trunc).write(data.data(), static_cast<std::streamsize>(data.size()));
+
+    return files.emplace(size, std::move(path)).first->second;
+}
+
+void BM_FileReadBytes(benchmark::State& state) {
+    const std::string& path = getTestFile(state.range(0));
+    std::vector<uint8_t> data;
+
+    for (auto _ : state) {
+        if (FileUtils::readFile(path, data) != FileResult::Success) {
+            state.SkipWithError("readFile failed");
+            break;
+        }
+        benchmark::DoNotOptimize(data.data());
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_FileReadBytes)->Arg(4 * 1024)->Arg(1024 * 1024)->Arg(16 * 1024 * 1024);
+
+void BM_FileReadString(benchmark::State& state) {
+    const std::string& path = getTestFile(state.range(0));
+    std::string content;
+
+    for (auto _ : state) {
+        if (FileUtils::readFile(path, content) != FileResult::Success) {
+            state.SkipWithError("readFile failed");
+            break;
+        }
+        benchmark::DoNotOptimize(content.data());
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_FileReadString)->Arg(4 * 1024)->Arg(1024 * 1024);
+
+// Mapping plus one touch per page, for comparison with the copying reads
+void BM_FileMap(benchmark::State& state) {
+    const std::string& path = getTestFile(state.range(0));
+
+    for (auto _ : state) {
+        MappedFile file;
+        if (FileUtils::mapFile(path, file) != FileResult::Success) {
+            state.SkipWithError("mapFile failed");
+            break;
+        }
+        std::span<const uint8_t> bytes = file.getDataAs<uint8_t>();
+        uint64_t sum = 0;
+        for (size_t offset = 0; offset < bytes.size(); offset += 4096) {
+            sum += bytes[offset];
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_FileMap)->Arg(4 * 1024)->Arg(1024 * 1024)->Arg(16 * 1024 * 1024);
+
+} // namespace
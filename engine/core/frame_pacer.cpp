@@ -0,0 +1,99 @@
+#include "frame_pacer.h"
+#include <algorithm>
+#include <iostream>
+#include <thread>
+
+namespace VortexEngine {
+
+namespace {
+
+// Weight of the newest sample in the smoothed timings
+constexpr double STATS_SMOOTHING = 0.1;
+
+double elapsedMilliseconds(FramePacer::Clock::time_point start, FramePacer::Clock::time_point end) {
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+} // namespace
+
+void FramePacer::setTargetFrameRate(double framesPerSecond) {
+    if (framesPerSecond < 0.0) {
+        std::cerr << "Ignoring negative frame rate limit" << std::endl;
+        return;
+    }
+
+    Clock::duration period = framesPerSecond > 0.0
+        ? std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / framesPerSecond))
+        : Clock::duration::zero();
+    m_targetFrameRate.store(framesPerSecond, std::memory_order_relaxed);
+    m_requestedFramePeriod.store(period.count(), std::memory_order_relaxed);
+
+    std::lock_guard<std::mutex> lock(m_statsMutex);
+    m_stats.targetFrameTime = framesPerSecond > 0.0 ? 1000.0 / framesPerSecond : 0.0;
+}
+
+FramePacer::Clock::time_point FramePacer::waitForNextFrame() {
+    // A new limit restarts the schedule at this frame boundary
+    Clock::duration requestedPeriod(m_requestedFramePeriod.load(std::memory_order_relaxed));
+    if (requestedPeriod != m_framePeriod) {
+        m_framePeriod = requestedPeriod;
+        m_nextFrameTime = Clock::time_point();
+    }
+
+    auto now = Clock::now();
+    if (m_framePeriod == Clock::duration::zero()) {
+        return now;
+    }
+
+    // First frame, or more than a frame behind (hitch, breakpoint): restart
+    // the schedule from now instead of running several frames back to back
+    if (m_nextFrameTime == Clock::time_point() || now - m_nextFrameTime > m_framePeriod) {
+        m_nextFrameTime = now;
+    }
+
+    auto waitStart = now;
+    if (m_nextFrameTime - now > SPIN_MARGIN) {
+        std::this_thread::sleep_until(m_nextFrameTime - SPIN_MARGIN);
+    }
+    while ((now = Clock::now()) < m_nextFrameTime) {
+        std::this_thread::yield();
+    }
+    m_nextFrameTime += m_framePeriod;
+
+    std::lock_guard<std::mutex> lock(m_statsMutex);
+    accumulate(m_stats.limiterWaitTime, m_stats.framesLimited, elapsedMilliseconds(waitStart, now));
+    m_stats.framesLimited++;
+    return now;
+}
+
+void FramePacer::recordPresent(Clock::time_point inputSampleTime) {
+    if (inputSampleTime == Clock::time_point()) {
+        return;
+    }
+
+    double latency = elapsedMilliseconds(inputSampleTime, Clock::now());
+
+    std::lock_guard<std::mutex> lock(m_statsMutex);
+    accumulate(m_stats.inputToPresentTime, m_stats.framesPresented, latency);
+    m_stats.lastInputToPresentTime = latency;
+    m_stats.maxInputToPresentTime = std::max(m_stats.maxInputToPresentTime, latency);
+    m_stats.framesPresented++;
+}
+
+FramePacingStats FramePacer::getStats() const {
+    std::lock_guard<std::mutex> lock(m_statsMutex);
+    return m_stats;
+}
+
+void FramePacer::resetStats() {
+    std::lock_guard<std::mutex> lock(m_statsMutex);
+    double targetFrameTime = m_stats.targetFrameTime;
+    m_stats = FramePacingStats{};
+    m_stats.targetFrameTime = targetFrameTime;
+}
+
+void FramePacer::accumulate(double& average, uint64_t samples, double sample) {
+    average = samples == 0 ? sample : average + (sample - average) * STATS_SMOOTHING;
+}
+
+} // namespace VortexEngine
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+
+namespace VortexEngine {
+
+// Frame pacing and latency statistics (milliseconds, exponentially smoothed
+// unless noted)
+struct FramePacingStats {
+    double targetFrameTime = 0.0;           // 0 when the limiter is off
+    double limiterWaitTime = 0.0;
+    double inputToPresentTime = 0.0;
+    double lastInputToPresentTime = 0.0;    // Most recent frame, unsmoothed
+    double maxInputToPresentTime = 0.0;
+    uint64_t framesLimited = 0;
+    uint64_t framesPresented = 0;
+};
+
+// CPU frame limiter and input-to-present latency tracking
+//
+// waitForNextFrame() is called immediately before input is sampled, so the
+// time spent waiting for the next frame slot is spent before the input is
+// read rather than between reading it and presenting. Sleeping covers most
+// of the wait and the last SPIN_MARGIN is spun, since sleep granularity is
+// coarser than a frame budget needs.
+//
+// Latency is measured from the input sample that fed a frame to the return
+// of its present call. The sample time travels with the frame (see
+// RenderSnapshot::inputSampleTime), so this also works when the frame is
+// presented from the render thread.
+class FramePacer {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr Clock::duration SPIN_MARGIN = std::chrono::microseconds(1000);
+
+    FramePacer() = default;
+
+    FramePacer(const FramePacer&) = delete;
+    FramePacer& operator=(const FramePacer&) = delete;
+
+    // Limiter (0 disables it); any thread, applied at the next frame boundary
+    void setTargetFrameRate(double framesPerSecond);
+    double getTargetFrameRate() const { return m_targetFrameRate.load(std::memory_order_relaxed); }
+
+    // Main thread: blocks until the next frame slot, returns the input sample time
+    Clock::time_point waitForNextFrame();
+
+    // Any thread: records one presented frame
+    void recordPresent(Clock::time_point inputSampleTime);
+
+    // Information
+    FramePacingStats getStats() const;
+    void resetStats();
+
+private:
+    std::atomic<double> m_targetFrameRate{0.0};
+    std::atomic<Clock::rep> m_requestedFramePeriod{0};
+
+    // Main thread only
+    Clock::duration m_framePeriod = Clock::duration::zero();
+    Clock::time_point m_nextFrameTime;
+
+    mutable std::mutex m_statsMutex;
+    FramePacingStats m_stats;
+
+    // Internal methods
+    // samples counts the values already averaged; the first one seeds it,
+    // so a genuine 0.0 sample is not mistaken for "no data yet"
+    static void accumulate(double& average, uint64_t samples, double sample);
+};
+
+} // namespace VortexEngine
@@ -0,0 +1,194 @@
+#include "frame_pipeline.h"
+#include "../utils/profiler.h"
+#include <chrono>
+#include <iostream>
+
+namespace VortexEngine {
+
+namespace {
+
+// Weight of the newest sample in the smoothed timings
+constexpr double STATS_SMOOTHING = 0.1;
+
+double elapsedMilliseconds(std::chrono::steady_clock::time_point start,
+                           std::chrono::steady_clock::time_point end) {
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+} // namespace
+
+FramePipeline::~FramePipeline() {
+    shutdown();
+}
+
+bool FramePipeline::initialize(RenderCallback renderCallback) {
+    if (m_initialized) {
+        return true;
+    }
+
+    if (!renderCallback) {
+        std::cerr << "Frame pipeline requires a render callback" << std::endl;
+        return false;
+    }
+
+    m_renderCallback = std::move(renderCallback);
+    m_writeIndex = 0;
+    m_pendingIndex = NO_SNAPSHOT;
+    m_renderingIndex = NO_SNAPSHOT;
+    m_nextFrameIndex = 0;
+    m_stopRequested = false;
+    m_lastSubmitTime = std::chrono::steady_clock::now();
+    resetStats();
+
+    try {
+        m_renderThread = std::thread(&FramePipeline::renderThreadMain, this);
+    }
+    catch (const std::system_error& e) {
+        std::cerr << "Failed to start render thread: " << e.what() << std::endl;
+        return false;
+    }
+
+    m_initialized = true;
+    return true;
+}
+
+void FramePipeline::shutdown() {
+    if (!m_initialized) {
+        return;
+    }
+
+    // Let the last submitted frame finish before stopping
+    waitIdle();
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopRequested = true;
+    }
+    m_snapshotReady.notify_all();
+
+    if (m_renderThread.joinable()) {
+        m_renderThread.join();
+    }
+
+    for (auto& snapshot : m_snapshots) {
+        snapshot.clear();
+    }
+
+    m_renderCallback = nullptr;
+    m_initialized = false;
+}
+
+RenderSnapshot& FramePipeline::beginSnapshot() {
+    auto waitStart = std::chrono::steady_clock::now();
+
+    {
+        // The write buffer may still be in use by the render thread
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_snapshotConsumed.wait(lock, [this] {
+            return m_renderingIndex != m_writeIndex && m_pendingIndex != m_writeIndex;
+        });
+    }
+
+    double waited = elapsedMilliseconds(waitStart, std::chrono::steady_clock::now());
+    {
+        std::lock_guard<std::mutex> lock(m_statsMutex);
+        accumulate(m_stats.mainWaitTime, m_stats.framesSubmitted, waited);
+    }
+
+    RenderSnapshot& snapshot = m_snapshots[m_writeIndex];
+    snapshot.clear();
+    snapshot.frameIndex = m_nextFrameIndex;
+    return snapshot;
+}
+
+void FramePipeline::submitSnapshot() {
+    {
+        // Only one frame may be queued ahead of the one being rendered
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_snapshotConsumed.wait(lock, [this] { return m_pendingIndex == NO_SNAPSHOT; });
+
+        m_pendingIndex = m_writeIndex;
+        m_writeIndex = (m_writeIndex + 1) % SNAPSHOT_COUNT;
+        m_nextFrameIndex++;
+    }
+    m_snapshotReady.notify_one();
+
+    auto now = std::chrono::steady_clock::now();
+    std::lock_guard<std::mutex> lock(m_statsMutex);
+    accumulate(m_stats.frameTime, m_stats.framesSubmitted, elapsedMilliseconds(m_lastSubmitTime, now));
+    m_stats.framesSubmitted++;
+    m_lastSubmitTime = now;
+}
+
+void FramePipeline::waitIdle() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_snapshotConsumed.wait(lock, [this] {
+        return m_pendingIndex == NO_SNAPSHOT && m_renderingIndex == NO_SNAPSHOT;
+    });
+}
+
+void FramePipeline::recordSimulateTime(double milliseconds) {
+    std::lock_guard<std::mutex> lock(m_statsMutex);
+    accumulate(m_stats.simulateTime, m_stats.framesSubmitted, milliseconds);
+}
+
+void FramePipeline::recordExtractTime(double milliseconds) {
+    std::lock_guard<std::mutex> lock(m_statsMutex);
+    accumulate(m_stats.extractTime, m_stats.framesSubmitted, milliseconds);
+}
+
+FramePipelineStats FramePipeline::getStats() const {
+    std::lock_guard<std::mutex> lock(m_statsMutex);
+    return m_stats;
+}
+
+void FramePipeline::resetStats() {
+    std::lock_guard<std::mutex> lock(m_statsMutex);
+    m_stats = FramePipelineStats{};
+}
+
+void FramePipeline::renderThreadMain() {
+    VORTEX_PROFILE_THREAD("Render");
+
+    while (true) {
+        size_t index = NO_SNAPSHOT;
+        auto waitStart = std::chrono::steady_clock::now();
+
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_snapshotReady.wait(lock, [this] {
+                return m_stopRequested || m_pendingIndex != NO_SNAPSHOT;
+            });
+
+            if (m_pendingIndex == NO_SNAPSHOT) {
+                break;
+            }
+
+            index = m_pendingIndex;
+            m_renderingIndex = index;
+            m_pendingIndex = NO_SNAPSHOT;
+        }
+        m_snapshotConsumed.notify_all();
+
+        auto renderStart = std::chrono::steady_clock::now();
+        m_renderCallback(m_snapshots[index]);
+        auto renderEnd = std::chrono::steady_clock::now();
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_renderingIndex = NO_SNAPSHOT;
+        }
+        m_snapshotConsumed.notify_all();
+
+        std::lock_guard<std::mutex> lock(m_statsMutex);
+        accumulate(m_stats.renderWaitTime, m_stats.framesRendered, elapsedMilliseconds(waitStart, renderStart));
+        accumulate(m_stats.renderTime, m_stats.framesRendered, elapsedMilliseconds(renderStart, renderEnd));
+        m_stats.framesRendered++;
+    }
+}
+
+void FramePipeline::accumulate(double& average, uint64_t samples, double sample) {
+    average = samples == 0 ? sample : average + (sample - average) * STATS_SMOOTHING;
+}
+
+} // namespace VortexEngine
@@ -0,0 +1,118 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <glm/glm.hpp>
+
+#include "../ecs/ecs_manager.h"
+
+namespace VortexEngine {
+
+// Render data for a single object, extracted from the ECS
+struct RenderItem {
+    Entity entity = INVALID_ENTITY;
+    glm::mat4 transform = glm::mat4(1.0f);
+};
+
+// Everything the renderer needs to draw one frame
+//
+// Snapshots are plain data so the render thread never touches the ECS while
+// the main thread is simulating the next frame.
+struct RenderSnapshot {
+    uint64_t frameIndex = 0;
+    float interpolationAlpha = 0.0f;
+    std::chrono::steady_clock::time_point inputSampleTime;  // When the input for this frame was read
+    std::vector<RenderItem> items;
+
+    void clear() {
+        interpolationAlpha = 0.0f;
+        inputSampleTime = {};
+        items.clear();
+    }
+};
+
+// Per-stage frame timing (milliseconds, exponentially smoothed)
+struct FramePipelineStats {
+    double simulateTime = 0.0;
+    double extractTime = 0.0;
+    double renderTime = 0.0;
+    double mainWaitTime = 0.0;
+    double renderWaitTime = 0.0;
+    double frameTime = 0.0;
+    uint64_t framesSubmitted = 0;
+    uint64_t framesRendered = 0;
+};
+
+// Two-stage frame pipeline
+//
+// The main thread fills a snapshot for frame N+1 while the render thread
+// draws frame N from the other snapshot. beginSnapshot() only blocks when the
+// render thread is still reading the buffer the main thread wants to reuse,
+// so the main thread can run at most one frame ahead.
+class FramePipeline {
+public:
+    using RenderCallback = std::function<void(const RenderSnapshot&)>;
+
+    FramePipeline() = default;
+    ~FramePipeline();
+
+    FramePipeline(const FramePipeline&) = delete;
+    FramePipeline& operator=(const FramePipeline&) = delete;
+
+    // Lifecycle
+    bool initialize(RenderCallback renderCallback);
+    void shutdown();
+    bool isInitialized() const { return m_initialized; }
+
+    // Main thread interface
+    RenderSnapshot& beginSnapshot();
+    void submitSnapshot();
+    void waitIdle();
+
+    // Timing
+    void recordSimulateTime(double milliseconds);
+    void recordExtractTime(double milliseconds);
+    FramePipelineStats getStats() const;
+    void resetStats();
+
+private:
+    static constexpr size_t SNAPSHOT_COUNT = 2;
+    static constexpr size_t NO_SNAPSHOT = SNAPSHOT_COUNT;
+
+    bool m_initialized = false;
+    RenderCallback m_renderCallback;
+
+    // Snapshot buffers
+    std::array<RenderSnapshot, SNAPSHOT_COUNT> m_snapshots;
+    size_t m_writeIndex = 0;
+    size_t m_pendingIndex = NO_SNAPSHOT;
+    size_t m_renderingIndex = NO_SNAPSHOT;
+    uint64_t m_nextFrameIndex = 0;
+
+    // Render thread
+    std::thread m_renderThread;
+    std::atomic<bool> m_stopRequested{false};
+    mutable std::mutex m_mutex;
+    std::condition_variable m_snapshotReady;
+    std::condition_variable m_snapshotConsumed;
+
+    // Timing
+    mutable std::mutex m_statsMutex;
+    FramePipelineStats m_stats;
+    std::chrono::steady_clock::time_point m_lastSubmitTime;
+
+    // Internal methods
+    void renderThreadMain();
+    // samples counts the values already averaged; the first one seeds it,
+    // so a genuine 0.0 sample is not mistaken for "no data yet"
+    static void accumulate(double& average, uint64_t samples, double sample);
+};
+
+} // namespace VortexEngine
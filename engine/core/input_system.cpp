@@ -0,0 +1,205 @@
+#include "input_system.h"
+
+namespace VortexEngine {
+
+void InputSystem::pushKey(int32_t scancode, int32_t keycode, bool pressed, bool repeat, uint16_t modifiers, uint32_t timestamp) {
+    InputEvent event;
+    event.type = InputEventType::Key;
+    event.pressed = pressed;
+    event.repeat = repeat;
+    event.modifiers = modifiers;
+    event.code = keycode;
+    event.scancode = scancode;
+    event.timestamp = timestamp;
+    enqueue(event);
+}
+
+void InputSystem::pushMouseButton(int32_t button, bool pressed, float x, float y, uint32_t timestamp) {
+    InputEvent event;
+    event.type = InputEventType::MouseButton;
+    event.pressed = pressed;
+    event.code = button;
+    event.x = x;
+    event.y = y;
+    event.timestamp = timestamp;
+    enqueue(event);
+}
+
+void InputSystem::pushMouseMotion(float x, float y, float deltaX, float deltaY, uint32_t timestamp) {
+    if (m_hasPending && m_pending.type == InputEventType::MouseMotion) {
+        m_pending.x = x;
+        m_pending.y = y;
+        m_pending.deltaX += deltaX;
+        m_pending.deltaY += deltaY;
+        m_pending.timestamp = timestamp;
+        m_motionEventsCoalesced.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    // A pending wheel event happened before this motion
+    flushPending();
+    m_pending = InputEvent();
+    m_pending.type = InputEventType::MouseMotion;
+    m_pending.x = x;
+    m_pending.y = y;
+    m_pending.deltaX = deltaX;
+    m_pending.deltaY = deltaY;
+    m_pending.timestamp = timestamp;
+    m_hasPending = true;
+}
+
+void InputSystem::pushMouseWheel(float deltaX, float deltaY, uint32_t timestamp) {
+    if (m_hasPending && m_pending.type == InputEventType::MouseWheel) {
+        m_pending.deltaX += deltaX;
+        m_pending.deltaY += deltaY;
+        m_pending.timestamp = timestamp;
+        return;
+    }
+
+    // A pending motion event happened before this wheel event
+    flushPending();
+    m_pending = InputEvent();
+    m_pending.type = InputEventType::MouseWheel;
+    m_pending.deltaX = deltaX;
+    m_pending.deltaY = deltaY;
+    m_pending.timestamp = timestamp;
+    m_hasPending = true;
+}
+
+void InputSystem::pushResize(int32_t width, int32_t height, uint32_t timestamp) {
+    InputEvent event;
+    event.type = InputEventType::Resize;
+    event.code = width;
+    event.scancode = height;
+    event.timestamp = timestamp;
+    enqueue(event);
+}
+
+void InputSystem::flush() {
+    flushPending();
+}
+
+const InputSnapshot& InputSystem::beginFrame() {
+    // Transitions and deltas only cover the events since the last frame
+    m_snapshot.frameIndex = m_framesProcessed++;
+    m_snapshot.keysPressed.reset();
+    m_snapshot.keysReleased.reset();
+    m_snapshot.mouseButtonsPressed = 0;
+    m_snapshot.mouseButtonsReleased = 0;
+    m_snapshot.mouseDeltaX = 0.0f;
+    m_snapshot.mouseDeltaY = 0.0f;
+    m_snapshot.scrollX = 0.0f;
+    m_snapshot.scrollY = 0.0f;
+    m_snapshot.resized = false;
+
+    m_frameEventCount = m_queue.popBatch(m_frameEvents.data(), m_frameEvents.size());
+    for (size_t i = 0; i < m_frameEventCount; ++i) {
+        applyEvent(m_frameEvents[i]);
+    }
+    m_snapshot.eventCount = static_cast<uint32_t>(m_frameEventCount);
+
+    // Checked after draining: any event dropped before this point may have
+    // been a release we will never see
+    m_snapshot.overflowed = m_overflowed.exchange(false, std::memory_order_acquire);
+    if (m_snapshot.overflowed) {
+        releaseAll();
+    }
+    return m_snapshot;
+}
+
+InputStats InputSystem::getStats() const {
+    InputStats stats;
+    stats.eventsQueued = m_eventsQueued.load(std::memory_order_relaxed);
+    stats.eventsDropped = m_eventsDropped.load(std::memory_order_relaxed);
+    stats.motionEventsCoalesced = m_motionEventsCoalesced.load(std::memory_order_relaxed);
+    stats.framesProcessed = m_framesProcessed;
+    return stats;
+}
+
+void InputSystem::enqueue(const InputEvent& event) {
+    // A pending merged event happened before this event
+    flushPending();
+    pushEvent(event);
+}
+
+void InputSystem::flushPending() {
+    if (m_hasPending) {
+        m_hasPending = false;
+        pushEvent(m_pending);
+    }
+}
+
+void InputSystem::pushEvent(const InputEvent& event) {
+    if (m_queue.push(event)) {
+        m_eventsQueued.fetch_add(1, std::memory_order_relaxed);
+    } else {
+        m_eventsDropped.fetch_add(1, std::memory_order_relaxed);
+        m_overflowed.store(true, std::memory_order_release);
+    }
+}
+
+void InputSystem::applyEvent(const InputEvent& event) {
+    switch (event.type) {
+        case InputEventType::Key: {
+            m_snapshot.modifiers = event.modifiers;
+            if (event.scancode < 0 || static_cast<size_t>(event.scancode) >= InputSnapshot::KEY_COUNT) {
+                break;
+            }
+            auto key = static_cast<size_t>(event.scancode);
+            if (event.pressed) {
+                if (!m_snapshot.keysDown.test(key)) {
+                    m_snapshot.keysPressed.set(key);
+                }
+                m_snapshot.keysDown.set(key);
+            } else if (m_snapshot.keysDown.test(key)) {
+                m_snapshot.keysDown.reset(key);
+                m_snapshot.keysReleased.set(key);
+            }
+            break;
+        }
+
+        case InputEventType::MouseButton: {
+            m_snapshot.mouseX = event.x;
+            m_snapshot.mouseY = event.y;
+            if (event.code < 0 || event.code >= 32) {
+                break;
+            }
+            uint32_t bit = 1u << event.code;
+            if (event.pressed) {
+                m_snapshot.mouseButtonsPressed |= bit & ~m_snapshot.mouseButtonsDown;
+                m_snapshot.mouseButtonsDown |= bit;
+            } else {
+                m_snapshot.mouseButtonsReleased |= bit & m_snapshot.mouseButtonsDown;
+                m_snapshot.mouseButtonsDown &= ~bit;
+            }
+            break;
+        }
+
+        case InputEventType::MouseMotion:
+            m_snapshot.mouseX = event.x;
+            m_snapshot.mouseY = event.y;
+            m_snapshot.mouseDeltaX += event.deltaX;
+            m_snapshot.mouseDeltaY += event.deltaY;
+            break;
+
+        case InputEventType::MouseWheel:
+            m_snapshot.scrollX += event.deltaX;
+            m_snapshot.scrollY += event.deltaY;
+            break;
+
+        case InputEventType::Resize:
+            m_snapshot.resized = true;
+            m_snapshot.width = event.code;
+            m_snapshot.height = event.scancode;
+            break;
+    }
+}
+
+void InputSystem::releaseAll() {
+    m_snapshot.keysReleased |= m_snapshot.keysDown;
+    m_snapshot.keysDown.reset();
+    m_snapshot.mouseButtonsReleased |= m_snapshot.mouseButtonsDown;
+    m_snapshot.mouseButtonsDown = 0;
+}
+
+} // namespace VortexEngine
@@ -0,0 +1,148 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#include "../utils/spsc_ring.h"
+
+namespace VortexEngine {
+
+enum class InputEventType : uint8_t {
+    Key,
+    MouseButton,
+    MouseMotion,  // Coalesced: last position, summed deltas
+    MouseWheel,   // Coalesced: summed deltas
+    Resize
+};
+
+// One queued input event; fields not used by a type are zero
+struct InputEvent {
+    InputEventType type = InputEventType::Key;
+    bool pressed = false;
+    bool repeat = false;
+    uint16_t modifiers = 0;
+    int32_t code = 0;       // Key: keycode, MouseButton: button index, Resize: width
+    int32_t scancode = 0;   // Key: scancode, Resize: height
+    float x = 0.0f;         // Cursor position (MouseButton, MouseMotion)
+    float y = 0.0f;
+    float deltaX = 0.0f;    // Relative motion or wheel delta
+    float deltaY = 0.0f;
+    uint32_t timestamp = 0; // Milliseconds, as reported by the window system
+};
+
+// Input state for one frame
+//
+// Plain data: keys are indexed by scancode and mouse buttons by bit, so
+// reading it is a bit test. Pressed/released cover every transition since
+// the previous frame, so a tap shorter than a frame still shows up as both.
+struct InputSnapshot {
+    static constexpr size_t KEY_COUNT = 512;
+
+    uint64_t frameIndex = 0;
+
+    std::bitset<KEY_COUNT> keysDown;
+    std::bitset<KEY_COUNT> keysPressed;
+    std::bitset<KEY_COUNT> keysReleased;
+    uint16_t modifiers = 0;
+
+    uint32_t mouseButtonsDown = 0;      // Bit (1 << button)
+    uint32_t mouseButtonsPressed = 0;
+    uint32_t mouseButtonsReleased = 0;
+    float mouseX = 0.0f;
+    float mouseY = 0.0f;
+    float mouseDeltaX = 0.0f;           // Summed over the frame
+    float mouseDeltaY = 0.0f;
+    float scrollX = 0.0f;
+    float scrollY = 0.0f;
+
+    bool resized = false;
+    int32_t width = 0;
+    int32_t height = 0;
+
+    uint32_t eventCount = 0;            // Events consumed this frame
+    bool overflowed = false;            // Events were dropped; held keys and buttons were released
+
+    bool isKeyDown(uint32_t scancode) const { return scancode < KEY_COUNT && keysDown.test(scancode); }
+    bool wasKeyPressed(uint32_t scancode) const { return scancode < KEY_COUNT && keysPressed.test(scancode); }
+    bool wasKeyReleased(uint32_t scancode) const { return scancode < KEY_COUNT && keysReleased.test(scancode); }
+    bool isMouseButtonDown(uint32_t button) const { return button < 32 && (mouseButtonsDown >> button) & 1u; }
+    bool wasMouseButtonPressed(uint32_t button) const { return button < 32 && (mouseButtonsPressed >> button) & 1u; }
+    bool wasMouseButtonReleased(uint32_t button) const { return button < 32 && (mouseButtonsReleased >> button) & 1u; }
+};
+
+// Input statistics
+struct InputStats {
+    uint64_t eventsQueued = 0;
+    uint64_t eventsDropped = 0;
+    uint64_t motionEventsCoalesced = 0;
+    uint64_t framesProcessed = 0;
+};
+
+// Buffered input between the window's event pump and the frame
+//
+// The producer (the thread calling Window::pollEvents) pushes translated
+// events into a fixed-capacity SPSC ring. Consecutive mouse motion events,
+// and consecutive wheel events, are merged into one pending event that is
+// flushed before any event of another type, so the queue keeps arrival
+// order; a burst of high-rate motion costs one queue slot per pump. The consumer calls beginFrame() once per frame, which
+// drains the ring and updates the snapshot, so per-frame work is bounded by
+// the ring capacity regardless of the event rate.
+//
+// If the ring fills up, further events are dropped and the next snapshot is
+// marked overflowed with every held key and button released, so nothing is
+// stuck down.
+class InputSystem {
+public:
+    static constexpr size_t QUEUE_CAPACITY = 1024;
+
+    InputSystem() = default;
+
+    InputSystem(const InputSystem&) = delete;
+    InputSystem& operator=(const InputSystem&) = delete;
+
+    // Producer interface
+    void pushKey(int32_t scancode, int32_t keycode, bool pressed, bool repeat, uint16_t modifiers, uint32_t timestamp);
+    void pushMouseButton(int32_t button, bool pressed, float x, float y, uint32_t timestamp);
+    void pushMouseMotion(float x, float y, float deltaX, float deltaY, uint32_t timestamp);
+    void pushMouseWheel(float deltaX, float deltaY, uint32_t timestamp);
+    void pushResize(int32_t width, int32_t height, uint32_t timestamp);
+    void flush();  // Queues pending merged motion/wheel; call after each pump
+
+    // Consumer interface
+    const InputSnapshot& beginFrame();
+    const InputSnapshot& getSnapshot() const { return m_snapshot; }
+    std::span<const InputEvent> getFrameEvents() const { return {m_frameEvents.data(), m_frameEventCount}; }
+
+    // Information
+    InputStats getStats() const;
+
+private:
+    SpscRing<InputEvent, QUEUE_CAPACITY> m_queue;
+
+    // Producer state
+    InputEvent m_pending;           // Motion or wheel event being merged
+    bool m_hasPending = false;
+    std::atomic<uint64_t> m_eventsQueued{0};
+    std::atomic<uint64_t> m_eventsDropped{0};
+    std::atomic<uint64_t> m_motionEventsCoalesced{0};
+    std::atomic<bool> m_overflowed{false};
+
+    // Consumer state
+    InputSnapshot m_snapshot;
+    std::array<InputEvent, QUEUE_CAPACITY> m_frameEvents{};
+    size_t m_frameEventCount = 0;
+    uint64_t m_framesProcessed = 0;
+
+    // Internal methods
+    void enqueue(const InputEvent& event);
+    void flushPending();
+    void pushEvent(const InputEvent& event);
+    void applyEvent(const InputEvent& event);
+    void releaseAll();
+};
+
+} // namespace VortexEngine
@@ -0,0 +1,352 @@
+#include "job_system.h"
+#include "../utils/profiler.h"
+#include <algorithm>
+#include <iostream>
+#include <string>
+
+namespace VortexEngine {
+
+namespace {
+
+// Spins before an idle worker goes to sleep
+constexpr int IDLE_SPIN_COUNT = 64;
+
+// Worker identity of the current thread
+thread_local const JobSystem* t_jobSystem = nullptr;
+thread_local uint32_t t_workerIndex = JobSystem::INVALID_WORKER;
+thread_local uint32_t t_stealSeed = 0;
+
+uint32_t nextRandom(uint32_t& state) {
+    if (state == 0) {
+        state = static_cast<uint32_t>(std::hash<std::thread::id>{}(std::this_thread::get_id())) | 1u;
+    }
+
+    // xorshift32
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return state;
+}
+
+} // namespace
+
+JobSystem::~JobSystem() {
+    shutdown();
+}
+
+bool JobSystem::initialize(uint32_t workerCount) {
+    if (m_initialized) {
+        return true;
+    }
+
+    if (workerCount == 0) {
+        workerCount = std::max(std::thread::hardware_concurrency(), 1u);
+    }
+
+    m_stopRequested = false;
+    m_workers.clear();
+    for (uint32_t i = 0; i < workerCount; ++i) {
+        m_workers.push_back(std::make_unique<Worker>());
+    }
+
+    // The initializing thread is worker zero and runs jobs while it waits
+    t_jobSystem = this;
+    t_workerIndex = 0;
+
+    try {
+        for (uint32_t i = 1; i < workerCount; ++i) {
+            m_workers[i]->thread = std::thread(&JobSystem::workerMain, this, i);
+        }
+    }
+    catch (const std::system_error& e) {
+        std::cerr << "Failed to start job worker thread: " << e.what() << std::endl;
+        m_initialized = true;
+        shutdown();
+        return false;
+    }
+
+    m_initialized = true;
+    std::cout << "Job system initialized with " << workerCount << " workers" << std::endl;
+    return true;
+}
+
+void JobSystem::shutdown() {
+    if (!m_initialized) {
+        return;
+    }
+
+    // Drain outstanding work with the workers still helping
+    while (Job* job = findJob(getCurrentWorkerIndex())) {
+        execute(job);
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_sleepMutex);
+        m_stopRequested = true;
+    }
+    m_workAvailable.notify_all();
+
+    for (auto& worker : m_workers) {
+        if (worker->thread.joinable()) {
+            worker->thread.join();
+        }
+    }
+
+    // Jobs spawned after the first drain may still sit in the deques of
+    // workers that have now exited; steal and run them here so every
+    // counter reaches zero and no Job leaks
+    while (Job* job = findJob(getCurrentWorkerIndex())) {
+        execute(job);
+    }
+    m_workers.clear();
+
+    if (t_jobSystem == this) {
+        t_jobSystem = nullptr;
+        t_workerIndex = INVALID_WORKER;
+    }
+
+    m_initialized = false;
+}
+
+void JobSystem::run(JobFunction job, JobCounter* counter) {
+    if (!job) {
+        return;
+    }
+
+    if (counter) {
+        counter->m_value.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    if (!m_initialized) {
+        // No workers - behave like a plain function call
+        job();
+        completeJob(counter);
+        return;
+    }
+
+    submit(new Job{std::move(job), counter});
+}
+
+void JobSystem::run(JobFunction job, JobCounter* counter, JobCounter* dependency) {
+    if (!job) {
+        return;
+    }
+
+    if (dependency && !dependency->isDone()) {
+        // Park the job on its dependency; the decrement that reaches zero
+        // queues it. Checked again under the lock so that decrement cannot
+        // slip between the check and the park
+        std::lock_guard<std::mutex> lock(dependency->m_continuationMutex);
+        if (dependency->getValue() != 0) {
+            if (counter) {
+                counter->m_value.fetch_add(1, std::memory_order_relaxed);
+            }
+            dependency->m_continuations.push_back({std::move(job), counter});
+            return;
+        }
+    }
+
+    run(std::move(job), counter);
+}
+
+void JobSystem::parallelFor(uint32_t count, uint32_t batchSize, JobRangeFunction function, JobCounter* counter) {
+    if (count == 0 || !function) {
+        return;
+    }
+
+    if (batchSize == 0) {
+        // Roughly four batches per worker keeps stealing effective
+        uint32_t workers = std::max(getWorkerCount(), 1u);
+        batchSize = std::max(1u, count / (workers * 4));
+    }
+
+    auto shared = std::make_shared<JobRangeFunction>(std::move(function));
+    for (uint32_t begin = 0; begin < count; begin += batchSize) {
+        uint32_t end = std::min(begin + batchSize, count);
+        run([shared, begin, end]() { (*shared)(begin, end); }, counter);
+    }
+}
+
+void JobSystem::wait(JobCounter* counter) {
+    if (!counter) {
+        return;
+    }
+
+    uint32_t workerIndex = getCurrentWorkerIndex();
+    int spins = 0;
+    while (!counter->isDone()) {
+        if (Job* job = findJob(workerIndex)) {
+            execute(job);
+            spins = 0;
+        } else if (++spins > IDLE_SPIN_COUNT) {
+            std::this_thread::yield();
+        }
+    }
+}
+
+uint32_t JobSystem::getCurrentWorkerIndex() const {
+    return t_jobSystem == this ? t_workerIndex : INVALID_WORKER;
+}
+
+JobSystemStats JobSystem::getStats() const {
+    JobSystemStats stats;
+    stats.jobsExecuted = m_jobsExecuted.load(std::memory_order_relaxed);
+    stats.jobsStolen = m_jobsStolen.load(std::memory_order_relaxed);
+    stats.jobsRunInline = m_jobsRunInline.load(std::memory_order_relaxed);
+    return stats;
+}
+
+void JobSystem::workerMain(uint32_t workerIndex) {
+    t_jobSystem = this;
+    t_workerIndex = workerIndex;
+    VORTEX_PROFILE_THREAD("Job Worker " + std::to_string(workerIndex));
+
+    int spins = 0;
+    while (!m_stopRequested.load(std::memory_order_relaxed)) {
+        if (Job* job = findJob(workerIndex)) {
+            execute(job);
+            spins = 0;
+            continue;
+        }
+
+        if (++spins < IDLE_SPIN_COUNT) {
+            std::this_thread::yield();
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(m_sleepMutex);
+        m_sleepingWorkers.fetch_add(1);
+        m_workAvailable.wait(lock, [this] {
+            return m_stopRequested.load() || m_queuedJobs.load() > 0;
+        });
+        m_sleepingWorkers.fetch_sub(1);
+        spins = 0;
+    }
+
+    t_jobSystem = nullptr;
+    t_workerIndex = INVALID_WORKER;
+}
+
+void JobSystem::submit(Job* job) {
+    uint32_t workerIndex = getCurrentWorkerIndex();
+
+    if (workerIndex != INVALID_WORKER) {
+        m_queuedJobs.fetch_add(1);
+        if (!m_workers[workerIndex]->deque.push(job)) {
+            // Deque full - run it now rather than grow
+            m_queuedJobs.fetch_sub(1);
+            m_jobsRunInline.fetch_add(1, std::memory_order_relaxed);
+            execute(job);
+            return;
+        }
+    } else {
+        std::lock_guard<std::mutex> lock(m_injectionMutex);
+        m_injectionQueue.push_back(job);
+        m_injectedJobs.fetch_add(1);
+        m_queuedJobs.fetch_add(1);
+    }
+
+    wakeWorkers();
+}
+
+JobSystem::Job* JobSystem::findJob(uint32_t workerIndex) {
+    Job* job = nullptr;
+
+    if (workerIndex != INVALID_WORKER && workerIndex < m_workers.size()) {
+        job = m_workers[workerIndex]->deque.pop();
+    }
+
+    if (!job && m_injectedJobs.load() > 0) {
+        std::lock_guard<std::mutex> lock(m_injectionMutex);
+        if (!m_injectionQueue.empty()) {
+            job = m_injectionQueue.front();
+            m_injectionQueue.pop_front();
+            m_injectedJobs.fetch_sub(1);
+        }
+    }
+
+    if (!job) {
+        job = stealJob(workerIndex);
+    }
+
+    if (job) {
+        m_queuedJobs.fetch_sub(1);
+    }
+
+    return job;
+}
+
+JobSystem::Job* JobSystem::stealJob(uint32_t workerIndex) {
+    size_t workerCount = m_workers.size();
+    if (workerCount == 0) {
+        return nullptr;
+    }
+
+    size_t start = nextRandom(t_stealSeed) % workerCount;
+
+    for (size_t i = 0; i < workerCount; ++i) {
+        size_t victim = (start + i) % workerCount;
+        if (victim == workerIndex) {
+            continue;
+        }
+
+        if (Job* job = m_workers[victim]->deque.steal()) {
+            m_jobsStolen.fetch_add(1, std::memory_order_relaxed);
+            return job;
+        }
+    }
+
+    return nullptr;
+}
+
+void JobSystem::execute(Job* job) {
+    {
+        VORTEX_PROFILE_SCOPE("Job");
+        job->function();
+    }
+
+    JobCounter* counter = job->counter;
+    delete job;
+    m_jobsExecuted.fetch_add(1, std::memory_order_relaxed);
+    completeJob(counter);
+}
+
+void JobSystem::completeJob(JobCounter* counter) {
+    if (!counter) {
+        return;
+    }
+
+    // Keeps the counter from reading as done until its continuations are
+    // out; the last access to the counter is the release below
+    counter->m_completing.fetch_add(1, std::memory_order_relaxed);
+    std::vector<JobCounter::Continuation> continuations;
+    if (counter->m_value.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        std::lock_guard<std::mutex> lock(counter->m_continuationMutex);
+        continuations.swap(counter->m_continuations);
+    }
+    counter->m_completing.fetch_sub(1, std::memory_order_release);
+
+    // Their counters were incremented when they were parked
+    for (auto& continuation : continuations) {
+        if (!m_initialized) {
+            continuation.function();
+            completeJob(continuation.counter);
+        } else {
+            submit(new Job{std::move(continuation.function), continuation.counter});
+        }
+    }
+}
+
+void JobSystem::wakeWorkers() {
+    if (m_sleepingWorkers.load() == 0) {
+        return;
+    }
+
+    // Taking the lock orders this wakeup after a sleeper's predicate check
+    {
+        std::lock_guard<std::mutex> lock(m_sleepMutex);
+    }
+    m_workAvailable.notify_one();
+}
+
+} // namespace VortexEngine
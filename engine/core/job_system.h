@@ -0,0 +1,234 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace VortexEngine {
+
+// Work-stealing deque (Chase-Lev)
+//
+// The owning worker pushes and pops at the bottom without locks; any other
+// thread may steal from the top. Capacity is fixed and must be a power of two;
+// push() returns false when the deque is full so the caller can run the job
+// inline instead.
+template<typename T>
+class WorkStealingDeque {
+    static_assert(std::is_pointer_v<T>, "WorkStealingDeque stores pointers");
+
+public:
+    explicit WorkStealingDeque(size_t capacity = 4096)
+        : m_capacity(capacity)
+        , m_mask(capacity - 1)
+        , m_buffer(std::make_unique<std::atomic<T>[]>(capacity)) {
+    }
+
+    WorkStealingDeque(const WorkStealingDeque&) = delete;
+    WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+    // Owner thread only
+    bool push(T item) {
+        int64_t bottom = m_bottom.load(std::memory_order_relaxed);
+        int64_t top = m_top.load(std::memory_order_acquire);
+        if (bottom - top >= static_cast<int64_t>(m_capacity)) {
+            return false;
+        }
+
+        m_buffer[bottom & m_mask].store(item, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        m_bottom.store(bottom + 1, std::memory_order_relaxed);
+        return true;
+    }
+
+    // Owner thread only
+    T pop() {
+        int64_t bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+        m_bottom.store(bottom, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t top = m_top.load(std::memory_order_relaxed);
+
+        if (top > bottom) {
+            // Empty
+            m_bottom.store(bottom + 1, std::memory_order_relaxed);
+            return nullptr;
+        }
+
+        T item = m_buffer[bottom & m_mask].load(std::memory_order_relaxed);
+        if (top == bottom) {
+            // Last item - race against thieves for it
+            if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+                item = nullptr;
+            }
+            m_bottom.store(bottom + 1, std::memory_order_relaxed);
+        }
+
+        return item;
+    }
+
+    // Any thread
+    T steal() {
+        int64_t top = m_top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t bottom = m_bottom.load(std::memory_order_acquire);
+
+        if (top >= bottom) {
+            return nullptr;
+        }
+
+        T item = m_buffer[top & m_mask].load(std::memory_order_relaxed);
+        if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+            return nullptr;
+        }
+
+        return item;
+    }
+
+    size_t size() const {
+        int64_t bottom = m_bottom.load(std::memory_order_relaxed);
+        int64_t top = m_top.load(std::memory_order_relaxed);
+        return bottom > top ? static_cast<size_t>(bottom - top) : 0;
+    }
+
+private:
+    alignas(64) std::atomic<int64_t> m_top{0};
+    alignas(64) std::atomic<int64_t> m_bottom{0};
+    size_t m_capacity;
+    size_t m_mask;
+    std::unique_ptr<std::atomic<T>[]> m_buffer;
+};
+
+using JobFunction = std::function<void()>;
+
+// Job completion counter
+//
+// Incremented when a job is scheduled against it and decremented when that
+// job finishes. A counter reaching zero means all of its jobs are done, and
+// the decrement that gets it there queues the jobs that depend on it. A
+// counter must outlive the continuations parked on it.
+class JobCounter {
+public:
+    JobCounter() = default;
+
+    JobCounter(const JobCounter&) = delete;
+    JobCounter& operator=(const JobCounter&) = delete;
+
+    uint32_t getValue() const { return m_value.load(std::memory_order_acquire); }
+
+    // Also false while the final decrement is still queueing continuations,
+    // so a counter may be destroyed once this returns true
+    bool isDone() const {
+        return getValue() == 0 && m_completing.load(std::memory_order_acquire) == 0;
+    }
+
+private:
+    friend class JobSystem;
+
+    struct Continuation {
+        JobFunction function;
+        JobCounter* counter = nullptr;
+    };
+
+    std::atomic<uint32_t> m_value{0};
+    std::atomic<uint32_t> m_completing{0};
+
+    // Jobs waiting for this counter to reach zero
+    std::mutex m_continuationMutex;
+    std::vector<Continuation> m_continuations;
+};
+
+using JobRangeFunction = std::function<void(uint32_t begin, uint32_t end)>;
+
+// Job system statistics
+struct JobSystemStats {
+    uint64_t jobsExecuted = 0;
+    uint64_t jobsStolen = 0;
+    uint64_t jobsRunInline = 0;
+};
+
+// Engine job system
+//
+// One worker thread per core (the thread calling initialize() acts as worker
+// zero), each with its own work-stealing deque. Jobs spawned from a worker go
+// to that worker's deque; jobs spawned from other threads go to a shared
+// injection queue. wait() never blocks: the waiting thread keeps executing
+// other jobs until the counter reaches zero, so jobs may wait on jobs.
+// Dependent jobs never wait: they stay parked on their dependency until it
+// completes, so chains of any length cannot deadlock the workers.
+class JobSystem {
+public:
+    static constexpr uint32_t INVALID_WORKER = 0xFFFFFFFF;
+
+    JobSystem() = default;
+    ~JobSystem();
+
+    JobSystem(const JobSystem&) = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+
+    // Lifecycle
+    bool initialize(uint32_t workerCount = 0);
+    void shutdown();
+    bool isInitialized() const { return m_initialized; }
+
+    // Job submission
+    void run(JobFunction job, JobCounter* counter = nullptr);
+    void run(JobFunction job, JobCounter* counter, JobCounter* dependency);
+    void parallelFor(uint32_t count, uint32_t batchSize, JobRangeFunction function, JobCounter* counter);
+
+    // Synchronization
+    void wait(JobCounter* counter);
+
+    // Information
+    uint32_t getWorkerCount() const { return static_cast<uint32_t>(m_workers.size()); }
+    uint32_t getCurrentWorkerIndex() const;
+    JobSystemStats getStats() const;
+
+private:
+    struct Job {
+        JobFunction function;
+        JobCounter* counter = nullptr;
+    };
+
+    struct Worker {
+        WorkStealingDeque<Job*> deque;
+        std::thread thread;
+    };
+
+    bool m_initialized = false;
+    std::vector<std::unique_ptr<Worker>> m_workers;
+    std::atomic<bool> m_stopRequested{false};
+
+    // Jobs submitted from threads that are not workers
+    std::mutex m_injectionMutex;
+    std::deque<Job*> m_injectionQueue;
+    std::atomic<size_t> m_injectedJobs{0};
+
+    // Idle workers sleep until work is queued
+    std::mutex m_sleepMutex;
+    std::condition_variable m_workAvailable;
+    std::atomic<uint32_t> m_sleepingWorkers{0};
+    std::atomic<int64_t> m_queuedJobs{0};
+
+    // Statistics
+    std::atomic<uint64_t> m_jobsExecuted{0};
+    std::atomic<uint64_t> m_jobsStolen{0};
+    std::atomic<uint64_t> m_jobsRunInline{0};
+
+    // Internal methods
+    void workerMain(uint32_t workerIndex);
+    void submit(Job* job);
+    Job* findJob(uint32_t workerIndex);
+    Job* stealJob(uint32_t workerIndex);
+    void execute(Job* job);
+    void completeJob(JobCounter* counter);
+    void wakeWorkers();
+};
+
+} // namespace VortexEngine
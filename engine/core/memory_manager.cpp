@@ -1,4 +1,5 @@
 #include "memory_manager.h"
+#include "../utils/metrics.h"
 #include <iostream>
 #include <algorithm>
 
@@ -109,6 +110,7 @@ VkDeviceMemory MemoryManager::allocateBufferMemory(VkBuffer buffer, VkMemoryProp
     m_memorySizes[memory] = memRequirements.size;
     m_totalAllocatedMemory += memRequirements.size;
     m_memoryAllocationCount++;
+    trackAllocationMetrics(static_cast<int64_t>(memRequirements.size), 1);
 
     std::cout << "Allocated buffer memory: " << memRequirements.size << " bytes" << std::endl;
     return memory;
@@ -141,6 +143,7 @@ VkDeviceMemory MemoryManager::allocateImageMemory(VkImage image, VkMemoryPropert
     m_memorySizes[memory] = memRequirements.size;
     m_totalAllocatedMemory += memRequirements.size;
     m_memoryAllocationCount++;
+    trackAllocationMetrics(static_cast<int64_t>(memRequirements.size), 1);
 
     std::cout << "Allocated image memory: " << memRequirements.size << " bytes" << std::endl;
     return memory;
@@ -155,6 +158,7 @@ void MemoryManager::deallocateMemory(VkDeviceMemory memory) {
     auto it = m_memorySizes.find(memory);
     if (it != m_memorySizes.end()) {
         m_totalAllocatedMemory -= it->second;
+        trackAllocationMetrics(-static_cast<int64_t>(it->second), -1);
         m_memorySizes.erase(it);
     }
 
@@ -492,7 +496,13 @@ void MemoryManager::endSingleTimeCommands(VkCommandBuffer commandBuffer) {
     fenceInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
     vkCreateFence(m_device, &fenceInfo, nullptr, &fence);
 
-    VkResult result = vkQueueSubmit(m_graphicsQueue, 1, &submitInfo, fence);
+    VkResult result;
+    if (m_queueMutex) {
+        std::lock_guard<std::mutex> lock(*m_queueMutex);
+        result = vkQueueSubmit(m_graphicsQueue, 1, &submitInfo, fence);
+    } else {
+        result = vkQueueSubmit(m_graphicsQueue, 1, &submitInfo, fence);
+    }
     if (result != VK_SUCCESS) {
         std::cerr << "Failed to submit command buffer: " << result << std::endl;
     }
@@ -508,6 +518,14 @@ void MemoryManager::endSingleTimeCommands(VkCommandBuffer commandBuffer) {
     }
 }
 
+void MemoryManager::trackAllocationMetrics(int64_t bytes, int64_t allocations) {
+    // Shared by every MemoryManager instance, hence deltas rather than totals
+    static Gauge& bytesAllocated = MetricsRegistry::getInstance().gauge(MetricNames::MemoryBytesAllocated);
+    static Gauge& allocationCount = MetricsRegistry::getInstance().gauge(MetricNames::MemoryAllocations);
+    bytesAllocated.add(bytes);
+    allocationCount.add(allocations);
+}
+
 void MemoryManager::cleanupStagingBuffer() {
     if (m_stagingBuffer != VK_NULL_HANDLE) {
         vkDestroyBuffer(m_device, m_stagingBuffer, nullptr);
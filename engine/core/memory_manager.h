@@ -1,6 +1,6 @@
 #pragma once
 
-#include <vulkan/vulkan.h>
+#include "vulkan_dispatch.h"
 #include <memory>
 #include <vector>
 #include <unordered_map>
@@ -24,8 +24,12 @@ public:
     MemoryManager();
     ~MemoryManager();
     
-    // Graphics queue setter
-    void setGraphicsQueue(VkQueue queue) { m_graphicsQueue = queue; }
+    // Graphics queue setter; queueMutex is taken around submissions when
+    // the queue is shared with other threads
+    void setGraphicsQueue(VkQueue queue, std::mutex* queueMutex = nullptr) {
+        m_graphicsQueue = queue;
+        m_queueMutex = queueMutex;
+    }
 
     // Memory manager lifecycle
     bool initialize(VkDevice device, VkPhysicalDevice physicalDevice);
@@ -108,10 +112,12 @@ private:
     
     // Graphics queue for command submission
     VkQueue m_graphicsQueue = VK_NULL_HANDLE;
+    std::mutex* m_queueMutex = nullptr;
 
     // Internal methods
     uint32_t findMemoryType(uint32_t typeFilter, VkMemoryPropertyFlags properties, uint32_t* memoryTypeIndex);
     void cleanupStagingBuffer();
+    void trackAllocationMetrics(int64_t bytes, int64_t allocations);
     void cleanupBuffers();
     void cleanupImages();
     void cleanupImageViews();
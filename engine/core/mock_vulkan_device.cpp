@@ -0,0 +1,2326 @@
+#include "mock_vulkan_device.h"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <functional>
+#include <iostream>
+#include <mutex>
+#include <unordered_set>
+
+// Non-dispatchable handles are pointers to the mock's own objects, which
+// needs the 64-bit handle representation
+static_assert(sizeof(void*) == 8, "MockVulkanDevice requires 64-bit Vulkan handles");
+
+namespace VortexEngine {
+
+namespace {
+
+constexpr VkDeviceSize KiB = 1024;
+constexpr VkDeviceSize MiB = 1024 * KiB;
+constexpr VkDeviceSize GiB = 1024 * MiB;
+
+// Ticks added per timestamp write; with timestampPeriod 1.0 this reads as 1 us
+constexpr uint64_t TIMESTAMP_STEP = 1000;
+
+// Objects
+
+enum class MockObjectType {
+    Device,
+    Memory,
+    Buffer,
+    Image,
+    ImageView,
+    ShaderModule,
+    PipelineLayout,
+    PipelineCache,
+    Pipeline,
+    CommandPool,
+    CommandBuffer,
+    Fence,
+    Semaphore,
+    QueryPool,
+    Swapchain
+};
+
+const char* getObjectTypeName(MockObjectType type) {
+    switch (type) {
+        case MockObjectType::Device: return "VkDevice";
+        case MockObjectType::Memory: return "VkDeviceMemory";
+        case MockObjectType::Buffer: return "VkBuffer";
+        case MockObjectType::Image: return "VkImage";
+        case MockObjectType::ImageView: return "VkImageView";
+        case MockObjectType::ShaderModule: return "VkShaderModule";
+        case MockObjectType::PipelineLayout: return "VkPipelineLayout";
+        case MockObjectType::PipelineCache: return "VkPipelineCache";
+        case MockObjectType::Pipeline: return "VkPipeline";
+        case MockObjectType::CommandPool: return "VkCommandPool";
+        case MockObjectType::CommandBuffer: return "VkCommandBuffer";
+        case MockObjectType::Fence: return "VkFence";
+        case MockObjectType::Semaphore: return "VkSemaphore";
+        case MockObjectType::QueryPool: return "VkQueryPool";
+        case MockObjectType::Swapchain: return "VkSwapchainKHR";
+    }
+    return "handle";
+}
+
+// Dispatchable handles carry a pointer to the driver's table, as with a real
+// ICD; the loader-style trampolines below read it on every call
+enum DeviceFunctionSlot {
+#define VORTEX_MOCK_SLOT(name) SLOT_##name,
+    VORTEX_VK_DEVICE_FUNCTIONS(VORTEX_MOCK_SLOT)
+#undef VORTEX_MOCK_SLOT
+    DEVICE_FUNCTION_COUNT
+};
+
+const PFN_vkVoidFunction* getDeviceTable();
+
+struct MockDevice;
+
+struct MockObject {
+    MockObject(MockObjectType objectType, MockDevice* ownerDevice) : type(objectType), device(ownerDevice) {}
+    virtual ~MockObject() = default;
+
+    MockObjectType type;
+    MockDevice* device;   // Null for devices themselves
+};
+
+template<MockObjectType Type>
+struct MockObjectOf : MockObject {
+    static constexpr MockObjectType TYPE = Type;
+    explicit MockObjectOf(MockDevice* ownerDevice) : MockObject(Type, ownerDevice) {}
+};
+
+struct MockMemory : MockObjectOf<MockObjectType::Memory> {
+    using MockObjectOf::MockObjectOf;
+    VkDeviceSize size = 0;
+    uint32_t typeIndex = 0;
+    uint32_t heapIndex = 0;
+    std::unique_ptr<uint8_t[]> data;   // Backed on first map
+    bool mapped = false;
+    VkDeviceSize mapOffset = 0;
+    VkDeviceSize mapSize = 0;
+};
+
+struct MockBuffer : MockObjectOf<MockObjectType::Buffer> {
+    using MockObjectOf::MockObjectOf;
+    VkDeviceSize size = 0;
+    VkBufferUsageFlags usage = 0;
+    MockMemory* memory = nullptr;
+};
+
+struct MockImage : MockObjectOf<MockObjectType::Image> {
+    using MockObjectOf::MockObjectOf;
+    VkFormat format = VK_FORMAT_UNDEFINED;
+    VkExtent3D extent{};
+    uint32_t mipLevels = 1;
+    uint32_t arrayLayers = 1;
+    VkImageTiling tiling = VK_IMAGE_TILING_OPTIMAL;
+    MockMemory* memory = nullptr;
+    bool ownedBySwapchain = false;
+};
+
+using MockImageView = MockObjectOf<MockObjectType::ImageView>;
+using MockPipelineLayout = MockObjectOf<MockObjectType::PipelineLayout>;
+using MockPipelineCache = MockObjectOf<MockObjectType::PipelineCache>;
+using MockPipeline = MockObjectOf<MockObjectType::Pipeline>;
+using MockShaderModule = MockObjectOf<MockObjectType::ShaderModule>;
+
+struct MockQueryPool : MockObjectOf<MockObjectType::QueryPool> {
+    using MockObjectOf::MockObjectOf;
+    std::vector<uint64_t> values;
+    std::vector<bool> available;
+};
+
+// Query resets and timestamp writes take effect when the submission completes
+struct MockQueryOp {
+    MockQueryPool* pool;
+    uint32_t firstQuery;
+    uint32_t queryCount;
+    bool reset;
+};
+
+struct MockCommandBuffer;
+
+struct MockCommandPool : MockObjectOf<MockObjectType::CommandPool> {
+    using MockObjectOf::MockObjectOf;
+    uint32_t queueFamilyIndex = 0;
+    VkCommandPoolCreateFlags flags = 0;
+    std::unordered_set<MockCommandBuffer*> commandBuffers;
+};
+
+enum class CommandBufferState {
+    Initial,
+    Recording,
+    Executable
+};
+
+struct MockCommandBuffer : MockObjectOf<MockObjectType::CommandBuffer> {
+    using MockObjectOf::MockObjectOf;
+    const PFN_vkVoidFunction* dispatch = getDeviceTable();
+    MockCommandPool* pool = nullptr;
+    CommandBufferState state = CommandBufferState::Initial;
+    std::vector<MockVulkanCommand> commands;
+    std::vector<MockVulkanBarrier> barriers;
+    std::vector<MockQueryOp> queryOps;
+
+    void clear() {
+        commands.clear();
+        barriers.clear();
+        queryOps.clear();
+    }
+};
+
+struct MockFence : MockObjectOf<MockObjectType::Fence> {
+    using MockObjectOf::MockObjectOf;
+    bool signaled = false;
+    bool pending = false;   // Attached to a submission that has not completed
+};
+
+struct MockSemaphore : MockObjectOf<MockObjectType::Semaphore> {
+    using MockObjectOf::MockObjectOf;
+    bool timeline = false;
+    bool signaled = false;        // Binary payload
+    uint64_t value = 0;           // Timeline payload
+    uint32_t pendingSignals = 0;  // Incomplete submissions that signal it
+};
+
+struct MockSwapchain : MockObjectOf<MockObjectType::Swapchain> {
+    using MockObjectOf::MockObjectOf;
+    std::vector<MockImage*> images;
+    uint32_t nextImage = 0;
+};
+
+struct MockSemaphoreOp {
+    MockSemaphore* semaphore;
+    uint64_t value;   // Ignored for binary semaphores
+};
+
+struct MockSubmission {
+    std::vector<MockSemaphoreOp> waits;
+    std::vector<MockSemaphoreOp> signals;
+    std::vector<MockQueryOp> queryOps;
+    MockFence* fence = nullptr;
+};
+
+struct MockQueue {
+    const PFN_vkVoidFunction* dispatch = getDeviceTable();
+    uint32_t familyIndex = 0;
+    uint32_t queueIndex = 0;
+    std::deque<MockSubmission> pending;
+};
+
+struct MockDevice : MockObjectOf<MockObjectType::Device> {
+    MockDevice() : MockObjectOf(nullptr) {}
+    const PFN_vkVoidFunction* dispatch = getDeviceTable();
+    std::vector<std::unique_ptr<MockQueue>> queues;
+    uint64_t liveObjects = 0;
+    bool timelineSemaphore = false;   // Enabled at creation
+};
+
+// Handle conversion; objects are always converted through MockObject* so the
+// round trip is exact
+template<typename Handle>
+Handle toHandle(MockObject* object) {
+    return reinterpret_cast<Handle>(object);
+}
+
+template<typename Handle>
+MockObject* toObject(Handle handle) {
+    return reinterpret_cast<MockObject*>(handle);
+}
+
+template<typename Handle>
+uint64_t toId(Handle handle) {
+    return static_cast<uint64_t>(reinterpret_cast<uintptr_t>(handle));
+}
+
+VkDeviceSize alignUp(VkDeviceSize value, VkDeviceSize alignment) {
+    return alignment > 1 ? (value + alignment - 1) / alignment * alignment : value;
+}
+
+uint32_t getFormatSize(VkFormat format) {
+    switch (format) {
+        case VK_FORMAT_R16G16B16A16_SFLOAT: return 8;
+        case VK_FORMAT_R32G32B32A32_SFLOAT: return 16;
+        default: return 4;
+    }
+}
+
+template<typename T>
+VkResult enumerate(const std::vector<T>& items, uint32_t* pCount, T* pItems) {
+    uint32_t available = static_cast<uint32_t>(items.size());
+    if (!pItems) {
+        *pCount = available;
+        return VK_SUCCESS;
+    }
+
+    uint32_t count = std::min(*pCount, available);
+    std::copy(items.begin(), items.begin() + count, pItems);
+    *pCount = count;
+    return count < available ? VK_INCOMPLETE : VK_SUCCESS;
+}
+
+// Walks a pNext chain for a structure of the given type
+template<typename T>
+const T* findInChain(const void* pNext, VkStructureType type) {
+    for (auto* next = static_cast<const VkBaseInStructure*>(pNext); next; next = next->pNext) {
+        if (next->sType == type) {
+            return reinterpret_cast<const T*>(next);
+        }
+    }
+    return nullptr;
+}
+
+} // namespace
+
+struct MockVulkanDevice::State {
+    MockVulkanConfig config;
+
+    // Instance and physical device are fixed; only their addresses matter
+    uint8_t instanceTag = 0;
+    uint8_t physicalDeviceTag = 0;
+
+    mutable std::mutex mutex;
+    std::condition_variable completion;
+
+    std::unordered_set<MockObject*> objects;
+    std::vector<MockDevice*> devices;
+    MockDevice* defaultDevice = nullptr;
+
+    std::vector<VkDeviceSize> heapUsage;
+    uint32_t allocationCount = 0;
+    size_t pendingSubmissions = 0;
+    uint64_t timestamp = 0;
+
+    bool autoComplete = true;
+    std::atomic<bool> recordCalls{true};
+    std::vector<MockVulkanCall> calls;
+    std::vector<std::string> errors;
+
+    VkInstance getInstance() { return reinterpret_cast<VkInstance>(&instanceTag); }
+    VkPhysicalDevice getPhysicalDevice() { return reinterpret_cast<VkPhysicalDevice>(&physicalDeviceTag); }
+};
+
+namespace {
+
+using State = MockVulkanDevice::State;
+
+// The installed mock; entry points have no other way to find it
+State* g_active = nullptr;
+
+State& active() {
+    return *g_active;
+}
+
+// Everything below that touches shared state expects state.mutex to be held
+
+void reportError(State& state, const std::string& message) {
+    std::cerr << "Mock Vulkan: " << message << std::endl;
+    state.errors.push_back(message);
+}
+
+void recordCall(State& state, const char* function, uint64_t handle = 0) {
+    if (state.recordCalls.load(std::memory_order_relaxed)) {
+        state.calls.push_back({function, handle});
+    }
+}
+
+template<typename Object, typename Handle>
+Object* lookup(State& state, Handle handle, const char* function) {
+    if (handle == VK_NULL_HANDLE) {
+        reportError(state, std::string(function) + " got a null " + getObjectTypeName(Object::TYPE));
+        return nullptr;
+    }
+
+    MockObject* object = toObject(handle);
+    if (state.objects.count(object) == 0 || object->type != Object::TYPE) {
+        reportError(state, std::string(function) + " got an invalid or destroyed " + getObjectTypeName(Object::TYPE));
+        return nullptr;
+    }
+    return static_cast<Object*>(object);
+}
+
+template<typename Handle>
+Handle registerObject(State& state, MockObject* object, const char* function) {
+    state.objects.insert(object);
+    if (object->device) {
+        object->device->liveObjects++;
+    }
+    Handle handle = toHandle<Handle>(object);
+    recordCall(state, function, toId(handle));
+    return handle;
+}
+
+void releaseObject(State& state, MockObject* object) {
+    state.objects.erase(object);
+    if (object->device) {
+        object->device->liveObjects--;
+    }
+    delete object;
+}
+
+MockDevice* getDevice(VkDevice device) {
+    return static_cast<MockDevice*>(toObject(device));
+}
+
+MockCommandBuffer* getCommandBuffer(VkCommandBuffer commandBuffer) {
+    return static_cast<MockCommandBuffer*>(toObject(commandBuffer));
+}
+
+MockQueue* getQueue(VkQueue queue) {
+    return reinterpret_cast<MockQueue*>(queue);
+}
+
+// Memory requirements
+
+VkMemoryRequirements getBufferRequirements(const State& state, const MockBuffer& buffer) {
+    const VkPhysicalDeviceLimits& limits = state.config.properties.limits;
+    VkDeviceSize alignment = 16;
+    if (buffer.usage & VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT) {
+        alignment = std::max(alignment, limits.minUniformBufferOffsetAlignment);
+    }
+    if (buffer.usage & VK_BUFFER_USAGE_STORAGE_BUFFER_BIT) {
+        alignment = std::max(alignment, limits.minStorageBufferOffsetAlignment);
+    }
+
+    uint32_t typeCount = state.config.memoryProperties.memoryTypeCount;
+    VkMemoryRequirements requirements{};
+    requirements.size = alignUp(buffer.size, alignment);
+    requirements.alignment = alignment;
+    requirements.memoryTypeBits = typeCount >= 32 ? ~0u : (1u << typeCount) - 1;
+    return requirements;
+}
+
+VkMemoryRequirements getImageRequirements(const State& state, const MockImage& image) {
+    VkDeviceSize size = 0;
+    for (uint32_t mip = 0; mip < image.mipLevels; ++mip) {
+        VkDeviceSize width = std::max(image.extent.width >> mip, 1u);
+        VkDeviceSize height = std::max(image.extent.height >> mip, 1u);
+        VkDeviceSize depth = std::max(image.extent.depth >> mip, 1u);
+        size += width * height * depth * getFormatSize(image.format);
+    }
+    size *= image.arrayLayers;
+
+    // Optimal tiling lives in device-local memory only, as on discrete GPUs
+    const VkPhysicalDeviceMemoryProperties& memory = state.config.memoryProperties;
+    uint32_t typeBits = 0;
+    for (uint32_t i = 0; i < memory.memoryTypeCount; ++i) {
+        bool deviceLocal = memory.memoryTypes[i].propertyFlags & VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+        if (image.tiling == VK_IMAGE_TILING_LINEAR || deviceLocal) {
+            typeBits |= 1u << i;
+        }
+    }
+
+    VkMemoryRequirements requirements{};
+    requirements.alignment = image.tiling == VK_IMAGE_TILING_OPTIMAL ? 4 * KiB : 256;
+    requirements.size = alignUp(size, requirements.alignment);
+    requirements.memoryTypeBits = typeBits;
+    return requirements;
+}
+
+void checkMemoryBinding(State& state, const char* function, MockMemory& memory,
+                        const VkMemoryRequirements& requirements, VkDeviceSize offset) {
+    if (!(requirements.memoryTypeBits & (1u << memory.typeIndex))) {
+        reportError(state, std::string(function) + ": memory type " + std::to_string(memory.typeIndex) +
+                           " is not allowed by memoryTypeBits");
+    }
+    if (offset % requirements.alignment != 0) {
+        reportError(state, std::string(function) + ": offset " + std::to_string(offset) +
+                           " is not aligned to " + std::to_string(requirements.alignment));
+    }
+    if (offset + requirements.size > memory.size) {
+        reportError(state, std::string(function) + ": range [" + std::to_string(offset) + ", " +
+                           std::to_string(offset + requirements.size) + ") exceeds the allocation size " +
+                           std::to_string(memory.size));
+    }
+}
+
+void checkMappedRange(State& state, const char* function, const VkMappedMemoryRange& range) {
+    MockMemory* memory = lookup<MockMemory>(state, range.memory, function);
+    if (!memory) {
+        return;
+    }
+    if (!memory->mapped) {
+        reportError(state, std::string(function) + ": memory is not mapped");
+        return;
+    }
+
+    // Coherent memory needs no flushing, but the range rules still apply
+    VkDeviceSize atomSize = std::max<VkDeviceSize>(state.config.properties.limits.nonCoherentAtomSize, 1);
+    VkDeviceSize end = range.size == VK_WHOLE_SIZE ? memory->mapOffset + memory->mapSize : range.offset + range.size;
+    if (range.offset % atomSize != 0) {
+        reportError(state, std::string(function) + ": offset " + std::to_string(range.offset) +
+                           " is not a multiple of nonCoherentAtomSize");
+    }
+    if (range.size != VK_WHOLE_SIZE && range.size % atomSize != 0 && end != memory->size) {
+        reportError(state, std::string(function) + ": size " + std::to_string(range.size) +
+                           " is not a multiple of nonCoherentAtomSize");
+    }
+    if (range.offset < memory->mapOffset || end > memory->mapOffset + memory->mapSize) {
+        reportError(state, std::string(function) + ": range is outside the mapped region");
+    }
+}
+
+// Submissions
+
+bool areWaitsMet(const MockSubmission& submission) {
+    for (const MockSemaphoreOp& wait : submission.waits) {
+        if (!wait.semaphore) {
+            continue;
+        }
+        if (wait.semaphore->timeline ? wait.semaphore->value < wait.value : !wait.semaphore->signaled) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void executeSubmission(State& state, MockSubmission& submission) {
+    for (const MockSemaphoreOp& wait : submission.waits) {
+        if (wait.semaphore && !wait.semaphore->timeline) {
+            wait.semaphore->signaled = false;
+        }
+    }
+
+    for (const MockQueryOp& op : submission.queryOps) {
+        if (!op.pool) {
+            continue;
+        }
+        for (uint32_t query = op.firstQuery; query < op.firstQuery + op.queryCount; ++query) {
+            if (query >= op.pool->values.size()) {
+                continue;
+            }
+            if (op.reset) {
+                op.pool->available[query] = false;
+            } else {
+                state.timestamp += TIMESTAMP_STEP;
+                op.pool->values[query] = state.timestamp;
+                op.pool->available[query] = true;
+            }
+        }
+    }
+
+    for (const MockSemaphoreOp& signal : submission.signals) {
+        if (!signal.semaphore) {
+            continue;
+        }
+        signal.semaphore->pendingSignals--;
+        if (!signal.semaphore->timeline) {
+            signal.semaphore->signaled = true;
+        } else if (signal.value <= signal.semaphore->value) {
+            reportError(state, "Timeline semaphore signaled with " + std::to_string(signal.value) +
+                               ", not greater than its value " + std::to_string(signal.semaphore->value));
+        } else {
+            signal.semaphore->value = signal.value;
+        }
+    }
+
+    if (submission.fence) {
+        submission.fence->pending = false;
+        submission.fence->signaled = true;
+    }
+}
+
+// Runs queue heads whose waits are met until nothing more can run
+uint32_t processSubmissions(State& state, uint32_t maxCount) {
+    uint32_t completed = 0;
+    bool progress = true;
+    while (progress && completed < maxCount) {
+        progress = false;
+        for (MockDevice* device : state.devices) {
+            for (auto& queue : device->queues) {
+                if (completed >= maxCount || queue->pending.empty() || !areWaitsMet(queue->pending.front())) {
+                    continue;
+                }
+                executeSubmission(state, queue->pending.front());
+                queue->pending.pop_front();
+                state.pendingSubmissions--;
+                completed++;
+                progress = true;
+            }
+        }
+    }
+
+    if (completed > 0) {
+        state.completion.notify_all();
+    }
+    return completed;
+}
+
+// Drops references from incomplete submissions to an object being destroyed
+void detachFromSubmissions(State& state, MockObject* object, const char* function) {
+    bool referenced = false;
+    for (MockDevice* device : state.devices) {
+        for (auto& queue : device->queues) {
+            for (MockSubmission& submission : queue->pending) {
+                if (submission.fence == object) {
+                    submission.fence = nullptr;
+                    referenced = true;
+                }
+                for (auto* ops : {&submission.waits, &submission.signals}) {
+                    for (MockSemaphoreOp& op : *ops) {
+                        if (op.semaphore == object) {
+                            op.semaphore = nullptr;
+                            referenced = true;
+                        }
+                    }
+                }
+                for (MockQueryOp& op : submission.queryOps) {
+                    if (op.pool == object) {
+                        op.pool = nullptr;
+                        referenced = true;
+                    }
+                }
+            }
+        }
+    }
+    if (referenced) {
+        reportError(state, std::string(function) + " destroys an object still used by a pending submission");
+    }
+}
+
+// Blocks until ready() holds, the timeout passes, or nothing pending could make it hold
+VkResult waitUntil(State& state, std::unique_lock<std::mutex>& lock, uint64_t timeout,
+                   const std::function<bool()>& ready, const std::function<bool()>& satisfiable,
+                   const char* function) {
+    if (ready()) {
+        return VK_SUCCESS;
+    }
+    if (timeout == 0) {
+        return VK_TIMEOUT;
+    }
+    if (!satisfiable()) {
+        reportError(state, std::string(function) + " waits for something no pending submission will signal");
+        return VK_ERROR_DEVICE_LOST;
+    }
+
+    if (timeout == UINT64_MAX) {
+        state.completion.wait(lock, ready);
+        return VK_SUCCESS;
+    }
+    return state.completion.wait_for(lock, std::chrono::nanoseconds(timeout), ready) ? VK_SUCCESS : VK_TIMEOUT;
+}
+
+// Entry points
+
+namespace MockEntry {
+
+PFN_vkVoidFunction lookupInstanceFunction(const char* name);
+PFN_vkVoidFunction lookupDeviceFunction(const char* name);
+
+// Instance and physical device
+
+// Device functions resolved here come back as trampolines, as from the loader
+VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL vkGetInstanceProcAddr(VkInstance, const char* pName) {
+    return g_active && pName ? lookupInstanceFunction(pName) : nullptr;
+}
+
+VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL vkGetDeviceProcAddr(VkDevice, const char* pName) {
+    return g_active && pName ? lookupDeviceFunction(pName) : nullptr;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL vkCreateInstance(const VkInstanceCreateInfo*, const VkAllocationCallbacks*,
+                                                VkInstance* pInstance) {
+    State& state = active();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    *pInstance = state.getInstance();
+    recordCall(state, "vkCreateInstance", toId(*pInstance));
+    return VK_SUCCESS;
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDestroyInstance(VkInstance instance, const VkAllocationCallbacks*) {
+    State& state = active();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    recordCall(state, "vkDestroyInstance", toId(instance));
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL vkEnumeratePhysicalDevices(VkInstance, uint32_t* pCount, VkPhysicalDevice* pDevices) {
+    return enumerate(std::vector<VkPhysicalDevice>{active().getPhysicalDevice()}, pCount, pDevices);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkGetPhysicalDeviceProperties(VkPhysicalDevice, VkPhysicalDeviceProperties* pProperties) {
+    *pProperties = active().config.properties;
+}
+
+VKAPI_ATTR void VKAPI_CALL vkGetPhysicalDeviceFeatures(VkPhysicalDevice, VkPhysicalDeviceFeatures* pFeatures) {
+    *pFeatures = active().config.features;
+}
+
+VKAPI_ATTR void VKAPI_CALL vkGetPhysicalDeviceFeatures2(VkPhysicalDevice, VkPhysicalDeviceFeatures2* pFeatures) {
+    const MockVulkanConfig& config = active().config;
+    pFeatures->features = config.features;
+    for (auto* next = static_cast<VkBaseOutStructure*>(pFeatures->pNext); next; next = next->pNext) {
+        if (next->sType == VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_FEATURES) {
+            reinterpret_cast<VkPhysicalDeviceTimelineSemaphoreFeatures*>(next)->timelineSemaphore =
+                config.timelineSemaphore ? VK_TRUE : VK_FALSE;
+        }
+    }
+}
+
+VKAPI_ATTR void VKAPI_CALL vkGetPhysicalDeviceMemoryProperties(VkPhysicalDevice,
+                                                               VkPhysicalDeviceMemoryProperties* pMemoryProperties) {
+    *pMemoryProperties = active().config.memoryProperties;
+}
+
+VKAPI_ATTR void VKAPI_CALL vkGetPhysicalDeviceQueueFamilyProperties(VkPhysicalDevice, uint32_t* pCount,
+                                                                    VkQueueFamilyProperties* pProperties) {
+    enumerate(active().config.queueFamilies, pCount, pProperties);
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL vkEnumerateDeviceExtensionProperties(VkPhysicalDevice, const char*, uint32_t* pCount,
+                                                                    VkExtensionProperties* pProperties) {
+    std::vector<VkExtensionProperties> extensions;
+    for (const std::string& name : active().config.deviceExtensions) {
+        VkExtensionProperties properties{};
+        std::strncpy(properties.extensionName, name.c_str(), sizeof(properties.extensionName) - 1);
+        properties.specVersion = 1;
+        extensions.push_back(properties);
+    }
+    return enumerate(extensions, pCount, pProperties);
+}
+
+// Surfaces belong to the window system, so any surface handle is accepted
+VKAPI_ATTR VkResult VKAPI_CALL vkGetPhysicalDeviceSurfaceSupportKHR(VkPhysicalDevice, uint32_t familyIndex,
+                                                                    VkSurfaceKHR, VkBool32* pSupported) {
+    const auto& families = active().config.queueFamilies;
+    *pSupported = familyIndex < families.size() && (families[familyIndex].queueFlags & VK_QUEUE_GRAPHICS_BIT);
+    return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL vkGetPhysicalDeviceSurfaceCapabilitiesKHR(VkPhysicalDevice, VkSurfaceKHR,
+                                                                         VkSurfaceCapabilitiesKHR* pCapabilities) {
+    VkSurfaceCapabilitiesKHR capabilities{};
+    capabilities.minImageCount = 2;
+    capabilities.maxImageCount = 8;
+    capabilities.currentExtent = {1280, 720};
+    capabilities.minImageExtent = {1, 1};
+    capabilities.maxImageExtent = {16384, 16384};
+    capabilities.maxImageArrayLayers = 1;
+    capabilities.supportedTransforms = VK_SURFACE_TRANSFORM_IDENTITY_BIT_KHR;
+    capabilities.currentTransform = VK_SURFACE_TRANSFORM_IDENTITY_BIT_KHR;
+    capabilities.supportedCompositeAlpha = VK_COMPOSITE_ALPHA_OPAQUE_BIT_KHR;
+    capabilities.supportedUsageFlags = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT |
+                                       VK_IMAGE_USAGE_TRANSFER_DST_BIT;
+    *pCapabilities = capabilities;
+    return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL vkGetPhysicalDeviceSurfaceFormatsKHR(VkPhysicalDevice, VkSurfaceKHR, uint32_t* pCount,
+                                                                    VkSurfaceFormatKHR* pFormats) {
+    return enumerate(std::vector<VkSurfaceFormatKHR>{
+        {VK_FORMAT_B8G8R8A8_SRGB, VK_COLOR_SPACE_SRGB_NONLINEAR_KHR},
+        {VK_FORMAT_B8G8R8A8_UNORM, VK_COLOR_SPACE_SRGB_NONLINEAR_KHR}
+    }, pCount, pFormats);
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL vkGetPhysicalDeviceSurfacePresentModesKHR(VkPhysicalDevice, VkSurfaceKHR,
+                                                                         uint32_t* pCount, VkPresentModeKHR* pModes) {
+    return enumerate(std::vector<VkPresentModeKHR>{
+        VK_PRESENT_MODE_FIFO_KHR,
+        VK_PRESENT_MODE_FIFO_RELAXED_KHR,
+        VK_PRESENT_MODE_MAILBOX_KHR,
+        VK_PRESENT_MODE_IMMEDIATE_KHR
+    }, pCount, pModes);
+}
+
+// Device and queues
+
+VKAPI_ATTR VkResult VKAPI_CALL vkCreateDevice(VkPhysicalDevice, const VkDeviceCreateInfo* pCreateInfo,
+                                              const VkAllocationCallbacks*, VkDevice* pDevice) {
+    State& state = active();
+    std::lock_guard<std::mutex> lock(state.mutex);
+
+    for (uint32_t i = 0; i < pCreateInfo->enabledExtensionCount; ++i) {
+        const auto& supported = state.config.deviceExtensions;
+        if (std::find(supported.begin(), supported.end(), pCreateInfo->ppEnabledExtensionNames[i]) == supported.end()) {
+            return VK_ERROR_EXTENSION_NOT_PRESENT;
+        }
+    }
+
+    auto device = std::make_unique<MockDevice>();
+    auto* timelineFeatures = findInChain<VkPhysicalDeviceTimelineSemaphoreFeatures>(
+        pCreateInfo->pNext, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_FEATURES);
+    if (timelineFeatures && timelineFeatures->timelineSemaphore) {
+        if (!state.config.timelineSemaphore) {
+            return VK_ERROR_FEATURE_NOT_PRESENT;
+        }
+        device->timelineSemaphore = true;
+    }
+
+    for (uint32_t i = 0; i < pCreateInfo->queueCreateInfoCount; ++i) {
+        const VkDeviceQueueCreateInfo& queueInfo = pCreateInfo->pQueueCreateInfos[i];
+        if (queueInfo.queueFamilyIndex >= state.config.queueFamilies.size() ||
+            queueInfo.queueCount > state.config.queueFamilies[queueInfo.queueFamilyIndex].queueCount) {
+            reportError(state, "vkCreateDevice requests more queues than family " +
+                               std::to_string(queueInfo.queueFamilyIndex) + " has");
+            return VK_ERROR_INITIALIZATION_FAILED;
+        }
+        for (uint32_t queueIndex = 0; queueIndex < queueInfo.queueCount; ++queueIndex) {
+            auto queue = std::make_unique<MockQueue>();
+            queue->familyIndex = queueInfo.queueFamilyIndex;
+            queue->queueIndex = queueIndex;
+            device->queues.push_back(std::move(queue));
+        }
+    }
+
+    state.devices.push_back(device.get());
+    *pDevice = registerObject<VkDevice>(state, device.release(), "vkCreateDevice");
+    return VK_SUCCESS;
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDestroyDevice(VkDevice device, const VkAllocationCallbacks*) {
+    if (device == VK_NULL_HANDLE) {
+        return;
+    }
+
+    State& state = active();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    MockDevice* mockDevice = lookup<MockDevice>(state, device, "vkDestroyDevice");
+    if (!mockDevice) {
+        return;
+    }
+
+    if (mockDevice->liveObjects > 0) {
+        reportError(state, "vkDestroyDevice with " + std::to_string(mockDevice->liveObjects) + " objects still alive");
+    }
+    for (auto& queue : mockDevice->queues) {
+        if (!queue->pending.empty()) {
+            reportError(state, "vkDestroyDevice with submissions still pending");
+            state.pendingSubmissions -= queue->pending.size();
+        }
+    }
+
+    recordCall(state, "vkDestroyDevice", toId(device));
+    state.devices.erase(std::remove(state.devices.begin(), state.devices.end(), mockDevice), state.devices.end());
+    if (state.defaultDevice == mockDevice) {
+        state.defaultDevice = nullptr;
+    }
+    releaseObject(state, mockDevice);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkGetDeviceQueue(VkDevice device, uint32_t familyIndex, uint32_t queueIndex, VkQueue* pQueue) {
+    *pQueue = VK_NULL_HANDLE;
+    for (auto& queue : getDevice(device)->queues) {
+        if (queue->familyIndex == familyIndex && queue->queueIndex == queueIndex) {
+            *pQueue = reinterpret_cast<VkQueue>(queue.get());
+            return;
+        }
+    }
+
+    State& state = active();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    reportError(state, "vkGetDeviceQueue for queue " + std::to_string(queueIndex) + " of family " +
+                       std::to_string(familyIndex) + ", which was not created");
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL vkQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo* pSubmits,
+                                             VkFence fence) {
+    State& state = active();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    MockQueue* mockQueue = getQueue(queue);
+
+    std::vector<MockSubmission> submissions(std::max(submitCount, 1u));
+    for (uint32_t i = 0; i < submitCount; ++i) {
+        const VkSubmitInfo& submit = pSubmits[i];
+        MockSubmission& submission = submissions[i];
+        auto* timelineInfo = findInChain<VkTimelineSemaphoreSubmitInfo>(
+            submit.pNext, VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO);
+
+        for (uint32_t w = 0; w < submit.waitSemaphoreCount; ++w) {
+            MockSemaphore* semaphore = lookup<MockSemaphore>(state, submit.pWaitSemaphores[w], "vkQueueSubmit");
+            if (!semaphore) {
+                continue;
+            }
+            uint64_t value = 0;
+            if (semaphore->timeline) {
+                if (!timelineInfo || w >= timelineInfo->waitSemaphoreValueCount) {
+                    reportError(state, "vkQueueSubmit waits on a timeline semaphore without a value");
+                    continue;
+                }
+                value = timelineInfo->pWaitSemaphoreValues[w];
+            }
+            submission.waits.push_back({semaphore, value});
+        }
+
+        for (uint32_t c = 0; c < submit.commandBufferCount; ++c) {
+            auto* commandBuffer = lookup<MockCommandBuffer>(state, submit.pCommandBuffers[c], "vkQueueSubmit");
+            if (!commandBuffer) {
+                continue;
+            }
+            if (commandBuffer->state != CommandBufferState::Executable) {
+                reportError(state, "vkQueueSubmit of a command buffer that is not ended");
+            }
+            if (commandBuffer->pool->queueFamilyIndex != mockQueue->familyIndex) {
+                reportError(state, "vkQueueSubmit of a command buffer from family " +
+                                   std::to_string(commandBuffer->pool->queueFamilyIndex) + " to a queue of family " +
+                                   std::to_string(mockQueue->familyIndex));
+            }
+            submission.queryOps.insert(submission.queryOps.end(), commandBuffer->queryOps.begin(),
+                                       commandBuffer->queryOps.end());
+        }
+
+        for (uint32_t s = 0; s < submit.signalSemaphoreCount; ++s) {
+            MockSemaphore* semaphore = lookup<MockSemaphore>(state, submit.pSignalSemaphores[s], "vkQueueSubmit");
+            if (!semaphore) {
+                continue;
+            }
+            uint64_t value = 0;
+            if (semaphore->timeline) {
+                if (!timelineInfo || s >= timelineInfo->signalSemaphoreValueCount) {
+                    reportError(state, "vkQueueSubmit signals a timeline semaphore without a value");
+                    continue;
+                }
+                value = timelineInfo->pSignalSemaphoreValues[s];
+            }
+            semaphore->pendingSignals++;
+            submission.signals.push_back({semaphore, value});
+        }
+    }
+
+    if (fence != VK_NULL_HANDLE) {
+        MockFence* mockFence = lookup<MockFence>(state, fence, "vkQueueSubmit");
+        if (mockFence && (mockFence->signaled || mockFence->pending)) {
+            reportError(state, "vkQueueSubmit with a fence that is signaled or already in use");
+        }
+        if (mockFence) {
+            mockFence->pending = true;
+            submissions.back().fence = mockFence;
+        }
+    }
+
+    if (submitCount > 0 || fence != VK_NULL_HANDLE) {
+        for (MockSubmission& submission : submissions) {
+            mockQueue->pending.push_back(std::move(submission));
+            state.pendingSubmissions++;
+        }
+    }
+
+    recordCall(state, "vkQueueSubmit", toId(queue));
+    if (state.autoComplete) {
+        processSubmissions(state, UINT32_MAX);
+    }
+    return VK_SUCCESS;
+}
+
+VkResult drainQueues(State& state, const char* function, MockQueue* onlyQueue) {
+    processSubmissions(state, UINT32_MAX);
+
+    for (MockDevice* device : state.devices) {
+        for (auto& queue : device->queues) {
+            if ((!onlyQueue || queue.get() == onlyQueue) && !queue->pending.empty()) {
+                reportError(state, std::string(function) + ": submissions wait on semaphores nothing will signal");
+                return VK_ERROR_DEVICE_LOST;
+            }
+        }
+    }
+    return VK_SUCCESS;
+}
+
+// Waiting for idle lets the simulated GPU run everything it can, even with
+// automatic completion off
+VKAPI_ATTR VkResult VKAPI_CALL vkQueueWaitIdle(VkQueue queue) {
+    State& state = active();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    recordCall(state, "vkQueueWaitIdle", toId(queue));
+    return drainQueues(state, "vkQueueWaitIdle", getQueue(queue));
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL vkDeviceWaitIdle(VkDevice device) {
+    State& state = active();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    recordCall(state, "vkDeviceWaitIdle", toId(device));
+    return drainQueues(state, "vkDeviceWaitIdle", nullptr);
+}
+
+// Memory
+
+VKAPI_ATTR VkResult VKAPI_CALL vkAllocateMemory(VkDevice device, const VkMemoryAllocateInfo* pAllocateInfo,
+                                                const VkAllocationCallbacks*, VkDeviceMemory* pMemory) {
+    State& state = active();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    const VkPhysicalDeviceMemoryProperties& properties = state.config.memoryProperties;
+
+    if (pAllocateInfo->memoryTypeIndex >= properties.memoryTypeCount) {
+        reportError(state, "vkAllocateMemory with memory type " + std::to_string(pAllocateInfo->memoryTypeIndex) +
+                           ", which does not exist");
+        return VK_ERROR_OUT_OF_DEVICE_MEMORY;
+    }
+    if (pAllocateInfo->allocationSize == 0) {
+        reportError(state, "vkAllocateMemory with a size of zero");
+        return VK_ERROR_OUT_OF_DEVICE_MEMORY;
+    }
+
+    uint32_t maxAllocations = state.config.properties.limits.maxMemoryAllocationCount;
+    if (maxAllocations > 0 && state.allocationCount >= maxAllocations) {
+        return VK_ERROR_TOO_MANY_OBJECTS;
+    }
+
+    uint32_t heapIndex = properties.memoryTypes[pAllocateInfo->memoryTypeIndex].heapIndex;
+    if (state.heapUsage[heapIndex] + pAllocateInfo->allocationSize > properties.memoryHeaps[heapIndex].size) {
+        return VK_ERROR_OUT_OF_DEVICE_MEMORY;
+    }
+
+    auto* memory = new MockMemory(getDevice(device));
+    memory->size = pAllocateInfo->allocationSize;
+    memory->typeIndex = pAllocateInfo->memoryTypeIndex;
+    memory->heapIndex = heapIndex;
+    state.heapUsage[heapIndex] += memory->size;
+    state.allocationCount++;
+    *pMemory = registerObject<VkDeviceMemory>(state, memory, "vkAllocateMemory");
+    return VK_SUCCESS;
+}
+
+VKAPI_ATTR void VKAPI_CALL vkFreeMemory(VkDevice, VkDeviceMemory memory, const VkAllocationCallbacks*) {
+    if (memory == VK_NULL_HANDLE) {
+        return;
+    }
+
+    State& state = active();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    MockMemory* mockMemory = lookup<MockMemory>(state, memory, "vkFreeMemory");
+    if (!mockMemory) {
+        return;
+    }
+
+    state.heapUsage[mockMemory->heapIndex] -= mockMemory->size;
+    state.allocationCount--;
+    recordCall(state, "vkFreeMemory", toId(memory));
+    releaseObject(state, mockMemory);
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL vkMapMemory(VkDevice, VkDeviceMemory memory, VkDeviceSize offset, VkDeviceSize size,
+                                           VkMemoryMapFlags, void** ppData) {
+    State& state = active();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    *ppData = nullptr;
+
+    MockMemory* mockMemory = lookup<MockMemory>(state, memory, "vkMapMemory");
+    if (!mockMemory) {
+        return VK_ERROR_MEMORY_MAP_FAILED;
+    }
+
+    VkMemoryPropertyFlags flags = state.config.memoryProperties.memoryTypes[mockMemory->typeIndex].propertyFlags;
+    if (!(flags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT)) {
+        reportError(state, "vkMapMemory on memory that is not host visible");
+        return VK_ERROR_MEMORY_MAP_FAILED;
+    }
+    if (mockMemory->mapped) {
+        reportError(state, "vkMapMemory on memory that is already mapped");
+        return VK_ERROR_MEMORY_MAP_FAILED;
+    }
+
+    VkDeviceSize mapSize = size == VK_WHOLE_SIZE ? mockMemory->size - std::min(offset, mockMemory->size) : size;
+    if (offset + mapSize > mockMemory->size || mapSize == 0) {
+        reportError(state, "vkMapMemory range exceeds the allocation");
+        return VK_ERROR_MEMORY_MAP_FAILED;
+    }
+
+    if (!mockMemory->data) {
+        mockMemory->data = std::make_unique<uint8_t[]>(static_cast<size_t>(mockMemory->size));
+    }
+    mockMemory->mapped = true;
+    mockMemory->mapOffset = offset;
+    mockMemory->mapSize = mapSize;
+    recordCall(state, "vkMapMemory", toId(memory));
+    *ppData = mockMemory->data.get() + offset;
+    return VK_SUCCESS;
+}
+
+VKAPI_ATTR void VKAPI_CALL vkUnmapMemory(VkDevice, VkDeviceMemory memory) {
+    State& state = active();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    MockMemory* mockMemory = lookup<MockMemory>(state, memory, "vkUnmapMemory");
+    if (!mockMemory) {
+        return;
+    }
+    if (!mockMemory->mapped) {
+        reportError(state, "vkUnmapMemory on memory that is not mapped");
+    }
+    mockMemory->mapped = false;
+    recordCall(state, "vkUnmapMemory", toId(memory));
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL vkFlushMappedMemoryRanges(VkDevice, uint32_t rangeCount,
+                                                         const VkMappedMemoryRange* pRanges) {
+    State& state = active();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    for (uint32_t i = 0; i < rangeCount; ++i) {
+        checkMappedRange(state, "vkFlushMappedMemoryRanges", pRanges[i]);
+    }
+    recordCall(state, "vkFlushMappedMemoryRanges");
+    return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL vkInvalidateMappedMemoryRanges(VkDevice, uint32_t rangeCount,
+                                                              const VkMappedMemoryRange* pRanges) {
+    State& state = active();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    for (uint32_t i = 0; i < rangeCount; ++i) {
+        checkMappedRange(state, "vkInvalidateMappedMemoryRanges", pRanges[i]);
+    }
+    recordCall(state, "vkInvalidateMappedMemoryRanges");
+    return VK_SUCCESS;
+}
+
+// Buffers and images
+
+VKAPI_ATTR VkResult VKAPI_CALL vkCreateBuffer(VkDevice device, const VkBufferCreateInfo* pCreateInfo,
+                                              const VkAllocationCallbacks*, VkBuffer* pBuffer) {
+    State& state = active();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    if (pCreateInfo->size == 0) {
+        reportError(state, "vkCreateBuffer with a size of zero");
+    }
+
+    auto* buffer = new MockBuffer(getDevice(device));
+    buffer->size = pCreateInfo->size;
+    buffer->usage = pCreateInfo->usage;
+    *pBuffer = registerObject<VkBuffer>(state, buffer, "vkCreateBuffer");
+    return VK_SUCCESS;
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDestroyBuffer(VkDevice, VkBuffer buffer, const VkAllocationCallbacks*) {
+    if (buffer == VK_NULL_HANDLE) {
+        return;
+    }
+
+    State& state = active();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    if (MockBuffer* mockBuffer = lookup<MockBuffer>(state, buffer, "vkDestroyBuffer")) {
+        recordCall(state, "vkDestroyBuffer", toId(buffer));
+        releaseObject(state, mockBuffer);
+    }
+}
+
+VKAPI_ATTR void VKAPI_CALL vkGetBufferMemoryRequirements(VkDevice, VkBuffer buffer,
+                                                         VkMemoryRequirements* pMemoryRequirements) {
+    State& state = active();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    *pMemoryRequirements = {};
+    if (MockBuffer* mockBuffer = lookup<MockBuffer>(state, buffer, "vkGetBufferMemoryRequirements")) {
+        *pMemoryRequirements = getBufferRequirements(state, *mockBuffer);
+    }
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL vkBindBufferMemory(VkDevice, VkBuffer buffer, VkDeviceMemory memory,
+                                                  VkDeviceSize memoryOffset) {
+    State& state = active();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    MockBuffer* mockBuffer = lookup<MockBuffer>(state, buffer, "vkBindBufferMemory");
+    MockMemory* mockMemory = lookup<MockMemory>(state, memory, "vkBindBufferMemory");
+    if (!mockBuffer || !mockMemory) {
+        return VK_SUCCESS;
+    }
+
+    if (mockBuffer->memory) {
+        reportError(state, "vkBindBufferMemory on a buffer that is already bound");
+    }
+    checkMemoryBinding(state, "vkBindBufferMemory", *mockMemory, getBufferRequirements(state, *mockBuffer), memoryOffset);
+    mockBuffer->memory = mockMemory;
+    recordCall(state, "vkBindBufferMemory", toId(buffer));
+    return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL vkCreateImage(VkDevice device, const VkImageCreateInfo* pCreateInfo,
+                                             const VkAllocationCallbacks*, VkImage* pImage) {
+    State& state = active();
+    std::lock_guard<std::mutex> lock(state.mutex);
+
+    auto* image = new MockImage(getDevice(device));
+    image->format = pCreateInfo->format;
+    image->extent = pCreateInfo->extent;
+    image->mipLevels = std::max(pCreateInfo->mipLevels, 1u);
+    image->arrayLayers = std::max(pCreateInfo->arrayLayers, 1u);
+    image->tiling = pCreateInfo->tiling;
+    *pImage = registerObject<VkImage>(state, image, "vkCreateImage");
+    return VK_SUCCESS;
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDestroyImage(VkDevice, VkImage image, const VkAllocationCallbacks*) {
+    if (image == VK_NULL_HANDLE) {
+        return;
+    }
+
+    State& state = active();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    MockImage* mockImage = lookup<MockImage>(state, image, "vkDestroyImage");
+    if (!mockImage) {
+        return;
+    }
+    if (mockImage->ownedBySwapchain) {
+        reportError(state, "vkDestroyImage on a swapchain image");
+        return;
+    }
+    recordCall(state, "vkDestroyImage", toId(image));
+    releaseObject(state, mockImage);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkGetImageMemoryRequirements(VkDevice, VkImage image,
+                                                        VkMemoryRequirements* pMemoryRequirements) {
+    State& state = active();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    *pMemoryRequirements = {};
+    if (MockImage* mockImage = lookup<MockImage>(state, image, "vkGetImageMemoryRequirements")) {
+        *pMemoryRequirements = getImageRequirements(state, *mockImage);
+    }
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL vkBindImageMemory(VkDevice, VkImage image, VkDeviceMemory memory,
+                                                 VkDeviceSize memoryOffset) {
+    State& state = active();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    MockImage* mockImage = lookup<MockImage>(state, image, "vkBindImageMemory");
+    MockMemory* mockMemory = lookup<MockMemory>(state, memory, "vkBindImageMemory");
+    if (!mockImage || !mockMemory) {
+        return VK_SUCCESS;
+    }
+
+    if (mockImage->memory || mockImage->ownedBySwapchain) {
+        reportError(state, "vkBindImageMemory on an image that is already bound");
+    }
+    checkMemoryBinding(state, "vkBindImageMemory", *mockMemory, getImageRequirements(state, *mockImage), memoryOffset);
+    mockImage->memory = mockMemory;
+    recordCall(state, "vkBindImageMemory", toId(image));
+    return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL vkCreateImageView(VkDevice device, const VkImageViewCreateInfo* pCreateInfo,
+                                                 const VkAllocationCallbacks*, VkImageView* pView) {
+    State& state = active();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    lookup<MockImage>(state, pCreateInfo->image, "vkCreateImageView");
+    *pView = registerObject<VkImageView>(state, new MockImageView(getDevice(device)), "vkCreateImageView");
+    return VK_SUCCESS;
+}
+
+// Objects with no state of their own
+
+template<typename Object, typename Handle>
+void destroySimpleObject(Handle handle, const char* function) {
+    if (handle == VK_NULL_HANDLE) {
+        return;
+    }
+
+    State& state = active();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    if (Object* object = lookup<Object>(state, handle, function)) {
+        recordCall(state, function, toId(handle));
+        releaseObject(state, object);
+    }
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDestroyImageView(VkDevice, VkImageView imageView, const VkAllocationCallbacks*) {
+    destroySimpleObject<MockImageView>(imageView, "vkDestroyImageView");
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL vkCreateShaderModule(VkDevice device, const VkShaderModuleCreateInfo* pCreateInfo,
+                                                    const VkAllocationCallbacks*, VkShaderModule* pShaderModule) {
+    constexpr uint32_t SPIRV_MAGIC = 0x07230203;
+
+    State& state = active();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    if (pCreateInfo->codeSize == 0 || pCreateInfo->codeSize % 4 != 0 || pCreateInfo->pCode[0] != SPIRV_MAGIC) {
+        reportError(state, "vkCreateShaderModule with code that is not SPIR-V");
+    }
+    *pShaderModule = registerObject<VkShaderModule>(state, new MockShaderModule(getDevice(device)),
+                                                    "vkCreateShaderModule");
+    return VK_SUCCESS;
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDestroyShaderModule(VkDevice, VkShaderModule shaderModule, const VkAllocationCallbacks*) {
+    destroySimpleObject<MockShaderModule>(shaderModule, "vkDestroyShaderModule");
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL vkCreatePipelineLayout(VkDevice device, const VkPipelineLayoutCreateInfo*,
+                                                      const VkAllocationCallbacks*, VkPipelineLayout* pPipelineLayout) {
+    State& state = active();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    *pPipelineLayout = registerObject<VkPipelineLayout>(state, new MockPipelineLayout(getDevice(device)),
+                                                        "vkCreatePipelineLayout");
+    return VK_SUCCESS;
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDestroyPipelineLayout(VkDevice, VkPipelineLayout pipelineLayout,
+                                                   const VkAllocationCallbacks*) {
+    destroySimpleObject<MockPipelineLayout>(pipelineLayout, "vkDestroyPipelineLayout");
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL vkCreatePipelineCache(VkDevice device, const VkPipelineCacheCreateInfo*,
+                                                     const VkAllocationCallbacks*, VkPipelineCache* pPipelineCache) {
+    State& state = active();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    *pPipelineCache = registerObject<VkPipelineCache>(state, new MockPipelineCache(getDevice(device)),
+                                                      "vkCreatePipelineCache");
+    return VK_SUCCESS;
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDestroyPipelineCache(VkDevice, VkPipelineCache pipelineCache,
+                                                  const VkAllocationCallbacks*) {
+    destroySimpleObject<MockPipelineCache>(pipelineCache, "vkDestroyPipelineCache");
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL vkCreateGraphicsPipelines(VkDevice device, VkPipelineCache, uint32_t createInfoCount,
+                                                         const VkGraphicsPipelineCreateInfo*,
+                                                         const VkAllocationCallbacks*, VkPipeline* pPipelines) {
+    State& state = active();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    for (uint32_t i = 0; i < createInfoCount; ++i) {
+        pPipelines[i] = registerObject<VkPipeline>(state, new MockPipeline(getDevice(device)),
+                                                   "vkCreateGraphicsPipelines");
+    }
+    return VK_SUCCESS;
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDestroyPipeline(VkDevice, VkPipeline pipeline, const VkAllocationCallbacks*) {
+    destroySimpleObject<MockPipeline>(pipeline, "vkDestroyPipeline");
+}
+
+// Command pools and buffers
+
+VKAPI_ATTR VkResult VKAPI_CALL vkCreateCommandPool(VkDevice device, const VkCommandPoolCreateInfo* pCreateInfo,
+                                                   const VkAllocationCallbacks*, VkCommandPool* pCommandPool) {
+    State& state = active();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    if (pCreateInfo->queueFamilyIndex >= state.config.queueFamilies.size()) {
+        reportError(state, "vkCreateCommandPool for queue family " + std::to_string(pCreateInfo->queueFamilyIndex) +
+                           ", which does not exist");
+    }
+
+    auto* pool = new MockCommandPool(getDevice(device));
+    pool->queueFamilyIndex = pCreateInfo->queueFamilyIndex;
+    pool->flags = pCreateInfo->flags;
+    *pCommandPool = registerObject<VkCommandPool>(state, pool, "vkCreateCommandPool");
+    return VK_SUCCESS;
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDestroyCommandPool(VkDevice, VkCommandPool commandPool, const VkAllocationCallbacks*) {
+    if (commandPool == VK_NULL_HANDLE) {
+        return;
+    }
+
+    State& state = active();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    MockCommandPool* pool = lookup<MockCommandPool>(state, commandPool, "vkDestroyCommandPool");
+    if (!pool) {
+        return;
+    }
+
+    // Destroying a pool frees its command buffers
+    for (MockCommandBuffer* commandBuffer : pool->commandBuffers) {
+        releaseObject(state, commandBuffer);
+    }
+    recordCall(state, "vkDestroyCommandPool", toId(commandPool));
+    releaseObject(state, pool);
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL vkResetCommandPool(VkDevice, VkCommandPool commandPool, VkCommandPoolResetFlags) {
+    State& state = active();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    MockCommandPool* pool = lookup<MockCommandPool>(state, commandPool, "vkResetCommandPool");
+    if (!pool) {
+        return VK_SUCCESS;
+    }
+
+    for (MockCommandBuffer* commandBuffer : pool->commandBuffers) {
+        commandBuffer->state = CommandBufferState::Initial;
+        commandBuffer->clear();
+    }
+    recordCall(state, "vkResetCommandPool", toId(commandPool));
+    return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL vkAllocateCommandBuffers(VkDevice device, const VkCommandBufferAllocateInfo* pAllocateInfo,
+                                                        VkCommandBuffer* pCommandBuffers) {
+    State& state = active();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    MockCommandPool* pool = lookup<MockCommandPool>(state, pAllocateInfo->commandPool, "vkAllocateCommandBuffers");
+    if (!pool) {
+        return VK_ERROR_OUT_OF_HOST_MEMORY;
+    }
+
+    for (uint32_t i = 0; i < pAllocateInfo->commandBufferCount; ++i) {
+        auto* commandBuffer = new MockCommandBuffer(getDevice(device));
+        commandBuffer->pool = pool;
+        pool->commandBuffers.insert(commandBuffer);
+        pCommandBuffers[i] = registerObject<VkCommandBuffer>(state, commandBuffer, "vkAllocateCommandBuffers");
+    }
+    return VK_SUCCESS;
+}
+
+VKAPI_ATTR void VKAPI_CALL vkFreeCommandBuffers(VkDevice, VkCommandPool, uint32_t commandBufferCount,
+                                                const VkCommandBuffer* pCommandBuffers) {
+    State& state = active();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    for (uint32_t i = 0; i < commandBufferCount; ++i) {
+        if (pCommandBuffers[i] == VK_NULL_HANDLE) {
+            continue;
+        }
+        if (auto* commandBuffer = lookup<MockCommandBuffer>(state, pCommandBuffers[i], "vkFreeCommandBuffers")) {
+            commandBuffer->pool->commandBuffers.erase(commandBuffer);
+            recordCall(state, "vkFreeCommandBuffers", toId(pCommandBuffers[i]));
+            releaseObject(state, commandBuffer);
+        }
+    }
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL vkBeginCommandBuffer(VkCommandBuffer commandBuffer, const VkCommandBufferBeginInfo*) {
+    State& state = active();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    auto* mockCommandBuffer = lookup<MockCommandBuffer>(state, commandBuffer, "vkBeginCommandBuffer");
+    if (!mockCommandBuffer) {
+        return VK_SUCCESS;
+    }
+
+    if (mockCommandBuffer->state == CommandBufferState::Recording) {
+        reportError(state, "vkBeginCommandBuffer on a command buffer that is already recording");
+    } else if (mockCommandBuffer->state == CommandBufferState::Executable &&
+               !(mockCommandBuffer->pool->flags & VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT)) {
+        reportError(state, "vkBeginCommandBuffer implicitly resets a command buffer whose pool lacks "
+                           "VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT");
+    }
+
+    mockCommandBuffer->clear();
+    mockCommandBuffer->state = CommandBufferState::Recording;
+    recordCall(state, "vkBeginCommandBuffer", toId(commandBuffer));
+    return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL vkEndCommandBuffer(VkCommandBuffer commandBuffer) {
+    State& state = active();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    auto* mockCommandBuffer = lookup<MockCommandBuffer>(state, commandBuffer, "vkEndCommandBuffer");
+    if (!mockCommandBuffer) {
+        return VK_SUCCESS;
+    }
+
+    if (mockCommandBuffer->state != CommandBufferState::Recording) {
+        reportError(state, "vkEndCommandBuffer on a command buffer that is not recording");
+    }
+    mockCommandBuffer->state = CommandBufferState::Executable;
+    recordCall(state, "vkEndCommandBuffer", toId(commandBuffer));
+    return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL vkResetCommandBuffer(VkCommandBuffer commandBuffer, VkCommandBufferResetFlags) {
+    State& state = active();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    auto* mockCommandBuffer = lookup<MockCommandBuffer>(state, commandBuffer, "vkResetCommandBuffer");
+    if (!mockCommandBuffer) {
+        return VK_SUCCESS;
+    }
+
+    if (!(mockCommandBuffer->pool->flags & VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT)) {
+        reportError(state, "vkResetCommandBuffer on a command buffer whose pool lacks "
+                           "VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT");
+    }
+    mockCommandBuffer->clear();
+    mockCommandBuffer->state = CommandBufferState::Initial;
+    recordCall(state, "vkResetCommandBuffer", toId(commandBuffer));
+    return VK_SUCCESS;
+}
+
+// Fences and semaphores
+
+VKAPI_ATTR VkResult VKAPI_CALL vkCreateFence(VkDevice device, const VkFenceCreateInfo* pCreateInfo,
+                                             const VkAllocationCallbacks*, VkFence* pFence) {
+    State& state = active();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    auto* fence = new MockFence(getDevice(device));
+    fence->signaled = pCreateInfo->flags & VK_FENCE_CREATE_SIGNALED_BIT;
+    *pFence = registerObject<VkFence>(state, fence, "vkCreateFence");
+    return VK_SUCCESS;
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDestroyFence(VkDevice, VkFence fence, const VkAllocationCallbacks*) {
+    if (fence == VK_NULL_HANDLE) {
+        return;
+    }
+
+    State& state = active();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    if (MockFence* mockFence = lookup<MockFence>(state, fence, "vkDestroyFence")) {
+        if (mockFence->pending) {
+            detachFromSubmissions(state, mockFence, "vkDestroyFence");
+        }
+        recordCall(state, "vkDestroyFence", toId(fence));
+        releaseObject(state, mockFence);
+    }
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL vkResetFences(VkDevice, uint32_t fenceCount, const VkFence* pFences) {
+    State& state = active();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    for (uint32_t i = 0; i < fenceCount; ++i) {
+        if (MockFence* fence = lookup<MockFence>(state, pFences[i], "vkResetFences")) {
+            if (fence->pending) {
+                reportError(state, "vkResetFences on a fence used by a pending submission");
+            }
+            fence->signaled = false;
+            recordCall(state, "vkResetFences", toId(pFences[i]));
+        }
+    }
+    return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL vkWaitForFences(VkDevice, uint32_t fenceCount, const VkFence* pFences,
+                                               VkBool32 waitAll, uint64_t timeout) {
+    State& state = active();
+    std::unique_lock<std::mutex> lock(state.mutex);
+    std::vector<MockFence*> fences;
+    for (uint32_t i = 0; i < fenceCount; ++i) {
+        if (MockFence* fence = lookup<MockFence>(state, pFences[i], "vkWaitForFences")) {
+            fences.push_back(fence);
+        }
+    }
+    recordCall(state, "vkWaitForFences", fenceCount > 0 ? toId(pFences[0]) : 0);
+
+    auto done = [&fences](MockFence* fence) { return fence->signaled; };
+    auto possible = [&fences](MockFence* fence) { return fence->signaled || fence->pending; };
+    auto ready = [&] {
+        return waitAll ? std::all_of(fences.begin(), fences.end(), done) : std::any_of(fences.begin(), fences.end(), done);
+    };
+    auto satisfiable = [&] {
+        return waitAll ? std::all_of(fences.begin(), fences.end(), possible)
+                       : std::any_of(fences.begin(), fences.end(), possible);
+    };
+    return waitUntil(state, lock, timeout, ready, satisfiable, "vkWaitForFences");
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL vkGetFenceStatus(VkDevice, VkFence fence) {
+    State& state = active();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    MockFence* mockFence = lookup<MockFence>(state, fence, "vkGetFenceStatus");
+    return mockFence && mockFence->signaled ? VK_SUCCESS : VK_NOT_READY;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL vkCreateSemaphore(VkDevice device, const VkSemaphoreCreateInfo* pCreateInfo,
+                                                 const VkAllocationCallbacks*, VkSemaphore* pSemaphore) {
+    State& state = active();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    auto* semaphore = new MockSemaphore(getDevice(device));
+    auto* typeInfo = findInChain<VkSemaphoreTypeCreateInfo>(pCreateInfo->pNext,
+                                                            VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO);
+    if (typeInfo && typeInfo->semaphoreType == VK_SEMAPHORE_TYPE_TIMELINE) {
+        if (!semaphore->device->timelineSemaphore) {
+            reportError(state, "vkCreateSemaphore creates a timeline semaphore without the timelineSemaphore feature");
+        }
+        semaphore->timeline = true;
+        semaphore->value = typeInfo->initialValue;
+    }
+    *pSemaphore = registerObject<VkSemaphore>(state, semaphore, "vkCreateSemaphore");
+    return VK_SUCCESS;
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDestroySemaphore(VkDevice, VkSemaphore semaphore, const VkAllocationCallbacks*) {
+    if (semaphore == VK_NULL_HANDLE) {
+        return;
+    }
+
+    State& state = active();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    if (MockSemaphore* mockSemaphore = lookup<MockSemaphore>(state, semaphore, "vkDestroySemaphore")) {
+        if (state.pendingSubmissions > 0) {
+            detachFromSubmissions(state, mockSemaphore, "vkDestroySemaphore");
+        }
+        recordCall(state, "vkDestroySemaphore", toId(semaphore));
+        releaseObject(state, mockSemaphore);
+    }
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL vkGetSemaphoreCounterValue(VkDevice, VkSemaphore semaphore, uint64_t* pValue) {
+    State& state = active();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    *pValue = 0;
+    MockSemaphore* mockSemaphore = lookup<MockSemaphore>(state, semaphore, "vkGetSemaphoreCounterValue");
+    if (mockSemaphore && !mockSemaphore->timeline) {
+        reportError(state, "vkGetSemaphoreCounterValue on a binary semaphore");
+    } else if (mockSemaphore) {
+        *pValue = mockSemaphore->value;
+    }
+    return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL vkWaitSemaphores(VkDevice, const VkSemaphoreWaitInfo* pWaitInfo, uint64_t timeout) {
+    State& state = active();
+    std::unique_lock<std::mutex> lock(state.mutex);
+    std::vector<MockSemaphoreOp> waits;
+    for (uint32_t i = 0; i < pWaitInfo->semaphoreCount; ++i) {
+        MockSemaphore* semaphore = lookup<MockSemaphore>(state, pWaitInfo->pSemaphores[i], "vkWaitSemaphores");
+        if (semaphore && !semaphore->timeline) {
+            reportError(state, "vkWaitSemaphores on a binary semaphore");
+        } else if (semaphore) {
+            waits.push_back({semaphore, pWaitInfo->pValues[i]});
+        }
+    }
+    recordCall(state, "vkWaitSemaphores");
+
+    bool waitAny = pWaitInfo->flags & VK_SEMAPHORE_WAIT_ANY_BIT;
+    auto done = [](const MockSemaphoreOp& wait) { return wait.semaphore->value >= wait.value; };
+    auto possible = [](const MockSemaphoreOp& wait) {
+        return wait.semaphore->value >= wait.value || wait.semaphore->pendingSignals > 0;
+    };
+    auto ready = [&] {
+        return waitAny ? std::any_of(waits.begin(), waits.end(), done) : std::all_of(waits.begin(), waits.end(), done);
+    };
+    auto satisfiable = [&] {
+        return waitAny ? std::any_of(waits.begin(), waits.end(), possible)
+                       : std::all_of(waits.begin(), waits.end(), possible);
+    };
+    return waitUntil(state, lock, timeout, ready, satisfiable, "vkWaitSemaphores");
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL vkSignalSemaphore(VkDevice, const VkSemaphoreSignalInfo* pSignalInfo) {
+    State& state = active();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    MockSemaphore* semaphore = lookup<MockSemaphore>(state, pSignalInfo->semaphore, "vkSignalSemaphore");
+    if (!semaphore) {
+        return VK_SUCCESS;
+    }
+
+    if (!semaphore->timeline) {
+        reportError(state, "vkSignalSemaphore on a binary semaphore");
+    } else if (pSignalInfo->value <= semaphore->value) {
+        reportError(state, "vkSignalSemaphore with " + std::to_string(pSignalInfo->value) +
+                           ", not greater than the current value " + std::to_string(semaphore->value));
+    } else {
+        semaphore->value = pSignalInfo->value;
+    }
+    recordCall(state, "vkSignalSemaphore", toId(pSignalInfo->semaphore));
+
+    // A host signal can unblock queued work
+    if (state.autoComplete) {
+        processSubmissions(state, UINT32_MAX);
+    }
+    state.completion.notify_all();
+    return VK_SUCCESS;
+}
+
+// Queries
+
+VKAPI_ATTR VkResult VKAPI_CALL vkCreateQueryPool(VkDevice device, const VkQueryPoolCreateInfo* pCreateInfo,
+                                                 const VkAllocationCallbacks*, VkQueryPool* pQueryPool) {
+    State& state = active();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    auto* pool = new MockQueryPool(getDevice(device));
+    pool->values.assign(pCreateInfo->queryCount, 0);
+    pool->available.assign(pCreateInfo->queryCount, false);
+    *pQueryPool = registerObject<VkQueryPool>(state, pool, "vkCreateQueryPool");
+    return VK_SUCCESS;
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDestroyQueryPool(VkDevice, VkQueryPool queryPool, const VkAllocationCallbacks*) {
+    if (queryPool == VK_NULL_HANDLE) {
+        return;
+    }
+
+    State& state = active();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    if (MockQueryPool* mockPool = lookup<MockQueryPool>(state, queryPool, "vkDestroyQueryPool")) {
+        detachFromSubmissions(state, mockPool, "vkDestroyQueryPool");
+
+        // Recorded but unsubmitted command buffers are merely invalidated
+        for (MockObject* object : state.objects) {
+            if (object->type == MockObjectType::CommandBuffer) {
+                std::erase_if(static_cast<MockCommandBuffer*>(object)->queryOps,
+                              [mockPool](const MockQueryOp& op) { return op.pool == mockPool; });
+            }
+        }
+        recordCall(state, "vkDestroyQueryPool", toId(queryPool));
+        releaseObject(state, mockPool);
+    }
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL vkGetQueryPoolResults(VkDevice, VkQueryPool queryPool, uint32_t firstQuery,
+                                                     uint32_t queryCount, size_t dataSize, void* pData,
+                                                     VkDeviceSize stride, VkQueryResultFlags flags) {
+    State& state = active();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    MockQueryPool* pool = lookup<MockQueryPool>(state, queryPool, "vkGetQueryPoolResults");
+    if (!pool) {
+        return VK_SUCCESS;
+    }
+
+    bool is64Bit = flags & VK_QUERY_RESULT_64_BIT;
+    bool withAvailability = flags & VK_QUERY_RESULT_WITH_AVAILABILITY_BIT;
+    size_t valueSize = is64Bit ? sizeof(uint64_t) : sizeof(uint32_t);
+    size_t resultSize = valueSize * (withAvailability ? 2 : 1);
+    if (firstQuery + queryCount > pool->values.size() || (queryCount > 0 && stride * (queryCount - 1) + resultSize > dataSize)) {
+        reportError(state, "vkGetQueryPoolResults range exceeds the pool or the output buffer");
+        return VK_SUCCESS;
+    }
+
+    VkResult result = VK_SUCCESS;
+    auto* output = static_cast<uint8_t*>(pData);
+    for (uint32_t i = 0; i < queryCount; ++i) {
+        uint32_t query = firstQuery + i;
+        uint8_t* slot = output + stride * i;
+        bool available = pool->available[query];
+        if (!available) {
+            if (flags & VK_QUERY_RESULT_WAIT_BIT) {
+                reportError(state, "vkGetQueryPoolResults waits on a query no pending submission will write");
+                return VK_ERROR_DEVICE_LOST;
+            }
+            result = VK_NOT_READY;
+        }
+
+        uint64_t values[2] = {pool->values[query], available ? 1u : 0u};
+        for (int v = 0; v < (withAvailability ? 2 : 1); ++v) {
+            if (v == 0 && !available) {
+                continue;   // Unavailable results are left untouched
+            }
+            if (is64Bit) {
+                std::memcpy(slot + v * valueSize, &values[v], sizeof(uint64_t));
+            } else {
+                uint32_t narrow = static_cast<uint32_t>(values[v]);
+                std::memcpy(slot + v * valueSize, &narrow, sizeof(uint32_t));
+            }
+        }
+    }
+    return result;
+}
+
+// Swapchain
+
+VKAPI_ATTR VkResult VKAPI_CALL vkCreateSwapchainKHR(VkDevice device, const VkSwapchainCreateInfoKHR* pCreateInfo,
+                                                    const VkAllocationCallbacks*, VkSwapchainKHR* pSwapchain) {
+    State& state = active();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    MockDevice* mockDevice = getDevice(device);
+
+    auto* swapchain = new MockSwapchain(mockDevice);
+    for (uint32_t i = 0; i < std::max(pCreateInfo->minImageCount, 2u); ++i) {
+        auto* image = new MockImage(mockDevice);
+        image->format = pCreateInfo->imageFormat;
+        image->extent = {pCreateInfo->imageExtent.width, pCreateInfo->imageExtent.height, 1};
+        image->ownedBySwapchain = true;
+        state.objects.insert(image);
+        mockDevice->liveObjects++;
+        swapchain->images.push_back(image);
+    }
+    *pSwapchain = registerObject<VkSwapchainKHR>(state, swapchain, "vkCreateSwapchainKHR");
+    return VK_SUCCESS;
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDestroySwapchainKHR(VkDevice, VkSwapchainKHR swapchain, const VkAllocationCallbacks*) {
+    if (swapchain == VK_NULL_HANDLE) {
+        return;
+    }
+
+    State& state = active();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    MockSwapchain* mockSwapchain = lookup<MockSwapchain>(state, swapchain, "vkDestroySwapchainKHR");
+    if (!mockSwapchain) {
+        return;
+    }
+
+    for (MockImage* image : mockSwapchain->images) {
+        releaseObject(state, image);
+    }
+    recordCall(state, "vkDestroySwapchainKHR", toId(swapchain));
+    releaseObject(state, mockSwapchain);
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL vkGetSwapchainImagesKHR(VkDevice, VkSwapchainKHR swapchain, uint32_t* pCount,
+                                                       VkImage* pImages) {
+    State& state = active();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    MockSwapchain* mockSwapchain = lookup<MockSwapchain>(state, swapchain, "vkGetSwapchainImagesKHR");
+    if (!mockSwapchain) {
+        *pCount = 0;
+        return VK_SUCCESS;
+    }
+
+    std::vector<VkImage> images;
+    for (MockImage* image : mockSwapchain->images) {
+        images.push_back(toHandle<VkImage>(image));
+    }
+    return enumerate(images, pCount, pImages);
+}
+
+// Images are handed out round robin and are available immediately
+VKAPI_ATTR VkResult VKAPI_CALL vkAcquireNextImageKHR(VkDevice, VkSwapchainKHR swapchain, uint64_t,
+                                                     VkSemaphore semaphore, VkFence fence, uint32_t* pImageIndex) {
+    State& state = active();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    MockSwapchain* mockSwapchain = lookup<MockSwapchain>(state, swapchain, "vkAcquireNextImageKHR");
+    if (!mockSwapchain) {
+        return VK_ERROR_OUT_OF_DATE_KHR;
+    }
+
+    *pImageIndex = mockSwapchain->nextImage;
+    mockSwapchain->nextImage = (mockSwapchain->nextImage + 1) % static_cast<uint32_t>(mockSwapchain->images.size());
+
+    if (semaphore != VK_NULL_HANDLE) {
+        if (MockSemaphore* mockSemaphore = lookup<MockSemaphore>(state, semaphore, "vkAcquireNextImageKHR")) {
+            if (mockSemaphore->signaled) {
+                reportError(state, "vkAcquireNextImageKHR with a semaphore that is already signaled");
+            }
+            mockSemaphore->signaled = true;
+        }
+    }
+    if (fence != VK_NULL_HANDLE) {
+        if (MockFence* mockFence = lookup<MockFence>(state, fence, "vkAcquireNextImageKHR")) {
+            mockFence->signaled = true;
+        }
+    }
+
+    recordCall(state, "vkAcquireNextImageKHR", toId(swapchain));
+    state.completion.notify_all();
+    return VK_SUCCESS;
+}
+
+// Presentation consumes the wait semaphores; the image is returned at once
+VKAPI_ATTR VkResult VKAPI_CALL vkQueuePresentKHR(VkQueue queue, const VkPresentInfoKHR* pPresentInfo) {
+    State& state = active();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    for (uint32_t i = 0; i < pPresentInfo->waitSemaphoreCount; ++i) {
+        MockSemaphore* semaphore = lookup<MockSemaphore>(state, pPresentInfo->pWaitSemaphores[i], "vkQueuePresentKHR");
+        if (semaphore && !semaphore->signaled && semaphore->pendingSignals == 0) {
+            reportError(state, "vkQueuePresentKHR waits on a semaphore nothing will signal");
+        }
+        if (semaphore) {
+            semaphore->signaled = false;
+        }
+    }
+    for (uint32_t i = 0; i < pPresentInfo->swapchainCount; ++i) {
+        lookup<MockSwapchain>(state, pPresentInfo->pSwapchains[i], "vkQueuePresentKHR");
+        if (pPresentInfo->pResults) {
+            pPresentInfo->pResults[i] = VK_SUCCESS;
+        }
+    }
+    recordCall(state, "vkQueuePresentKHR", toId(queue));
+    return VK_SUCCESS;
+}
+
+// Commands
+//
+// Recording touches only the command buffer, which the caller synchronizes,
+// so these take no lock unless they have an error to report.
+
+void recordCommand(VkCommandBuffer commandBuffer, const char* function, uint32_t count = 0) {
+    MockCommandBuffer* mockCommandBuffer = getCommandBuffer(commandBuffer);
+    if (mockCommandBuffer->state != CommandBufferState::Recording) {
+        State& state = active();
+        std::lock_guard<std::mutex> lock(state.mutex);
+        reportError(state, std::string(function) + " on a command buffer that is not recording");
+    }
+    if (active().recordCalls.load(std::memory_order_relaxed)) {
+        mockCommandBuffer->commands.push_back({function, count});
+    }
+}
+
+VKAPI_ATTR void VKAPI_CALL vkCmdBeginRenderPass(VkCommandBuffer commandBuffer, const VkRenderPassBeginInfo*,
+                                                VkSubpassContents) {
+    recordCommand(commandBuffer, "vkCmdBeginRenderPass");
+}
+
+VKAPI_ATTR void VKAPI_CALL vkCmdEndRenderPass(VkCommandBuffer commandBuffer) {
+    recordCommand(commandBuffer, "vkCmdEndRenderPass");
+}
+
+VKAPI_ATTR void VKAPI_CALL vkCmdBindPipeline(VkCommandBuffer commandBuffer, VkPipelineBindPoint, VkPipeline) {
+    recordCommand(commandBuffer, "vkCmdBindPipeline");
+}
+
+VKAPI_ATTR void VKAPI_CALL vkCmdBindVertexBuffers(VkCommandBuffer commandBuffer, uint32_t, uint32_t bindingCount,
+                                                  const VkBuffer*, const VkDeviceSize*) {
+    recordCommand(commandBuffer, "vkCmdBindVertexBuffers", bindingCount);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkCmdBindIndexBuffer(VkCommandBuffer commandBuffer, VkBuffer, VkDeviceSize, VkIndexType) {
+    recordCommand(commandBuffer, "vkCmdBindIndexBuffer");
+}
+
+VKAPI_ATTR void VKAPI_CALL vkCmdBindDescriptorSets(VkCommandBuffer commandBuffer, VkPipelineBindPoint, VkPipelineLayout,
+                                                   uint32_t, uint32_t descriptorSetCount, const VkDescriptorSet*,
+                                                   uint32_t, const uint32_t*) {
+    recordCommand(commandBuffer, "vkCmdBindDescriptorSets", descriptorSetCount);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkCmdPushConstants(VkCommandBuffer commandBuffer, VkPipelineLayout, VkShaderStageFlags,
+                                              uint32_t, uint32_t size, const void*) {
+    recordCommand(commandBuffer, "vkCmdPushConstants", size);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkCmdSetViewport(VkCommandBuffer commandBuffer, uint32_t, uint32_t viewportCount,
+                                            const VkViewport*) {
+    recordCommand(commandBuffer, "vkCmdSetViewport", viewportCount);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkCmdSetScissor(VkCommandBuffer commandBuffer, uint32_t, uint32_t scissorCount,
+                                           const VkRect2D*) {
+    recordCommand(commandBuffer, "vkCmdSetScissor", scissorCount);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkCmdSetLineWidth(VkCommandBuffer commandBuffer, float) {
+    recordCommand(commandBuffer, "vkCmdSetLineWidth");
+}
+
+VKAPI_ATTR void VKAPI_CALL vkCmdSetDepthBias(VkCommandBuffer commandBuffer, float, float, float) {
+    recordCommand(commandBuffer, "vkCmdSetDepthBias");
+}
+
+VKAPI_ATTR void VKAPI_CALL vkCmdDraw(VkCommandBuffer commandBuffer, uint32_t vertexCount, uint32_t, uint32_t, uint32_t) {
+    recordCommand(commandBuffer, "vkCmdDraw", vertexCount);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkCmdDrawIndexed(VkCommandBuffer commandBuffer, uint32_t indexCount, uint32_t, uint32_t,
+                                            int32_t, uint32_t) {
+    recordCommand(commandBuffer, "vkCmdDrawIndexed", indexCount);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkCmdDispatch(VkCommandBuffer commandBuffer, uint32_t groupCountX, uint32_t groupCountY,
+                                         uint32_t groupCountZ) {
+    recordCommand(commandBuffer, "vkCmdDispatch", groupCountX * groupCountY * groupCountZ);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkCmdPipelineBarrier(VkCommandBuffer commandBuffer, VkPipelineStageFlags srcStageMask,
+                                                VkPipelineStageFlags dstStageMask, VkDependencyFlags,
+                                                uint32_t memoryBarrierCount, const VkMemoryBarrier* pMemoryBarriers,
+                                                uint32_t bufferMemoryBarrierCount,
+                                                const VkBufferMemoryBarrier* pBufferMemoryBarriers,
+                                                uint32_t imageMemoryBarrierCount,
+                                                const VkImageMemoryBarrier* pImageMemoryBarriers) {
+    recordCommand(commandBuffer, "vkCmdPipelineBarrier",
+                  memoryBarrierCount + bufferMemoryBarrierCount + imageMemoryBarrierCount);
+    if (!active().recordCalls.load(std::memory_order_relaxed)) {
+        return;
+    }
+
+    MockVulkanBarrier barrier;
+    barrier.srcStageMask = srcStageMask;
+    barrier.dstStageMask = dstStageMask;
+    barrier.memoryBarriers.assign(pMemoryBarriers, pMemoryBarriers + memoryBarrierCount);
+    barrier.bufferBarriers.assign(pBufferMemoryBarriers, pBufferMemoryBarriers + bufferMemoryBarrierCount);
+    barrier.imageBarriers.assign(pImageMemoryBarriers, pImageMemoryBarriers + imageMemoryBarrierCount);
+    for (auto& memoryBarrier : barrier.memoryBarriers) {
+        memoryBarrier.pNext = nullptr;
+    }
+    for (auto& bufferBarrier : barrier.bufferBarriers) {
+        bufferBarrier.pNext = nullptr;
+    }
+    for (auto& imageBarrier : barrier.imageBarriers) {
+        imageBarrier.pNext = nullptr;
+    }
+    getCommandBuffer(commandBuffer)->barriers.push_back(std::move(barrier));
+}
+
+VKAPI_ATTR void VKAPI_CALL vkCmdCopyBuffer(VkCommandBuffer commandBuffer, VkBuffer, VkBuffer, uint32_t regionCount,
+                                           const VkBufferCopy*) {
+    recordCommand(commandBuffer, "vkCmdCopyBuffer", regionCount);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkCmdCopyBufferToImage(VkCommandBuffer commandBuffer, VkBuffer, VkImage, VkImageLayout,
+                                                  uint32_t regionCount, const VkBufferImageCopy*) {
+    recordCommand(commandBuffer, "vkCmdCopyBufferToImage", regionCount);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkCmdCopyImageToBuffer(VkCommandBuffer commandBuffer, VkImage, VkImageLayout, VkBuffer,
+                                                  uint32_t regionCount, const VkBufferImageCopy*) {
+    recordCommand(commandBuffer, "vkCmdCopyImageToBuffer", regionCount);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkCmdBlitImage(VkCommandBuffer commandBuffer, VkImage, VkImageLayout, VkImage, VkImageLayout,
+                                          uint32_t regionCount, const VkImageBlit*, VkFilter) {
+    recordCommand(commandBuffer, "vkCmdBlitImage", regionCount);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkCmdClearColorImage(VkCommandBuffer commandBuffer, VkImage, VkImageLayout,
+                                                const VkClearColorValue*, uint32_t rangeCount,
+                                                const VkImageSubresourceRange*) {
+    recordCommand(commandBuffer, "vkCmdClearColorImage", rangeCount);
+}
+
+void recordQueryOp(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount,
+                   bool reset, const char* function) {
+    State& state = active();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    MockQueryPool* pool = lookup<MockQueryPool>(state, queryPool, function);
+    if (!pool) {
+        return;
+    }
+    if (firstQuery + queryCount > pool->values.size()) {
+        reportError(state, std::string(function) + " range exceeds the query pool");
+        return;
+    }
+    getCommandBuffer(commandBuffer)->queryOps.push_back({pool, firstQuery, queryCount, reset});
+}
+
+VKAPI_ATTR void VKAPI_CALL vkCmdResetQueryPool(VkCommandBuffer commandBuffer, VkQueryPool queryPool,
+                                               uint32_t firstQuery, uint32_t queryCount) {
+    recordCommand(commandBuffer, "vkCmdResetQueryPool", queryCount);
+    recordQueryOp(commandBuffer, queryPool, firstQuery, queryCount, true, "vkCmdResetQueryPool");
+}
+
+VKAPI_ATTR void VKAPI_CALL vkCmdWriteTimestamp(VkCommandBuffer commandBuffer, VkPipelineStageFlagBits,
+                                               VkQueryPool queryPool, uint32_t query) {
+    recordCommand(commandBuffer, "vkCmdWriteTimestamp");
+    recordQueryOp(commandBuffer, queryPool, query, 1, false, "vkCmdWriteTimestamp");
+}
+
+// Name lookup; the static_cast checks each entry point against its PFN type
+
+struct NamedFunction {
+    const char* name;
+    PFN_vkVoidFunction function;
+};
+
+#define VORTEX_MOCK_ENTRY(name) {#name, reinterpret_cast<PFN_vkVoidFunction>(static_cast<PFN_##name>(&MockEntry::name))},
+const NamedFunction INSTANCE_FUNCTIONS[] = {
+    VORTEX_MOCK_ENTRY(vkGetInstanceProcAddr)
+    VORTEX_VK_GLOBAL_FUNCTIONS(VORTEX_MOCK_ENTRY)
+    VORTEX_VK_INSTANCE_FUNCTIONS(VORTEX_MOCK_ENTRY)
+};
+const NamedFunction DEVICE_FUNCTIONS[] = {
+    VORTEX_VK_DEVICE_FUNCTIONS(VORTEX_MOCK_ENTRY)
+};
+#undef VORTEX_MOCK_ENTRY
+
+// Stand-ins for the loader's trampolines: find the table through the
+// dispatchable handle, then call through it
+const PFN_vkVoidFunction* getDispatch(VkDevice device) {
+    return static_cast<MockDevice*>(toObject(device))->dispatch;
+}
+
+const PFN_vkVoidFunction* getDispatch(VkQueue queue) {
+    return getQueue(queue)->dispatch;
+}
+
+const PFN_vkVoidFunction* getDispatch(VkCommandBuffer commandBuffer) {
+    return getCommandBuffer(commandBuffer)->dispatch;
+}
+
+template<typename Function, size_t Slot>
+struct Trampoline;
+
+template<typename Result, typename Handle, typename... Args, size_t Slot>
+struct Trampoline<Result (VKAPI_PTR*)(Handle, Args...), Slot> {
+    static VKAPI_ATTR Result VKAPI_CALL call(Handle handle, Args... args) {
+        auto function = reinterpret_cast<Result (VKAPI_PTR*)(Handle, Args...)>(getDispatch(handle)[Slot]);
+        return function(handle, args...);
+    }
+};
+
+#define VORTEX_MOCK_TRAMPOLINE(name) {#name, reinterpret_cast<PFN_vkVoidFunction>(&Trampoline<PFN_##name, SLOT_##name>::call)},
+const NamedFunction DEVICE_TRAMPOLINES[] = {
+    VORTEX_VK_DEVICE_FUNCTIONS(VORTEX_MOCK_TRAMPOLINE)
+};
+#undef VORTEX_MOCK_TRAMPOLINE
+
+template<size_t Count>
+PFN_vkVoidFunction findFunction(const NamedFunction (&functions)[Count], const char* name) {
+    for (const NamedFunction& entry : functions) {
+        if (std::strcmp(entry.name, name) == 0) {
+            return entry.function;
+        }
+    }
+    return nullptr;
+}
+
+PFN_vkVoidFunction lookupInstanceFunction(const char* name) {
+    PFN_vkVoidFunction function = findFunction(INSTANCE_FUNCTIONS, name);
+    return function ? function : findFunction(DEVICE_TRAMPOLINES, name);
+}
+
+PFN_vkVoidFunction lookupDeviceFunction(const char* name) {
+    return findFunction(DEVICE_FUNCTIONS, name);
+}
+
+} // namespace MockEntry
+
+const PFN_vkVoidFunction* getDeviceTable() {
+    static const auto table = [] {
+        std::array<PFN_vkVoidFunction, DEVICE_FUNCTION_COUNT> functions{};
+        for (size_t i = 0; i < DEVICE_FUNCTION_COUNT; ++i) {
+            functions[i] = MockEntry::DEVICE_FUNCTIONS[i].function;
+        }
+        return functions;
+    }();
+    return table.data();
+}
+
+} // namespace
+
+// Configurations
+
+MockVulkanConfig MockVulkanConfig::discreteGpu() {
+    MockVulkanConfig config;
+
+    VkPhysicalDeviceProperties& properties = config.properties;
+    properties.apiVersion = VK_API_VERSION_1_3;
+    properties.deviceType = VK_PHYSICAL_DEVICE_TYPE_DISCRETE_GPU;
+    std::strncpy(properties.deviceName, "Vortex Mock Discrete GPU", VK_MAX_PHYSICAL_DEVICE_NAME_SIZE - 1);
+    properties.limits.maxMemoryAllocationCount = 4096;
+    properties.limits.bufferImageGranularity = 1024;
+    properties.limits.minUniformBufferOffsetAlignment = 256;
+    properties.limits.minStorageBufferOffsetAlignment = 64;
+    properties.limits.nonCoherentAtomSize = 64;
+    properties.limits.timestampPeriod = 1.0f;
+    properties.limits.timestampComputeAndGraphics = VK_TRUE;
+
+    // VRAM, system memory, and the CPU-visible window into VRAM
+    VkPhysicalDeviceMemoryProperties& memory = config.memoryProperties;
+    memory.memoryHeapCount = 3;
+    memory.memoryHeaps[0] = {8 * GiB, VK_MEMORY_HEAP_DEVICE_LOCAL_BIT};
+    memory.memoryHeaps[1] = {16 * GiB, 0};
+    memory.memoryHeaps[2] = {256 * MiB, VK_MEMORY_HEAP_DEVICE_LOCAL_BIT};
+
+    memory.memoryTypeCount = 4;
+    memory.memoryTypes[0] = {VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, 0};
+    memory.memoryTypes[1] = {VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, 1};
+    memory.memoryTypes[2] = {VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT |
+                             VK_MEMORY_PROPERTY_HOST_CACHED_BIT, 1};
+    memory.memoryTypes[3] = {VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT | VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT |
+                             VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, 2};
+
+    config.queueFamilies = {
+        {VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT, 4, 64, {1, 1, 1}},
+        {VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT, 2, 64, {1, 1, 1}},
+        {VK_QUEUE_TRANSFER_BIT, 1, 64, {1, 1, 1}}
+    };
+    config.deviceExtensions = {VK_KHR_SWAPCHAIN_EXTENSION_NAME};
+    return config;
+}
+
+MockVulkanConfig MockVulkanConfig::integratedGpu() {
+    MockVulkanConfig config = discreteGpu();
+    config.properties.deviceType = VK_PHYSICAL_DEVICE_TYPE_INTEGRATED_GPU;
+    std::strncpy(config.properties.deviceName, "Vortex Mock Integrated GPU", VK_MAX_PHYSICAL_DEVICE_NAME_SIZE - 1);
+
+    VkPhysicalDeviceMemoryProperties& memory = config.memoryProperties;
+    memory = {};
+    memory.memoryHeapCount = 1;
+    memory.memoryHeaps[0] = {4 * GiB, VK_MEMORY_HEAP_DEVICE_LOCAL_BIT};
+    memory.memoryTypeCount = 2;
+    memory.memoryTypes[0] = {VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT | VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT |
+                             VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, 0};
+    memory.memoryTypes[1] = {VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT | VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT |
+                             VK_MEMORY_PROPERTY_HOST_COHERENT_BIT | VK_MEMORY_PROPERTY_HOST_CACHED_BIT, 0};
+
+    config.queueFamilies = {
+        {VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT, 1, 64, {1, 1, 1}}
+    };
+    return config;
+}
+
+// MockVulkanDevice
+
+MockVulkanDevice::MockVulkanDevice(const MockVulkanConfig& config) : m_state(std::make_unique<State>()) {
+    m_state->config = config;
+    m_state->heapUsage.assign(config.memoryProperties.memoryHeapCount, 0);
+    m_state->autoComplete = config.autoCompleteSubmissions;
+    m_state->recordCalls = config.recordCalls;
+}
+
+MockVulkanDevice::~MockVulkanDevice() {
+    uninstall();
+
+    // Whatever the test leaked; devices own their queues
+    for (MockObject* object : m_state->objects) {
+        delete object;
+    }
+}
+
+bool MockVulkanDevice::install() {
+    if (g_active && g_active != m_state.get()) {
+        std::cerr << "Another mock Vulkan device is already installed" << std::endl;
+        return false;
+    }
+
+    g_active = m_state.get();
+    if (!loadVulkanGlobalFunctions(getInstanceProcAddr())) {
+        g_active = nullptr;
+        return false;
+    }
+    loadVulkanInstanceFunctions(m_state->getInstance());
+    return true;
+}
+
+void MockVulkanDevice::uninstall() {
+    if (g_active == m_state.get()) {
+        resetVulkanDispatch();
+        g_active = nullptr;
+    }
+}
+
+bool MockVulkanDevice::isInstalled() const {
+    return g_active == m_state.get();
+}
+
+PFN_vkGetInstanceProcAddr MockVulkanDevice::getInstanceProcAddr() {
+    return &MockEntry::vkGetInstanceProcAddr;
+}
+
+VkInstance MockVulkanDevice::getInstance() const {
+    return m_state->getInstance();
+}
+
+VkPhysicalDevice MockVulkanDevice::getPhysicalDevice() const {
+    return m_state->getPhysicalDevice();
+}
+
+VkDevice MockVulkanDevice::getDevice() {
+    if (!isInstalled()) {
+        std::cerr << "Mock Vulkan device must be installed before use" << std::endl;
+        return VK_NULL_HANDLE;
+    }
+    if (m_state->defaultDevice) {
+        return toHandle<VkDevice>(m_state->defaultDevice);
+    }
+
+    // Every queue of every family, so any family index a test picks is valid
+    const auto& families = m_state->config.queueFamilies;
+    std::vector<std::vector<float>> priorities(families.size());
+    std::vector<VkDeviceQueueCreateInfo> queueInfos(families.size());
+    for (uint32_t i = 0; i < families.size(); ++i) {
+        priorities[i].assign(families[i].queueCount, 1.0f);
+        queueInfos[i].sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
+        queueInfos[i].queueFamilyIndex = i;
+        queueInfos[i].queueCount = families[i].queueCount;
+        queueInfos[i].pQueuePriorities = priorities[i].data();
+    }
+
+    // Every supported feature too
+    VkPhysicalDeviceTimelineSemaphoreFeatures timelineFeatures{};
+    timelineFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_FEATURES;
+    timelineFeatures.timelineSemaphore = m_state->config.timelineSemaphore ? VK_TRUE : VK_FALSE;
+
+    VkDeviceCreateInfo createInfo{};
+    createInfo.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
+    createInfo.pNext = &timelineFeatures;
+    createInfo.pEnabledFeatures = &m_state->config.features;
+    createInfo.queueCreateInfoCount = static_cast<uint32_t>(queueInfos.size());
+    createInfo.pQueueCreateInfos = queueInfos.data();
+
+    VkDevice device = VK_NULL_HANDLE;
+    if (MockEntry::vkCreateDevice(getPhysicalDevice(), &createInfo, nullptr, &device) != VK_SUCCESS) {
+        return VK_NULL_HANDLE;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_state->mutex);
+        m_state->defaultDevice = static_cast<MockDevice*>(toObject(device));
+    }
+    loadVulkanDeviceFunctions(device);
+    return device;
+}
+
+VkQueue MockVulkanDevice::getQueue(uint32_t familyIndex, uint32_t queueIndex) {
+    VkDevice device = getDevice();
+    VkQueue queue = VK_NULL_HANDLE;
+    if (device != VK_NULL_HANDLE) {
+        MockEntry::vkGetDeviceQueue(device, familyIndex, queueIndex, &queue);
+    }
+    return queue;
+}
+
+const MockVulkanConfig& MockVulkanDevice::getConfig() const {
+    return m_state->config;
+}
+
+// Simulated GPU progress
+
+void MockVulkanDevice::setAutoCompleteSubmissions(bool autoComplete) {
+    std::lock_guard<std::mutex> lock(m_state->mutex);
+    m_state->autoComplete = autoComplete;
+    if (autoComplete) {
+        processSubmissions(*m_state, UINT32_MAX);
+    }
+}
+
+uint32_t MockVulkanDevice::completeSubmissions(uint32_t maxCount) {
+    std::lock_guard<std::mutex> lock(m_state->mutex);
+    return processSubmissions(*m_state, maxCount);
+}
+
+size_t MockVulkanDevice::getPendingSubmissionCount() const {
+    std::lock_guard<std::mutex> lock(m_state->mutex);
+    return m_state->pendingSubmissions;
+}
+
+// Call recording
+
+void MockVulkanDevice::setCallRecording(bool record) {
+    m_state->recordCalls = record;
+}
+
+std::vector<MockVulkanCall> MockVulkanDevice::getCalls() const {
+    std::lock_guard<std::mutex> lock(m_state->mutex);
+    return m_state->calls;
+}
+
+uint64_t MockVulkanDevice::getCallCount(const char* function) const {
+    std::lock_guard<std::mutex> lock(m_state->mutex);
+    return std::count_if(m_state->calls.begin(), m_state->calls.end(), [function](const MockVulkanCall& call) {
+        return std::strcmp(call.function, function) == 0;
+    });
+}
+
+void MockVulkanDevice::clearCalls() {
+    std::lock_guard<std::mutex> lock(m_state->mutex);
+    m_state->calls.clear();
+}
+
+std::vector<MockVulkanCommand> MockVulkanDevice::getCommands(VkCommandBuffer commandBuffer) const {
+    std::lock_guard<std::mutex> lock(m_state->mutex);
+    auto* mockCommandBuffer = lookup<MockCommandBuffer>(*m_state, commandBuffer, "getCommands");
+    return mockCommandBuffer ? mockCommandBuffer->commands : std::vector<MockVulkanCommand>{};
+}
+
+std::vector<MockVulkanBarrier> MockVulkanDevice::getBarriers(VkCommandBuffer commandBuffer) const {
+    std::lock_guard<std::mutex> lock(m_state->mutex);
+    auto* mockCommandBuffer = lookup<MockCommandBuffer>(*m_state, commandBuffer, "getBarriers");
+    return mockCommandBuffer ? mockCommandBuffer->barriers : std::vector<MockVulkanBarrier>{};
+}
+
+// Simulated state
+
+VkDeviceSize MockVulkanDevice::getHeapUsage(uint32_t heapIndex) const {
+    std::lock_guard<std::mutex> lock(m_state->mutex);
+    return heapIndex < m_state->heapUsage.size() ? m_state->heapUsage[heapIndex] : 0;
+}
+
+uint32_t MockVulkanDevice::getAllocationCount() const {
+    std::lock_guard<std::mutex> lock(m_state->mutex);
+    return m_state->allocationCount;
+}
+
+uint64_t MockVulkanDevice::getLiveObjectCount() const {
+    std::lock_guard<std::mutex> lock(m_state->mutex);
+    uint64_t count = 0;
+    for (MockDevice* device : m_state->devices) {
+        count += device->liveObjects;
+    }
+    return count;
+}
+
+bool MockVulkanDevice::isFenceSignaled(VkFence fence) const {
+    std::lock_guard<std::mutex> lock(m_state->mutex);
+    MockFence* mockFence = lookup<MockFence>(*m_state, fence, "isFenceSignaled");
+    return mockFence && mockFence->signaled;
+}
+
+uint64_t MockVulkanDevice::getSemaphoreValue(VkSemaphore semaphore) const {
+    std::lock_guard<std::mutex> lock(m_state->mutex);
+    MockSemaphore* mockSemaphore = lookup<MockSemaphore>(*m_state, semaphore, "getSemaphoreValue");
+    if (!mockSemaphore) {
+        return 0;
+    }
+    return mockSemaphore->timeline ? mockSemaphore->value : (mockSemaphore->signaled ? 1 : 0);
+}
+
+std::vector<std::string> MockVulkanDevice::getErrors() const {
+    std::lock_guard<std::mutex> lock(m_state->mutex);
+    return m_state->errors;
+}
+
+void MockVulkanDevice::clearErrors() {
+    std::lock_guard<std::mutex> lock(m_state->mutex);
+    m_state->errors.clear();
+}
+
+} // namespace VortexEngine
@@ -0,0 +1,124 @@
+#pragma once
+
+#include "vulkan_dispatch.h"
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace VortexEngine {
+
+// A device-level call seen by the mock
+struct MockVulkanCall {
+    const char* function;   // Entry point, e.g. "vkAllocateMemory"
+    uint64_t handle;        // Object created or operated on, 0 if none
+};
+
+// A command recorded into a command buffer
+struct MockVulkanCommand {
+    const char* function;   // Entry point, e.g. "vkCmdDrawIndexed"
+    uint32_t count;         // Vertices or indices drawn, regions copied, barriers recorded; otherwise 0
+};
+
+// A vkCmdPipelineBarrier call with its barrier arrays copied out (pNext cleared)
+struct MockVulkanBarrier {
+    VkPipelineStageFlags srcStageMask = 0;
+    VkPipelineStageFlags dstStageMask = 0;
+    std::vector<VkMemoryBarrier> memoryBarriers;
+    std::vector<VkBufferMemoryBarrier> bufferBarriers;
+    std::vector<VkImageMemoryBarrier> imageBarriers;
+};
+
+// What the mock reports as its physical device
+struct MockVulkanConfig {
+    VkPhysicalDeviceProperties properties{};
+    VkPhysicalDeviceFeatures features{};
+    VkPhysicalDeviceMemoryProperties memoryProperties{};
+    std::vector<VkQueueFamilyProperties> queueFamilies;
+    std::vector<std::string> deviceExtensions;
+    bool timelineSemaphore = true;         // Reported through vkGetPhysicalDeviceFeatures2
+
+    bool autoCompleteSubmissions = true;   // Submissions finish as soon as their waits are met
+    bool recordCalls = true;               // Keep the call log and per-command-buffer commands
+
+    // Separate VRAM, host and BAR heaps; graphics, async compute and transfer-only families
+    static MockVulkanConfig discreteGpu();
+    // One device-local heap that is also host visible; a single general queue family
+    static MockVulkanConfig integratedGpu();
+};
+
+// A Vulkan implementation that runs on the CPU
+//
+// install() points the engine's dispatch table at the mock; from then on
+// MemoryManager, BufferAllocator, CommandBuffer, SyncObjects and the rest
+// run without a driver, either on the handles returned here or through a
+// VulkanContext initialized afterwards. Allocations are checked against the
+// configured heaps and limits and mapped memory is real host memory.
+// Commands are recorded, not executed. A submission signals its semaphores
+// and fence once its waits are met, either immediately or when
+// completeSubmissions() is called, so frame pacing and cross-queue waits can
+// be stepped by hand.
+//
+// Device functions resolved through the instance go through loader-style
+// trampolines that dispatch on the handle; vkGetDeviceProcAddr returns the
+// implementation itself, so both dispatch paths can be measured.
+//
+// Misuse a driver would not report (binding past the end of an allocation,
+// mapping device-only memory, destroying a handle twice, unflushed ranges
+// that break nonCoherentAtomSize) is printed and collected in getErrors().
+//
+// The dispatch table is global, so only one mock can be installed at a time.
+class MockVulkanDevice {
+public:
+    explicit MockVulkanDevice(const MockVulkanConfig& config = MockVulkanConfig::discreteGpu());
+    ~MockVulkanDevice();
+
+    MockVulkanDevice(const MockVulkanDevice&) = delete;
+    MockVulkanDevice& operator=(const MockVulkanDevice&) = delete;
+
+    // Installation
+    bool install();
+    void uninstall();
+    bool isInstalled() const;
+    static PFN_vkGetInstanceProcAddr getInstanceProcAddr();
+
+    // Handles for code that does not go through VulkanContext; getDevice()
+    // creates a device with every queue of every family on first use and,
+    // like VulkanContext, loads its device functions into the dispatch table
+    VkInstance getInstance() const;
+    VkPhysicalDevice getPhysicalDevice() const;
+    VkDevice getDevice();
+    VkQueue getQueue(uint32_t familyIndex, uint32_t queueIndex = 0);
+    const MockVulkanConfig& getConfig() const;
+
+    // Simulated GPU progress
+    void setAutoCompleteSubmissions(bool autoComplete);
+    uint32_t completeSubmissions(uint32_t maxCount = UINT32_MAX);
+    size_t getPendingSubmissionCount() const;
+
+    // Call recording
+    void setCallRecording(bool record);
+    std::vector<MockVulkanCall> getCalls() const;
+    uint64_t getCallCount(const char* function) const;
+    void clearCalls();
+    std::vector<MockVulkanCommand> getCommands(VkCommandBuffer commandBuffer) const;
+    std::vector<MockVulkanBarrier> getBarriers(VkCommandBuffer commandBuffer) const;
+
+    // Simulated state
+    VkDeviceSize getHeapUsage(uint32_t heapIndex) const;
+    uint32_t getAllocationCount() const;
+    uint64_t getLiveObjectCount() const;
+    bool isFenceSignaled(VkFence fence) const;
+    uint64_t getSemaphoreValue(VkSemaphore semaphore) const;
+
+    // Misuse detected so far
+    std::vector<std::string> getErrors() const;
+    void clearErrors();
+
+    struct State;
+
+private:
+    std::unique_ptr<State> m_state;
+};
+
+} // namespace VortexEngine
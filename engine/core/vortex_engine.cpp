@@ -1,6 +1,11 @@
 #include "vortex_engine.h"
+#include "../utils/image_writer.h"
 #include <iostream>
+#include <algorithm>
 #include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <filesystem>
 
 namespace VortexEngine {
 
@@ -19,11 +24,14 @@ bool VortexEngine::initialize() {
     }
 
     try {
-        // Initialize logger first
-        m_logger = std::make_unique<Logger>();
-        if (!m_logger->initialize()) {
-            VORTEX_ERROR("Failed to initialize logger");
-            return false;
+        // Initialize logger first; the VORTEX_* macros log through the singleton
+        Logger& logger = Logger::getInstance();
+        if (!logger.isWriterRunning()) {
+            if (!logger.initialize()) {
+                VORTEX_ERROR("Failed to initialize logger");
+                return false;
+            }
+            m_ownsLogger = true;
         }
 
         VORTEX_INFO("Logger initialized successfully");
@@ -39,7 +47,7 @@ bool VortexEngine::initialize() {
         return true;
     }
     catch (const std::exception& e) {
-        VORTEX_ERROR("Exception during engine initialization: " << e.what());
+        VORTEX_ERROR("Exception during engine initialization: {}", e.what());
         return false;
     }
 }
@@ -57,30 +65,113 @@ void VortexEngine::run() {
 
     m_running = true;
     VORTEX_INFO("Starting engine main loop");
+    VORTEX_PROFILE_THREAD("Main");
+
+    m_accumulator = 0.0f;
+    m_interpolationAlpha = 0.0f;
+    m_transformInterpolator.clear();
+
+    if (m_pipelinedRendering) {
+        runPipelined();
+    } else {
+        runSequential();
+    }
+
+    FramePacingStats pacing = m_framePacer.getStats();
+    VORTEX_INFO("Input-to-present latency (ms): average {:.3f}, max {:.3f}, limiter wait {:.3f}",
+                pacing.inputToPresentTime, pacing.maxInputToPresentTime, pacing.limiterWaitTime);
+
+    VORTEX_INFO("Engine main loop ended");
+}
 
+void VortexEngine::runSequential() {
     auto lastTime = std::chrono::high_resolution_clock::now();
     float deltaTime = 0.0f;
 
-    while (m_running && m_window->shouldClose()) {
+    while (isFrameLoopActive()) {
+        VORTEX_PROFILE_SCOPE("Frame");
+
+        // Handle input events
+        sampleInput();
+        handleEvents();
+
         auto currentTime = std::chrono::high_resolution_clock::now();
         deltaTime = std::chrono::duration<float>(currentTime - lastTime).count();
         lastTime = currentTime;
 
-        // Handle input events
+        // Step the simulation at a fixed rate, then update per-frame systems
+        advanceSimulation(deltaTime);
+        update(deltaTime);
+
+        // Render frame between the last two simulation states
+        extractRenderSnapshot(m_renderSnapshot);
+        renderFrame(m_renderSnapshot);
+        m_renderSnapshot.frameIndex++;
+
+        presentFrame(m_renderSnapshot);
+        endFrameMetrics();
+        m_framesRun++;
+
+        if (Profiler::isCapturing()) {
+            Profiler::getInstance().collect();
+        }
+    }
+}
+
+void VortexEngine::runPipelined() {
+    bool started = m_framePipeline.initialize([this](const RenderSnapshot& snapshot) {
+        renderFrame(snapshot);
+        presentFrame(snapshot);
+    });
+
+    if (!started) {
+        VORTEX_WARNING("Failed to start render thread, falling back to sequential rendering");
+        runSequential();
+        return;
+    }
+
+    auto lastTime = std::chrono::high_resolution_clock::now();
+    float deltaTime = 0.0f;
+
+    while (isFrameLoopActive()) {
+        VORTEX_PROFILE_SCOPE("Frame");
+
+        // Input and simulation stay on the main thread (SDL requires it)
+        sampleInput();
         handleEvents();
 
-        // Update engine
-        update(deltaTime);
+        auto currentTime = std::chrono::high_resolution_clock::now();
+        deltaTime = std::chrono::duration<float>(currentTime - lastTime).count();
+        lastTime = currentTime;
 
-        // Render frame
-        renderFrame();
+        advanceSimulation(deltaTime);
+        update(deltaTime);
 
-        // Update window
-        m_window->swapBuffers();
-        m_window->pollEvents();
+        auto simulateEnd = std::chrono::high_resolution_clock::now();
+        m_framePipeline.recordSimulateTime(std::chrono::duration<double, std::milli>(simulateEnd - currentTime).count());
+
+        // Hand the frame to the render thread; this only blocks if it is
+        // still drawing from the buffer we are about to fill
+        RenderSnapshot& snapshot = m_framePipeline.beginSnapshot();
+        auto extractStart = std::chrono::high_resolution_clock::now();
+        extractRenderSnapshot(snapshot);
+        auto extractEnd = std::chrono::high_resolution_clock::now();
+        m_framePipeline.recordExtractTime(std::chrono::duration<double, std::milli>(extractEnd - extractStart).count());
+        m_framePipeline.submitSnapshot();
+        endFrameMetrics();
+        m_framesRun++;
+
+        // Also drains the render thread's zones
+        if (Profiler::isCapturing()) {
+            Profiler::getInstance().collect();
+        }
     }
 
-    VORTEX_INFO("Engine main loop ended");
+    m_framePipeline.shutdown();
+
+    FramePipelineStats stats = m_framePipeline.getStats();
+    VORTEX_INFO("Pipelined frame timing (ms): simulate {:.3f}, extract {:.3f}, render {:.3f}, main wait {:.3f}, frame {:.3f}",
+                stats.simulateTime, stats.extractTime, stats.renderTime, stats.mainWaitTime, stats.frameTime);
 }
 
 void VortexEngine::shutdown() {
@@ -97,6 +188,11 @@ void VortexEngine::shutdown() {
 
     m_initialized = false;
     VORTEX_INFO("Vortex Engine shutdown complete");
+
+    if (m_ownsLogger) {
+        Logger::getInstance().shutdown();
+        m_ownsLogger = false;
+    }
 }
 
 void VortexEngine::setWindowTitle(const std::string& title) {
@@ -125,20 +221,163 @@ void VortexEngine::setEngineVersion(const std::string& version) {
     m_engineVersion = version;
 }
 
+void VortexEngine::setWorkerThreadCount(uint32_t count) {
+    if (m_jobSystem && m_jobSystem->isInitialized()) {
+        VORTEX_WARNING("Worker thread count can only be changed before initialization");
+        return;
+    }
+
+    m_workerThreadCount = count;
+}
+
+void VortexEngine::setScriptWorkerCount(uint32_t count) {
+    if (m_pythonEngine && m_pythonEngine->isInitialized()) {
+        VORTEX_WARNING("Script worker count can only be changed before initialization");
+        return;
+    }
+
+    m_scriptWorkerCount = count;
+}
+
+void VortexEngine::setFixedTimestep(float seconds) {
+    if (seconds <= 0.0f) {
+        VORTEX_WARNING("Ignoring non-positive fixed timestep");
+        return;
+    }
+
+    m_fixedTimestep = seconds;
+    m_accumulator = std::min(m_accumulator, m_fixedTimestep);
+}
+
+void VortexEngine::setMaxSimulationSteps(uint32_t steps) {
+    m_maxSimulationSteps = std::max(steps, 1u);
+}
+
+void VortexEngine::setPresentConfig(const PresentConfig& config) {
+    m_presentConfig = config;
+    if (m_vulkanContext) {
+        // Takes effect when the swapchain is next created
+        m_vulkanContext->setPresentConfig(config);
+    }
+}
+
+void VortexEngine::setFrameRateLimit(double framesPerSecond) {
+    m_framePacer.setTargetFrameRate(framesPerSecond);
+}
+
+void VortexEngine::setHeadless(bool headless) {
+    if (m_initialized) {
+        VORTEX_WARNING("Headless mode can only be changed before initialization");
+        return;
+    }
+
+    m_headless = headless;
+}
+
+void VortexEngine::setHeadlessFormat(VkFormat format) {
+    if (OffscreenTarget::getFormatSize(format) == 0) {
+        VORTEX_WARNING("Unsupported headless format {}, keeping the current one", static_cast<int>(format));
+        return;
+    }
+
+    m_headlessFormat = format;
+}
+
+void VortexEngine::setFrameCapture(const std::string& directory, uint32_t interval) {
+    m_captureDirectory = directory;
+    m_captureInterval = std::max(interval, 1u);
+}
+
+void VortexEngine::beginProfileCapture() {
+    Profiler::getInstance().beginCapture();
+    VORTEX_INFO("Profile capture started");
+}
+
+bool VortexEngine::endProfileCapture(const std::string& tracePath) {
+    // GPU zones of the last frames in flight are only resolved when their
+    // slot comes round again; let the GPU finish and resolve them now
+    if (m_gpuProfiler) {
+        if (m_pipelinedRendering) {
+            m_framePipeline.waitIdle();
+        }
+        {
+            std::lock_guard<std::mutex> lock(m_vulkanContext->getQueueMutex());
+            vkDeviceWaitIdle(m_vulkanContext->getDevice());
+        }
+        m_gpuProfiler->flush();
+    }
+
+    Profiler& profiler = Profiler::getInstance();
+    profiler.endCapture();
+
+    ProfilerStats stats = profiler.getStats();
+    if (stats.eventsDropped > 0) {
+        VORTEX_WARNING("Profile capture dropped {} events", stats.eventsDropped);
+    }
+
+    if (!profiler.writeChromeTrace(tracePath)) {
+        VORTEX_ERROR("Failed to write profile trace {}", tracePath);
+        return false;
+    }
+
+    VORTEX_INFO("Wrote {} profile events to {}", stats.eventsRecorded, tracePath);
+    return true;
+}
+
+bool VortexEngine::setMetricsDump(const std::string& path, MetricsDumpFormat format, uint32_t intervalFrames) {
+    if (!MetricsRegistry::getInstance().setDumpFile(path, format, intervalFrames)) {
+        VORTEX_ERROR("Failed to open metrics dump {}", path);
+        return false;
+    }
+
+    VORTEX_INFO("Dumping metrics to {} every {} frames", path, std::max(intervalFrames, 1u));
+    return true;
+}
+
+void VortexEngine::setPipelinedRendering(bool enable) {
+    if (m_running) {
+        VORTEX_WARNING("Pipelined rendering can only be changed before the main loop starts");
+        return;
+    }
+
+    m_pipelinedRendering = enable;
+}
+
 bool VortexEngine::initializeSubsystems() {
     VORTEX_INFO("Initializing subsystems...");
 
     try {
-        // Initialize window
-        m_window = std::make_unique<Window>();
-        if (!m_window->initialize(m_windowTitle, m_windowWidth, m_windowHeight)) {
-            VORTEX_ERROR("Failed to initialize window");
+        // Initialize job system first so every other subsystem can use it
+        m_jobSystem = std::make_unique<JobSystem>();
+        if (!m_jobSystem->initialize(m_workerThreadCount)) {
+            VORTEX_ERROR("Failed to initialize job system");
             return false;
         }
-        VORTEX_INFO("Window initialized successfully");
+        VORTEX_INFO("Job system initialized successfully");
+
+        // Initialize async I/O (completions are delivered as jobs)
+        m_asyncIO = std::make_unique<AsyncIOService>();
+        if (!m_asyncIO->initialize(m_jobSystem.get())) {
+            VORTEX_ERROR("Failed to initialize async I/O");
+            return false;
+        }
+        VORTEX_INFO("Async I/O initialized successfully ({})", AsyncIOService::backendToString(m_asyncIO->getBackend()));
+
+        // Initialize window (headless runs have no display to open one on)
+        if (!m_headless) {
+            m_window = std::make_unique<Window>();
+            if (!m_window->initialize(m_windowTitle, m_windowWidth, m_windowHeight)) {
+                VORTEX_ERROR("Failed to initialize window");
+                return false;
+            }
+            VORTEX_INFO("Window initialized successfully");
+        }
 
         // Initialize Vulkan context
         m_vulkanContext = std::make_unique<VulkanContext>();
+        m_vulkanContext->setPresentConfig(m_presentConfig);
+        m_vulkanContext->setHeadless(m_headless);
+        m_vulkanContext->setPreferSoftwareDevice(m_headless && m_preferSoftwareDevice);
         VkInstanceCreateInfo createInfo{};
         createInfo.sType = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO;
         createInfo.enabledExtensionCount = 0;
@@ -154,6 +393,7 @@ bool VortexEngine::initializeSubsystems() {
 
         // Initialize memory manager
         m_memoryManager = std::make_unique<MemoryManager>();
+        m_memoryManager->setGraphicsQueue(m_vulkanContext->getGraphicsQueue(), &m_vulkanContext->getQueueMutex());
         if (!m_memoryManager->initialize(m_vulkanContext->getDevice(), m_vulkanContext->getPhysicalDevice())) {
             VORTEX_ERROR("Failed to initialize memory manager");
             return false;
@@ -166,8 +406,36 @@ bool VortexEngine::initializeSubsystems() {
             VORTEX_ERROR("Failed to initialize shader system");
             return false;
         }
+        m_shaderSystem->setFileSystem(&m_fileSystem);
         VORTEX_INFO("Shader system initialized successfully");
 
+        // Initialize the offscreen target that replaces the swapchain
+        if (m_headless) {
+            m_offscreenTarget = std::make_unique<OffscreenTarget>();
+            m_offscreenTarget->setQueueMutex(&m_vulkanContext->getQueueMutex());
+            if (!m_offscreenTarget->initialize(m_vulkanContext->getDevice(), m_memoryManager.get(),
+                                               m_vulkanContext->getGraphicsQueue(),
+                                               m_vulkanContext->getGraphicsQueueFamilyIndex(),
+                                               static_cast<uint32_t>(m_windowWidth), static_cast<uint32_t>(m_windowHeight),
+                                               m_headlessFormat, m_vulkanContext->getFramesInFlight())) {
+                VORTEX_ERROR("Failed to initialize offscreen target");
+                return false;
+            }
+            m_offscreenTarget->setReadbackCallback([this](const OffscreenFrame& frame) { captureFrame(frame); });
+            VORTEX_INFO("Headless rendering to {}x{} offscreen target on {}", m_windowWidth, m_windowHeight,
+                        m_vulkanContext->getPhysicalDeviceName());
+        }
+
+        // GPU timestamps share the frames-in-flight ring, so results are read
+        // once the frame's fence has signalled; missing support is not fatal
+        m_gpuProfiler = std::make_unique<GpuProfiler>();
+        uint32_t profilerFrames = m_offscreenTarget ? m_offscreenTarget->getRingSize() : m_vulkanContext->getFramesInFlight();
+        if (!m_gpuProfiler->initialize(m_vulkanContext->getPhysicalDevice(), m_vulkanContext->getDevice(),
+                                       m_vulkanContext->getGraphicsQueueFamilyIndex(), profilerFrames)) {
+            VORTEX_WARNING("GPU profiler unavailable, captures will only contain CPU zones");
+            m_gpuProfiler.reset();
+        }
+
         // Initialize pipeline system
         m_pipelineSystem = std::make_unique<PipelineSystem>();
         if (!m_pipelineSystem->initialize(m_vulkanContext->getDevice(), nullptr)) {
@@ -205,11 +473,16 @@ bool VortexEngine::initializeSubsystems() {
         }
         VORTEX_INFO("Python engine initialized successfully");
 
+        // Entity scripts in worker subinterpreters (Python 3.12+)
+        if (m_scriptWorkerCount > 0 && !m_pythonEngine->enableScriptWorkers(m_jobSystem.get(), m_scriptWorkerCount)) {
+            VORTEX_WARNING("Script workers unavailable, running all scripts on the main thread");
+        }
+
         VORTEX_INFO("All subsystems initialized successfully");
         return true;
     }
     catch (const std::exception& e) {
-        VORTEX_ERROR("Exception during subsystem initialization: " << e.what());
+        VORTEX_ERROR("Exception during subsystem initialization: {}", e.what());
         return false;
     }
 }
@@ -248,6 +521,21 @@ void VortexEngine::shutdownSubsystems() {
         VORTEX_INFO("Shader system shutdown");
     }
 
+    if (m_offscreenTarget) {
+        m_offscreenTarget->shutdown();
+        VORTEX_INFO("Offscreen target shutdown");
+    }
+
+    if (m_gpuProfiler) {
+        m_gpuProfiler->shutdown();
+        VORTEX_INFO("GPU profiler shutdown");
+    }
+
+    // Captures are encoded on the job system
+    if (m_jobSystem && m_jobSystem->isInitialized()) {
+        m_jobSystem->wait(&m_captureJobs);
+    }
+
     if (m_memoryManager) {
         m_memoryManager->shutdown();
         VORTEX_INFO("Memory manager shutdown");
@@ -263,10 +551,20 @@ void VortexEngine::shutdownSubsystems() {
         VORTEX_INFO("Window shutdown");
     }
 
+    if (m_asyncIO) {
+        m_asyncIO->shutdown();
+        VORTEX_INFO("Async I/O shutdown");
+    }
+
+    if (m_jobSystem) {
+        m_jobSystem->shutdown();
+        VORTEX_INFO("Job system shutdown");
+    }
+
     VORTEX_INFO("All subsystems shutdown complete");
 }
 
-void VortexEngine::renderFrame() {
+void VortexEngine::renderFrame(const RenderSnapshot& snapshot) {
     // This is a simplified render frame implementation
     // In a real engine, this would handle:
     // - Command buffer recording
@@ -274,22 +572,202 @@ void VortexEngine::renderFrame() {
     // - Pipeline binding
     // - Draw calls
     // - Synchronization
+    //
+    // It must only read from the snapshot: in pipelined mode it runs on the
+    // render thread while the main thread is already simulating the next frame.
+    VORTEX_PROFILE_SCOPE("Render");
+
+    if (m_offscreenTarget) {
+        VkCommandBuffer commandBuffer = m_offscreenTarget->beginFrame(snapshot.frameIndex);
+        if (commandBuffer != VK_NULL_HANDLE) {
+            if (m_gpuProfiler) {
+                m_gpuProfiler->beginFrame(commandBuffer, m_offscreenTarget->getCurrentSlot());
+                m_gpuProfiler->endFrame(commandBuffer);
+            }
+            m_offscreenTarget->endFrame();
+        }
+    }
 
     VORTEX_DEBUG("Rendering frame...");
 }
 
+void VortexEngine::presentFrame(const RenderSnapshot& snapshot) {
+    VORTEX_PROFILE_SCOPE("Present");
+
+    // Offscreen frames were submitted by renderFrame; readback is asynchronous
+    if (m_window) {
+        m_window->swapBuffers();
+    }
+    m_framePacer.recordPresent(snapshot.inputSampleTime);
+}
+
+bool VortexEngine::isFrameLoopActive() const {
+    if (!m_running) {
+        return false;
+    }
+    if (m_headless) {
+        return m_headlessFrameCount == 0 || m_framesRun < m_headlessFrameCount;
+    }
+    return m_window->shouldClose();
+}
+
+void VortexEngine::captureFrame(const OffscreenFrame& frame) {
+    if (m_captureDirectory.empty() || frame.frameIndex % m_captureInterval != 0) {
+        return;
+    }
+
+    // The readback buffer is reused once this returns, so encode from a copy
+    // on a worker instead of stalling the frame on PNG/EXR compression
+    auto pixels = std::make_shared<std::vector<uint8_t>>(
+        static_cast<const uint8_t*>(frame.data), static_cast<const uint8_t*>(frame.data) + frame.rowPitch * frame.height);
+    char name[32];
+    std::snprintf(name, sizeof(name), "frame_%06llu", static_cast<unsigned long long>(frame.frameIndex));
+    std::string basePath = (std::filesystem::path(m_captureDirectory) / name).string();
+
+    m_jobSystem->run([pixels, basePath, frame]() {
+        VORTEX_PROFILE_SCOPE("Encode Frame Capture");
+        bool written = false;
+        switch (frame.format) {
+            case VK_FORMAT_B8G8R8A8_UNORM:
+            case VK_FORMAT_B8G8R8A8_SRGB:
+                for (size_t i = 0; i + 3 < pixels->size(); i += 4) {
+                    std::swap((*pixels)[i], (*pixels)[i + 2]);
+                }
+                [[fallthrough]];
+            case VK_FORMAT_R8G8B8A8_UNORM:
+            case VK_FORMAT_R8G8B8A8_SRGB:
+                written = ImageWriter::writePNG(basePath + ".png", frame.width, frame.height, pixels->data(), frame.rowPitch);
+                break;
+            case VK_FORMAT_R16G16B16A16_SFLOAT:
+                written = ImageWriter::writeEXR(basePath + ".exr", frame.width, frame.height, pixels->data(),
+                                                ExrPixelType::Half, frame.rowPitch);
+                break;
+            case VK_FORMAT_R32G32B32A32_SFLOAT:
+                written = ImageWriter::writeEXR(basePath + ".exr", frame.width, frame.height, pixels->data(),
+                                                ExrPixelType::Float, frame.rowPitch);
+                break;
+            default:
+                break;
+        }
+        if (!written) {
+            VORTEX_WARNING("Failed to write frame capture {}", basePath);
+        }
+    }, &m_captureJobs);
+}
+
+void VortexEngine::endFrameMetrics() {
+    static MetricsRegistry& registry = MetricsRegistry::getInstance();
+    static Histogram& frameCpuTime = registry.histogram(MetricNames::FrameCpuMs);
+    static Counter& frames = registry.counter(MetricNames::Frames);
+    static Gauge& entities = registry.gauge(MetricNames::EcsEntities);
+
+    // Main thread work since the limiter released the frame
+    frameCpuTime.record(std::chrono::duration<double, std::milli>(FramePacer::Clock::now() - m_inputSampleTime).count());
+    frames.add();
+    if (m_ecsManager) {
+        entities.set(static_cast<int64_t>(m_ecsManager->getEntityCount()));
+    }
+
+    registry.endFrame(m_framesRun);
+}
+
+void VortexEngine::extractRenderSnapshot(RenderSnapshot& snapshot) {
+    VORTEX_PROFILE_SCOPE("Extract");
+
+    snapshot.clear();
+    snapshot.interpolationAlpha = m_interpolationAlpha;
+    snapshot.inputSampleTime = m_inputSampleTime;
+
+    if (!m_ecsManager) {
+        return;
+    }
+
+    // Transforms are blended between the last two simulation states here, so
+    // the renderer receives final matrices
+    ComponentType transformType = ComponentRegistry::GetComponentType<SceneComponents::Transform>();
+    std::vector<Entity> entities = m_ecsManager->getEntitiesWithComponent(transformType);
+    snapshot.items.reserve(entities.size());
+    for (Entity entity : entities) {
+        RenderItem item;
+        item.entity = entity;
+        item.transform = m_transformInterpolator.getInterpolatedMatrix(m_ecsManager.get(), entity, m_interpolationAlpha);
+        snapshot.items.push_back(item);
+    }
+}
+
+void VortexEngine::sampleInput() {
+    // The limiter waits here, before input is read, so the frame starts from
+    // the freshest input instead of idling after it was sampled
+    {
+        VORTEX_PROFILE_SCOPE("Frame Limiter");
+        m_inputSampleTime = m_framePacer.waitForNextFrame();
+    }
+
+    VORTEX_PROFILE_SCOPE("Input");
+    if (m_window) {
+        m_window->pollEvents();
+    }
+}
+
 void VortexEngine::handleEvents() {
-    // This would handle window events, input events, etc.
-    // For now, it's a placeholder
+    // Drain the input queued by the last pollEvents into this frame's snapshot
+    if (m_window) {
+        m_window->getInput().beginFrame();
+    }
 }
 
-void VortexEngine::update(float deltaTime) {
-    // Update all systems
+void VortexEngine::advanceSimulation(float frameTime) {
+    VORTEX_PROFILE_SCOPE("Simulation");
+
+    // Clamp long frames (breakpoints, window drags) so one hitch cannot queue
+    // an unbounded amount of simulation work
+    const float maxFrameTime = m_fixedTimestep * static_cast<float>(m_maxSimulationSteps);
+    frameTime = std::max(frameTime, 0.0f);
+    if (frameTime > maxFrameTime) {
+        // Whole steps past the cap are dropped; the fraction is kept so the
+        // simulation clock stays on the step grid
+        float excess = frameTime - maxFrameTime;
+        m_droppedSimulationSteps += static_cast<uint64_t>(excess / m_fixedTimestep);
+        frameTime = maxFrameTime + std::fmod(excess, m_fixedTimestep);
+        VORTEX_DEBUG("Frame exceeded the simulation step cap, dropped steps");
+    }
+    m_accumulator += frameTime;
+
+    uint32_t steps = std::min(static_cast<uint32_t>(m_accumulator / m_fixedTimestep), m_maxSimulationSteps);
+    for (uint32_t step = 0; step < steps; ++step) {
+        // Only the state before the final step is needed for interpolation
+        if (step + 1 == steps) {
+            m_transformInterpolator.capturePrevious(m_ecsManager.get());
+        }
+
+        fixedUpdate(m_fixedTimestep);
+        m_accumulator -= m_fixedTimestep;
+        m_simulationStepCount++;
+    }
+
+    // The remainder carried from earlier frames can still leave a full step
+    // behind after the cap: drop it the same way
+    if (m_accumulator >= m_fixedTimestep) {
+        uint64_t dropped = static_cast<uint64_t>(m_accumulator / m_fixedTimestep);
+        m_droppedSimulationSteps += dropped;
+        m_accumulator = std::fmod(m_accumulator, m_fixedTimestep);
+        VORTEX_DEBUG("Simulation fell behind, dropped steps");
+    }
+
+    m_interpolationAlpha = m_accumulator / m_fixedTimestep;
+}
+
+void VortexEngine::fixedUpdate(float fixedDeltaTime) {
     if (m_ecsManager) {
         // Update ECS systems
-        m_ecsManager->updateSystems(deltaTime);
+        m_ecsManager->updateSystems(fixedDeltaTime);
     }
+}
+
+void VortexEngine::update(float deltaTime) {
+    VORTEX_PROFILE_SCOPE("Update");
 
+    // ECS systems run from fixedUpdate(); the rest follows the frame rate
     if (m_sceneManager) {
         // Update scene
         m_sceneManager->update(deltaTime);
@@ -298,6 +776,7 @@ void VortexEngine::update(float deltaTime) {
     if (m_pythonEngine) {
         // Update Python scripts
         m_pythonEngine->checkForScriptUpdates();
+        m_pythonEngine->updateScripts(deltaTime);
     }
 }
 
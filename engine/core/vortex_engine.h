@@ -6,11 +6,21 @@
 
 #include "../ecs/ecs_manager.h"
 #include "../renderer/buffer_allocator.h"
+#include "../renderer/gpu_profiler.h"
+#include "../renderer/offscreen_target.h"
 #include "../renderer/pipeline_system.h"
 #include "../renderer/shader_system.h"
 #include "../scene/scene_manager.h"
+#include "../scene/transform_interpolator.h"
 #include "../scripting/python_engine.h"
+#include "../utils/async_io.h"
+#include "../utils/virtual_file_system.h"
 #include "../utils/logger.h"
+#include "../utils/metrics.h"
+#include "../utils/profiler.h"
+#include "frame_pacer.h"
+#include "frame_pipeline.h"
+#include "job_system.h"
 #include "memory_manager.h"
 #include "vulkan_context.h"
 #include "window.h"
@@ -32,14 +42,59 @@ class VortexEngine {
     void setWindowSize(int width, int height);
     void enableValidationLayers(bool enable);
     void setEngineVersion(const std::string& version);
+    void setWorkerThreadCount(uint32_t count);
+    void setScriptWorkerCount(uint32_t count);
+
+    // Simulation timing
+    void setFixedTimestep(float seconds);
+    void setMaxSimulationSteps(uint32_t steps);
+    float getFixedTimestep() const { return m_fixedTimestep; }
+    uint32_t getMaxSimulationSteps() const { return m_maxSimulationSteps; }
+    float getInterpolationAlpha() const { return m_interpolationAlpha; }
+    uint64_t getSimulationStepCount() const { return m_simulationStepCount; }
+    uint64_t getDroppedSimulationSteps() const { return m_droppedSimulationSteps; }
+
+    // Pipelined rendering (simulate frame N+1 while frame N renders)
+    void setPipelinedRendering(bool enable);
+    bool isPipelinedRendering() const { return m_pipelinedRendering; }
+    FramePipelineStats getFramePipelineStats() const { return m_framePipeline.getStats(); }
+
+    // Latency policy
+    void setPresentConfig(const PresentConfig& config);
+    const PresentConfig& getPresentConfig() const { return m_presentConfig; }
+    void setFrameRateLimit(double framesPerSecond);
+    double getFrameRateLimit() const { return m_framePacer.getTargetFrameRate(); }
+    FramePacingStats getFramePacingStats() const { return m_framePacer.getStats(); }
+
+    // Headless rendering (no window; frames go to an offscreen target of the window size)
+    void setHeadless(bool headless);
+    bool isHeadless() const { return m_headless; }
+    void setHeadlessFormat(VkFormat format);
+    void setHeadlessFrameCount(uint64_t frames) { m_headlessFrameCount = frames; }
+    void setPreferSoftwareDevice(bool prefer) { m_preferSoftwareDevice = prefer; }
+    void setFrameCapture(const std::string& directory, uint32_t interval = 1);
+
+    // Profiling (CPU zones and GPU timestamps, written as Chrome trace-event JSON)
+    void beginProfileCapture();
+    bool endProfileCapture(const std::string& tracePath);
+    bool isProfileCapturing() const { return Profiler::isCapturing(); }
+
+    // Metrics (see MetricNames); snapshots are taken at the end of every frame
+    bool setMetricsDump(const std::string& path, MetricsDumpFormat format, uint32_t intervalFrames = 60);
+    MetricsSnapshot getFrameMetrics() const { return MetricsRegistry::getInstance().getLastFrame(); }
 
     // Engine state
     bool isInitialized() const { return m_initialized; }
     bool isRunning() const { return m_running; }
 
     // Subsystem access
+    JobSystem* getJobSystem() { return m_jobSystem.get(); }
+    AsyncIOService* getAsyncIO() { return m_asyncIO.get(); }
+    VirtualFileSystem* getFileSystem() { return &m_fileSystem; }
     VulkanContext* getVulkanContext() { return m_vulkanContext.get(); }
     Window* getWindow() { return m_window.get(); }
+    OffscreenTarget* getOffscreenTarget() { return m_offscreenTarget.get(); }
+    GpuProfiler* getGpuProfiler() { return m_gpuProfiler.get(); }
     MemoryManager* getMemoryManager() { return m_memoryManager.get(); }
     ShaderSystem* getShaderSystem() { return m_shaderSystem.get(); }
     PipelineSystem* getPipelineSystem() { return m_pipelineSystem.get(); }
@@ -47,6 +102,7 @@ class VortexEngine {
     ECSManager* getECSManager() { return m_ecsManager.get(); }
     SceneManager* getSceneManager() { return m_sceneManager.get(); }
     PythonEngine* getPythonEngine() { return m_pythonEngine.get(); }
+    TransformInterpolator* getTransformInterpolator() { return &m_transformInterpolator; }
 
    private:
     // Engine state
@@ -59,10 +115,46 @@ class VortexEngine {
     int m_windowWidth = 1280;
     int m_windowHeight = 720;
     std::string m_engineVersion = "1.0.0";
+    uint32_t m_workerThreadCount = 0;
+    uint32_t m_scriptWorkerCount = 0;
+
+    // Simulation timing
+    float m_fixedTimestep = 1.0f / 60.0f;
+    uint32_t m_maxSimulationSteps = 5;
+    float m_accumulator = 0.0f;
+    float m_interpolationAlpha = 0.0f;
+    uint64_t m_simulationStepCount = 0;
+    uint64_t m_droppedSimulationSteps = 0;
+    TransformInterpolator m_transformInterpolator;
+
+    // Frame pipelining
+    bool m_pipelinedRendering = false;
+    FramePipeline m_framePipeline;
+    RenderSnapshot m_renderSnapshot;
+
+    // Latency policy
+    PresentConfig m_presentConfig;
+    FramePacer m_framePacer;
+    FramePacer::Clock::time_point m_inputSampleTime;
+
+    // Headless rendering
+    bool m_headless = false;
+    bool m_preferSoftwareDevice = true;
+    VkFormat m_headlessFormat = VK_FORMAT_R8G8B8A8_UNORM;
+    uint64_t m_headlessFrameCount = 0;   // 0 runs until shutdown
+    uint64_t m_framesRun = 0;
+    std::string m_captureDirectory;
+    uint32_t m_captureInterval = 1;
+    JobCounter m_captureJobs;
 
     // Subsystems
+    std::unique_ptr<JobSystem> m_jobSystem;
+    std::unique_ptr<AsyncIOService> m_asyncIO;
+    VirtualFileSystem m_fileSystem;
     std::unique_ptr<VulkanContext> m_vulkanContext;
     std::unique_ptr<Window> m_window;
+    std::unique_ptr<OffscreenTarget> m_offscreenTarget;
+    std::unique_ptr<GpuProfiler> m_gpuProfiler;
     std::unique_ptr<MemoryManager> m_memoryManager;
     std::unique_ptr<ShaderSystem> m_shaderSystem;
     std::unique_ptr<PipelineSystem> m_pipelineSystem;
@@ -71,15 +163,25 @@ class VortexEngine {
     std::unique_ptr<SceneManager> m_sceneManager;
     std::unique_ptr<PythonEngine> m_pythonEngine;
 
-    // Logger
-    std::unique_ptr<Logger> m_logger;
+    // Logger (set when the engine started the singleton writer thread itself)
+    bool m_ownsLogger = false;
 
     // Internal methods
     bool initializeSubsystems();
     void shutdownSubsystems();
-    void renderFrame();
+    void renderFrame(const RenderSnapshot& snapshot);
+    void extractRenderSnapshot(RenderSnapshot& snapshot);
+    void runSequential();
+    void runPipelined();
+    bool isFrameLoopActive() const;
+    void presentFrame(const RenderSnapshot& snapshot);
+    void captureFrame(const OffscreenFrame& frame);
+    void endFrameMetrics();
+    void sampleInput();
     void handleEvents();
     void update(float deltaTime);
+    void fixedUpdate(float fixedDeltaTime);
+    void advanceSimulation(float frameTime);
 };
 
 }  // namespace VortexEngine
\ No newline at end of file
@@ -4,6 +4,7 @@
 #include <vector>
 #include <set>
 #include <cstring>
+#include <map>
 #include <algorithm> // std::min, std::max
 
 namespace VortexEngine {
@@ -27,15 +28,20 @@ bool VulkanContext::initialize(const VkInstanceCreateInfo& createInfo) {
         m_validationLayers.clear();
 
         VkInstanceCreateInfo modifiedCreateInfo = createInfo;
+
+        // Gates the physical device queries that need Vulkan 1.1
+        m_instanceApiVersion = createInfo.pApplicationInfo && createInfo.pApplicationInfo->apiVersion != 0
+            ? createInfo.pApplicationInfo->apiVersion : VK_API_VERSION_1_0;
         
-        std::vector<const char*> requiredExtensions = {
-            VK_KHR_SURFACE_EXTENSION_NAME
-        };
-        
-        #ifdef __linux__
-        requiredExtensions.push_back("VK_KHR_wayland_surface");
-        requiredExtensions.push_back("VK_KHR_xlib_surface");
-        #endif
+        // Headless contexts must not depend on a display server's WSI extensions
+        std::vector<const char*> requiredExtensions;
+        if (!m_headless) {
+            requiredExtensions.push_back(VK_KHR_SURFACE_EXTENSION_NAME);
+            #ifdef __linux__
+            requiredExtensions.push_back("VK_KHR_wayland_surface");
+            requiredExtensions.push_back("VK_KHR_xlib_surface");
+            #endif
+        }
         
         std::vector<const char*> allExtensions;
         for (uint32_t i = 0; i < createInfo.enabledExtensionCount; i++) {
@@ -58,12 +64,20 @@ bool VulkanContext::initialize(const VkInstanceCreateInfo& createInfo) {
         modifiedCreateInfo.enabledExtensionCount = static_cast<uint32_t>(allExtensions.size());
         modifiedCreateInfo.ppEnabledExtensionNames = allExtensions.data();
 
+        // An installed MockVulkanDevice has already filled the dispatch table
+        if (!isVulkanDispatchLoaded() && !loadVulkanGlobalFunctions(::vkGetInstanceProcAddr)) {
+            std::cerr << "Failed to load Vulkan entry points" << std::endl;
+            return false;
+        }
+
         VkResult result = vkCreateInstance(&modifiedCreateInfo, nullptr, &m_instance);
         if (result != VK_SUCCESS) {
             std::cerr << "Failed to create Vulkan instance: " << result << std::endl;
             return false;
         }
 
+        loadVulkanInstanceFunctions(m_instance);
+
         std::cout << "Vulkan instance created successfully" << std::endl;
 
         if (m_validationLayersEnabled) {
@@ -97,6 +111,8 @@ void VulkanContext::shutdown() {
     std::cout << "Shutting down Vulkan context..." << std::endl;
 
     if (m_device != VK_NULL_HANDLE) {
+        vkDeviceWaitIdle(m_device);
+        cleanupSwapChain();
         vkDestroyDevice(m_device, nullptr);
         m_device = VK_NULL_HANDLE;
     }
@@ -159,10 +175,28 @@ bool VulkanContext::selectPhysicalDevice() {
     std::vector<VkPhysicalDevice> devices(deviceCount);
     vkEnumeratePhysicalDevices(m_instance, &deviceCount, devices.data());
 
+    // A software rasterizer (e.g. lavapipe) gives the same results on every
+    // machine, which is what automated captures want
+    if (m_preferSoftwareDevice) {
+        for (const auto& device : devices) {
+            VkPhysicalDeviceProperties properties;
+            vkGetPhysicalDeviceProperties(device, &properties);
+            if (properties.deviceType == VK_PHYSICAL_DEVICE_TYPE_CPU && isDeviceSuitable(device)) {
+                m_physicalDevice = device;
+                break;
+            }
+        }
+        if (m_physicalDevice == VK_NULL_HANDLE) {
+            std::cout << "No software Vulkan device found, using the first suitable device" << std::endl;
+        }
+    }
+
     for (const auto& device : devices) {
+        if (m_physicalDevice != VK_NULL_HANDLE) {
+            break;
+        }
         if (isDeviceSuitable(device)) {
             m_physicalDevice = device;
-            break;
         }
     }
 
@@ -177,7 +211,11 @@ bool VulkanContext::selectPhysicalDevice() {
         return false;
     }
 
-    std::cout << "Selected physical device with queue family index: " << m_graphicsQueueFamilyIndex << std::endl;
+    findAsyncQueueFamilies(m_physicalDevice);
+
+    std::cout << "Selected physical device with queue family index: " << m_graphicsQueueFamilyIndex
+              << " (compute: " << m_computeQueueFamilyIndex
+              << ", transfer: " << m_transferQueueFamilyIndex << ")" << std::endl;
     return true;
 }
 
@@ -253,6 +291,44 @@ uint32_t VulkanContext::findQueueFamilies(VkPhysicalDevice device) {
     return UINT32_MAX;
 }
 
+void VulkanContext::findAsyncQueueFamilies(VkPhysicalDevice device) {
+    uint32_t queueFamilyCount = 0;
+    vkGetPhysicalDeviceQueueFamilyProperties(device, &queueFamilyCount, nullptr);
+    std::vector<VkQueueFamilyProperties> queueFamilies(queueFamilyCount);
+    vkGetPhysicalDeviceQueueFamilyProperties(device, &queueFamilyCount, queueFamilies.data());
+
+    // Without dedicated families both roles share the graphics queue
+    m_computeQueueFamilyIndex = m_graphicsQueueFamilyIndex;
+    m_computeQueueIndex = 0;
+    m_transferQueueFamilyIndex = m_graphicsQueueFamilyIndex;
+    m_transferQueueIndex = 0;
+
+    // Async compute: a family that computes but cannot draw
+    for (uint32_t i = 0; i < queueFamilyCount; i++) {
+        VkQueueFlags flags = queueFamilies[i].queueFlags;
+        if ((flags & VK_QUEUE_COMPUTE_BIT) && !(flags & VK_QUEUE_GRAPHICS_BIT)) {
+            m_computeQueueFamilyIndex = i;
+            break;
+        }
+    }
+
+    // Uploads prefer a copy-only family (the DMA engines of discrete GPUs)
+    for (uint32_t i = 0; i < queueFamilyCount; i++) {
+        VkQueueFlags flags = queueFamilies[i].queueFlags;
+        if ((flags & VK_QUEUE_TRANSFER_BIT) && !(flags & (VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT))) {
+            m_transferQueueFamilyIndex = i;
+            break;
+        }
+    }
+
+    // Otherwise a second queue of the async compute family, so uploads do
+    // not queue up behind compute work
+    if (m_transferQueueFamilyIndex == m_graphicsQueueFamilyIndex && hasDedicatedComputeQueue()) {
+        m_transferQueueFamilyIndex = m_computeQueueFamilyIndex;
+        m_transferQueueIndex = queueFamilies[m_computeQueueFamilyIndex].queueCount > 1 ? 1 : 0;
+    }
+}
+
 bool VulkanContext::checkDeviceExtensionSupport(VkPhysicalDevice device) {
     uint32_t extensionCount;
     vkEnumerateDeviceExtensionProperties(device, nullptr, &extensionCount, nullptr);
@@ -260,7 +336,9 @@ bool VulkanContext::checkDeviceExtensionSupport(VkPhysicalDevice device) {
     vkEnumerateDeviceExtensionProperties(device, nullptr, &extensionCount, availableExtensions.data());
 
     std::set<std::string> requiredExtensions;
-    requiredExtensions.insert(VK_KHR_SWAPCHAIN_EXTENSION_NAME);
+    if (!m_headless) {
+        requiredExtensions.insert(VK_KHR_SWAPCHAIN_EXTENSION_NAME);
+    }
 
     for (const auto& extension : availableExtensions) {
         requiredExtensions.erase(extension.extensionName);
@@ -294,19 +372,26 @@ SwapChainSupportDetails VulkanContext::querySwapChainSupport(VkPhysicalDevice de
 }
 
 bool VulkanContext::createSwapChain(VkSurfaceKHR surface) {
+    if (m_headless) {
+        std::cerr << "Cannot create a swapchain on a headless context" << std::endl;
+        return false;
+    }
+
     SwapChainSupportDetails swapChainSupport = querySwapChainSupport(m_physicalDevice);
     
     VkSurfaceFormatKHR surfaceFormat = chooseSwapSurfaceFormat(swapChainSupport.formats);
     m_swapChainImageFormat = surfaceFormat.format;
     
     VkPresentModeKHR presentMode = chooseSwapPresentMode(swapChainSupport.presentModes);
+    m_presentMode = presentMode;
     
     m_swapChainExtent = chooseSwapExtent(swapChainSupport.capabilities);
 
-    // 2025 SOTA: Intel UHD da segfault oldini olish uchun majburiy 2 ta image
-    uint32_t imageCount = 2;  // Bu yagona ishlab chiqaruvchi variant
+    // The default of 2 images keeps Intel UHD drivers from crashing
+    uint32_t imageCount = chooseSwapImageCount(swapChainSupport.capabilities);
 
-    std::cout << "SOTA safe image count for Intel UHD: 2" << std::endl;
+    std::cout << "Requesting " << imageCount << " swapchain images (configured " << m_presentConfig.imageCount
+              << "), present mode " << presentMode << std::endl;
 
     VkSwapchainCreateInfoKHR createInfo{};
     createInfo.sType = VK_STRUCTURE_TYPE_SWAPCHAIN_CREATE_INFO_KHR;
@@ -351,10 +436,24 @@ bool VulkanContext::createSwapChain(VkSurfaceKHR surface) {
     std::cout << "Swapchain created with " << imageCount << " images" << std::endl;
     
     createSwapChainImageViews();
+
+    // Frames in flight are bounded by the fences, not by the image count
+    m_frameSync = std::make_unique<SyncObjects>(m_device, m_presentConfig.framesInFlight);
+    if (!m_frameSync->create()) {
+        std::cerr << "Failed to create per-frame sync objects" << std::endl;
+        m_frameSync.reset();
+        return false;
+    }
     
     return true;
 }
 
+void VulkanContext::setPresentConfig(const PresentConfig& config) {
+    m_presentConfig = config;
+    m_presentConfig.imageCount = std::max(config.imageCount, 1u);
+    m_presentConfig.framesInFlight = std::max(config.framesInFlight, 1u);
+}
+
 void VulkanContext::recreateSwapChain(VkSurfaceKHR surface) {
     vkDeviceWaitIdle(m_device);
     
@@ -363,6 +462,8 @@ void VulkanContext::recreateSwapChain(VkSurfaceKHR surface) {
 }
 
 void VulkanContext::cleanupSwapChain() {
+    m_frameSync.reset();
+
     for (auto imageView : m_swapChainImageViews) {
         vkDestroyImageView(m_device, imageView, nullptr);
     }
@@ -388,15 +489,42 @@ VkSurfaceFormatKHR VulkanContext::chooseSwapSurfaceFormat(const std::vector<VkSu
 }
 
 VkPresentModeKHR VulkanContext::chooseSwapPresentMode(const std::vector<VkPresentModeKHR>& availablePresentModes) {
+    VkPresentModeKHR requested = VK_PRESENT_MODE_FIFO_KHR;
+    switch (m_presentConfig.presentMode) {
+        case PresentModePreference::Fifo:
+            requested = VK_PRESENT_MODE_FIFO_KHR;
+            break;
+        case PresentModePreference::FifoRelaxed:
+            requested = VK_PRESENT_MODE_FIFO_RELAXED_KHR;
+            break;
+        case PresentModePreference::Mailbox:
+            requested = VK_PRESENT_MODE_MAILBOX_KHR;
+            break;
+        case PresentModePreference::Immediate:
+            requested = VK_PRESENT_MODE_IMMEDIATE_KHR;
+            break;
+    }
+
     for (const auto& availablePresentMode : availablePresentModes) {
-        if (availablePresentMode == VK_PRESENT_MODE_MAILBOX_KHR) {
+        if (availablePresentMode == requested) {
             return availablePresentMode;
         }
     }
     
+    if (requested != VK_PRESENT_MODE_FIFO_KHR) {
+        std::cout << "Present mode " << requested << " not supported, falling back to FIFO" << std::endl;
+    }
     return VK_PRESENT_MODE_FIFO_KHR;
 }
 
+uint32_t VulkanContext::chooseSwapImageCount(const VkSurfaceCapabilitiesKHR& capabilities) const {
+    uint32_t imageCount = std::max(m_presentConfig.imageCount, capabilities.minImageCount);
+    if (capabilities.maxImageCount > 0) {
+        imageCount = std::min(imageCount, capabilities.maxImageCount);
+    }
+    return imageCount;
+}
+
 VkExtent2D VulkanContext::chooseSwapExtent(const VkSurfaceCapabilitiesKHR& capabilities) {
     if (capabilities.currentExtent.width != std::numeric_limits<uint32_t>::max()) {
         return capabilities.currentExtent;
@@ -475,7 +603,11 @@ bool VulkanContext::presentFrame(uint32_t imageIndex, VkSemaphore waitSemaphore)
     presentInfo.pSwapchains = &m_swapChain;
     presentInfo.pImageIndices = &imageIndex;
     
-    VkResult result = vkQueuePresentKHR(m_presentQueue, &presentInfo);
+    VkResult result;
+    {
+        std::lock_guard<std::mutex> lock(m_queueMutex);
+        result = vkQueuePresentKHR(m_presentQueue, &presentInfo);
+    }
     
     if (result == VK_ERROR_OUT_OF_DATE_KHR || result == VK_SUBOPTIMAL_KHR) {
         return false;
@@ -487,6 +619,89 @@ bool VulkanContext::presentFrame(uint32_t imageIndex, VkSemaphore waitSemaphore)
     return true;
 }
 
+VkQueue VulkanContext::getQueue(QueueType type) const {
+    switch (type) {
+        case QueueType::Graphics: return m_graphicsQueue;
+        case QueueType::Compute: return m_computeQueue;
+        case QueueType::Transfer: return m_transferQueue;
+    }
+    return VK_NULL_HANDLE;
+}
+
+uint32_t VulkanContext::getQueueFamilyIndex(QueueType type) const {
+    switch (type) {
+        case QueueType::Graphics: return m_graphicsQueueFamilyIndex;
+        case QueueType::Compute: return m_computeQueueFamilyIndex;
+        case QueueType::Transfer: return m_transferQueueFamilyIndex;
+    }
+    return UINT32_MAX;
+}
+
+bool VulkanContext::submit(QueueType type, const QueueSubmission& submission, VkFence fence) {
+    VkQueue queue = getQueue(type);
+    if (queue == VK_NULL_HANDLE) {
+        std::cerr << "Cannot submit - queue " << static_cast<int>(type) << " was not created" << std::endl;
+        return false;
+    }
+
+    std::vector<VkSemaphore> waitSemaphores;
+    std::vector<VkPipelineStageFlags> waitStages;
+    std::vector<uint64_t> waitValues;
+    bool timeline = false;
+    for (const QueueWait& wait : submission.waits) {
+        waitSemaphores.push_back(wait.semaphore);
+        waitStages.push_back(wait.stageMask);
+        waitValues.push_back(wait.timeline ? wait.value : 0);
+        timeline |= wait.timeline;
+    }
+
+    std::vector<VkSemaphore> signalSemaphores;
+    std::vector<uint64_t> signalValues;
+    for (const QueueSignal& signal : submission.signals) {
+        signalSemaphores.push_back(signal.semaphore);
+        signalValues.push_back(signal.timeline ? signal.value : 0);
+        timeline |= signal.timeline;
+    }
+
+    if (timeline && !m_timelineSemaphoresSupported) {
+        std::cerr << "Cannot submit timeline semaphores - the device does not support them" << std::endl;
+        return false;
+    }
+
+    VkSubmitInfo submitInfo{};
+    submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+    submitInfo.waitSemaphoreCount = static_cast<uint32_t>(waitSemaphores.size());
+    submitInfo.pWaitSemaphores = waitSemaphores.data();
+    submitInfo.pWaitDstStageMask = waitStages.data();
+    submitInfo.commandBufferCount = static_cast<uint32_t>(submission.commandBuffers.size());
+    submitInfo.pCommandBuffers = submission.commandBuffers.data();
+    submitInfo.signalSemaphoreCount = static_cast<uint32_t>(signalSemaphores.size());
+    submitInfo.pSignalSemaphores = signalSemaphores.data();
+
+    // Binary semaphores ignore their entries, so one list covers mixed batches
+    VkTimelineSemaphoreSubmitInfo timelineInfo{};
+    if (timeline) {
+        timelineInfo.sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO;
+        timelineInfo.waitSemaphoreValueCount = static_cast<uint32_t>(waitValues.size());
+        timelineInfo.pWaitSemaphoreValues = waitValues.data();
+        timelineInfo.signalSemaphoreValueCount = static_cast<uint32_t>(signalValues.size());
+        timelineInfo.pSignalSemaphoreValues = signalValues.data();
+        submitInfo.pNext = &timelineInfo;
+    }
+
+    VkResult result;
+    {
+        std::lock_guard<std::mutex> lock(m_queueMutex);
+        result = vkQueueSubmit(queue, 1, &submitInfo, fence);
+    }
+
+    if (result != VK_SUCCESS) {
+        std::cerr << "Failed to submit to queue " << static_cast<int>(type) << ": " << result << std::endl;
+        return false;
+    }
+    return true;
+}
+
 VkResult VulkanContext::createDebugUtilsMessengerEXT(const VkDebugUtilsMessengerCreateInfoEXT* pCreateInfo, const VkAllocationCallbacks* pAllocator) {
     auto func = (PFN_vkCreateDebugUtilsMessengerEXT) vkGetInstanceProcAddr(m_instance, "vkCreateDebugUtilsMessengerEXT");
     if (func != nullptr) {
@@ -543,17 +758,34 @@ std::string VulkanContext::getPhysicalDeviceName() const {
 }
 
 void VulkanContext::createLogicalDevice() {
-    VkDeviceQueueCreateInfo queueCreateInfo{};
-    queueCreateInfo.sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
-    queueCreateInfo.queueFamilyIndex = m_graphicsQueueFamilyIndex;
-    queueCreateInfo.queueCount = 1;
-    float queuePriority = 1.0f;
-    queueCreateInfo.pQueuePriorities = &queuePriority;
+    // One create info per family, with as many queues as the roles mapped
+    // onto it need
+    std::map<uint32_t, uint32_t> queueCounts;
+    auto requestQueue = [&queueCounts](uint32_t familyIndex, uint32_t queueIndex) {
+        if (familyIndex != UINT32_MAX) {
+            queueCounts[familyIndex] = std::max(queueCounts[familyIndex], queueIndex + 1);
+        }
+    };
+    requestQueue(m_graphicsQueueFamilyIndex, 0);
+    requestQueue(m_presentQueueFamilyIndex, 0);
+    requestQueue(m_computeQueueFamilyIndex, m_computeQueueIndex);
+    requestQueue(m_transferQueueFamilyIndex, m_transferQueueIndex);
+
+    const std::vector<float> queuePriorities(2, 1.0f);
+    std::vector<VkDeviceQueueCreateInfo> queueCreateInfos;
+    for (const auto& [familyIndex, queueCount] : queueCounts) {
+        VkDeviceQueueCreateInfo queueCreateInfo{};
+        queueCreateInfo.sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
+        queueCreateInfo.queueFamilyIndex = familyIndex;
+        queueCreateInfo.queueCount = queueCount;
+        queueCreateInfo.pQueuePriorities = queuePriorities.data();
+        queueCreateInfos.push_back(queueCreateInfo);
+    }
 
     VkDeviceCreateInfo createInfo{};
     createInfo.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
-    createInfo.pQueueCreateInfos = &queueCreateInfo;
-    createInfo.queueCreateInfoCount = 1;
+    createInfo.pQueueCreateInfos = queueCreateInfos.data();
+    createInfo.queueCreateInfoCount = static_cast<uint32_t>(queueCreateInfos.size());
     
     VkPhysicalDeviceFeatures supportedFeatures;
     vkGetPhysicalDeviceFeatures(m_physicalDevice, &supportedFeatures);
@@ -562,10 +794,51 @@ void VulkanContext::createLogicalDevice() {
     
     createInfo.pEnabledFeatures = &m_enabledFeatures;
     
-    std::vector<const char*> deviceExtensions = {VK_KHR_SWAPCHAIN_EXTENSION_NAME};
+    std::vector<const char*> deviceExtensions;
+    if (!m_headless) {
+        deviceExtensions.push_back(VK_KHR_SWAPCHAIN_EXTENSION_NAME);
+    }
     createInfo.enabledExtensionCount = static_cast<uint32_t>(deviceExtensions.size());
     createInfo.ppEnabledExtensionNames = deviceExtensions.data();
 
+    // Timeline semaphores are core in 1.2 and need VK_KHR_timeline_semaphore
+    // before that; either way the feature has to be enabled explicitly
+    VkPhysicalDeviceTimelineSemaphoreFeatures timelineFeatures{};
+    timelineFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_FEATURES;
+    VkPhysicalDeviceProperties deviceProperties;
+    vkGetPhysicalDeviceProperties(m_physicalDevice, &deviceProperties);
+    uint32_t apiVersion = std::min(deviceProperties.apiVersion, m_instanceApiVersion);
+    bool timelineExtension = false;
+    if (apiVersion >= VK_API_VERSION_1_1 && apiVersion < VK_API_VERSION_1_2) {
+        uint32_t extensionCount = 0;
+        vkEnumerateDeviceExtensionProperties(m_physicalDevice, nullptr, &extensionCount, nullptr);
+        std::vector<VkExtensionProperties> availableExtensions(extensionCount);
+        vkEnumerateDeviceExtensionProperties(m_physicalDevice, nullptr, &extensionCount, availableExtensions.data());
+        for (const auto& extension : availableExtensions) {
+            if (strcmp(extension.extensionName, VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME) == 0) {
+                timelineExtension = true;
+                break;
+            }
+        }
+    }
+    if (apiVersion >= VK_API_VERSION_1_2 || timelineExtension) {
+        VkPhysicalDeviceFeatures2 features2{};
+        features2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+        features2.pNext = &timelineFeatures;
+        vkGetPhysicalDeviceFeatures2(m_physicalDevice, &features2);
+        timelineFeatures.pNext = nullptr;
+    }
+
+    m_timelineSemaphoresSupported = timelineFeatures.timelineSemaphore == VK_TRUE;
+    if (m_timelineSemaphoresSupported) {
+        if (timelineExtension) {
+            deviceExtensions.push_back(VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME);
+            createInfo.enabledExtensionCount = static_cast<uint32_t>(deviceExtensions.size());
+            createInfo.ppEnabledExtensionNames = deviceExtensions.data();
+        }
+        createInfo.pNext = &timelineFeatures;
+    }
+
     if (m_validationLayersEnabled) {
         createInfo.enabledLayerCount = static_cast<uint32_t>(m_validationLayers.size());
         createInfo.ppEnabledLayerNames = m_validationLayers.data();
@@ -579,8 +852,13 @@ void VulkanContext::createLogicalDevice() {
         throw std::runtime_error("Failed to create logical device!");
     }
 
+    // Skip the loader's trampolines for everything recorded on this device
+    loadVulkanDeviceFunctions(m_device);
+
     vkGetDeviceQueue(m_device, m_graphicsQueueFamilyIndex, 0, &m_graphicsQueue);
     vkGetDeviceQueue(m_device, m_presentQueueFamilyIndex, 0, &m_presentQueue);
+    vkGetDeviceQueue(m_device, m_computeQueueFamilyIndex, m_computeQueueIndex, &m_computeQueue);
+    vkGetDeviceQueue(m_device, m_transferQueueFamilyIndex, m_transferQueueIndex, &m_transferQueue);
 
     std::cout << "Logical device created successfully" << std::endl;
 }
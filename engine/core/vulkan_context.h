@@ -1,7 +1,9 @@
 #pragma once
 
-#include <vulkan/vulkan.h>
+#include "vulkan_dispatch.h"
+#include "../renderer/synchronization.h"
 #include <memory>
+#include <mutex>
 #include <vector>
 #include <string>
 
@@ -11,6 +13,57 @@ namespace VortexEngine {
 struct SwapChainSupportDetails;
 struct SwapChainDetails;
 
+// Present mode preference, lowest latency last
+//
+// FIFO is always available and is the fallback for the others. FifoRelaxed
+// tears instead of waiting a full refresh when a frame misses vblank;
+// Mailbox replaces the queued image without tearing; Immediate tears.
+enum class PresentModePreference {
+    Fifo,
+    FifoRelaxed,
+    Mailbox,
+    Immediate
+};
+
+// Swapchain latency policy; applied the next time the swapchain is created
+struct PresentConfig {
+    PresentModePreference presentMode = PresentModePreference::Mailbox;
+    uint32_t imageCount = 2;        // Clamped to the surface limits
+    uint32_t framesInFlight = 2;    // CPU frames recorded ahead of the GPU; sizes getFrameSync()
+};
+
+// Queues the context creates. Compute and Transfer map to dedicated queue
+// families where the device has them and to the graphics queue otherwise
+enum class QueueType {
+    Graphics,
+    Compute,
+    Transfer
+};
+
+// Semaphore wait for a submission. Set timeline for semaphores created as
+// VK_SEMAPHORE_TYPE_TIMELINE; value is then the payload to wait for (0 is a
+// valid payload) and is ignored for binary semaphores
+struct QueueWait {
+    VkSemaphore semaphore = VK_NULL_HANDLE;
+    VkPipelineStageFlags stageMask = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+    uint64_t value = 0;
+    bool timeline = false;
+};
+
+struct QueueSignal {
+    VkSemaphore semaphore = VK_NULL_HANDLE;
+    uint64_t value = 0;
+    bool timeline = false;
+};
+
+// One batch for VulkanContext::submit(). Command buffers must come from a
+// pool created for the target queue's family
+struct QueueSubmission {
+    std::vector<VkCommandBuffer> commandBuffers;
+    std::vector<QueueWait> waits;
+    std::vector<QueueSignal> signals;
+};
+
 class VulkanContext {
 public:
     VulkanContext();
@@ -34,6 +87,35 @@ public:
     VkQueue getGraphicsQueue() const { return m_graphicsQueue; }
     VkQueue getPresentQueue() const { return m_presentQueue; }
 
+    // Async compute and transfer queues
+    uint32_t getComputeQueueFamilyIndex() const { return m_computeQueueFamilyIndex; }
+    uint32_t getTransferQueueFamilyIndex() const { return m_transferQueueFamilyIndex; }
+    VkQueue getComputeQueue() const { return m_computeQueue; }
+    VkQueue getTransferQueue() const { return m_transferQueue; }
+    VkQueue getQueue(QueueType type) const;
+    uint32_t getQueueFamilyIndex(QueueType type) const;
+    bool hasDedicatedComputeQueue() const { return m_computeQueueFamilyIndex != m_graphicsQueueFamilyIndex; }
+    bool hasDedicatedTransferQueue() const { return m_transferQueueFamilyIndex != m_graphicsQueueFamilyIndex; }
+
+    // Queue submission. Serialized across threads because queue types may
+    // share a VkQueue; waits on semaphores signaled by another queue order
+    // the work across queues. Timeline values are rejected unless
+    // supportsTimelineSemaphores()
+    bool submit(QueueType type, const QueueSubmission& submission, VkFence fence = VK_NULL_HANDLE);
+
+    // Enabled at device creation when the device has the timelineSemaphore
+    // feature (Vulkan 1.2, or 1.1 with VK_KHR_timeline_semaphore)
+    bool supportsTimelineSemaphores() const { return m_timelineSemaphoresSupported; }
+
+    // Held around every vkQueueSubmit and vkQueuePresentKHR on the context's
+    // queues; code that submits to them directly must take it as well
+    std::mutex& getQueueMutex() { return m_queueMutex; }
+
+    // Headless mode (no surface, no swapchain); set before initialize()
+    void setHeadless(bool headless) { m_headless = headless; }
+    bool isHeadless() const { return m_headless; }
+    void setPreferSoftwareDevice(bool prefer) { m_preferSoftwareDevice = prefer; }
+
     // Validation layers
     void enableValidationLayers(bool enable);
     bool areValidationLayersEnabled() const { return m_validationLayersEnabled; }
@@ -67,6 +149,12 @@ public:
     void recreateSwapChain(VkSurfaceKHR surface);
     void cleanupSwapChain();
     void setSurface(VkSurfaceKHR surface) { m_surface = surface; }
+
+    // Latency policy
+    void setPresentConfig(const PresentConfig& config);
+    const PresentConfig& getPresentConfig() const { return m_presentConfig; }
+    VkPresentModeKHR getPresentMode() const { return m_presentMode; }
+    uint32_t getFramesInFlight() const { return m_presentConfig.framesInFlight; }
     
     // Swapchain accessors
     VkSwapchainKHR getSwapChain() const { return m_swapChain; }
@@ -76,6 +164,10 @@ public:
     VkExtent2D getSwapChainExtent() const { return m_swapChainExtent; }
     uint32_t getSwapChainImageCount() const { return static_cast<uint32_t>(m_swapChainImages.size()); }
     
+    // Per-frame acquire/render semaphores and in-flight fences, one set per
+    // PresentConfig::framesInFlight; created and destroyed with the swapchain
+    SyncObjects* getFrameSync() const { return m_frameSync.get(); }
+
     // Frame presentation
     uint32_t acquireNextImage(VkSemaphore semaphore);
     bool presentFrame(uint32_t imageIndex, VkSemaphore waitSemaphore);
@@ -88,15 +180,34 @@ private:
     VkDevice m_device = VK_NULL_HANDLE;
     VkQueue m_graphicsQueue = VK_NULL_HANDLE;
     VkQueue m_presentQueue = VK_NULL_HANDLE;
+    VkQueue m_computeQueue = VK_NULL_HANDLE;
+    VkQueue m_transferQueue = VK_NULL_HANDLE;
     VkSurfaceKHR m_surface = VK_NULL_HANDLE;
 
     // Queue family indices
     uint32_t m_graphicsQueueFamilyIndex = UINT32_MAX;
     uint32_t m_presentQueueFamilyIndex = UINT32_MAX;
+    uint32_t m_computeQueueFamilyIndex = UINT32_MAX;
+    uint32_t m_transferQueueFamilyIndex = UINT32_MAX;
+
+    // Queue indices within their families; a role that shares a family
+    // with another one may get its own queue when the family has several
+    uint32_t m_computeQueueIndex = 0;
+    uint32_t m_transferQueueIndex = 0;
+
+    // Guards vkQueueSubmit and vkQueuePresentKHR here and in the
+    // MemoryManager and OffscreenTarget it is handed to
+    std::mutex m_queueMutex;
+
+    // Version and optional features
+    uint32_t m_instanceApiVersion = VK_API_VERSION_1_0;
+    bool m_timelineSemaphoresSupported = false;
 
     // Configuration
     bool m_initialized = false;
     bool m_validationLayersEnabled = true;
+    bool m_headless = false;
+    bool m_preferSoftwareDevice = false;
 
     // Validation layers
     std::vector<const char*> m_validationLayers = {
@@ -119,6 +230,11 @@ private:
     std::vector<VkImageView> m_swapChainImageViews;
     VkFormat m_swapChainImageFormat;
     VkExtent2D m_swapChainExtent;
+    std::unique_ptr<SyncObjects> m_frameSync;
+
+    // Latency policy
+    PresentConfig m_presentConfig;
+    VkPresentModeKHR m_presentMode = VK_PRESENT_MODE_FIFO_KHR;
 
     // Debug messenger setup
     static VKAPI_ATTR VkBool32 VKAPI_CALL debugCallback(
@@ -139,12 +255,14 @@ private:
 
     // Physical device utilities
     bool checkDeviceExtensionSupport(VkPhysicalDevice device);
+    void findAsyncQueueFamilies(VkPhysicalDevice device);
     SwapChainSupportDetails querySwapChainSupport(VkPhysicalDevice device) const;
     
     // Swapchain utilities
     VkSurfaceFormatKHR chooseSwapSurfaceFormat(const std::vector<VkSurfaceFormatKHR>& availableFormats);
     VkPresentModeKHR chooseSwapPresentMode(const std::vector<VkPresentModeKHR>& availablePresentModes);
     VkExtent2D chooseSwapExtent(const VkSurfaceCapabilitiesKHR& capabilities);
+    uint32_t chooseSwapImageCount(const VkSurfaceCapabilitiesKHR& capabilities) const;
     void createSwapChainImages(VkSurfaceKHR surface);
     void createSwapChainImageViews();
 };
@@ -0,0 +1,64 @@
+#include "vulkan_dispatch.h"
+
+namespace VortexEngine {
+
+#define VORTEX_VK_DEFINE_FUNCTION(name) PFN_##name name = nullptr;
+PFN_vkGetInstanceProcAddr vkGetInstanceProcAddr = nullptr;
+VORTEX_VK_GLOBAL_FUNCTIONS(VORTEX_VK_DEFINE_FUNCTION)
+VORTEX_VK_INSTANCE_FUNCTIONS(VORTEX_VK_DEFINE_FUNCTION)
+VORTEX_VK_DEVICE_FUNCTIONS(VORTEX_VK_DEFINE_FUNCTION)
+#undef VORTEX_VK_DEFINE_FUNCTION
+
+bool loadVulkanGlobalFunctions(PFN_vkGetInstanceProcAddr getInstanceProcAddr) {
+    if (!getInstanceProcAddr) {
+        return false;
+    }
+
+    vkGetInstanceProcAddr = getInstanceProcAddr;
+#define VORTEX_VK_LOAD_FUNCTION(name) \
+    name = reinterpret_cast<PFN_##name>(vkGetInstanceProcAddr(VK_NULL_HANDLE, #name));
+    VORTEX_VK_GLOBAL_FUNCTIONS(VORTEX_VK_LOAD_FUNCTION)
+#undef VORTEX_VK_LOAD_FUNCTION
+
+    return vkCreateInstance != nullptr;
+}
+
+void loadVulkanInstanceFunctions(VkInstance instance) {
+    if (!vkGetInstanceProcAddr) {
+        return;
+    }
+
+#define VORTEX_VK_LOAD_FUNCTION(name) \
+    name = reinterpret_cast<PFN_##name>(vkGetInstanceProcAddr(instance, #name));
+    VORTEX_VK_INSTANCE_FUNCTIONS(VORTEX_VK_LOAD_FUNCTION)
+    VORTEX_VK_DEVICE_FUNCTIONS(VORTEX_VK_LOAD_FUNCTION)
+#undef VORTEX_VK_LOAD_FUNCTION
+}
+
+void loadVulkanDeviceFunctions(VkDevice device) {
+    if (!vkGetDeviceProcAddr || device == VK_NULL_HANDLE) {
+        return;
+    }
+
+#define VORTEX_VK_LOAD_FUNCTION(name) \
+    if (auto function = reinterpret_cast<PFN_##name>(vkGetDeviceProcAddr(device, #name))) { \
+        name = function; \
+    }
+    VORTEX_VK_DEVICE_FUNCTIONS(VORTEX_VK_LOAD_FUNCTION)
+#undef VORTEX_VK_LOAD_FUNCTION
+}
+
+bool isVulkanDispatchLoaded() {
+    return vkGetInstanceProcAddr != nullptr;
+}
+
+void resetVulkanDispatch() {
+#define VORTEX_VK_RESET_FUNCTION(name) name = nullptr;
+    vkGetInstanceProcAddr = nullptr;
+    VORTEX_VK_GLOBAL_FUNCTIONS(VORTEX_VK_RESET_FUNCTION)
+    VORTEX_VK_INSTANCE_FUNCTIONS(VORTEX_VK_RESET_FUNCTION)
+    VORTEX_VK_DEVICE_FUNCTIONS(VORTEX_VK_RESET_FUNCTION)
+#undef VORTEX_VK_RESET_FUNCTION
+}
+
+} // namespace VortexEngine
@@ -0,0 +1,147 @@
+#pragma once
+
+#include <vulkan/vulkan.h>
+
+namespace VortexEngine {
+
+// Vulkan entry points used by the engine
+//
+// Engine code calls Vulkan through these function pointers instead of the
+// loader's exported prototypes. They live in the engine namespace, so an
+// unqualified vkCreateBuffer(...) inside VortexEngine resolves to the pointer
+// and call sites need no prefix. VulkanContext fills the table from the
+// loader; MockVulkanDevice fills it with its CPU implementation, which lets
+// the renderer run on machines without a driver.
+//
+// Code outside the namespace (the examples) keeps calling the loader
+// directly; both paths reach the same driver.
+
+// Callable before an instance exists
+#define VORTEX_VK_GLOBAL_FUNCTIONS(X) \
+    X(vkCreateInstance)
+
+// Instance and physical device functions
+#define VORTEX_VK_INSTANCE_FUNCTIONS(X) \
+    X(vkDestroyInstance) \
+    X(vkEnumeratePhysicalDevices) \
+    X(vkGetPhysicalDeviceProperties) \
+    X(vkGetPhysicalDeviceFeatures) \
+    X(vkGetPhysicalDeviceFeatures2) \
+    X(vkGetPhysicalDeviceMemoryProperties) \
+    X(vkGetPhysicalDeviceQueueFamilyProperties) \
+    X(vkEnumerateDeviceExtensionProperties) \
+    X(vkGetPhysicalDeviceSurfaceSupportKHR) \
+    X(vkGetPhysicalDeviceSurfaceCapabilitiesKHR) \
+    X(vkGetPhysicalDeviceSurfaceFormatsKHR) \
+    X(vkGetPhysicalDeviceSurfacePresentModesKHR) \
+    X(vkCreateDevice) \
+    X(vkGetDeviceProcAddr)
+
+// Device, queue and command buffer functions. The timeline semaphore entry
+// points are Vulkan 1.2 and stay null on older implementations.
+#define VORTEX_VK_DEVICE_FUNCTIONS(X) \
+    X(vkDestroyDevice) \
+    X(vkGetDeviceQueue) \
+    X(vkDeviceWaitIdle) \
+    X(vkQueueSubmit) \
+    X(vkQueueWaitIdle) \
+    X(vkAllocateMemory) \
+    X(vkFreeMemory) \
+    X(vkMapMemory) \
+    X(vkUnmapMemory) \
+    X(vkFlushMappedMemoryRanges) \
+    X(vkInvalidateMappedMemoryRanges) \
+    X(vkCreateBuffer) \
+    X(vkDestroyBuffer) \
+    X(vkGetBufferMemoryRequirements) \
+    X(vkBindBufferMemory) \
+    X(vkCreateImage) \
+    X(vkDestroyImage) \
+    X(vkGetImageMemoryRequirements) \
+    X(vkBindImageMemory) \
+    X(vkCreateImageView) \
+    X(vkDestroyImageView) \
+    X(vkCreateShaderModule) \
+    X(vkDestroyShaderModule) \
+    X(vkCreatePipelineLayout) \
+    X(vkDestroyPipelineLayout) \
+    X(vkCreatePipelineCache) \
+    X(vkDestroyPipelineCache) \
+    X(vkCreateGraphicsPipelines) \
+    X(vkDestroyPipeline) \
+    X(vkCreateCommandPool) \
+    X(vkDestroyCommandPool) \
+    X(vkResetCommandPool) \
+    X(vkAllocateCommandBuffers) \
+    X(vkFreeCommandBuffers) \
+    X(vkBeginCommandBuffer) \
+    X(vkEndCommandBuffer) \
+    X(vkResetCommandBuffer) \
+    X(vkCreateFence) \
+    X(vkDestroyFence) \
+    X(vkResetFences) \
+    X(vkWaitForFences) \
+    X(vkGetFenceStatus) \
+    X(vkCreateSemaphore) \
+    X(vkDestroySemaphore) \
+    X(vkGetSemaphoreCounterValue) \
+    X(vkWaitSemaphores) \
+    X(vkSignalSemaphore) \
+    X(vkCreateQueryPool) \
+    X(vkDestroyQueryPool) \
+    X(vkGetQueryPoolResults) \
+    X(vkCreateSwapchainKHR) \
+    X(vkDestroySwapchainKHR) \
+    X(vkGetSwapchainImagesKHR) \
+    X(vkAcquireNextImageKHR) \
+    X(vkQueuePresentKHR) \
+    X(vkCmdBeginRenderPass) \
+    X(vkCmdEndRenderPass) \
+    X(vkCmdBindPipeline) \
+    X(vkCmdBindVertexBuffers) \
+    X(vkCmdBindIndexBuffer) \
+    X(vkCmdBindDescriptorSets) \
+    X(vkCmdPushConstants) \
+    X(vkCmdSetViewport) \
+    X(vkCmdSetScissor) \
+    X(vkCmdSetLineWidth) \
+    X(vkCmdSetDepthBias) \
+    X(vkCmdDraw) \
+    X(vkCmdDrawIndexed) \
+    X(vkCmdDispatch) \
+    X(vkCmdPipelineBarrier) \
+    X(vkCmdCopyBuffer) \
+    X(vkCmdCopyBufferToImage) \
+    X(vkCmdCopyImageToBuffer) \
+    X(vkCmdBlitImage) \
+    X(vkCmdClearColorImage) \
+    X(vkCmdResetQueryPool) \
+    X(vkCmdWriteTimestamp)
+
+#define VORTEX_VK_DECLARE_FUNCTION(name) extern PFN_##name name;
+extern PFN_vkGetInstanceProcAddr vkGetInstanceProcAddr;
+VORTEX_VK_GLOBAL_FUNCTIONS(VORTEX_VK_DECLARE_FUNCTION)
+VORTEX_VK_INSTANCE_FUNCTIONS(VORTEX_VK_DECLARE_FUNCTION)
+VORTEX_VK_DEVICE_FUNCTIONS(VORTEX_VK_DECLARE_FUNCTION)
+#undef VORTEX_VK_DECLARE_FUNCTION
+
+// Table loading
+//
+// loadVulkanGlobalFunctions() takes the implementation's vkGetInstanceProcAddr
+// (the loader's, or MockVulkanDevice::getInstanceProcAddr()) and resolves
+// everything usable without an instance. loadVulkanInstanceFunctions() then
+// resolves the rest through the new instance; device functions come back as
+// loader trampolines that look up the driver's table from the dispatchable
+// handle on every call.
+//
+// loadVulkanDeviceFunctions() replaces those with the device's own entry
+// points from vkGetDeviceProcAddr, so vkCmdDraw* and friends call the driver
+// directly. The table holds one device at a time, which is all the engine
+// creates; entry points the device does not expose keep their trampoline.
+bool loadVulkanGlobalFunctions(PFN_vkGetInstanceProcAddr getInstanceProcAddr);
+void loadVulkanInstanceFunctions(VkInstance instance);
+void loadVulkanDeviceFunctions(VkDevice device);
+bool isVulkanDispatchLoaded();
+void resetVulkanDispatch();
+
+} // namespace VortexEngine
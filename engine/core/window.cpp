@@ -3,6 +3,8 @@
 
 namespace VortexEngine {
 
+static_assert(InputSnapshot::KEY_COUNT >= SDL_NUM_SCANCODES, "InputSnapshot must cover every SDL scancode");
+
 Window::Window() {
     std::cout << "Initializing window system..." << std::endl;
 }
@@ -84,28 +86,39 @@ void Window::pollEvents() {
         switch (event.type) {
             case SDL_KEYDOWN:
             case SDL_KEYUP:
+                m_input.pushKey(event.key.keysym.scancode, event.key.keysym.sym, event.key.state == SDL_PRESSED,
+                                event.key.repeat != 0, event.key.keysym.mod, event.key.timestamp);
                 if (m_keyCallback) {
                     m_keyCallback(event.key.keysym.sym, event.key.keysym.scancode, event.key.state, event.key.keysym.mod);
                 }
                 break;
             case SDL_MOUSEBUTTONDOWN:
             case SDL_MOUSEBUTTONUP:
+                m_input.pushMouseButton(event.button.button, event.button.state == SDL_PRESSED,
+                                        static_cast<float>(event.button.x), static_cast<float>(event.button.y),
+                                        event.button.timestamp);
                 if (m_mouseButtonCallback) {
                     m_mouseButtonCallback(event.button.button, event.button.state, event.button.state);
                 }
                 break;
             case SDL_MOUSEMOTION:
+                m_input.pushMouseMotion(static_cast<float>(event.motion.x), static_cast<float>(event.motion.y),
+                                        static_cast<float>(event.motion.xrel), static_cast<float>(event.motion.yrel),
+                                        event.motion.timestamp);
                 if (m_cursorPosCallback) {
                     m_cursorPosCallback(event.motion.x, event.motion.y);
                 }
                 break;
             case SDL_MOUSEWHEEL:
+                m_input.pushMouseWheel(static_cast<float>(event.wheel.x), static_cast<float>(event.wheel.y),
+                                       event.wheel.timestamp);
                 if (m_scrollCallback) {
                     m_scrollCallback(event.wheel.x, event.wheel.y);
                 }
                 break;
             case SDL_WINDOWEVENT:
                 if (event.window.event == SDL_WINDOWEVENT_RESIZED) {
+                    m_input.pushResize(event.window.data1, event.window.data2, event.window.timestamp);
                     if (m_resizeCallback) {
                         m_resizeCallback(event.window.data1, event.window.data2);
                     }
@@ -113,6 +126,9 @@ void Window::pollEvents() {
                 break;
         }
     }
+
+    // Queue the motion/wheel merged during this pump
+    m_input.flush();
 }
 
 void Window::swapBuffers() {
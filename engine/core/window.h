@@ -2,11 +2,13 @@
 
 #include <SDL2/SDL.h>
 #include <SDL2/SDL_vulkan.h>
-#include <vulkan/vulkan.h>
+#include "vulkan_dispatch.h"
 #include <string>
 #include <functional>
 #include <memory>
 
+#include "input_system.h"
+
 namespace VortexEngine {
 
 class Window {
@@ -54,6 +56,10 @@ public:
     void getCursorPos(double& xpos, double& ypos) const;
     void setCursorPos(double xpos, double ypos);
 
+    // Buffered input; filled by pollEvents, consumed once per frame
+    InputSystem& getInput() { return m_input; }
+    const InputSystem& getInput() const { return m_input; }
+
     // Cursor modes
     void setCursorMode(int mode); // SDL_CURSOR_NORMAL, SDL_CURSOR_HIDDEN, SDL_CURSOR_DISABLED
 
@@ -82,6 +88,9 @@ private:
     ScrollCallback m_scrollCallback;
     ResizeCallback m_resizeCallback;
 
+    // Buffered input
+    InputSystem m_input;
+
     // Static callback functions
     static void keyCallbackStatic(SDL_Event* event);
     static void mouseButtonCallbackStatic(SDL_Event* event);
@@ -0,0 +1,280 @@
+#include "ecs_manager.h"
+#include <algorithm>
+#include <iostream>
+
+namespace VortexEngine {
+
+namespace {
+
+bool matches(const Signature& entitySignature, const Signature& signature) {
+    return (entitySignature & signature) == signature;
+}
+
+} // namespace
+
+ECSManager::ECSManager() {
+    // Id 0 is INVALID_ENTITY and never handed out
+    m_entitySignatures.resize(1);
+}
+
+ECSManager::~ECSManager() {
+    shutdown();
+}
+
+void ECSManager::initialize() {
+    m_initialized = true;
+}
+
+void ECSManager::shutdown() {
+    m_systems.clear();
+    m_systemMap.clear();
+    m_systemUpdateOrder.clear();
+    m_componentPools.clear();
+
+    m_availableEntities = {};
+    m_entities.clear();
+    m_entityIndices.clear();
+    m_entitySignatures.assign(1, Signature());
+
+    m_initialized = false;
+}
+
+// Entity management
+Entity ECSManager::createEntity() {
+    Entity entity;
+    if (!m_availableEntities.empty()) {
+        entity = m_availableEntities.front();
+        m_availableEntities.pop();
+    } else {
+        entity = static_cast<Entity>(m_entitySignatures.size());
+        m_entitySignatures.emplace_back();
+    }
+
+    m_entityIndices[entity] = m_entities.size();
+    m_entities.push_back(entity);
+    notifyEntityAdded(entity);
+    return entity;
+}
+
+void ECSManager::destroyEntity(Entity entity) {
+    auto it = m_entityIndices.find(entity);
+    if (it == m_entityIndices.end()) {
+        return;
+    }
+
+    const Signature& signature = m_entitySignatures[entity];
+    notifyEntityRemoved(entity);
+
+    for (const auto& [type, pool] : m_componentPools) {
+        if (signature.test(type)) {
+            pool->removeEntity(entity);
+        }
+    }
+    m_entitySignatures[entity].reset();
+
+    // Swap-remove from the live list
+    size_t index = it->second;
+    Entity last = m_entities.back();
+    m_entities[index] = last;
+    m_entityIndices[last] = index;
+    m_entities.pop_back();
+    m_entityIndices.erase(entity);
+
+    m_availableEntities.push(entity);
+}
+
+bool ECSManager::isEntityValid(Entity entity) const {
+    return entity != INVALID_ENTITY && m_entityIndices.find(entity) != m_entityIndices.end();
+}
+
+EntityId ECSManager::getEntityId(Entity entity) const {
+    return entity;
+}
+
+void ECSManager::applyPendingChanges() {
+    for (const auto& [type, pool] : m_componentPools) {
+        pool->applyPendingChanges();
+    }
+}
+
+// System execution
+void ECSManager::updateSystems(float deltaTime) {
+    // Frame sync point: land changes deferred while script buffers were exported
+    applyPendingChanges();
+
+    if (m_systemUpdateOrder.empty()) {
+        for (auto& system : m_systems) {
+            system->update(deltaTime);
+        }
+        return;
+    }
+
+    // Ordered systems first, then the rest in registration order
+    std::vector<ISystem*> updated;
+    for (const std::type_index& type : m_systemUpdateOrder) {
+        auto it = m_systemMap.find(type);
+        if (it != m_systemMap.end()) {
+            it->second->update(deltaTime);
+            updated.push_back(it->second);
+        }
+    }
+
+    for (auto& system : m_systems) {
+        if (std::find(updated.begin(), updated.end(), system.get()) == updated.end()) {
+            system->update(deltaTime);
+        }
+    }
+}
+
+void ECSManager::registerSystemUpdateOrder(const std::vector<std::type_index>& order) {
+    m_systemUpdateOrder = order;
+}
+
+// Entity queries
+std::vector<Entity> ECSManager::getEntitiesWithSignature(const Signature& signature) const {
+    std::vector<Entity> entities;
+    for (Entity entity : m_entities) {
+        if (matches(m_entitySignatures[entity], signature)) {
+            entities.push_back(entity);
+        }
+    }
+    return entities;
+}
+
+std::vector<Entity> ECSManager::getEntitiesWithComponent(ComponentType componentType) const {
+    // The pool already lists exactly these entities
+    auto it = m_componentPools.find(componentType);
+    if (it == m_componentPools.end()) {
+        return {};
+    }
+
+    const IComponentPool& pool = *it->second;
+    return std::vector<Entity>(pool.getEntityData(), pool.getEntityData() + pool.size());
+}
+
+std::vector<Entity> ECSManager::getEntitiesWithComponents(const std::vector<ComponentType>& componentTypes) const {
+    Signature signature;
+    for (ComponentType type : componentTypes) {
+        signature.set(type);
+    }
+    return getEntitiesWithSignature(signature);
+}
+
+// Event system
+void ECSManager::onEntityAdded(EntityEvent callback) {
+    m_entityAddedCallbacks.push_back(std::move(callback));
+}
+
+void ECSManager::onEntityRemoved(EntityEvent callback) {
+    m_entityRemovedCallbacks.push_back(std::move(callback));
+}
+
+void ECSManager::onComponentAdded(ComponentEvent callback) {
+    m_componentAddedCallbacks.push_back(std::move(callback));
+}
+
+void ECSManager::onComponentRemoved(ComponentEvent callback) {
+    m_componentRemovedCallbacks.push_back(std::move(callback));
+}
+
+// Debug information
+void ECSManager::printECSInfo() const {
+    std::cout << "ECS: " << m_entities.size() << " entities, " << m_componentPools.size()
+              << " component pools, " << m_systems.size() << " systems" << std::endl;
+    for (const auto& [type, pool] : m_componentPools) {
+        std::cout << "  component " << static_cast<int>(type) << ": " << pool->size() << " x "
+                  << pool->getComponentSize() << " bytes" << std::endl;
+    }
+}
+
+// Internal methods
+void ECSManager::addEntityToSystems(Entity entity) {
+    for (auto& system : m_systems) {
+        if (matches(m_entitySignatures[entity], system->getSignature())) {
+            system->onEntityAdded(entity);
+        }
+    }
+}
+
+void ECSManager::removeEntityFromSystems(Entity entity) {
+    for (auto& system : m_systems) {
+        if (matches(m_entitySignatures[entity], system->getSignature())) {
+            system->onEntityRemoved(entity);
+        }
+    }
+}
+
+void ECSManager::updateEntitySignature(Entity entity, const Signature& newSignature) {
+    Signature oldSignature = m_entitySignatures[entity];
+    m_entitySignatures[entity] = newSignature;
+
+    for (auto& system : m_systems) {
+        bool before = matches(oldSignature, system->getSignature());
+        bool after = matches(newSignature, system->getSignature());
+        if (!before && after) {
+            system->onEntityAdded(entity);
+        } else if (before && !after) {
+            system->onEntityRemoved(entity);
+        }
+    }
+}
+
+void ECSManager::notifyEntityAdded(Entity entity) {
+    addEntityToSystems(entity);
+    for (const auto& callback : m_entityAddedCallbacks) {
+        callback(entity);
+    }
+}
+
+void ECSManager::notifyEntityRemoved(Entity entity) {
+    removeEntityFromSystems(entity);
+    for (const auto& callback : m_entityRemovedCallbacks) {
+        callback(entity);
+    }
+}
+
+// The signature already includes the component; systems that match only
+// now gain the entity
+void ECSManager::notifyComponentAdded(Entity entity, ComponentType componentType) {
+    const Signature& signature = m_entitySignatures[entity];
+    Signature previous = signature;
+    previous.reset(componentType);
+
+    for (auto& system : m_systems) {
+        if (!matches(signature, system->getSignature())) {
+            continue;
+        }
+        if (!matches(previous, system->getSignature())) {
+            system->onEntityAdded(entity);
+        }
+        system->onComponentAdded(entity, componentType);
+    }
+
+    for (const auto& callback : m_componentAddedCallbacks) {
+        callback(entity, componentType);
+    }
+}
+
+// The signature no longer includes the component; systems that matched
+// before lose the entity
+void ECSManager::notifyComponentRemoved(Entity entity, ComponentType componentType) {
+    const Signature& signature = m_entitySignatures[entity];
+    Signature previous = signature;
+    previous.set(componentType);
+
+    for (auto& system : m_systems) {
+        if (!matches(previous, system->getSignature())) {
+            continue;
+        }
+        system->onComponentRemoved(entity, componentType);
+        if (!matches(signature, system->getSignature())) {
+            system->onEntityRemoved(entity);
+        }
+    }
+
+    for (const auto& callback : m_componentRemovedCallbacks) {
+        callback(entity, componentType);
+    }
+}
+
+} // namespace VortexEngine
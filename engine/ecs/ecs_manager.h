@@ -7,7 +7,9 @@
 #include <functional>
 #include <typeindex>
 #include <bitset>
+#include <cstdint>
 #include <queue>
+#include <span>
 
 namespace VortexEngine {
 
@@ -41,21 +43,23 @@ public:
     static ComponentType GetNextComponentType() { return s_nextComponentType; }
 
 private:
-    static ComponentType s_nextComponentType;
+    static inline ComponentType s_nextComponentType = 0;
 };
 
-// Entity wrapper class
-class Entity {
+class ECSManager;
+
+// Entity handle bound to its manager; converts to the plain Entity id
+class EntityHandle {
 public:
-    Entity(uint32_t id = INVALID_ENTITY, ECSManager* manager = nullptr)
+    EntityHandle(Entity id = INVALID_ENTITY, ECSManager* manager = nullptr)
         : m_id(id), m_manager(manager) {}
     
-    Entity(const Entity& other) = default;
-    Entity& operator=(const Entity& other) = default;
-    Entity(Entity&& other) noexcept = default;
-    Entity& operator=(Entity&& other) noexcept = default;
+    EntityHandle(const EntityHandle& other) = default;
+    EntityHandle& operator=(const EntityHandle& other) = default;
+    EntityHandle(EntityHandle&& other) noexcept = default;
+    EntityHandle& operator=(EntityHandle&& other) noexcept = default;
     
-    ~Entity() = default;
+    ~EntityHandle() = default;
 
     // Entity operations
     bool isValid() const { return m_id != INVALID_ENTITY && m_manager != nullptr; }
@@ -74,18 +78,12 @@ public:
     template<typename T>
     void removeComponent();
 
-    // Entity relationships
-    Entity createChild();
-    Entity getParent() const;
-    void setParent(Entity parent);
-    const std::vector<Entity>& getChildren() const;
-
     // Utility
-    uint32_t getId() const { return m_id; }
-    operator uint32_t() const { return m_id; }
+    Entity getId() const { return m_id; }
+    operator Entity() const { return m_id; }
 
 private:
-    uint32_t m_id;
+    Entity m_id;
     ECSManager* m_manager;
 };
 
@@ -119,6 +117,11 @@ private:
     Signature m_signature;
 };
 
+// Component storage
+class IComponentPool;
+template<typename T>
+class ComponentPool;
+
 // ECS Manager
 class ECSManager {
 public:
@@ -151,6 +154,16 @@ public:
     template<typename T>
     void removeComponent(Entity entity);
 
+    // Dense component storage (null if T was never registered)
+    template<typename T>
+    ComponentPool<T>* getComponentPool();
+
+    IComponentPool* getComponentPool(ComponentType componentType);
+
+    // Moves changes deferred by exported buffer views into dense storage;
+    // runs at the start of updateSystems()
+    void applyPendingChanges();
+
     // System management
     template<typename T>
     T& addSystem();
@@ -187,10 +200,11 @@ public:
 
 private:
     // Entity management
+    // Ids index m_entitySignatures; destroyed ids are reused first
     std::queue<Entity> m_availableEntities;
     std::vector<Entity> m_entities;
     std::vector<Signature> m_entitySignatures;
-    std::unordered_map<EntityId, Entity> m_entityMap;
+    std::unordered_map<EntityId, size_t> m_entityIndices;   // Position in m_entities
 
     // Component management
     std::unordered_map<ComponentType, std::unique_ptr<class IComponentPool>> m_componentPools;
@@ -220,16 +234,43 @@ private:
 };
 
 // Component pool interface
+//
+// Pools store components densely: getComponentData() points at size()
+// contiguous components of getComponentSize() bytes, and getEntityData() at
+// the owning entity of each one. Both pointers are invalidated by adding or
+// removing a component. While Python buffer views are exported
+// (getExportCount() > 0) the dense storage is therefore left alone: adds and
+// removes are recorded as pending and visible through hasComponent() and
+// findComponent() right away, but only reach the dense arrays when
+// applyPendingChanges() runs with no exports outstanding.
 class IComponentPool {
 public:
     virtual ~IComponentPool() = default;
     virtual void removeEntity(Entity entity) = 0;
-    virtual void* getComponent(Entity entity) = 0;
-    virtual const void* getComponent(Entity entity) const = 0;
+    virtual void* findComponent(Entity entity) = 0;
+    virtual const void* findComponent(Entity entity) const = 0;
     virtual Signature getSignature() const = 0;
+
+    // Dense storage
+    virtual void* getComponentData() = 0;
+    virtual const Entity* getEntityData() const = 0;
+    virtual size_t getComponentSize() const = 0;
+    virtual size_t size() const = 0;
+
+    // Deferred structural changes; a no-op while buffers are exported
+    virtual void applyPendingChanges() = 0;
+    virtual bool hasPendingChanges() const = 0;
+
+    // Buffer exports
+    void acquireExport() { m_exportCount++; }
+    void releaseExport() { m_exportCount--; }
+    uint32_t getExportCount() const { return m_exportCount; }
+
+private:
+    uint32_t m_exportCount = 0;
 };
 
-// Component pool implementation
+// Component pool implementation (packed array, swap-remove)
 template<typename T>
 class ComponentPool : public IComponentPool {
 public:
@@ -238,53 +279,191 @@ public:
     }
 
     void addComponent(Entity entity, T component) {
-        if (m_components.find(entity) == m_components.end()) {
-            m_components[entity] = component;
+        if (hasComponent(entity)) {
+            return;
+        }
+
+        auto it = m_indices.find(entity);
+        if (it != m_indices.end()) {
+            // Re-added while its removal is pending: reuse the slot in place
+            m_pendingRemovals.erase(entity);
+            m_components[it->second] = std::move(component);
+            return;
         }
+
+        if (getExportCount() != 0) {
+            m_pendingAdds.emplace_back(entity, std::make_unique<T>(std::move(component)));
+            return;
+        }
+
+        applyPendingChanges();
+        m_indices[entity] = m_components.size();
+        m_components.push_back(std::move(component));
+        m_entities.push_back(entity);
     }
 
     T& getComponent(Entity entity) {
-        return m_components.at(entity);
+        if (T* pending = findPendingAdd(entity)) {
+            return *pending;
+        }
+        return m_components[m_indices.at(entity)];
     }
 
     const T& getComponent(Entity entity) const {
-        return m_components.at(entity);
+        return const_cast<ComponentPool*>(this)->getComponent(entity);
+    }
+
+    bool hasComponent(Entity entity) const {
+        if (m_indices.find(entity) != m_indices.end()) {
+            return m_pendingRemovals.find(entity) == m_pendingRemovals.end();
+        }
+        return const_cast<ComponentPool*>(this)->findPendingAdd(entity) != nullptr;
     }
 
     void removeComponent(Entity entity) {
-        m_components.erase(entity);
+        for (auto pending = m_pendingAdds.begin(); pending != m_pendingAdds.end(); ++pending) {
+            if (pending->first == entity) {
+                m_pendingAdds.erase(pending);
+                return;
+            }
+        }
+
+        if (m_indices.find(entity) == m_indices.end()) {
+            return;
+        }
+
+        if (getExportCount() != 0) {
+            m_pendingRemovals.insert(entity);
+            return;
+        }
+
+        applyPendingChanges();
+        eraseDense(entity);
+    }
+
+    void applyPendingChanges() override {
+        if (getExportCount() != 0) {
+            return;
+        }
+
+        for (Entity entity : m_pendingRemovals) {
+            eraseDense(entity);
+        }
+        m_pendingRemovals.clear();
+
+        for (auto& [entity, component] : m_pendingAdds) {
+            m_indices[entity] = m_components.size();
+            m_components.push_back(std::move(*component));
+            m_entities.push_back(entity);
+        }
+        m_pendingAdds.clear();
+    }
+
+    bool hasPendingChanges() const override {
+        return !m_pendingAdds.empty() || !m_pendingRemovals.empty();
     }
 
-    void* getComponent(Entity entity) override {
-        return &m_components[entity];
+    void removeEntity(Entity entity) override {
+        removeComponent(entity);
     }
 
-    const void* getComponent(Entity entity) const override {
-        return &m_components.at(entity);
+    void* findComponent(Entity entity) override {
+        return hasComponent(entity) ? &getComponent(entity) : nullptr;
+    }
+
+    const void* findComponent(Entity entity) const override {
+        return hasComponent(entity) ? &getComponent(entity) : nullptr;
     }
 
     Signature getSignature() const override {
         return m_signature;
     }
 
-    size_t size() const {
+    void* getComponentData() override {
+        return m_components.data();
+    }
+
+    const Entity* getEntityData() const override {
+        return m_entities.data();
+    }
+
+    size_t getComponentSize() const override {
+        return sizeof(T);
+    }
+
+    size_t size() const override {
         return m_components.size();
     }
 
+    // Typed dense access (pending changes are not included)
+    std::span<T> getComponents() { return m_components; }
+    std::span<const T> getComponents() const { return m_components; }
+    std::span<const Entity> getEntities() const { return m_entities; }
+
 private:
-    std::unordered_map<Entity, T> m_components;
+    std::vector<T> m_components;
+    std::vector<Entity> m_entities;
+    std::unordered_map<Entity, size_t> m_indices;
     Signature m_signature;
+
+    // Changes held back while buffers are exported. Pending components live
+    // behind unique_ptr so references handed out stay valid until applied.
+    std::vector<std::pair<Entity, std::unique_ptr<T>>> m_pendingAdds;
+    std::unordered_set<Entity> m_pendingRemovals;
+
+    T* findPendingAdd(Entity entity) {
+        for (auto& [pendingEntity, component] : m_pendingAdds) {
+            if (pendingEntity == entity) {
+                return component.get();
+            }
+        }
+        return nullptr;
+    }
+
+    void eraseDense(Entity entity) {
+        auto it = m_indices.find(entity);
+        size_t index = it->second;
+        size_t last = m_components.size() - 1;
+        if (index != last) {
+            m_components[index] = std::move(m_components[last]);
+            m_entities[index] = m_entities[last];
+            m_indices[m_entities[index]] = index;
+        }
+        m_components.pop_back();
+        m_entities.pop_back();
+        m_indices.erase(it);
+    }
 };
 
-// Entity implementation
-inline void Entity::destroy() {
+// Entity handle implementation
+inline void EntityHandle::destroy() {
     if (isValid()) {
-        m_manager->destroyEntity(*this);
+        m_manager->destroyEntity(m_id);
         m_id = INVALID_ENTITY;
         m_manager = nullptr;
     }
 }
 
+template<typename T>
+bool EntityHandle::hasComponent() const {
+    return m_manager->hasComponent<T>(m_id);
+}
+
+template<typename T, typename... Args>
+T& EntityHandle::addComponent(Args&&... args) {
+    return m_manager->addComponent<T>(m_id, std::forward<Args>(args)...);
+}
+
+template<typename T>
+T& EntityHandle::getComponent() const {
+    return m_manager->getComponent<T>(m_id);
+}
+
+template<typename T>
+void EntityHandle::removeComponent() {
+    m_manager->removeComponent<T>(m_id);
+}
+
 // ECS Manager template implementations
 template<typename T>
 void ECSManager::registerComponent() {
@@ -309,8 +488,11 @@ T& ECSManager::addComponent(Entity entity, Args&&... args) {
         registerComponent<T>();
     }
 
-    // Add component to pool
+    // Add component to pool; an existing component is kept
     ComponentPool<T>* pool = static_cast<ComponentPool<T>*>(m_componentPools[type].get());
+    if (pool->hasComponent(entity)) {
+        return pool->getComponent(entity);
+    }
     T component = T(std::forward<Args>(args)...);
     pool->addComponent(entity, component);
 
@@ -326,7 +508,7 @@ T& ECSManager::addComponent(Entity entity, Args&&... args) {
 template<typename T>
 T& ECSManager::getComponent(Entity entity) const {
     ComponentType type = ComponentRegistry::GetComponentType<T>();
-    ComponentPool<T>* pool = static_cast<ComponentPool<T>*>(m_componentPools[type].get());
+    ComponentPool<T>* pool = static_cast<ComponentPool<T>*>(m_componentPools.at(type).get());
     return pool->getComponent(entity);
 }
 
@@ -336,6 +518,9 @@ void ECSManager::removeComponent(Entity entity) {
     
     if (m_componentPools.find(type) != m_componentPools.end()) {
         ComponentPool<T>* pool = static_cast<ComponentPool<T>*>(m_componentPools[type].get());
+        if (!pool->hasComponent(entity)) {
+            return;
+        }
         pool->removeComponent(entity);
 
         // Update entity signature
@@ -346,5 +531,15 @@ void ECSManager::removeComponent(Entity entity) {
     }
 }
 
+template<typename T>
+ComponentPool<T>* ECSManager::getComponentPool() {
+    auto it = m_componentPools.find(ComponentRegistry::GetComponentType<T>());
+    return it != m_componentPools.end() ? static_cast<ComponentPool<T>*>(it->second.get()) : nullptr;
+}
+
+inline IComponentPool* ECSManager::getComponentPool(ComponentType componentType) {
+    auto it = m_componentPools.find(componentType);
+    return it != m_componentPools.end() ? it->second.get() : nullptr;
+}
 
 } // namespace VortexEngine
\ No newline at end of file
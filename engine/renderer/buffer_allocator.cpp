@@ -1,5 +1,6 @@
 #include "buffer_allocator.h"
 #include "../core/memory_manager.h"
+#include "../utils/metrics.h"
 #include <iostream>
 #include <cstring>
 #include <algorithm>
@@ -32,6 +33,7 @@ bool BufferAllocator::initialize(VkDevice device, VkPhysicalDevice physicalDevic
         // Calculate alignment requirements for different buffer types
         VkPhysicalDeviceProperties properties;
         vkGetPhysicalDeviceProperties(physicalDevice, &properties);
+        vkGetPhysicalDeviceMemoryProperties(physicalDevice, &m_memoryProperties);
 
         // Alignments based on buffer type and device limits
         m_alignments[static_cast<size_t>(BufferType::Vertex)] = std::max(properties.limits.minUniformBufferOffsetAlignment, static_cast<VkDeviceSize>(1));
@@ -63,11 +65,11 @@ void BufferAllocator::shutdown() {
 
     // Destroy all individual allocations
     std::lock_guard<std::mutex> lock(m_bufferMutex);
-    for (auto& allocation : m_allocations) {
+    std::unordered_map<VkBuffer, BufferAllocation> allocations = std::move(m_bufferMap);
+    m_bufferMap.clear();
+    for (auto& [buffer, allocation] : allocations) {
         destroyBufferInternal(allocation);
     }
-    m_allocations.clear();
-    m_bufferMap.clear();
 
     m_initialized = false;
     std::cout << "Buffer allocator shutdown complete" << std::endl;
@@ -453,7 +455,13 @@ BufferAllocator::BufferAllocation BufferAllocator::createBufferInternal(VkDevice
         VkMemoryAllocateInfo allocInfo{};
         allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
         allocInfo.allocationSize = memRequirements.size;
-        allocInfo.memoryTypeIndex = 0; // This should be properly determined
+        allocInfo.memoryTypeIndex = findMemoryType(memRequirements.memoryTypeBits, properties);
+        if (allocInfo.memoryTypeIndex == UINT32_MAX) {
+            std::cerr << "Failed to find suitable memory type for buffer" << std::endl;
+            vkDestroyBuffer(m_device, allocation.buffer, nullptr);
+            allocation.buffer = VK_NULL_HANDLE;
+            return {};
+        }
 
         result = vkAllocateMemory(m_device, &allocInfo, nullptr, &allocation.memory);
         if (result != VK_SUCCESS) {
@@ -476,7 +484,6 @@ BufferAllocator::BufferAllocation BufferAllocator::createBufferInternal(VkDevice
     }
 
     // Store in tracking structures
-    m_allocations.push_back(allocation);
     m_bufferMap[allocation.buffer] = allocation;
     updateBufferTracking(allocation, true);
 
@@ -487,6 +494,7 @@ void BufferAllocator::destroyBufferInternal(const BufferAllocation& allocation)
     if (allocation.buffer == VK_NULL_HANDLE) {
         return;
     }
+    VkBuffer buffer = allocation.buffer;
 
     // Unmap if mapped
     if (allocation.mappedPtr) {
@@ -509,10 +517,16 @@ void BufferAllocator::destroyBufferInternal(const BufferAllocation& allocation)
     }
 
     // Remove from tracking
-    m_bufferMap.erase(allocation.buffer);
+    m_bufferMap.erase(buffer);
 }
 
 void BufferAllocator::updateBufferTracking(const BufferAllocation& allocation, bool allocate) {
+    static Gauge& bytesAllocated = MetricsRegistry::getInstance().gauge(MetricNames::BufferBytesAllocated);
+    static Gauge& allocationCount = MetricsRegistry::getInstance().gauge(MetricNames::BufferAllocations);
+    int64_t sign = allocate ? 1 : -1;
+    bytesAllocated.add(sign * static_cast<int64_t>(allocation.size));
+    allocationCount.add(sign);
+
     if (allocate) {
         m_totalAllocatedMemory += allocation.size;
         m_bufferCount++;
@@ -558,7 +572,13 @@ void BufferAllocator::createBufferPoolInternal(BufferPool& pool, BufferType type
         VkMemoryAllocateInfo allocInfo{};
         allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
         allocInfo.allocationSize = memRequirements.size;
-        allocInfo.memoryTypeIndex = 0;
+        allocInfo.memoryTypeIndex = findMemoryType(memRequirements.memoryTypeBits, properties);
+        if (allocInfo.memoryTypeIndex == UINT32_MAX) {
+            std::cerr << "Failed to find suitable memory type for pool" << std::endl;
+            vkDestroyBuffer(m_device, pool.buffer, nullptr);
+            pool.buffer = VK_NULL_HANDLE;
+            return;
+        }
 
         result = vkAllocateMemory(m_device, &allocInfo, nullptr, &pool.memory);
         if (result != VK_SUCCESS) {
@@ -599,4 +619,13 @@ void BufferAllocator::destroyBufferPoolInternal(BufferPool& pool) {
     pool.usedSize = 0;
 }
 
-} // namespace VortexEngine
\ No newline at end of file
+uint32_t BufferAllocator::findMemoryType(uint32_t typeBits, VkMemoryPropertyFlags properties) const {
+    for (uint32_t i = 0; i < m_memoryProperties.memoryTypeCount; i++) {
+        if ((typeBits & (1u << i)) && (m_memoryProperties.memoryTypes[i].propertyFlags & properties) == properties) {
+            return i;
+        }
+    }
+    return UINT32_MAX;
+}
+
+} // namespace VortexEngine
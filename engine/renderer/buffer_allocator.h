@@ -1,6 +1,6 @@
 #pragma once
 
-#include <vulkan/vulkan.h>
+#include "../core/vulkan_dispatch.h"
 #include <vector>
 #include <unordered_map>
 #include <memory>
@@ -110,9 +110,9 @@ private:
     VkDevice m_device = VK_NULL_HANDLE;
     VkPhysicalDevice m_physicalDevice = VK_NULL_HANDLE;
     MemoryManager* m_memoryManager = nullptr;
+    VkPhysicalDeviceMemoryProperties m_memoryProperties{};
 
-    // Buffer storage
-    std::vector<BufferAllocation> m_allocations;
+    // Buffer storage (dedicated allocations, keyed by handle)
     std::unordered_map<VkBuffer, BufferAllocation> m_bufferMap;
     std::vector<BufferPool> m_bufferPools;
 
@@ -136,6 +136,7 @@ private:
     BufferPool* findBufferPool(BufferType type, VkDeviceSize size);
     void createBufferPoolInternal(BufferPool& pool, BufferType type, VkDeviceSize size);
     void destroyBufferPoolInternal(BufferPool& pool);
+    uint32_t findMemoryType(uint32_t typeBits, VkMemoryPropertyFlags properties) const;
 };
 
 // Buffer creation helpers
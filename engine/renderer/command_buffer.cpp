@@ -1,4 +1,5 @@
 #include "command_buffer.h"
+#include "../utils/metrics.h"
 #include <iostream>
 #include <stdexcept>
 #include <algorithm>
@@ -62,6 +63,8 @@ void CommandBuffer::beginRecording(VkCommandBufferUsageFlags flags) {
         return;
     }
 
+    m_drawCalls = 0;
+    m_pipelineBinds = 0;
     m_isRecording = true;
 }
 
@@ -78,6 +81,13 @@ void CommandBuffer::endRecording() {
     }
 
     m_isRecording = false;
+
+    // Counted locally and published once per recording, so parallel
+    // recording does not contend on the shared counters for every draw
+    static Counter& drawCalls = MetricsRegistry::getInstance().counter(MetricNames::DrawCalls);
+    static Counter& pipelineBinds = MetricsRegistry::getInstance().counter(MetricNames::PipelineBinds);
+    drawCalls.add(m_drawCalls);
+    pipelineBinds.add(m_pipelineBinds);
 }
 
 void CommandBuffer::reset() {
@@ -128,6 +138,7 @@ void CommandBuffer::bindPipeline(VkPipeline pipeline) {
     }
 
     vkCmdBindPipeline(m_commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline);
+    m_pipelineBinds++;
 }
 
 void CommandBuffer::bindVertexBuffers(VkBuffer vertexBuffer, VkDeviceSize offset) {
@@ -171,6 +182,7 @@ void CommandBuffer::draw(uint32_t vertexCount, uint32_t instanceCount,
     }
 
     vkCmdDraw(m_commandBuffer, vertexCount, instanceCount, firstVertex, firstInstance);
+    m_drawCalls++;
 }
 
 void CommandBuffer::drawIndexed(uint32_t indexCount, uint32_t instanceCount, 
@@ -183,6 +195,7 @@ void CommandBuffer::drawIndexed(uint32_t indexCount, uint32_t instanceCount,
 
     vkCmdDrawIndexed(m_commandBuffer, indexCount, instanceCount, firstIndex, 
                     vertexOffset, firstInstance);
+    m_drawCalls++;
 }
 
 void CommandBuffer::setViewport(uint32_t firstViewport, uint32_t viewportCount, 
@@ -293,6 +306,99 @@ void CommandBuffer::transitionImageLayout(VkImage image, VkImageLayout oldLayout
                         1, &barrier);
 }
 
+void CommandBuffer::releaseOwnership(VkBuffer buffer, const QueueOwnershipTransfer& transfer,
+                                     VkDeviceSize offset, VkDeviceSize size) {
+    VkBufferMemoryBarrier barrier{};
+    barrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+    barrier.buffer = buffer;
+    barrier.offset = offset;
+    barrier.size = size;
+    recordOwnershipBarrier(transfer, true, &barrier, nullptr);
+}
+
+void CommandBuffer::acquireOwnership(VkBuffer buffer, const QueueOwnershipTransfer& transfer,
+                                     VkDeviceSize offset, VkDeviceSize size) {
+    VkBufferMemoryBarrier barrier{};
+    barrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+    barrier.buffer = buffer;
+    barrier.offset = offset;
+    barrier.size = size;
+    recordOwnershipBarrier(transfer, false, &barrier, nullptr);
+}
+
+void CommandBuffer::releaseOwnership(VkImage image, VkImageAspectFlags aspectMask,
+                                     const QueueOwnershipTransfer& transfer) {
+    VkImageMemoryBarrier barrier{};
+    barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+    barrier.image = image;
+    barrier.subresourceRange = {aspectMask, 0, VK_REMAINING_MIP_LEVELS, 0, VK_REMAINING_ARRAY_LAYERS};
+    recordOwnershipBarrier(transfer, true, nullptr, &barrier);
+}
+
+void CommandBuffer::acquireOwnership(VkImage image, VkImageAspectFlags aspectMask,
+                                     const QueueOwnershipTransfer& transfer) {
+    VkImageMemoryBarrier barrier{};
+    barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+    barrier.image = image;
+    barrier.subresourceRange = {aspectMask, 0, VK_REMAINING_MIP_LEVELS, 0, VK_REMAINING_ARRAY_LAYERS};
+    recordOwnershipBarrier(transfer, false, nullptr, &barrier);
+}
+
+void CommandBuffer::recordOwnershipBarrier(const QueueOwnershipTransfer& transfer, bool release,
+                                           VkBufferMemoryBarrier* bufferBarrier, VkImageMemoryBarrier* imageBarrier) {
+    if (!m_isRecording) {
+        std::cerr << "Cannot transfer queue ownership - command buffer not recording" << std::endl;
+        return;
+    }
+
+    VkPipelineStageFlags srcStageMask = transfer.srcStageMask;
+    VkPipelineStageFlags dstStageMask = transfer.dstStageMask;
+    VkAccessFlags srcAccessMask = transfer.srcAccessMask;
+    VkAccessFlags dstAccessMask = transfer.dstAccessMask;
+    uint32_t srcQueueFamilyIndex = transfer.srcQueueFamilyIndex;
+    uint32_t dstQueueFamilyIndex = transfer.dstQueueFamilyIndex;
+
+    if (srcQueueFamilyIndex == dstQueueFamilyIndex) {
+        // No transfer needed; the release side makes the writes visible
+        if (!release) {
+            return;
+        }
+        srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    } else if (release) {
+        // The acquire's semaphore wait provides the rest of the dependency
+        dstStageMask = VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT;
+        dstAccessMask = 0;
+    } else {
+        srcStageMask = VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
+        srcAccessMask = 0;
+    }
+
+    uint32_t bufferBarrierCount = 0;
+    uint32_t imageBarrierCount = 0;
+    if (bufferBarrier) {
+        bufferBarrier->srcAccessMask = srcAccessMask;
+        bufferBarrier->dstAccessMask = dstAccessMask;
+        bufferBarrier->srcQueueFamilyIndex = srcQueueFamilyIndex;
+        bufferBarrier->dstQueueFamilyIndex = dstQueueFamilyIndex;
+        bufferBarrierCount = 1;
+    }
+    if (imageBarrier) {
+        imageBarrier->srcAccessMask = srcAccessMask;
+        imageBarrier->dstAccessMask = dstAccessMask;
+        imageBarrier->oldLayout = transfer.oldLayout;
+        imageBarrier->newLayout = transfer.newLayout;
+        imageBarrier->srcQueueFamilyIndex = srcQueueFamilyIndex;
+        imageBarrier->dstQueueFamilyIndex = dstQueueFamilyIndex;
+        imageBarrierCount = 1;
+    }
+
+    vkCmdPipelineBarrier(m_commandBuffer, srcStageMask, dstStageMask, 0,
+                        0, nullptr,
+                        bufferBarrierCount, bufferBarrier,
+                        imageBarrierCount, imageBarrier);
+}
+
 void CommandBuffer::copyBufferToImage(VkBuffer buffer, VkImage image, uint32_t width, 
                                      uint32_t height, uint32_t layerCount) {
     if (!m_isRecording) {
@@ -1,12 +1,27 @@
 #pragma once
 
-#include <vulkan/vulkan.h>
+#include "../core/vulkan_dispatch.h"
 #include <vector>
 #include <memory>
 #include <mutex>
 
 namespace VortexEngine {
 
+// Moves an exclusive resource between queue families. The same description
+// is recorded twice: released on a queue of the source family, then acquired
+// on a queue of the destination family after a semaphore wait. The layouts
+// only apply to images
+struct QueueOwnershipTransfer {
+    uint32_t srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    uint32_t dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    VkPipelineStageFlags srcStageMask = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+    VkAccessFlags srcAccessMask = 0;
+    VkPipelineStageFlags dstStageMask = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+    VkAccessFlags dstAccessMask = 0;
+    VkImageLayout oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+    VkImageLayout newLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+};
+
 class CommandBuffer {
 public:
     CommandBuffer(VkDevice device, VkCommandPool commandPool);
@@ -66,11 +81,28 @@ public:
     void blitImage(VkImage srcImage, VkImage dstImage, 
                   const VkImageBlit* region, VkFilter filter);
 
+    // Queue family ownership transfer. Within one family the release records
+    // an ordinary barrier and the acquire records nothing
+    void releaseOwnership(VkBuffer buffer, const QueueOwnershipTransfer& transfer,
+                         VkDeviceSize offset = 0, VkDeviceSize size = VK_WHOLE_SIZE);
+    void acquireOwnership(VkBuffer buffer, const QueueOwnershipTransfer& transfer,
+                         VkDeviceSize offset = 0, VkDeviceSize size = VK_WHOLE_SIZE);
+    void releaseOwnership(VkImage image, VkImageAspectFlags aspectMask, const QueueOwnershipTransfer& transfer);
+    void acquireOwnership(VkImage image, VkImageAspectFlags aspectMask, const QueueOwnershipTransfer& transfer);
+
 private:
     VkDevice m_device;
     VkCommandPool m_commandPool;
     VkCommandBuffer m_commandBuffer;
     bool m_isRecording;
+
+    // Shared by the ownership transfer helpers
+    void recordOwnershipBarrier(const QueueOwnershipTransfer& transfer, bool release,
+                               VkBufferMemoryBarrier* bufferBarrier, VkImageMemoryBarrier* imageBarrier);
+
+    // Published to the metrics registry by endRecording()
+    uint64_t m_drawCalls = 0;
+    uint64_t m_pipelineBinds = 0;
 };
 
 class CommandBufferManager {
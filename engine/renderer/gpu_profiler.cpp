@@ -0,0 +1,218 @@
+#include "gpu_profiler.h"
+#include "command_buffer.h"
+#include <iostream>
+
+namespace VortexEngine {
+
+GpuProfileScope::GpuProfileScope(GpuProfiler* profiler, CommandBuffer& commandBuffer, const char* name)
+    : GpuProfileScope(profiler, commandBuffer.getHandle(), name) {
+}
+
+GpuProfiler::~GpuProfiler() {
+    shutdown();
+}
+
+bool GpuProfiler::initialize(VkPhysicalDevice physicalDevice, VkDevice device, uint32_t queueFamilyIndex,
+                             uint32_t framesInFlight, uint32_t maxZonesPerFrame) {
+    if (m_initialized) {
+        std::cerr << "GPU profiler already initialized" << std::endl;
+        return true;
+    }
+
+    if (framesInFlight == 0 || maxZonesPerFrame == 0) {
+        std::cerr << "GPU profiler needs at least one frame and one zone" << std::endl;
+        return false;
+    }
+
+    VkPhysicalDeviceProperties properties;
+    vkGetPhysicalDeviceProperties(physicalDevice, &properties);
+    m_timestampPeriod = properties.limits.timestampPeriod;
+
+    uint32_t familyCount = 0;
+    vkGetPhysicalDeviceQueueFamilyProperties(physicalDevice, &familyCount, nullptr);
+    std::vector<VkQueueFamilyProperties> families(familyCount);
+    vkGetPhysicalDeviceQueueFamilyProperties(physicalDevice, &familyCount, families.data());
+    m_timestampValidBits = queueFamilyIndex < familyCount ? families[queueFamilyIndex].timestampValidBits : 0;
+
+    m_device = device;
+    m_frames.assign(framesInFlight, FrameQueries{});
+    m_currentFrame = 0;
+    m_frameActive = false;
+    m_droppedZones = 0;
+
+    if (!isSupported()) {
+        // Still initialized so callers need no special case; zones are ignored
+        std::cout << "GPU profiler: queue family has no timestamp support" << std::endl;
+        m_initialized = true;
+        return true;
+    }
+
+    // A frame zone plus begin/end for every user zone
+    m_queriesPerFrame = 2 + maxZonesPerFrame * 2;
+
+    VkQueryPoolCreateInfo poolInfo{};
+    poolInfo.sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+    poolInfo.queryType = VK_QUERY_TYPE_TIMESTAMP;
+    poolInfo.queryCount = m_queriesPerFrame * framesInFlight;
+
+    VkResult result = vkCreateQueryPool(m_device, &poolInfo, nullptr, &m_queryPool);
+    if (result != VK_SUCCESS) {
+        std::cerr << "Failed to create timestamp query pool: " << result << std::endl;
+        m_frames.clear();
+        return false;
+    }
+
+    for (auto& frame : m_frames) {
+        frame.zones.reserve(maxZonesPerFrame + 1);
+    }
+
+    m_initialized = true;
+    return true;
+}
+
+void GpuProfiler::shutdown() {
+    if (!m_initialized) {
+        return;
+    }
+
+    if (m_queryPool != VK_NULL_HANDLE) {
+        vkDestroyQueryPool(m_device, m_queryPool, nullptr);
+        m_queryPool = VK_NULL_HANDLE;
+    }
+
+    m_frames.clear();
+    m_frameActive = false;
+    m_initialized = false;
+}
+
+void GpuProfiler::beginFrame(VkCommandBuffer commandBuffer, uint32_t frameSlot) {
+    if (!m_initialized || m_queryPool == VK_NULL_HANDLE) {
+        return;
+    }
+    if (frameSlot >= m_frames.size()) {
+        std::cerr << "GPU profiler frame slot " << frameSlot << " is outside its " << m_frames.size()
+                  << " frames in flight" << std::endl;
+        m_frameActive = false;
+        return;
+    }
+
+    m_currentFrame = frameSlot;
+    FrameQueries& frame = m_frames[m_currentFrame];
+    if (frame.pending) {
+        resolveFrame(m_currentFrame);
+    }
+
+    frame.zones.clear();
+    frame.queryCount = 0;
+    m_frameActive = Profiler::isCapturing();
+    if (!m_frameActive) {
+        return;
+    }
+
+    vkCmdResetQueryPool(commandBuffer, m_queryPool, m_currentFrame * m_queriesPerFrame, m_queriesPerFrame);
+    beginZone(commandBuffer, "GPU Frame");
+}
+
+void GpuProfiler::endFrame(VkCommandBuffer commandBuffer) {
+    if (!m_frameActive) {
+        return;
+    }
+
+    FrameQueries& frame = m_frames[m_currentFrame];
+    endZone(commandBuffer, 0);
+    frame.cpuAnchor = Profiler::now();
+    frame.pending = true;
+    m_frameActive = false;
+}
+
+void GpuProfiler::flush() {
+    // The caller has waited for the GPU, so every submitted range is complete
+    for (uint32_t frameSlot = 0; frameSlot < m_frames.size(); ++frameSlot) {
+        if (m_frames[frameSlot].pending) {
+            resolveFrame(frameSlot);
+        }
+    }
+}
+
+uint32_t GpuProfiler::beginZone(VkCommandBuffer commandBuffer, const char* name) {
+    if (!m_frameActive) {
+        return INVALID_ZONE;
+    }
+
+    FrameQueries& frame = m_frames[m_currentFrame];
+    if (frame.queryCount + 2 > m_queriesPerFrame) {
+        m_droppedZones++;
+        return INVALID_ZONE;
+    }
+
+    Zone zone;
+    zone.name = name;
+    zone.beginQuery = writeTimestamp(commandBuffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT);
+    zone.endQuery = frame.queryCount++;   // Reserved; written by endZone
+    frame.zones.push_back(zone);
+    return static_cast<uint32_t>(frame.zones.size() - 1);
+}
+
+void GpuProfiler::endZone(VkCommandBuffer commandBuffer, uint32_t zone) {
+    if (!m_frameActive || zone == INVALID_ZONE) {
+        return;
+    }
+
+    FrameQueries& frame = m_frames[m_currentFrame];
+    uint32_t base = m_currentFrame * m_queriesPerFrame;
+    vkCmdWriteTimestamp(commandBuffer, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, m_queryPool,
+                        base + frame.zones[zone].endQuery);
+}
+
+uint32_t GpuProfiler::writeTimestamp(VkCommandBuffer commandBuffer, VkPipelineStageFlagBits stage) {
+    FrameQueries& frame = m_frames[m_currentFrame];
+    uint32_t query = frame.queryCount++;
+    vkCmdWriteTimestamp(commandBuffer, stage, m_queryPool, m_currentFrame * m_queriesPerFrame + query);
+    return query;
+}
+
+void GpuProfiler::resolveFrame(uint32_t frameSlot) {
+    FrameQueries& frame = m_frames[frameSlot];
+    frame.pending = false;
+    if (frame.queryCount == 0) {
+        return;
+    }
+
+    // Value/availability pairs; the slot's fence has signalled, so nothing waits
+    std::vector<uint64_t> results(size_t(frame.queryCount) * 2);
+    VkResult result = vkGetQueryPoolResults(m_device, m_queryPool, frameSlot * m_queriesPerFrame, frame.queryCount,
+                                            results.size() * sizeof(uint64_t), results.data(), 2 * sizeof(uint64_t),
+                                            VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WITH_AVAILABILITY_BIT);
+    if (result != VK_SUCCESS && result != VK_NOT_READY) {
+        std::cerr << "Failed to read GPU timestamps: " << result << std::endl;
+        return;
+    }
+
+    uint64_t mask = m_timestampValidBits >= 64 ? UINT64_MAX : (uint64_t(1) << m_timestampValidBits) - 1;
+    auto available = [&](uint32_t query) { return results[size_t(query) * 2 + 1] != 0; };
+    auto ticks = [&](uint32_t query) { return results[size_t(query) * 2] & mask; };
+
+    // Zone 0 is the whole frame and anchors the rest
+    const Zone& frameZone = frame.zones[0];
+    if (!available(frameZone.beginQuery)) {
+        return;
+    }
+    uint64_t origin = ticks(frameZone.beginQuery);
+
+    Profiler& profiler = Profiler::getInstance();
+    for (const Zone& zone : frame.zones) {
+        if (!available(zone.beginQuery) || !available(zone.endQuery)) {
+            continue;
+        }
+
+        // Counters may wrap at timestampValidBits; differences stay correct modulo the mask
+        uint64_t begin = (ticks(zone.beginQuery) - origin) & mask;
+        uint64_t end = (ticks(zone.endQuery) - origin) & mask;
+        profiler.recordEvent(zone.name,
+                             frame.cpuAnchor + static_cast<uint64_t>(static_cast<double>(begin) * m_timestampPeriod),
+                             frame.cpuAnchor + static_cast<uint64_t>(static_cast<double>(end) * m_timestampPeriod),
+                             PROFILE_EVENT_GPU);
+    }
+}
+
+} // namespace VortexEngine
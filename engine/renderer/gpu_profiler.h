@@ -0,0 +1,123 @@
+#pragma once
+
+#include "../core/vulkan_dispatch.h"
+#include <cstdint>
+#include <vector>
+
+#include "../utils/profiler.h"
+
+namespace VortexEngine {
+
+class CommandBuffer;
+
+// GPU zone timing with timestamp queries
+//
+// One query pool is split into a range per frame in flight, keyed by the
+// caller's frame slot (OffscreenTarget::getCurrentSlot() or
+// SyncObjects::getCurrentFrame()). beginFrame() is called after the slot's
+// fence has been waited on, so it resolves the range the slot wrote last time
+// without stalling and forwards the zones to the Profiler on the GPU track,
+// then resets the range for the new frame. Queries are only written while the
+// Profiler is capturing; flush() resolves the frames still in flight once the
+// GPU is idle, before a capture ends.
+//
+// GPU ticks are placed on the CPU timeline by anchoring the frame's first
+// timestamp to the CPU time at endFrame(), i.e. just before submission, so
+// GPU zones start no earlier than the work was handed to the queue.
+class GpuProfiler {
+public:
+    GpuProfiler() = default;
+    ~GpuProfiler();
+
+    GpuProfiler(const GpuProfiler&) = delete;
+    GpuProfiler& operator=(const GpuProfiler&) = delete;
+
+    // Lifecycle
+    bool initialize(VkPhysicalDevice physicalDevice, VkDevice device, uint32_t queueFamilyIndex,
+                    uint32_t framesInFlight, uint32_t maxZonesPerFrame = 256);
+    void shutdown();
+    bool isInitialized() const { return m_initialized; }
+    bool isSupported() const { return m_timestampValidBits != 0; }
+
+    // Frame interface (same command buffer for the whole frame)
+    void beginFrame(VkCommandBuffer commandBuffer, uint32_t frameSlot);
+    void endFrame(VkCommandBuffer commandBuffer);
+    void flush();
+
+    // Zones; name must be a string literal. Returns a zone id for endZone.
+    uint32_t beginZone(VkCommandBuffer commandBuffer, const char* name);
+    void endZone(VkCommandBuffer commandBuffer, uint32_t zone);
+
+    uint32_t getFramesInFlight() const { return static_cast<uint32_t>(m_frames.size()); }
+    uint64_t getDroppedZones() const { return m_droppedZones; }
+
+    static constexpr uint32_t INVALID_ZONE = UINT32_MAX;
+
+private:
+    struct Zone {
+        const char* name = nullptr;
+        uint32_t beginQuery = 0;
+        uint32_t endQuery = 0;
+    };
+
+    struct FrameQueries {
+        std::vector<Zone> zones;
+        uint32_t queryCount = 0;     // Queries written, starting at the range base
+        uint64_t cpuAnchor = 0;      // Profiler::now() at endFrame
+        bool pending = false;        // Submitted, not yet resolved
+    };
+
+    bool m_initialized = false;
+    VkDevice m_device = VK_NULL_HANDLE;
+    VkQueryPool m_queryPool = VK_NULL_HANDLE;
+
+    double m_timestampPeriod = 1.0;     // Nanoseconds per tick
+    uint32_t m_timestampValidBits = 0;
+    uint32_t m_queriesPerFrame = 0;
+
+    std::vector<FrameQueries> m_frames;
+    uint32_t m_currentFrame = 0;
+    bool m_frameActive = false;
+    uint64_t m_droppedZones = 0;
+
+    // Internal methods
+    void resolveFrame(uint32_t frameSlot);
+    uint32_t writeTimestamp(VkCommandBuffer commandBuffer, VkPipelineStageFlagBits stage);
+};
+
+// Records the enclosing scope as one GPU zone
+class GpuProfileScope {
+public:
+    GpuProfileScope(GpuProfiler* profiler, VkCommandBuffer commandBuffer, const char* name)
+        : m_profiler(profiler), m_commandBuffer(commandBuffer) {
+        if (m_profiler) {
+            m_zone = m_profiler->beginZone(m_commandBuffer, name);
+        }
+    }
+    GpuProfileScope(GpuProfiler* profiler, CommandBuffer& commandBuffer, const char* name);
+
+    ~GpuProfileScope() {
+        if (m_profiler) {
+            m_profiler->endZone(m_commandBuffer, m_zone);
+        }
+    }
+
+    GpuProfileScope(const GpuProfileScope&) = delete;
+    GpuProfileScope& operator=(const GpuProfileScope&) = delete;
+
+private:
+    GpuProfiler* m_profiler = nullptr;
+    VkCommandBuffer m_commandBuffer = VK_NULL_HANDLE;
+    uint32_t m_zone = GpuProfiler::INVALID_ZONE;
+};
+
+} // namespace VortexEngine
+
+// Usage: VORTEX_PROFILE_GPU_SCOPE(gpuProfiler, commandBuffer, "Shadows");
+// commandBuffer may be a VkCommandBuffer or a CommandBuffer.
+#if VORTEX_PROFILER_ENABLED
+#define VORTEX_PROFILE_GPU_SCOPE(profiler, commandBuffer, name) \
+    ::VortexEngine::GpuProfileScope VORTEX_PROFILE_CONCAT(vortexGpuProfileScope, __LINE__)(profiler, commandBuffer, name)
+#else
+#define VORTEX_PROFILE_GPU_SCOPE(profiler, commandBuffer, name) ((void)0)
+#endif
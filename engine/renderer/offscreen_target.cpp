@@ -0,0 +1,396 @@
+#include "offscreen_target.h"
+#include "../core/memory_manager.h"
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <limits>
+
+namespace VortexEngine {
+
+namespace {
+
+// Weight of the newest sample in the smoothed timings
+constexpr double STATS_SMOOTHING = 0.1;
+
+constexpr VkImageSubresourceRange COLOR_RANGE = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1};
+
+void imageBarrier(VkCommandBuffer commandBuffer, VkImage image,
+                  VkImageLayout oldLayout, VkImageLayout newLayout,
+                  VkAccessFlags srcAccess, VkAccessFlags dstAccess,
+                  VkPipelineStageFlags srcStage, VkPipelineStageFlags dstStage) {
+    VkImageMemoryBarrier barrier{};
+    barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+    barrier.oldLayout = oldLayout;
+    barrier.newLayout = newLayout;
+    barrier.srcAccessMask = srcAccess;
+    barrier.dstAccessMask = dstAccess;
+    barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    barrier.image = image;
+    barrier.subresourceRange = COLOR_RANGE;
+    vkCmdPipelineBarrier(commandBuffer, srcStage, dstStage, 0, 0, nullptr, 0, nullptr, 1, &barrier);
+}
+
+} // namespace
+
+OffscreenTarget::~OffscreenTarget() {
+    shutdown();
+}
+
+bool OffscreenTarget::initialize(VkDevice device, MemoryManager* memoryManager, VkQueue queue, uint32_t queueFamilyIndex,
+                                 uint32_t width, uint32_t height, VkFormat format, uint32_t ringSize) {
+    if (m_initialized) {
+        std::cout << "Offscreen target is already initialized" << std::endl;
+        return true;
+    }
+
+    if (device == VK_NULL_HANDLE || memoryManager == nullptr || queue == VK_NULL_HANDLE) {
+        std::cerr << "Offscreen target requires a device, memory manager and queue" << std::endl;
+        return false;
+    }
+
+    if (width == 0 || height == 0 || getFormatSize(format) == 0) {
+        std::cerr << "Unsupported offscreen target " << width << "x" << height << ", format " << format << std::endl;
+        return false;
+    }
+
+    m_device = device;
+    m_memoryManager = memoryManager;
+    m_queue = queue;
+    m_width = width;
+    m_height = height;
+    m_format = format;
+    m_stats = OffscreenTargetStats{};
+
+    VkCommandPoolCreateInfo poolInfo{};
+    poolInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+    poolInfo.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+    poolInfo.queueFamilyIndex = queueFamilyIndex;
+
+    VkResult result = vkCreateCommandPool(m_device, &poolInfo, nullptr, &m_commandPool);
+    if (result != VK_SUCCESS) {
+        std::cerr << "Failed to create offscreen command pool: " << result << std::endl;
+        return false;
+    }
+
+    m_slots.resize(std::max(ringSize, 1u));
+    for (Slot& slot : m_slots) {
+        if (!createSlot(slot)) {
+            m_initialized = true;
+            shutdown();
+            return false;
+        }
+    }
+
+    m_currentSlot = 0;
+    m_frameActive = false;
+    m_initialized = true;
+    std::cout << "Offscreen target created: " << width << "x" << height << ", " << m_slots.size()
+              << " readback slots" << std::endl;
+    return true;
+}
+
+void OffscreenTarget::shutdown() {
+    if (!m_initialized) {
+        return;
+    }
+
+    if (m_frameActive) {
+        vkEndCommandBuffer(m_slots[m_currentSlot].commandBuffer);
+        m_frameActive = false;
+    }
+
+    flush();
+
+    for (Slot& slot : m_slots) {
+        destroySlot(slot);
+    }
+    m_slots.clear();
+
+    if (m_commandPool != VK_NULL_HANDLE) {
+        vkDestroyCommandPool(m_device, m_commandPool, nullptr);
+        m_commandPool = VK_NULL_HANDLE;
+    }
+
+    m_readbackCallback = nullptr;
+    m_initialized = false;
+}
+
+VkCommandBuffer OffscreenTarget::beginFrame(uint64_t frameIndex) {
+    if (!m_initialized || m_frameActive) {
+        std::cerr << "Cannot begin offscreen frame - " << (m_initialized ? "a frame is already active" : "target not initialized") << std::endl;
+        return VK_NULL_HANDLE;
+    }
+
+    // Reusing the oldest slot: its readback is due
+    m_currentSlot = static_cast<uint32_t>(m_stats.framesSubmitted % m_slots.size());
+    Slot& slot = m_slots[m_currentSlot];
+    completeSlot(slot);
+
+    vkResetFences(m_device, 1, &slot.fence);
+    vkResetCommandBuffer(slot.commandBuffer, 0);
+
+    VkCommandBufferBeginInfo beginInfo{};
+    beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+
+    VkResult result = vkBeginCommandBuffer(slot.commandBuffer, &beginInfo);
+    if (result != VK_SUCCESS) {
+        std::cerr << "Failed to begin offscreen command buffer: " << result << std::endl;
+        return VK_NULL_HANDLE;
+    }
+
+    // Equivalent of a render pass with loadOp CLEAR
+    imageBarrier(slot.commandBuffer, slot.image,
+                 VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                 0, VK_ACCESS_TRANSFER_WRITE_BIT,
+                 VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT);
+    vkCmdClearColorImage(slot.commandBuffer, slot.image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, &m_clearColor, 1, &COLOR_RANGE);
+    imageBarrier(slot.commandBuffer, slot.image,
+                 VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL,
+                 VK_ACCESS_TRANSFER_WRITE_BIT, VK_ACCESS_COLOR_ATTACHMENT_READ_BIT | VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT,
+                 VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT);
+
+    slot.frameIndex = frameIndex;
+    m_frameActive = true;
+    return slot.commandBuffer;
+}
+
+bool OffscreenTarget::endFrame() {
+    if (!m_frameActive) {
+        std::cerr << "Cannot end offscreen frame - no frame is active" << std::endl;
+        return false;
+    }
+
+    m_frameActive = false;
+    Slot& slot = m_slots[m_currentSlot];
+
+    imageBarrier(slot.commandBuffer, slot.image,
+                 VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+                 VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT, VK_ACCESS_TRANSFER_READ_BIT,
+                 VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT);
+
+    VkBufferImageCopy region{};
+    region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+    region.imageSubresource.layerCount = 1;
+    region.imageExtent = {m_width, m_height, 1};
+    vkCmdCopyImageToBuffer(slot.commandBuffer, slot.image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+                           slot.readbackBuffer, 1, &region);
+
+    // Make the copy visible to the host once the fence signals
+    VkBufferMemoryBarrier hostBarrier{};
+    hostBarrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+    hostBarrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    hostBarrier.dstAccessMask = VK_ACCESS_HOST_READ_BIT;
+    hostBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    hostBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    hostBarrier.buffer = slot.readbackBuffer;
+    hostBarrier.size = VK_WHOLE_SIZE;
+    vkCmdPipelineBarrier(slot.commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_HOST_BIT, 0,
+                         0, nullptr, 1, &hostBarrier, 0, nullptr);
+
+    VkResult result = vkEndCommandBuffer(slot.commandBuffer);
+    if (result != VK_SUCCESS) {
+        std::cerr << "Failed to end offscreen command buffer: " << result << std::endl;
+        return false;
+    }
+
+    VkSubmitInfo submitInfo{};
+    submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+    submitInfo.commandBufferCount = 1;
+    submitInfo.pCommandBuffers = &slot.commandBuffer;
+
+    if (m_queueMutex) {
+        std::lock_guard<std::mutex> lock(*m_queueMutex);
+        result = vkQueueSubmit(m_queue, 1, &submitInfo, slot.fence);
+    } else {
+        result = vkQueueSubmit(m_queue, 1, &submitInfo, slot.fence);
+    }
+    if (result != VK_SUCCESS) {
+        std::cerr << "Failed to submit offscreen frame: " << result << std::endl;
+        return false;
+    }
+
+    slot.pending = true;
+    m_stats.framesSubmitted++;
+    return true;
+}
+
+void OffscreenTarget::flush() {
+    if (m_slots.empty()) {
+        return;
+    }
+
+    // Oldest first, so readbacks arrive in frame order
+    size_t first = static_cast<size_t>(m_stats.framesSubmitted % m_slots.size());
+    for (size_t i = 0; i < m_slots.size(); ++i) {
+        completeSlot(m_slots[(first + i) % m_slots.size()]);
+    }
+}
+
+uint32_t OffscreenTarget::getFormatSize(VkFormat format) {
+    switch (format) {
+        case VK_FORMAT_R8G8B8A8_UNORM:
+        case VK_FORMAT_R8G8B8A8_SRGB:
+        case VK_FORMAT_B8G8R8A8_UNORM:
+        case VK_FORMAT_B8G8R8A8_SRGB:
+            return 4;
+        case VK_FORMAT_R16G16B16A16_SFLOAT:
+            return 8;
+        case VK_FORMAT_R32G32B32A32_SFLOAT:
+            return 16;
+        default:
+            return 0;
+    }
+}
+
+bool OffscreenTarget::createSlot(Slot& slot) {
+    VkImageCreateInfo imageInfo{};
+    imageInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+    imageInfo.imageType = VK_IMAGE_TYPE_2D;
+    imageInfo.format = m_format;
+    imageInfo.extent = {m_width, m_height, 1};
+    imageInfo.mipLevels = 1;
+    imageInfo.arrayLayers = 1;
+    imageInfo.samples = VK_SAMPLE_COUNT_1_BIT;
+    imageInfo.tiling = VK_IMAGE_TILING_OPTIMAL;
+    imageInfo.usage = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT |
+                      VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT;
+    imageInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    imageInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+
+    VkResult result = vkCreateImage(m_device, &imageInfo, nullptr, &slot.image);
+    if (result != VK_SUCCESS) {
+        std::cerr << "Failed to create offscreen image: " << result << std::endl;
+        return false;
+    }
+
+    slot.imageMemory = m_memoryManager->allocateImageMemory(slot.image, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+    if (slot.imageMemory == VK_NULL_HANDLE) {
+        return false;
+    }
+    vkBindImageMemory(m_device, slot.image, slot.imageMemory, 0);
+
+    VkImageViewCreateInfo viewInfo{};
+    viewInfo.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+    viewInfo.image = slot.image;
+    viewInfo.viewType = VK_IMAGE_VIEW_TYPE_2D;
+    viewInfo.format = m_format;
+    viewInfo.subresourceRange = COLOR_RANGE;
+
+    result = vkCreateImageView(m_device, &viewInfo, nullptr, &slot.imageView);
+    if (result != VK_SUCCESS) {
+        std::cerr << "Failed to create offscreen image view: " << result << std::endl;
+        return false;
+    }
+
+    VkBufferCreateInfo bufferInfo{};
+    bufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+    bufferInfo.size = VkDeviceSize(m_width) * m_height * getFormatSize(m_format);
+    bufferInfo.usage = VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+    bufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+
+    result = vkCreateBuffer(m_device, &bufferInfo, nullptr, &slot.readbackBuffer);
+    if (result != VK_SUCCESS) {
+        std::cerr << "Failed to create readback buffer: " << result << std::endl;
+        return false;
+    }
+
+    // Cached memory makes CPU reads of the readback much faster where it exists
+    VkMemoryRequirements requirements;
+    vkGetBufferMemoryRequirements(m_device, slot.readbackBuffer, &requirements);
+    VkMemoryPropertyFlags properties = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+    uint32_t typeIndex = 0;
+    if (m_memoryManager->getMemoryType(requirements.memoryTypeBits, properties | VK_MEMORY_PROPERTY_HOST_CACHED_BIT, &typeIndex) != 0) {
+        properties |= VK_MEMORY_PROPERTY_HOST_CACHED_BIT;
+    }
+
+    slot.readbackMemory = m_memoryManager->allocateBufferMemory(slot.readbackBuffer, properties);
+    if (slot.readbackMemory == VK_NULL_HANDLE) {
+        return false;
+    }
+    vkBindBufferMemory(m_device, slot.readbackBuffer, slot.readbackMemory, 0);
+
+    slot.mapped = m_memoryManager->mapMemory(slot.readbackMemory);
+    if (slot.mapped == nullptr) {
+        return false;
+    }
+
+    VkCommandBufferAllocateInfo allocInfo{};
+    allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+    allocInfo.commandPool = m_commandPool;
+    allocInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+    allocInfo.commandBufferCount = 1;
+
+    result = vkAllocateCommandBuffers(m_device, &allocInfo, &slot.commandBuffer);
+    if (result != VK_SUCCESS) {
+        std::cerr << "Failed to allocate offscreen command buffer: " << result << std::endl;
+        return false;
+    }
+
+    VkFenceCreateInfo fenceInfo{};
+    fenceInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+    fenceInfo.flags = VK_FENCE_CREATE_SIGNALED_BIT;
+
+    result = vkCreateFence(m_device, &fenceInfo, nullptr, &slot.fence);
+    if (result != VK_SUCCESS) {
+        std::cerr << "Failed to create offscreen fence: " << result << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+void OffscreenTarget::destroySlot(Slot& slot) {
+    if (slot.fence != VK_NULL_HANDLE) {
+        vkDestroyFence(m_device, slot.fence, nullptr);
+    }
+    if (slot.commandBuffer != VK_NULL_HANDLE) {
+        vkFreeCommandBuffers(m_device, m_commandPool, 1, &slot.commandBuffer);
+    }
+    if (slot.mapped != nullptr) {
+        m_memoryManager->unmapMemory(slot.readbackMemory);
+    }
+    if (slot.readbackBuffer != VK_NULL_HANDLE) {
+        vkDestroyBuffer(m_device, slot.readbackBuffer, nullptr);
+    }
+    m_memoryManager->deallocateMemory(slot.readbackMemory);
+    if (slot.imageView != VK_NULL_HANDLE) {
+        vkDestroyImageView(m_device, slot.imageView, nullptr);
+    }
+    if (slot.image != VK_NULL_HANDLE) {
+        vkDestroyImage(m_device, slot.image, nullptr);
+    }
+    m_memoryManager->deallocateMemory(slot.imageMemory);
+
+    slot = Slot{};
+}
+
+void OffscreenTarget::completeSlot(Slot& slot) {
+    if (!slot.pending) {
+        return;
+    }
+
+    auto waitStart = std::chrono::steady_clock::now();
+    vkWaitForFences(m_device, 1, &slot.fence, VK_TRUE, std::numeric_limits<uint64_t>::max());
+    double waited = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - waitStart).count();
+    m_stats.readbackWaitTime = m_stats.framesReadBack == 0
+        ? waited
+        : m_stats.readbackWaitTime + (waited - m_stats.readbackWaitTime) * STATS_SMOOTHING;
+
+    slot.pending = false;
+    m_stats.framesReadBack++;
+
+    if (m_readbackCallback) {
+        OffscreenFrame frame;
+        frame.frameIndex = slot.frameIndex;
+        frame.width = m_width;
+        frame.height = m_height;
+        frame.format = m_format;
+        frame.data = slot.mapped;
+        frame.rowPitch = size_t(m_width) * getFormatSize(m_format);
+        m_readbackCallback(frame);
+    }
+}
+
+} // namespace VortexEngine
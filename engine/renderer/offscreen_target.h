@@ -0,0 +1,128 @@
+#pragma once
+
+#include "../core/vulkan_dispatch.h"
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+namespace VortexEngine {
+
+class MemoryManager;
+
+// One frame read back from an offscreen target
+//
+// data points into a persistently mapped readback buffer and is only valid
+// for the duration of the readback callback.
+struct OffscreenFrame {
+    uint64_t frameIndex = 0;
+    uint32_t width = 0;
+    uint32_t height = 0;
+    VkFormat format = VK_FORMAT_UNDEFINED;
+    const void* data = nullptr;
+    size_t rowPitch = 0;
+};
+
+// Offscreen target statistics (milliseconds, exponentially smoothed)
+struct OffscreenTargetStats {
+    uint64_t framesSubmitted = 0;
+    uint64_t framesReadBack = 0;
+    double readbackWaitTime = 0.0;   // CPU time blocked on a slot's fence
+};
+
+// Windowless render target with a readback ring
+//
+// Stands in for the swapchain when there is no display: each slot owns a
+// color image, a host-visible readback buffer, a command buffer and a fence.
+// beginFrame() plays the role of acquire and endFrame() the role of present;
+// endFrame() appends a copy of the image into the slot's readback buffer and
+// submits. A slot's readback is delivered to the callback when the slot is
+// reused, ringSize frames later, so the CPU only waits on the GPU when it
+// gets a full ring ahead. flush() delivers everything still in flight.
+class OffscreenTarget {
+public:
+    using ReadbackCallback = std::function<void(const OffscreenFrame& frame)>;
+
+    OffscreenTarget() = default;
+    ~OffscreenTarget();
+
+    OffscreenTarget(const OffscreenTarget&) = delete;
+    OffscreenTarget& operator=(const OffscreenTarget&) = delete;
+
+    // Lifecycle
+    bool initialize(VkDevice device, MemoryManager* memoryManager, VkQueue queue, uint32_t queueFamilyIndex,
+                    uint32_t width, uint32_t height, VkFormat format = VK_FORMAT_R8G8B8A8_UNORM,
+                    uint32_t ringSize = 2);
+    void shutdown();
+    bool isInitialized() const { return m_initialized; }
+
+    // Configuration
+    void setReadbackCallback(ReadbackCallback callback) { m_readbackCallback = std::move(callback); }
+    void setClearColor(const VkClearColorValue& color) { m_clearColor = color; }
+    // Taken around submissions when the queue is shared with other threads
+    void setQueueMutex(std::mutex* queueMutex) { m_queueMutex = queueMutex; }
+
+    // Frame interface
+    //
+    // beginFrame returns a recording command buffer with the slot's image
+    // cleared and in COLOR_ATTACHMENT_OPTIMAL; the renderer must leave it in
+    // that layout. Returns VK_NULL_HANDLE on failure.
+    VkCommandBuffer beginFrame(uint64_t frameIndex);
+    bool endFrame();
+    void flush();
+
+    // Current slot
+    uint32_t getCurrentSlot() const { return m_currentSlot; }
+    VkImage getImage() const { return m_slots[m_currentSlot].image; }
+    VkImageView getImageView() const { return m_slots[m_currentSlot].imageView; }
+
+    // Information
+    uint32_t getWidth() const { return m_width; }
+    uint32_t getHeight() const { return m_height; }
+    VkFormat getFormat() const { return m_format; }
+    uint32_t getRingSize() const { return static_cast<uint32_t>(m_slots.size()); }
+    const OffscreenTargetStats& getStats() const { return m_stats; }
+
+    // Bytes per pixel for the supported color formats, 0 if unsupported
+    static uint32_t getFormatSize(VkFormat format);
+
+private:
+    struct Slot {
+        VkImage image = VK_NULL_HANDLE;
+        VkDeviceMemory imageMemory = VK_NULL_HANDLE;
+        VkImageView imageView = VK_NULL_HANDLE;
+        VkBuffer readbackBuffer = VK_NULL_HANDLE;
+        VkDeviceMemory readbackMemory = VK_NULL_HANDLE;
+        void* mapped = nullptr;
+        VkCommandBuffer commandBuffer = VK_NULL_HANDLE;
+        VkFence fence = VK_NULL_HANDLE;
+        uint64_t frameIndex = 0;
+        bool pending = false;   // Submitted, readback not yet delivered
+    };
+
+    bool m_initialized = false;
+    VkDevice m_device = VK_NULL_HANDLE;
+    MemoryManager* m_memoryManager = nullptr;
+    VkQueue m_queue = VK_NULL_HANDLE;
+    std::mutex* m_queueMutex = nullptr;
+    VkCommandPool m_commandPool = VK_NULL_HANDLE;
+
+    uint32_t m_width = 0;
+    uint32_t m_height = 0;
+    VkFormat m_format = VK_FORMAT_UNDEFINED;
+    VkClearColorValue m_clearColor{};
+
+    std::vector<Slot> m_slots;
+    uint32_t m_currentSlot = 0;
+    bool m_frameActive = false;
+
+    ReadbackCallback m_readbackCallback;
+    OffscreenTargetStats m_stats;
+
+    // Internal methods
+    bool createSlot(Slot& slot);
+    void destroySlot(Slot& slot);
+    void completeSlot(Slot& slot);
+};
+
+} // namespace VortexEngine
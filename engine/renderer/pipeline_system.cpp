@@ -1,4 +1,6 @@
 #include "pipeline_system.h"
+#include "../utils/metrics.h"
+#include <chrono>
 #include <iostream>
 #include <stdexcept>
 #include <algorithm>
@@ -91,7 +93,11 @@ VkPipeline PipelineSystem::createGraphicsPipeline(const VkGraphicsPipelineCreate
                   << ", name=" << createInfo.pStages[i].pName << std::endl;
     }
     
+    static Histogram& compileTime = MetricsRegistry::getInstance().histogram(MetricNames::PipelineCompileMs);
+    static Counter& pipelinesCreated = MetricsRegistry::getInstance().counter(MetricNames::PipelinesCreated);
+    auto compileStart = std::chrono::steady_clock::now();
     VkResult result = vkCreateGraphicsPipelines(m_device, cache, 1, &createInfo, nullptr, &pipeline);
+    compileTime.record(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - compileStart).count());
     std::cout << "vkCreateGraphicsPipelines result: " << result << std::endl;
     
     if (result != VK_SUCCESS) {
@@ -140,6 +146,7 @@ VkPipeline PipelineSystem::createGraphicsPipeline(const VkGraphicsPipelineCreate
     }
 
     std::cout << "Pipeline created successfully, handle: " << pipeline << std::endl;
+    pipelinesCreated.add();
 
     // Store pipeline with generated name
     std::string name = generatePipelineName(createInfo);
@@ -1,6 +1,6 @@
 #pragma once
 
-#include <vulkan/vulkan.h>
+#include "../core/vulkan_dispatch.h"
 #include <vector>
 #include <unordered_map>
 #include <memory>
@@ -58,10 +58,15 @@ void ShaderSystem::shutdown() {
 }
 
 VkShaderModule ShaderSystem::createShaderModule(const std::vector<char>& code) {
+    return createShaderModule(std::as_bytes(std::span<const char>(code)));
+}
+
+VkShaderModule ShaderSystem::createShaderModule(std::span<const std::byte> code) {
     if (!m_initialized || code.empty()) {
         return VK_NULL_HANDLE;
     }
 
+    // SPIR-V is consumed directly from the caller's memory (e.g. a mapped file)
     VkShaderModuleCreateInfo createInfo{};
     createInfo.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
     createInfo.codeSize = code.size();
@@ -102,28 +107,28 @@ bool ShaderSystem::loadShader(const std::string& name, const std::string& vertex
     shaderData.vertexPath = vertexPath;
     shaderData.fragmentPath = fragmentPath;
 
-    // Load vertex shader
-    std::vector<char> vertexCode;
-    if (!loadShaderFile(vertexPath, vertexCode)) {
+    // Open vertex shader (mapped or archive view, no copy)
+    VirtualFile vertexFile;
+    if (!openShaderFile(vertexPath, vertexFile)) {
         std::cerr << "Failed to load vertex shader: " << vertexPath << std::endl;
         return false;
     }
 
-    // Load fragment shader
-    std::vector<char> fragmentCode;
-    if (!loadShaderFile(fragmentPath, fragmentCode)) {
+    // Open fragment shader
+    VirtualFile fragmentFile;
+    if (!openShaderFile(fragmentPath, fragmentFile)) {
         std::cerr << "Failed to load fragment shader: " << fragmentPath << std::endl;
         return false;
     }
 
-    // Create shader modules
-    shaderData.vertexShader = createShaderModule(vertexCode);
+    // Create shader modules straight from the file data
+    shaderData.vertexShader = createShaderModule(vertexFile.getData());
     if (shaderData.vertexShader == VK_NULL_HANDLE) {
         std::cerr << "Failed to create vertex shader module for: " << name << std::endl;
         return false;
     }
 
-    shaderData.fragmentShader = createShaderModule(fragmentCode);
+    shaderData.fragmentShader = createShaderModule(fragmentFile.getData());
     if (shaderData.fragmentShader == VK_NULL_HANDLE) {
         std::cerr << "Failed to create fragment shader module for: " << name << std::endl;
         vkDestroyShaderModule(m_device, shaderData.vertexShader, nullptr);
@@ -443,6 +448,28 @@ bool ShaderSystem::loadShaderFile(const std::string& path, std::vector<char>& co
     return true;
 }
 
+bool ShaderSystem::openShaderFile(const std::string& path, VirtualFile& file) {
+    const VirtualFileSystem& fileSystem = m_fileSystem ? *m_fileSystem : m_looseFileSystem;
+    file = fileSystem.openFile(path);
+    if (!file.isValid()) {
+        std::cerr << "Failed to open shader file: " << path << std::endl;
+        return false;
+    }
+
+    if (file.getSize() < 4 || file.getSize() % sizeof(uint32_t) != 0) {
+        std::cerr << "Shader file " << path << " is not a whole number of SPIR-V words (" << file.getSize() << " bytes)" << std::endl;
+        return false;
+    }
+
+    uint32_t magic;
+    std::memcpy(&magic, file.getData().data(), sizeof(magic));
+    if (magic != 0x07230203) { // SPIR-V magic number
+        std::cerr << "Warning: Shader file " << path << " doesn't appear to be SPIR-V (magic: 0x" << std::hex << magic << std::dec << ")" << std::endl;
+    }
+
+    return true;
+}
+
 bool ShaderSystem::loadSPIRVFile(const std::string& path, std::vector<uint32_t>& code) {
     std::ifstream file(path, std::ios::ate | std::ios::binary);
     if (!file.is_open()) {
@@ -1,11 +1,14 @@
 #pragma once
 
-#include <vulkan/vulkan.h>
+#include "../core/vulkan_dispatch.h"
 #include <string>
 #include <vector>
 #include <unordered_map>
 #include <memory>
 #include <mutex>
+#include <span>
+
+#include "../utils/virtual_file_system.h"
 
 namespace VortexEngine {
 
@@ -18,8 +21,13 @@ public:
     bool initialize(VkDevice device);
     void shutdown();
 
+    // Shader files are resolved through this file system (archives before
+    // loose files). Without one, paths are plain files on disk.
+    void setFileSystem(VirtualFileSystem* fileSystem) { m_fileSystem = fileSystem; }
+
     // Shader module management
     VkShaderModule createShaderModule(const std::vector<char>& code);
+    VkShaderModule createShaderModule(std::span<const std::byte> code);
     void destroyShaderModule(VkShaderModule shaderModule);
 
     // Shader loading
@@ -82,6 +90,8 @@ private:
 
     // Configuration
     bool m_initialized = false;
+    VirtualFileSystem* m_fileSystem = nullptr;
+    VirtualFileSystem m_looseFileSystem;
     bool m_hotReloadEnabled = false;
     bool m_shaderCacheEnabled = false;
     std::string m_shaderWatchDirectory;
@@ -95,6 +105,7 @@ private:
 
     // Internal methods
     bool loadShaderFile(const std::string& path, std::vector<char>& code);
+    bool openShaderFile(const std::string& path, VirtualFile& file);
     bool loadSPIRVFile(const std::string& path, std::vector<uint32_t>& code);
     bool compileShaderInternal(const std::string& sourcePath, const std::vector<std::string>& defines, std::vector<char>& output);
     bool generateShaderReflection(const std::string& name, ShaderData& shaderData);
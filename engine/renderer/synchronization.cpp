@@ -183,11 +183,10 @@ void SyncObjects::waitForFrame() {
         return;
     }
 
-    // Wait for the fence for the current frame to be signaled
-    if (m_framesInFlight > 0) {
-        vkWaitForFences(m_device, 1, &m_inFlightFences[m_currentFrame], VK_TRUE,
-                       std::numeric_limits<uint64_t>::max());
-    }
+    // Fences start signaled, so this only blocks once the CPU is
+    // m_maxFramesInFlight frames ahead of the GPU
+    vkWaitForFences(m_device, 1, &m_inFlightFences[m_currentFrame], VK_TRUE,
+                   std::numeric_limits<uint64_t>::max());
 }
 
 void SyncObjects::beginFrame() {
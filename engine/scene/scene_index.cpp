@@ -0,0 +1,237 @@
+#include "scene_index.h"
+#include "scene_manager.h"
+#include <algorithm>
+#include <atomic>
+#include <iostream>
+#include <mutex>
+
+namespace VortexEngine {
+
+namespace {
+
+// Tags are only ever appended, so lookups read the table without the lock:
+// a name is stored before the count that publishes it
+struct TagTable {
+    std::mutex mutex;   // Serializes registration
+    std::array<std::atomic<StringId>, MAX_TAGS> names{};
+    std::atomic<TagId> count{0};
+
+    TagId find(StringId tag) const {
+        TagId published = count.load(std::memory_order_acquire);
+        for (TagId id = 0; id < published; ++id) {
+            if (names[id].load(std::memory_order_relaxed) == tag) {
+                return id;
+            }
+        }
+        return INVALID_TAG;
+    }
+};
+
+TagTable& getTagTable() {
+    static TagTable table;
+    return table;
+}
+
+const std::vector<SceneNode*> s_emptyNodeList;
+
+} // namespace
+
+// TagRegistry implementation
+TagId TagRegistry::registerTag(StringId tag) {
+    if (!tag.isValid()) {
+        return INVALID_TAG;
+    }
+
+    TagTable& table = getTagTable();
+    TagId id = table.find(tag);
+    if (id != INVALID_TAG) {
+        return id;
+    }
+
+    std::lock_guard<std::mutex> lock(table.mutex);
+
+    // Another thread may have registered it since the unlocked check
+    id = table.find(tag);
+    if (id != INVALID_TAG) {
+        return id;
+    }
+
+    id = table.count.load(std::memory_order_relaxed);
+    if (id >= MAX_TAGS) {
+        std::cerr << "Tag limit reached (" << static_cast<int>(MAX_TAGS) << "), cannot register tag: " << tag.str() << std::endl;
+        return INVALID_TAG;
+    }
+
+    table.names[id].store(tag, std::memory_order_relaxed);
+    table.count.store(id + 1, std::memory_order_release);
+    return id;
+}
+
+TagId TagRegistry::getTagId(StringId tag) {
+    if (!tag.isValid()) {
+        return INVALID_TAG;
+    }
+    return getTagTable().find(tag);
+}
+
+StringId TagRegistry::getTagName(TagId tag) {
+    const TagTable& table = getTagTable();
+    return tag < table.count.load(std::memory_order_acquire) ? table.names[tag].load(std::memory_order_relaxed) : StringId();
+}
+
+size_t TagRegistry::getTagCount() {
+    return getTagTable().count.load(std::memory_order_acquire);
+}
+
+// SceneIndex implementation
+void SceneIndex::addNode(SceneNode* node) {
+    if (!node) {
+        return;
+    }
+
+    if (node->getNameId().isValid()) {
+        m_nodesByName[node->getNameId()].push_back(node);
+    }
+
+    const TagMask& tags = node->getTags();
+    for (TagId tag = 0; tag < MAX_TAGS; ++tag) {
+        if (tags.test(tag)) {
+            m_nodesByTag[tag].push_back(node);
+        }
+    }
+
+    for (const auto& [name, entity] : node->getEntityNames()) {
+        addEntity(name, entity);
+    }
+
+    m_nodeCount++;
+}
+
+void SceneIndex::removeNode(SceneNode* node) {
+    if (!node) {
+        return;
+    }
+
+    auto it = m_nodesByName.find(node->getNameId());
+    if (it != m_nodesByName.end()) {
+        eraseNode(it->second, node);
+        if (it->second.empty()) {
+            m_nodesByName.erase(it);
+        }
+    }
+
+    const TagMask& tags = node->getTags();
+    for (TagId tag = 0; tag < MAX_TAGS; ++tag) {
+        if (tags.test(tag)) {
+            eraseNode(m_nodesByTag[tag], node);
+        }
+    }
+
+    for (const auto& [name, entity] : node->getEntityNames()) {
+        removeEntity(name, entity);
+    }
+
+    if (m_nodeCount > 0) {
+        m_nodeCount--;
+    }
+}
+
+void SceneIndex::renameNode(SceneNode* node, StringId oldName, StringId newName) {
+    if (!node || oldName == newName) {
+        return;
+    }
+
+    auto it = m_nodesByName.find(oldName);
+    if (it != m_nodesByName.end()) {
+        eraseNode(it->second, node);
+        if (it->second.empty()) {
+            m_nodesByName.erase(it);
+        }
+    }
+
+    if (newName.isValid()) {
+        m_nodesByName[newName].push_back(node);
+    }
+}
+
+void SceneIndex::addTag(SceneNode* node, TagId tag) {
+    if (!node || tag >= MAX_TAGS) {
+        return;
+    }
+
+    m_nodesByTag[tag].push_back(node);
+}
+
+void SceneIndex::removeTag(SceneNode* node, TagId tag) {
+    if (!node || tag >= MAX_TAGS) {
+        return;
+    }
+
+    eraseNode(m_nodesByTag[tag], node);
+}
+
+void SceneIndex::clear() {
+    m_nodesByName.clear();
+    for (auto& nodes : m_nodesByTag) {
+        nodes.clear();
+    }
+    m_entitiesByName.clear();
+    m_nodeCount = 0;
+}
+
+void SceneIndex::addEntity(StringId name, Entity entity) {
+    if (!name.isValid()) {
+        return;
+    }
+
+    // First entity registered under a name wins, matching node lookups
+    auto [it, inserted] = m_entitiesByName.emplace(name, entity);
+    if (!inserted && it->second != entity) {
+        std::cerr << "Entity name '" << name.str() << "' is already used by entity " << it->second
+                  << "; findEntity() keeps returning it, not entity " << entity << std::endl;
+    }
+}
+
+void SceneIndex::removeEntity(StringId name, Entity entity) {
+    auto it = m_entitiesByName.find(name);
+    if (it != m_entitiesByName.end() && it->second == entity) {
+        m_entitiesByName.erase(it);
+    }
+}
+
+SceneNode* SceneIndex::findNode(StringId name) const {
+    auto it = m_nodesByName.find(name);
+    if (it != m_nodesByName.end() && !it->second.empty()) {
+        return it->second.front();
+    }
+
+    return nullptr;
+}
+
+const std::vector<SceneNode*>& SceneIndex::findNodes(StringId name) const {
+    auto it = m_nodesByName.find(name);
+    return it != m_nodesByName.end() ? it->second : s_emptyNodeList;
+}
+
+const std::vector<SceneNode*>& SceneIndex::findNodesWithTag(TagId tag) const {
+    if (tag >= MAX_TAGS) {
+        return s_emptyNodeList;
+    }
+
+    return m_nodesByTag[tag];
+}
+
+Entity SceneIndex::findEntity(StringId name) const {
+    auto it = m_entitiesByName.find(name);
+    return it != m_entitiesByName.end() ? it->second : Entity(INVALID_ENTITY);
+}
+
+void SceneIndex::eraseNode(std::vector<SceneNode*>& nodes, SceneNode* node) {
+    // Order is preserved so that the first node registered under a name stays first
+    auto it = std::find(nodes.begin(), nodes.end(), node);
+    if (it != nodes.end()) {
+        nodes.erase(it);
+    }
+}
+
+} // namespace VortexEngine
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <array>
+#include <bitset>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "../ecs/ecs_manager.h"
+#include "../utils/string_id.h"
+
+namespace VortexEngine {
+
+class SceneNode;
+
+// Tag types
+using TagId = uint8_t;
+constexpr TagId MAX_TAGS = 64;
+constexpr TagId INVALID_TAG = 0xFF;
+
+// Tag mask (bitset of tags attached to a node)
+using TagMask = std::bitset<MAX_TAGS>;
+
+// Tag registry
+//
+// Maps interned tag names to bit indices in a TagMask. Tag bits are shared by
+// all scenes, in the same way component types are shared by all entities.
+class TagRegistry {
+public:
+    static TagId registerTag(StringId tag);
+    static TagId getTagId(StringId tag);
+    static StringId getTagName(TagId tag);
+    static size_t getTagCount();
+};
+
+// Scene lookup tables
+//
+// Hash indices from node name to node and from tag to the nodes carrying it.
+// Nodes keep the index up to date as they are renamed, tagged or moved in and
+// out of a scene, so queries never walk the hierarchy.
+class SceneIndex {
+public:
+    SceneIndex() = default;
+    ~SceneIndex() = default;
+
+    SceneIndex(const SceneIndex&) = delete;
+    SceneIndex& operator=(const SceneIndex&) = delete;
+
+    // Node registration
+    void addNode(SceneNode* node);
+    void removeNode(SceneNode* node);
+    void renameNode(SceneNode* node, StringId oldName, StringId newName);
+    void addTag(SceneNode* node, TagId tag);
+    void removeTag(SceneNode* node, TagId tag);
+    void clear();
+
+    // Entity registration. Names map to one entity: the first registered
+    // under a name is kept and later ones are reported and ignored, even
+    // after the first is removed
+    void addEntity(StringId name, Entity entity);
+    void removeEntity(StringId name, Entity entity);
+
+    // Queries
+    SceneNode* findNode(StringId name) const;
+    const std::vector<SceneNode*>& findNodes(StringId name) const;
+    const std::vector<SceneNode*>& findNodesWithTag(TagId tag) const;
+    Entity findEntity(StringId name) const;
+
+    // Debug information
+    size_t getNodeCount() const { return m_nodeCount; }
+    size_t getNameCount() const { return m_nodesByName.size(); }
+
+private:
+    // Nodes sharing a name are kept in insertion order; the first one wins
+    std::unordered_map<StringId, std::vector<SceneNode*>> m_nodesByName;
+    std::array<std::vector<SceneNode*>, MAX_TAGS> m_nodesByTag;
+    std::unordered_map<StringId, Entity> m_entitiesByName;
+    size_t m_nodeCount = 0;
+
+    // Internal methods
+    static void eraseNode(std::vector<SceneNode*>& nodes, SceneNode* node);
+};
+
+} // namespace VortexEngine
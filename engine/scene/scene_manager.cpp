@@ -0,0 +1,331 @@
+#include "scene_manager.h"
+#include <algorithm>
+#include <iostream>
+
+namespace VortexEngine {
+
+// SceneNode implementation
+SceneNode::SceneNode(const std::string& name)
+    : m_name(name)
+    , m_nameId(StringId::intern(name)) {
+}
+
+SceneNode::~SceneNode() {
+    if (m_index) {
+        m_index->removeNode(this);
+        m_index = nullptr;
+    }
+
+    cleanupChildren();
+}
+
+SceneNode* SceneNode::createChild(const std::string& name) {
+    SceneNode* child = new SceneNode(name);
+    addChild(child);
+    return child;
+}
+
+void SceneNode::addChild(SceneNode* child) {
+    if (!child || child == this || isDescendantOf(child)) {
+        return;
+    }
+
+    if (child->m_parent) {
+        child->m_parent->removeChildInternal(child);
+    }
+
+    child->m_parent = this;
+    if (!child->m_ecsManager) {
+        child->m_ecsManager = m_ecsManager;
+    }
+    m_children.push_back(child);
+
+    child->setSceneIndex(m_index);
+}
+
+void SceneNode::removeChild(SceneNode* child) {
+    auto it = std::find(m_children.begin(), m_children.end(), child);
+    if (it == m_children.end()) {
+        return;
+    }
+
+    removeChildInternal(child);
+    delete child;
+}
+
+void SceneNode::removeChild(const std::string& name) {
+    StringId nameId = StringId::find(name);
+    if (!nameId.isValid()) {
+        return;
+    }
+
+    for (SceneNode* child : m_children) {
+        if (child->m_nameId == nameId) {
+            removeChild(child);
+            return;
+        }
+    }
+}
+
+void SceneNode::clearChildren() {
+    cleanupChildren();
+}
+
+Entity SceneNode::createEntity(const std::string& name) {
+    Entity entity = createEntity();
+    if (entity == INVALID_ENTITY) {
+        return entity;
+    }
+
+    StringId nameId = StringId::intern(name);
+    if (nameId.isValid() && m_entityNames.emplace(nameId, entity).second && m_index) {
+        m_index->addEntity(nameId, entity);
+    }
+
+    return entity;
+}
+
+Entity SceneNode::getEntity(const std::string& name) const {
+    return getEntity(StringId::find(name));
+}
+
+Entity SceneNode::getEntity(StringId name) const {
+    auto it = m_entityNames.find(name);
+    return it != m_entityNames.end() ? it->second : Entity(INVALID_ENTITY);
+}
+
+void SceneNode::setName(const std::string& name) {
+    StringId oldName = m_nameId;
+    m_name = name;
+    m_nameId = StringId::intern(name);
+
+    if (m_index) {
+        m_index->renameNode(this, oldName, m_nameId);
+    }
+}
+
+void SceneNode::addTag(StringId tag) {
+    TagId tagId = TagRegistry::registerTag(tag);
+    if (tagId == INVALID_TAG || m_tags.test(tagId)) {
+        return;
+    }
+
+    m_tags.set(tagId);
+    if (m_index) {
+        m_index->addTag(this, tagId);
+    }
+}
+
+void SceneNode::removeTag(StringId tag) {
+    TagId tagId = TagRegistry::getTagId(tag);
+    if (tagId == INVALID_TAG || !m_tags.test(tagId)) {
+        return;
+    }
+
+    m_tags.reset(tagId);
+    if (m_index) {
+        m_index->removeTag(this, tagId);
+    }
+}
+
+void SceneNode::clearTags() {
+    if (m_index) {
+        for (TagId tag = 0; tag < MAX_TAGS; ++tag) {
+            if (m_tags.test(tag)) {
+                m_index->removeTag(this, tag);
+            }
+        }
+    }
+
+    m_tags.reset();
+}
+
+bool SceneNode::hasTag(StringId tag) const {
+    return hasTag(TagRegistry::getTagId(tag));
+}
+
+SceneNode* SceneNode::findNode(const std::string& name) {
+    return findNode(StringId::find(name));
+}
+
+SceneNode* SceneNode::findNode(StringId name) {
+    if (!name.isValid()) {
+        return nullptr;
+    }
+
+    if (!m_index) {
+        return findNodeRecursive(name);
+    }
+
+    for (SceneNode* node : m_index->findNodes(name)) {
+        if (node == this || node->isDescendantOf(this)) {
+            return node;
+        }
+    }
+
+    return nullptr;
+}
+
+std::vector<SceneNode*> SceneNode::findNodesWithTag(const std::string& tag) {
+    return findNodesWithTag(StringId::find(tag));
+}
+
+std::vector<SceneNode*> SceneNode::findNodesWithTag(StringId tag) {
+    std::vector<SceneNode*> nodes;
+
+    TagId tagId = TagRegistry::getTagId(tag);
+    if (tagId == INVALID_TAG) {
+        return nodes;
+    }
+
+    if (!m_index) {
+        findNodesWithTagRecursive(tagId, nodes);
+        return nodes;
+    }
+
+    for (SceneNode* node : m_index->findNodesWithTag(tagId)) {
+        if (node == this || node->isDescendantOf(this)) {
+            nodes.push_back(node);
+        }
+    }
+
+    return nodes;
+}
+
+bool SceneNode::isDescendantOf(const SceneNode* ancestor) const {
+    for (const SceneNode* node = m_parent; node; node = node->m_parent) {
+        if (node == ancestor) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void SceneNode::setSceneIndex(SceneIndex* index) {
+    if (m_index != index) {
+        if (m_index) {
+            m_index->removeNode(this);
+        }
+
+        m_index = index;
+
+        if (m_index) {
+            m_index->addNode(this);
+        }
+    }
+
+    for (SceneNode* child : m_children) {
+        child->setSceneIndex(index);
+    }
+}
+
+SceneNode* SceneNode::findNodeRecursive(StringId name) {
+    if (m_nameId == name) {
+        return this;
+    }
+
+    for (SceneNode* child : m_children) {
+        if (SceneNode* node = child->findNodeRecursive(name)) {
+            return node;
+        }
+    }
+
+    return nullptr;
+}
+
+void SceneNode::findNodesWithTagRecursive(TagId tag, std::vector<SceneNode*>& nodes) {
+    if (m_tags.test(tag)) {
+        nodes.push_back(this);
+    }
+
+    for (SceneNode* child : m_children) {
+        child->findNodesWithTagRecursive(tag, nodes);
+    }
+}
+
+void SceneNode::removeChildInternal(SceneNode* child) {
+    auto it = std::find(m_children.begin(), m_children.end(), child);
+    if (it != m_children.end()) {
+        m_children.erase(it);
+    }
+
+    child->m_parent = nullptr;
+    child->setSceneIndex(nullptr);
+}
+
+void SceneNode::cleanupChildren() {
+    std::vector<SceneNode*> children;
+    children.swap(m_children);
+
+    for (SceneNode* child : children) {
+        child->m_parent = nullptr;
+        delete child;
+    }
+}
+
+// SceneManager implementation
+bool SceneManager::setActiveScene(const std::string& name) {
+    if (m_scenes.find(name) == m_scenes.end()) {
+        std::cerr << "Scene not found: " << name << std::endl;
+        return false;
+    }
+
+    m_activeScene = name;
+    rebuildSceneIndex();
+    return true;
+}
+
+SceneNode* SceneManager::findNode(const std::string& name) {
+    return findNode(StringId::find(name));
+}
+
+SceneNode* SceneManager::findNode(StringId name) const {
+    return m_sceneIndex ? m_sceneIndex->findNode(name) : nullptr;
+}
+
+std::vector<SceneNode*> SceneManager::findNodesWithTag(const std::string& tag) {
+    return findNodesWithTag(StringId::find(tag));
+}
+
+const std::vector<SceneNode*>& SceneManager::findNodesWithTag(StringId tag) const {
+    static const std::vector<SceneNode*> emptyNodeList;
+    if (!m_sceneIndex) {
+        return emptyNodeList;
+    }
+
+    return m_sceneIndex->findNodesWithTag(TagRegistry::getTagId(tag));
+}
+
+Entity SceneManager::getEntity(const std::string& name) const {
+    return getEntity(StringId::find(name));
+}
+
+Entity SceneManager::getEntity(StringId name) const {
+    return m_sceneIndex ? m_sceneIndex->findEntity(name) : Entity(INVALID_ENTITY);
+}
+
+void SceneManager::rebuildSceneIndex() {
+    if (!m_sceneIndex) {
+        m_sceneIndex = std::make_unique<SceneIndex>();
+    }
+
+    // Detach every scene first so nodes of inactive scenes stop updating the index
+    for (auto& [name, root] : m_scenes) {
+        if (root) {
+            root->setSceneIndex(nullptr);
+        }
+    }
+    if (m_rootNode) {
+        m_rootNode->setSceneIndex(nullptr);
+    }
+    m_sceneIndex->clear();
+
+    auto it = m_scenes.find(m_activeScene);
+    SceneNode* activeRoot = it != m_scenes.end() ? it->second.get() : m_rootNode.get();
+    if (activeRoot) {
+        activeRoot->setSceneIndex(m_sceneIndex.get());
+    }
+}
+
+} // namespace VortexEngine
@@ -5,13 +5,15 @@
 #include <unordered_map>
 #include <memory>
 #include <functional>
+#include <glm/glm.hpp>
 
 #include "../ecs/ecs_manager.h"
+#include "../utils/string_id.h"
+#include "scene_index.h"
 
 namespace VortexEngine {
 
 // Forward declarations
-class Entity;
 class Camera;
 class Light;
 class Mesh;
@@ -42,7 +44,9 @@ public:
     void destroyEntity(Entity entity);
     bool hasEntity(Entity entity) const;
     Entity getEntity(const std::string& name) const;
+    Entity getEntity(StringId name) const;
     const std::vector<Entity>& getEntities() const { return m_entities; }
+    const std::unordered_map<StringId, Entity>& getEntityNames() const { return m_entityNames; }
 
     // Transform
     void setPosition(const glm::vec3& position);
@@ -58,12 +62,19 @@ public:
     glm::mat4 getWorldTransformMatrix() const;
 
     // Scene node properties
-    void setName(const std::string& name) { m_name = name; }
+    void setName(const std::string& name);
     const std::string& getName() const { return m_name; }
+    StringId getNameId() const { return m_nameId; }
     void setActive(bool active) { m_active = active; }
     bool isActive() const { return m_active; }
-    void setTag(const std::string& tag) { m_tag = tag; }
-    const std::string& getTag() const { return m_tag; }
+
+    // Scene node tags
+    void addTag(StringId tag);
+    void addTag(const std::string& tag) { addTag(StringId::intern(tag)); }
+    void removeTag(StringId tag);
+    void removeTag(const std::string& tag) { removeTag(StringId::find(tag)); }
+    void clearTags();
+    const TagMask& getTags() const { return m_tags; }
 
     // Scene node updates
     void update(float deltaTime);
@@ -72,8 +83,17 @@ public:
 
     // Scene node queries
     SceneNode* findNode(const std::string& name);
+    SceneNode* findNode(StringId name);
     std::vector<SceneNode*> findNodesWithTag(const std::string& tag);
-    bool hasTag(const std::string& tag) const { return m_tag == tag; }
+    std::vector<SceneNode*> findNodesWithTag(StringId tag);
+    bool hasTag(const std::string& tag) const { return hasTag(StringId::find(tag)); }
+    bool hasTag(StringId tag) const;
+    bool hasTag(TagId tag) const { return tag < MAX_TAGS && m_tags.test(tag); }
+    bool isDescendantOf(const SceneNode* ancestor) const;
+
+    // Scene lookup tables
+    void setSceneIndex(SceneIndex* index);
+    SceneIndex* getSceneIndex() const { return m_index; }
 
     // Serialization
     void serialize(std::ostream& stream) const;
@@ -82,7 +102,8 @@ public:
 private:
     // Scene node properties
     std::string m_name;
-    std::string m_tag;
+    StringId m_nameId;
+    TagMask m_tags;
     bool m_active = true;
 
     // Transform
@@ -98,10 +119,16 @@ private:
 
     // Entities
     std::vector<Entity> m_entities;
+    std::unordered_map<StringId, Entity> m_entityNames;
     ECSManager* m_ecsManager = nullptr;
 
+    // Lookup tables of the scene this node belongs to (null when detached)
+    SceneIndex* m_index = nullptr;
+
     // Internal methods
     void updateWorldTransformRecursive();
+    SceneNode* findNodeRecursive(StringId name);
+    void findNodesWithTagRecursive(TagId tag, std::vector<SceneNode*>& nodes);
     void removeChildInternal(SceneNode* child);
     void cleanupChildren();
 };
@@ -128,7 +155,9 @@ public:
     SceneNode* getRootNode() { return m_rootNode.get(); }
     const SceneNode* getRootNode() const { return m_rootNode.get(); }
     SceneNode* findNode(const std::string& name);
+    SceneNode* findNode(StringId name) const;
     std::vector<SceneNode*> findNodesWithTag(const std::string& tag);
+    const std::vector<SceneNode*>& findNodesWithTag(StringId tag) const;
     std::vector<std::string> getSceneNames() const;
 
     // Entity management
@@ -136,6 +165,7 @@ public:
     void destroyEntity(Entity entity);
     bool hasEntity(Entity entity) const;
     Entity getEntity(const std::string& name) const;
+    Entity getEntity(StringId name) const;
 
     // Scene updates
     void update(float deltaTime);
@@ -171,6 +201,9 @@ private:
     std::string m_sceneDirectory = "scenes";
     bool m_autoSave = false;
 
+    // Name/tag lookup tables for the active scene
+    std::unique_ptr<SceneIndex> m_sceneIndex;
+
     // ECS integration
     ECSManager* m_ecsManager = nullptr;
 
@@ -194,6 +227,7 @@ private:
     void notifyEntityCreated(Entity entity);
     void notifyEntityDestroyed(Entity entity);
     void cleanupScenes();
+    void rebuildSceneIndex();
     void serializeSceneNode(SceneNode* node, std::ostream& stream) const;
     void deserializeSceneNode(SceneNode* node, std::istream& stream);
 };
@@ -224,6 +258,17 @@ namespace SceneComponents {
         bool receiveShadows = true;
     };
 
+    enum class CameraType {
+        Perspective,
+        Orthographic
+    };
+
+    enum class LightType {
+        Directional,
+        Point,
+        Spot
+    };
+
     // Camera component
     struct Camera {
         float fov = 45.0f;
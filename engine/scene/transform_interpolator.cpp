@@ -0,0 +1,112 @@
+#include "transform_interpolator.h"
+#include <algorithm>
+#include <cmath>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/quaternion.hpp>
+
+namespace VortexEngine {
+
+namespace {
+
+// Euler rotations apply yaw (Y), then pitch (X), then roll (Z), as in toMatrix()
+glm::quat toQuaternion(const glm::vec3& rotation) {
+    return glm::angleAxis(rotation.y, glm::vec3(0.0f, 1.0f, 0.0f)) *
+           glm::angleAxis(rotation.x, glm::vec3(1.0f, 0.0f, 0.0f)) *
+           glm::angleAxis(rotation.z, glm::vec3(0.0f, 0.0f, 1.0f));
+}
+
+glm::vec3 toEulerAngles(const glm::quat& rotation) {
+    // Columns of R = Ry * Rx * Rz; m[column][row]
+    glm::mat3 m = glm::mat3_cast(rotation);
+    float sinPitch = -m[2][1];
+    float cosPitch = std::sqrt(m[0][1] * m[0][1] + m[1][1] * m[1][1]);
+    float pitch = std::atan2(sinPitch, cosPitch);
+
+    if (cosPitch > 1e-6f) {
+        return glm::vec3(pitch, std::atan2(m[2][0], m[2][2]), std::atan2(m[0][1], m[1][1]));
+    }
+
+    // Gimbal lock: yaw and roll turn about the same axis, fold it into yaw
+    return glm::vec3(pitch, std::atan2(-m[0][2], m[0][0]), 0.0f);
+}
+
+} // namespace
+
+void TransformInterpolator::capturePrevious(ECSManager* ecsManager) {
+    if (!ecsManager) {
+        return;
+    }
+
+    ComponentType transformType = ComponentRegistry::GetComponentType<SceneComponents::Transform>();
+    m_entityScratch = ecsManager->getEntitiesWithComponent(transformType);
+
+    // Overwrite in place so a steady entity set captures without allocating
+    m_generation++;
+    for (Entity entity : m_entityScratch) {
+        CapturedTransform& captured = m_previous[entity];
+        captured.transform = ecsManager->getComponent<SceneComponents::Transform>(entity);
+        captured.generation = m_generation;
+    }
+    m_capturedCount = m_entityScratch.size();
+
+    // Entities destroyed since the last capture drop out
+    if (m_previous.size() > m_capturedCount) {
+        std::erase_if(m_previous, [this](const auto& entry) {
+            return entry.second.generation != m_generation;
+        });
+    }
+}
+
+void TransformInterpolator::clear() {
+    m_previous.clear();
+    m_entityScratch.clear();
+    m_capturedCount = 0;
+}
+
+SceneComponents::Transform TransformInterpolator::interpolate(Entity entity, const SceneComponents::Transform& current, float alpha) const {
+    auto it = m_previous.find(entity);
+    if (it == m_previous.end()) {
+        // Spawned during the last step - nothing to blend from
+        return current;
+    }
+
+    return lerp(it->second.transform, current, alpha);
+}
+
+SceneComponents::Transform TransformInterpolator::getInterpolatedTransform(ECSManager* ecsManager, Entity entity, float alpha) const {
+    const SceneComponents::Transform& current = ecsManager->getComponent<SceneComponents::Transform>(entity);
+    return interpolate(entity, current, alpha);
+}
+
+glm::mat4 TransformInterpolator::getInterpolatedMatrix(ECSManager* ecsManager, Entity entity, float alpha) const {
+    return toMatrix(getInterpolatedTransform(ecsManager, entity, alpha));
+}
+
+SceneComponents::Transform TransformInterpolator::lerp(const SceneComponents::Transform& a, const SceneComponents::Transform& b, float t) {
+    if (t <= 0.0f) {
+        return a;
+    }
+    if (t >= 1.0f) {
+        return b;
+    }
+
+    SceneComponents::Transform result;
+    result.position = glm::mix(a.position, b.position, t);
+    result.scale = glm::mix(a.scale, b.scale, t);
+
+    // Blending the angles directly takes the long way round across +-pi and
+    // wobbles when several axes turn at once; slerp follows the shortest arc
+    result.rotation = toEulerAngles(glm::slerp(toQuaternion(a.rotation), toQuaternion(b.rotation), t));
+    return result;
+}
+
+glm::mat4 TransformInterpolator::toMatrix(const SceneComponents::Transform& transform) {
+    glm::mat4 matrix = glm::translate(glm::mat4(1.0f), transform.position);
+    matrix = glm::rotate(matrix, transform.rotation.y, glm::vec3(0.0f, 1.0f, 0.0f));
+    matrix = glm::rotate(matrix, transform.rotation.x, glm::vec3(1.0f, 0.0f, 0.0f));
+    matrix = glm::rotate(matrix, transform.rotation.z, glm::vec3(0.0f, 0.0f, 1.0f));
+    matrix = glm::scale(matrix, transform.scale);
+    return matrix;
+}
+
+} // namespace VortexEngine
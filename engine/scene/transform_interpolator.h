@@ -0,0 +1,54 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "../ecs/ecs_manager.h"
+#include "scene_manager.h"
+
+namespace VortexEngine {
+
+// Transform interpolation between fixed simulation steps
+//
+// The simulation advances in fixed increments while frames are rendered at
+// whatever rate the display allows. Before the last simulation step of a frame
+// the current transforms are captured; the renderer then blends between that
+// capture and the post-step state using the leftover accumulator fraction.
+class TransformInterpolator {
+public:
+    TransformInterpolator() = default;
+    ~TransformInterpolator() = default;
+
+    // State capture
+    void capturePrevious(ECSManager* ecsManager);
+    void clear();
+
+    // Interpolation
+    SceneComponents::Transform interpolate(Entity entity, const SceneComponents::Transform& current, float alpha) const;
+    SceneComponents::Transform getInterpolatedTransform(ECSManager* ecsManager, Entity entity, float alpha) const;
+    glm::mat4 getInterpolatedMatrix(ECSManager* ecsManager, Entity entity, float alpha) const;
+
+    // Debug information
+    size_t getCapturedCount() const { return m_capturedCount; }
+
+    // Helpers
+    static SceneComponents::Transform lerp(const SceneComponents::Transform& a, const SceneComponents::Transform& b, float t);
+    static glm::mat4 toMatrix(const SceneComponents::Transform& transform);
+
+private:
+    struct CapturedTransform {
+        SceneComponents::Transform transform;
+        uint64_t generation = 0;
+    };
+
+    // Entries are overwritten in place each capture; ones not stamped with
+    // the current generation belong to entities that no longer exist
+    std::unordered_map<Entity, CapturedTransform> m_previous;
+    std::vector<Entity> m_entityScratch;
+    uint64_t m_generation = 0;
+    size_t m_capturedCount = 0;
+};
+
+} // namespace VortexEngine
@@ -0,0 +1,237 @@
+#include "component_array.h"
+#include <cstdlib>
+#include <iostream>
+
+namespace VortexEngine {
+
+PyObject* ComponentArray::s_type = nullptr;
+
+namespace {
+
+struct ComponentArrayObject {
+    PyObject_HEAD
+    IComponentPool* pool;
+    const ComponentBufferLayout* layout;
+    ComponentArray::Column column;
+    bool readOnly;
+};
+
+// Shape and strides must stay valid until the buffer is released, and the
+// pool may have changed size between two exports, so each export owns them
+struct ExportInfo {
+    Py_ssize_t shape[2];
+    Py_ssize_t strides[2];
+};
+
+// Stand-in address for empty pools, whose storage pointer may be null
+char s_emptyStorage = 0;
+
+const char* getColumnName(ComponentArray::Column column) {
+    switch (column) {
+        case ComponentArray::Column::Components: return "components";
+        case ComponentArray::Column::Scalars: return "scalars";
+        case ComponentArray::Column::Entities: return "entities";
+    }
+    return "unknown";
+}
+
+int componentArrayGetBuffer(PyObject* self, Py_buffer* view, int flags) {
+    auto* array = reinterpret_cast<ComponentArrayObject*>(self);
+    IComponentPool* pool = array->pool;
+    const ComponentBufferLayout* layout = array->layout;
+
+    bool readOnly = array->readOnly || array->column == ComponentArray::Column::Entities;
+    if ((flags & PyBUF_WRITABLE) == PyBUF_WRITABLE && readOnly) {
+        PyErr_SetString(PyExc_BufferError, "component array is read-only");
+        return -1;
+    }
+
+    auto* info = static_cast<ExportInfo*>(PyMem_Malloc(sizeof(ExportInfo)));
+    if (!info) {
+        PyErr_NoMemory();
+        return -1;
+    }
+
+    // First export since the last sync: land deferred adds/removes so the
+    // view reflects the pool's current contents
+    if (pool->getExportCount() == 0) {
+        pool->applyPendingChanges();
+    }
+
+    auto count = static_cast<Py_ssize_t>(pool->size());
+    void* data = nullptr;
+    const char* format = nullptr;
+
+    switch (array->column) {
+        case ComponentArray::Column::Components:
+            data = pool->getComponentData();
+            format = layout->format;
+            view->ndim = 1;
+            view->itemsize = static_cast<Py_ssize_t>(pool->getComponentSize());
+            info->shape[0] = count;
+            info->strides[0] = view->itemsize;
+            break;
+
+        case ComponentArray::Column::Scalars:
+            data = pool->getComponentData();
+            format = layout->scalarFormat;
+            view->ndim = 2;
+            view->itemsize = static_cast<Py_ssize_t>(layout->scalarSize);
+            info->shape[0] = count;
+            info->shape[1] = static_cast<Py_ssize_t>(layout->scalarCount);
+            info->strides[0] = static_cast<Py_ssize_t>(pool->getComponentSize());
+            info->strides[1] = view->itemsize;
+            break;
+
+        case ComponentArray::Column::Entities:
+            data = const_cast<Entity*>(pool->getEntityData());
+            format = "I";
+            view->ndim = 1;
+            view->itemsize = sizeof(uint32_t);
+            info->shape[0] = count;
+            info->strides[0] = view->itemsize;
+            break;
+    }
+
+    view->buf = data ? data : &s_emptyStorage;
+    view->len = count * static_cast<Py_ssize_t>(array->column == ComponentArray::Column::Entities
+                                                    ? sizeof(uint32_t) : pool->getComponentSize());
+    view->readonly = readOnly ? 1 : 0;
+    view->suboffsets = nullptr;
+    view->internal = info;
+
+    // Every column is C-contiguous. Without PyBUF_FORMAT the format is
+    // implicitly "B", so the consumer gets the column as plain bytes
+    if ((flags & PyBUF_FORMAT) == PyBUF_FORMAT) {
+        view->format = const_cast<char*>(format);
+    } else {
+        view->format = nullptr;
+        view->ndim = 1;
+        view->itemsize = 1;
+        info->shape[0] = view->len;
+        info->strides[0] = 1;
+    }
+
+    if ((flags & PyBUF_ND) == PyBUF_ND) {
+        view->shape = info->shape;
+        view->strides = (flags & PyBUF_STRIDES) == PyBUF_STRIDES ? info->strides : nullptr;
+    } else {
+        view->ndim = 1;
+        view->itemsize = 1;
+        view->shape = nullptr;
+        view->strides = nullptr;
+    }
+
+    Py_INCREF(self);
+    view->obj = self;
+    pool->acquireExport();
+    return 0;
+}
+
+void componentArrayReleaseBuffer(PyObject* self, Py_buffer* view) {
+    auto* array = reinterpret_cast<ComponentArrayObject*>(self);
+    array->pool->releaseExport();
+    PyMem_Free(view->internal);
+    view->internal = nullptr;
+}
+
+Py_ssize_t componentArrayLength(PyObject* self) {
+    auto* array = reinterpret_cast<ComponentArrayObject*>(self);
+    return static_cast<Py_ssize_t>(array->pool->size());
+}
+
+PyObject* componentArrayRepr(PyObject* self) {
+    auto* array = reinterpret_cast<ComponentArrayObject*>(self);
+    return PyUnicode_FromFormat("<ComponentArray %s %s[%zd]>", array->layout->name,
+                                getColumnName(array->column), static_cast<Py_ssize_t>(array->pool->size()));
+}
+
+PyObject* componentArrayGetExports(PyObject* self, void*) {
+    auto* array = reinterpret_cast<ComponentArrayObject*>(self);
+    return PyLong_FromUnsignedLong(array->pool->getExportCount());
+}
+
+void componentArrayDealloc(PyObject* self) {
+    PyTypeObject* type = Py_TYPE(self);
+    type->tp_free(self);
+    Py_DECREF(type);
+}
+
+PyGetSetDef s_componentArrayGetSet[] = {
+    {"exports", componentArrayGetExports, nullptr, "Buffers currently exported from the component pool", nullptr},
+    {nullptr, nullptr, nullptr, nullptr, nullptr}
+};
+
+PyType_Slot s_componentArraySlots[] = {
+    {Py_bf_getbuffer, reinterpret_cast<void*>(componentArrayGetBuffer)},
+    {Py_bf_releasebuffer, reinterpret_cast<void*>(componentArrayReleaseBuffer)},
+    {Py_sq_length, reinterpret_cast<void*>(componentArrayLength)},
+    {Py_tp_repr, reinterpret_cast<void*>(componentArrayRepr)},
+    {Py_tp_getset, s_componentArrayGetSet},
+    {Py_tp_dealloc, reinterpret_cast<void*>(componentArrayDealloc)},
+    {Py_tp_doc, const_cast<char*>("Zero-copy buffer view of a dense ECS component column")},
+    {0, nullptr}
+};
+
+PyType_Spec s_componentArraySpec = {
+    "vortex.ComponentArray",
+    sizeof(ComponentArrayObject),
+    0,
+    Py_TPFLAGS_DEFAULT,
+    s_componentArraySlots
+};
+
+} // namespace
+
+bool ComponentArray::registerType(PyObject* module) {
+    if (!s_type) {
+        s_type = PyType_FromSpec(&s_componentArraySpec);
+        if (!s_type) {
+            std::cerr << "Failed to create ComponentArray type" << std::endl;
+            PyErr_Print();
+            return false;
+        }
+    }
+
+    if (module) {
+        Py_INCREF(s_type);
+        if (PyModule_AddObject(module, "ComponentArray", s_type) < 0) {
+            Py_DECREF(s_type);
+            PyErr_Print();
+            return false;
+        }
+    }
+    return true;
+}
+
+void ComponentArray::unregisterType() {
+    Py_CLEAR(s_type);
+}
+
+PyObject* ComponentArray::create(IComponentPool* pool, const ComponentBufferLayout& layout, Column column, bool readOnly) {
+    if (!pool) {
+        PyErr_SetString(PyExc_ValueError, "component pool does not exist");
+        return nullptr;
+    }
+    if (column == Column::Scalars && !layout.scalarFormat) {
+        PyErr_Format(PyExc_TypeError, "%s has no scalar layout", layout.name);
+        return nullptr;
+    }
+    if (!s_type && !registerType()) {
+        return nullptr;
+    }
+
+    auto* type = reinterpret_cast<PyTypeObject*>(s_type);
+    auto* array = reinterpret_cast<ComponentArrayObject*>(type->tp_alloc(type, 0));
+    if (!array) {
+        return nullptr;
+    }
+
+    array->pool = pool;
+    array->layout = &layout;
+    array->column = column;
+    array->readOnly = readOnly;
+    return reinterpret_cast<PyObject*>(array);
+}
+
+} // namespace VortexEngine
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <Python.h>
+
+#include <cstddef>
+
+#include "../ecs/ecs_manager.h"
+
+namespace VortexEngine {
+
+// Memory layout of a component type as seen from Python
+//
+// format is a PEP 3118 struct string describing one component, e.g.
+// "T{(3)f:position:(3)f:rotation:(3)f:scale:}", which NumPy turns into a
+// structured dtype. Components made of a single scalar type can also be
+// viewed as a (count, scalarCount) array of scalarFormat.
+struct ComponentBufferLayout {
+    const char* name;
+    const char* format;
+    const char* scalarFormat;  // null if the fields have mixed types
+    size_t scalarSize;
+    size_t scalarCount;
+};
+
+// Specialize with a constexpr static ComponentBufferLayout layout for every
+// component that scripts may view
+template<typename T>
+struct ComponentBufferTraits;
+
+// Python view of a dense ECS component column
+//
+// A ComponentArray is a live handle on a component pool that implements the
+// buffer protocol, so memoryview(array) and numpy.asarray(array) read and
+// write the components in place without copying. While any buffer taken
+// from it is alive the pool's dense storage does not move: components of
+// that type added or removed meanwhile are deferred, and appear in views
+// taken after every view has been released (or after the next
+// ECSManager::updateSystems()). Consumers that do not ask for a format get
+// the column as plain bytes. The ECS manager must outlive every ComponentArray created from it.
+//
+// Must be used with the GIL held.
+class ComponentArray {
+public:
+    enum class Column {
+        Components,  // (count,) of the structured component format
+        Scalars,     // (count, scalarCount) of the scalar format
+        Entities     // (count,) uint32 entity ids, always read-only
+    };
+
+    // Creates the ComponentArray type; call once after Py_Initialize and
+    // optionally add it to a module so scripts can isinstance() it
+    static bool registerType(PyObject* module = nullptr);
+    static void unregisterType();
+
+    static PyObject* create(IComponentPool* pool, const ComponentBufferLayout& layout,
+                            Column column = Column::Components, bool readOnly = false);
+
+    template<typename T>
+    static PyObject* create(ECSManager& ecsManager, Column column = Column::Components, bool readOnly = false) {
+        constexpr const ComponentBufferLayout& layout = ComponentBufferTraits<T>::layout;
+        static_assert(layout.scalarFormat == nullptr || layout.scalarSize * layout.scalarCount == sizeof(T),
+                      "Scalar layout must cover the whole component");
+
+        ecsManager.registerComponent<T>();
+        return create(ecsManager.getComponentPool<T>(), layout, column, readOnly);
+    }
+
+private:
+    static PyObject* s_type;
+};
+
+} // namespace VortexEngine
@@ -0,0 +1,1288 @@
+#include "native_types.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <structmember.h>
+
+#if PY_VERSION_HEX < 0x030C0000
+#define Py_T_FLOAT T_FLOAT
+#define Py_T_UINT T_UINT
+#define Py_READONLY READONLY
+#endif
+
+namespace VortexEngine {
+
+namespace {
+
+// Object layouts
+struct Vec3Object {
+    PyObject_HEAD
+    float v[3];
+};
+
+struct Mat4Object {
+    PyObject_HEAD
+    float m[16]; // Column-major, m[column * 4 + row]
+};
+
+struct EntityObject {
+    PyObject_HEAD
+    uint32_t id;
+};
+
+struct TransformObject {
+    PyObject_HEAD
+    float position[3];
+    float rotation[3]; // Euler angles in radians, applied Y, X, Z
+    float scale[3];
+};
+
+// Fixed-size block allocator backing one object type. Freed blocks go on an
+// intrusive list and are reused first; trim() hands chunks whose blocks are
+// all free back to the system, keeping one spare so a steady allocation
+// rate does not map and unmap a chunk every frame. Called with the GIL held.
+class ObjectArena {
+public:
+    static constexpr size_t CHUNK_SIZE = 64 * 1024;
+
+    explicit ObjectArena(size_t objectSize)
+        : m_blockSize((objectSize + alignof(std::max_align_t) - 1) & ~(alignof(std::max_align_t) - 1)) {}
+
+    void* allocate() {
+        if (!m_freeList && !grow()) {
+            return nullptr;
+        }
+        FreeBlock* block = m_freeList;
+        m_freeList = block->next;
+        m_liveObjects++;
+        m_totalAllocations++;
+        return block;
+    }
+
+    void release(void* memory) {
+        auto* block = static_cast<FreeBlock*>(memory);
+        block->next = m_freeList;
+        m_freeList = block;
+        m_liveObjects--;
+    }
+
+    // Frees empty chunks beyond the first; returns the number released
+    size_t trim() {
+        size_t blockCount = CHUNK_SIZE / m_blockSize;
+        if (m_chunks.size() < 2 || m_liveObjects + 2 * blockCount > m_chunks.size() * blockCount) {
+            return 0;   // Fewer than two chunks' worth of free blocks
+        }
+
+        // Count free blocks per chunk, with chunks sorted by address
+        std::vector<std::pair<const char*, size_t>> chunks;
+        chunks.reserve(m_chunks.size());
+        for (const auto& chunk : m_chunks) {
+            chunks.emplace_back(reinterpret_cast<const char*>(chunk.get()), 0);
+        }
+        std::sort(chunks.begin(), chunks.end());
+
+        auto findChunk = [&chunks](const void* block) {
+            auto it = std::upper_bound(chunks.begin(), chunks.end(), static_cast<const char*>(block),
+                                       [](const char* address, const auto& chunk) { return address < chunk.first; });
+            return std::prev(it);
+        };
+        for (FreeBlock* block = m_freeList; block; block = block->next) {
+            findChunk(block)->second++;
+        }
+
+        // Keep the first empty chunk as a spare and mark the rest for release
+        bool spareKept = false;
+        size_t released = 0;
+        for (auto& [address, freeBlocks] : chunks) {
+            bool empty = freeBlocks == blockCount;
+            freeBlocks = empty && spareKept ? SIZE_MAX : 0;
+            spareKept |= empty;
+            released += freeBlocks == SIZE_MAX;
+        }
+        if (released == 0) {
+            return 0;
+        }
+
+        // Unlink the released chunks' blocks, preserving the list order
+        FreeBlock** link = &m_freeList;
+        while (*link) {
+            if (findChunk(*link)->second == SIZE_MAX) {
+                *link = (*link)->next;
+            } else {
+                link = &(*link)->next;
+            }
+        }
+
+        m_chunks.erase(std::remove_if(m_chunks.begin(), m_chunks.end(), [&](const auto& chunk) {
+            return findChunk(chunk.get())->second == SIZE_MAX;
+        }), m_chunks.end());
+        m_chunkReleases += released;
+        return released;
+    }
+
+    void addStats(NativeArenaStats& stats) const {
+        stats.liveObjects += m_liveObjects;
+        stats.reservedBytes += m_chunks.size() * CHUNK_SIZE;
+        stats.totalAllocations += m_totalAllocations;
+        stats.chunkAllocations += m_chunkAllocations;
+        stats.chunkReleases += m_chunkReleases;
+    }
+
+private:
+    struct FreeBlock {
+        FreeBlock* next;
+    };
+
+    size_t m_blockSize;
+    FreeBlock* m_freeList = nullptr;
+    std::vector<std::unique_ptr<std::max_align_t[]>> m_chunks;
+    size_t m_liveObjects = 0;
+    uint64_t m_totalAllocations = 0;
+    uint64_t m_chunkAllocations = 0;
+    uint64_t m_chunkReleases = 0;
+
+    bool grow() {
+        size_t blockCount = CHUNK_SIZE / m_blockSize;
+        auto chunk = std::unique_ptr<std::max_align_t[]>(new (std::nothrow) std::max_align_t[CHUNK_SIZE / sizeof(std::max_align_t)]);
+        if (!chunk) {
+            return false;
+        }
+
+        // Thread the new blocks in address order so allocations walk forward
+        auto* bytes = reinterpret_cast<char*>(chunk.get());
+        for (size_t i = blockCount; i-- > 0;) {
+            auto* block = reinterpret_cast<FreeBlock*>(bytes + i * m_blockSize);
+            block->next = m_freeList;
+            m_freeList = block;
+        }
+        m_chunks.push_back(std::move(chunk));
+        m_chunkAllocations++;
+        return true;
+    }
+};
+
+ObjectArena s_vec3Arena(sizeof(Vec3Object));
+ObjectArena s_mat4Arena(sizeof(Mat4Object));
+ObjectArena s_entityArena(sizeof(EntityObject));
+ObjectArena s_transformArena(sizeof(TransformObject));
+
+extern PyTypeObject s_vec3Type;
+extern PyTypeObject s_mat4Type;
+extern PyTypeObject s_entityType;
+extern PyTypeObject s_transformType;
+
+template<typename T, ObjectArena& Arena>
+PyObject* arenaAlloc(PyTypeObject* type, Py_ssize_t) {
+    void* memory = Arena.allocate();
+    if (!memory) {
+        return PyErr_NoMemory();
+    }
+    std::memset(memory, 0, sizeof(T));
+    return PyObject_Init(static_cast<PyObject*>(memory), type);
+}
+
+template<ObjectArena& Arena>
+void arenaFree(void* memory) {
+    Arena.release(memory);
+}
+
+void nativeDealloc(PyObject* self) {
+    Py_TYPE(self)->tp_free(self);
+}
+
+template<typename T>
+T* allocObject(PyTypeObject* type) {
+    return reinterpret_cast<T*>(type->tp_alloc(type, 0));
+}
+
+// Conversion helpers
+bool toFloat(PyObject* object, float& value) {
+    if (PyFloat_CheckExact(object)) {
+        value = static_cast<float>(PyFloat_AS_DOUBLE(object));
+        return true;
+    }
+    double result = PyFloat_AsDouble(object);
+    if (result == -1.0 && PyErr_Occurred()) {
+        return false;
+    }
+    value = static_cast<float>(result);
+    return true;
+}
+
+bool isNumber(PyObject* object) {
+    return PyFloat_Check(object) || PyLong_Check(object);
+}
+
+bool toFloats(PyObject* object, float* values, Py_ssize_t count, const char* typeName) {
+    PyObject* sequence = PySequence_Fast(object, typeName);
+    if (!sequence) {
+        return false;
+    }
+
+    bool success = PySequence_Fast_GET_SIZE(sequence) == count;
+    if (!success) {
+        PyErr_Format(PyExc_TypeError, "%s needs %zd numbers, got %zd", typeName, count, PySequence_Fast_GET_SIZE(sequence));
+    }
+    PyObject** items = PySequence_Fast_ITEMS(sequence);
+    for (Py_ssize_t i = 0; success && i < count; ++i) {
+        success = toFloat(items[i], values[i]);
+    }
+    Py_DECREF(sequence);
+    return success;
+}
+
+bool readVec3(PyObject* object, float* xyz) {
+    if (Py_IS_TYPE(object, &s_vec3Type)) {
+        std::memcpy(xyz, reinterpret_cast<Vec3Object*>(object)->v, sizeof(float) * 3);
+        return true;
+    }
+    return toFloats(object, xyz, 3, "Vec3");
+}
+
+bool checkNoKeywords(const char* name, PyObject* kwnames) {
+    if (kwnames && PyTuple_GET_SIZE(kwnames) != 0) {
+        PyErr_Format(PyExc_TypeError, "%s() takes no keyword arguments", name);
+        return false;
+    }
+    return true;
+}
+
+// Formats floats for repr() the way Python prints them
+void appendFloat(std::string& text, float value) {
+    char buffer[32];
+    std::snprintf(buffer, sizeof(buffer), "%.9g", static_cast<double>(value));
+    text += buffer;
+}
+
+// Types are called through tp_vectorcall; tp_new only serves __new__ and
+// other tuple-based calls
+template<vectorcallfunc Vectorcall>
+PyObject* newFromTuple(PyTypeObject* type, PyObject* args, PyObject* kwargs) {
+    Py_ssize_t nargs = PyTuple_GET_SIZE(args);
+    std::vector<PyObject*> stack(args ? &PyTuple_GET_ITEM(args, 0) : nullptr,
+                                 args ? &PyTuple_GET_ITEM(args, 0) + nargs : nullptr);
+
+    PyObject* kwnames = nullptr;
+    if (kwargs && PyDict_GET_SIZE(kwargs) != 0) {
+        kwnames = PyTuple_New(PyDict_GET_SIZE(kwargs));
+        if (!kwnames) {
+            return nullptr;
+        }
+        Py_ssize_t position = 0;
+        Py_ssize_t index = 0;
+        PyObject* key = nullptr;
+        PyObject* value = nullptr;
+        while (PyDict_Next(kwargs, &position, &key, &value)) {
+            Py_INCREF(key);
+            PyTuple_SET_ITEM(kwnames, index++, key);
+            stack.push_back(value);
+        }
+    }
+
+    PyObject* result = Vectorcall(reinterpret_cast<PyObject*>(type), stack.data(), static_cast<size_t>(nargs), kwnames);
+    Py_XDECREF(kwnames);
+    return result;
+}
+
+// Mat4 math (column-major, matching glm)
+void mat4Identity(float* m) {
+    std::memset(m, 0, sizeof(float) * 16);
+    m[0] = m[5] = m[10] = m[15] = 1.0f;
+}
+
+void mat4Multiply(const float* a, const float* b, float* result) {
+    for (int column = 0; column < 4; ++column) {
+        for (int row = 0; row < 4; ++row) {
+            result[column * 4 + row] = a[row] * b[column * 4] + a[4 + row] * b[column * 4 + 1] +
+                                       a[8 + row] * b[column * 4 + 2] + a[12 + row] * b[column * 4 + 3];
+        }
+    }
+}
+
+void mat4Rotation(float angle, const float* axis, float* m) {
+    float length = std::sqrt(axis[0] * axis[0] + axis[1] * axis[1] + axis[2] * axis[2]);
+    float x = length > 0.0f ? axis[0] / length : 0.0f;
+    float y = length > 0.0f ? axis[1] / length : 0.0f;
+    float z = length > 0.0f ? axis[2] / length : 0.0f;
+    float c = std::cos(angle);
+    float s = std::sin(angle);
+    float t = 1.0f - c;
+
+    mat4Identity(m);
+    m[0] = c + t * x * x;     m[1] = t * x * y + s * z; m[2] = t * x * z - s * y;
+    m[4] = t * y * x - s * z; m[5] = c + t * y * y;     m[6] = t * y * z + s * x;
+    m[8] = t * z * x + s * y; m[9] = t * z * y - s * x; m[10] = c + t * z * z;
+}
+
+bool mat4Inverse(const float* m, float* result) {
+    float inv[16];
+    inv[0] = m[5] * m[10] * m[15] - m[5] * m[11] * m[14] - m[9] * m[6] * m[15] + m[9] * m[7] * m[14] + m[13] * m[6] * m[11] - m[13] * m[7] * m[10];
+    inv[4] = -m[4] * m[10] * m[15] + m[4] * m[11] * m[14] + m[8] * m[6] * m[15] - m[8] * m[7] * m[14] - m[12] * m[6] * m[11] + m[12] * m[7] * m[10];
+    inv[8] = m[4] * m[9] * m[15] - m[4] * m[11] * m[13] - m[8] * m[5] * m[15] + m[8] * m[7] * m[13] + m[12] * m[5] * m[11] - m[12] * m[7] * m[9];
+    inv[12] = -m[4] * m[9] * m[14] + m[4] * m[10] * m[13] + m[8] * m[5] * m[14] - m[8] * m[6] * m[13] - m[12] * m[5] * m[10] + m[12] * m[6] * m[9];
+    inv[1] = -m[1] * m[10] * m[15] + m[1] * m[11] * m[14] + m[9] * m[2] * m[15] - m[9] * m[3] * m[14] - m[13] * m[2] * m[11] + m[13] * m[3] * m[10];
+    inv[5] = m[0] * m[10] * m[15] - m[0] * m[11] * m[14] - m[8] * m[2] * m[15] + m[8] * m[3] * m[14] + m[12] * m[2] * m[11] - m[12] * m[3] * m[10];
+    inv[9] = -m[0] * m[9] * m[15] + m[0] * m[11] * m[13] + m[8] * m[1] * m[15] - m[8] * m[3] * m[13] - m[12] * m[1] * m[11] + m[12] * m[3] * m[9];
+    inv[13] = m[0] * m[9] * m[14] - m[0] * m[10] * m[13] - m[8] * m[1] * m[14] + m[8] * m[2] * m[13] + m[12] * m[1] * m[10] - m[12] * m[2] * m[9];
+    inv[2] = m[1] * m[6] * m[15] - m[1] * m[7] * m[14] - m[5] * m[2] * m[15] + m[5] * m[3] * m[14] + m[13] * m[2] * m[7] - m[13] * m[3] * m[6];
+    inv[6] = -m[0] * m[6] * m[15] + m[0] * m[7] * m[14] + m[4] * m[2] * m[15] - m[4] * m[3] * m[14] - m[12] * m[2] * m[7] + m[12] * m[3] * m[6];
+    inv[10] = m[0] * m[5] * m[15] - m[0] * m[7] * m[13] - m[4] * m[1] * m[15] + m[4] * m[3] * m[13] + m[12] * m[1] * m[7] - m[12] * m[3] * m[5];
+    inv[14] = -m[0] * m[5] * m[14] + m[0] * m[6] * m[13] + m[4] * m[1] * m[14] - m[4] * m[2] * m[13] - m[12] * m[1] * m[6] + m[12] * m[2] * m[5];
+    inv[3] = -m[1] * m[6] * m[11] + m[1] * m[7] * m[10] + m[5] * m[2] * m[11] - m[5] * m[3] * m[10] - m[9] * m[2] * m[7] + m[9] * m[3] * m[6];
+    inv[7] = m[0] * m[6] * m[11] - m[0] * m[7] * m[10] - m[4] * m[2] * m[11] + m[4] * m[3] * m[10] + m[8] * m[2] * m[7] - m[8] * m[3] * m[6];
+    inv[11] = -m[0] * m[5] * m[11] + m[0] * m[7] * m[9] + m[4] * m[1] * m[11] - m[4] * m[3] * m[9] - m[8] * m[1] * m[7] + m[8] * m[3] * m[5];
+    inv[15] = m[0] * m[5] * m[10] - m[0] * m[6] * m[9] - m[4] * m[1] * m[10] + m[4] * m[2] * m[9] + m[8] * m[1] * m[6] - m[8] * m[2] * m[5];
+
+    float determinant = m[0] * inv[0] + m[1] * inv[4] + m[2] * inv[8] + m[3] * inv[12];
+    if (determinant == 0.0f) {
+        return false;
+    }
+    float scale = 1.0f / determinant;
+    for (int i = 0; i < 16; ++i) {
+        result[i] = inv[i] * scale;
+    }
+    return true;
+}
+
+// Same order as TransformInterpolator::toMatrix: T * Ry * Rx * Rz * S
+void transformMatrix(const TransformObject* transform, float* m) {
+    static const float xAxis[3] = {1.0f, 0.0f, 0.0f};
+    static const float yAxis[3] = {0.0f, 1.0f, 0.0f};
+    static const float zAxis[3] = {0.0f, 0.0f, 1.0f};
+
+    float ry[16], rx[16], rz[16], ryx[16];
+    mat4Rotation(transform->rotation[1], yAxis, ry);
+    mat4Rotation(transform->rotation[0], xAxis, rx);
+    mat4Rotation(transform->rotation[2], zAxis, rz);
+    mat4Multiply(ry, rx, ryx);
+    mat4Multiply(ryx, rz, m);
+
+    for (int column = 0; column < 3; ++column) {
+        for (int row = 0; row < 3; ++row) {
+            m[column * 4 + row] *= transform->scale[column];
+        }
+    }
+    m[12] = transform->position[0];
+    m[13] = transform->position[1];
+    m[14] = transform->position[2];
+}
+
+// ---------------------------------------------------------------------------
+// Vec3
+
+PyObject* vec3FromFloats(float x, float y, float z) {
+    Vec3Object* result = allocObject<Vec3Object>(&s_vec3Type);
+    if (result) {
+        result->v[0] = x;
+        result->v[1] = y;
+        result->v[2] = z;
+    }
+    return reinterpret_cast<PyObject*>(result);
+}
+
+PyObject* vec3Vectorcall(PyObject* type, PyObject* const* args, size_t nargsf, PyObject* kwnames) {
+    Py_ssize_t nargs = PyVectorcall_NARGS(nargsf);
+    if (!checkNoKeywords("Vec3", kwnames)) {
+        return nullptr;
+    }
+
+    float v[3] = {0.0f, 0.0f, 0.0f};
+    if (nargs == 1) {
+        // Vec3(s) splats, Vec3(v) copies any 3 numbers
+        if (isNumber(args[0])) {
+            if (!toFloat(args[0], v[0])) {
+                return nullptr;
+            }
+            v[1] = v[2] = v[0];
+        } else if (!readVec3(args[0], v)) {
+            return nullptr;
+        }
+    } else if (nargs == 3) {
+        for (int i = 0; i < 3; ++i) {
+            if (!toFloat(args[i], v[i])) {
+                return nullptr;
+            }
+        }
+    } else if (nargs != 0) {
+        PyErr_Format(PyExc_TypeError, "Vec3() takes 0, 1 or 3 arguments (%zd given)", nargs);
+        return nullptr;
+    }
+
+    (void)type;
+    return vec3FromFloats(v[0], v[1], v[2]);
+}
+
+PyObject* vec3Repr(PyObject* self) {
+    const float* v = reinterpret_cast<Vec3Object*>(self)->v;
+    std::string text = "Vec3(";
+    for (int i = 0; i < 3; ++i) {
+        appendFloat(text, v[i]);
+        text += i < 2 ? ", " : ")";
+    }
+    return PyUnicode_FromStringAndSize(text.data(), static_cast<Py_ssize_t>(text.size()));
+}
+
+PyObject* vec3RichCompare(PyObject* a, PyObject* b, int op) {
+    if (!Py_IS_TYPE(a, &s_vec3Type) || !Py_IS_TYPE(b, &s_vec3Type) || (op != Py_EQ && op != Py_NE)) {
+        Py_RETURN_NOTIMPLEMENTED;
+    }
+    const float* x = reinterpret_cast<Vec3Object*>(a)->v;
+    const float* y = reinterpret_cast<Vec3Object*>(b)->v;
+    bool equal = x[0] == y[0] && x[1] == y[1] && x[2] == y[2];
+    return PyBool_FromLong((op == Py_EQ) == equal);
+}
+
+// Operands of the arithmetic slots: a Vec3 or a number
+struct Vec3Operand {
+    float v[3];
+    bool isVector;
+};
+
+bool getOperand(PyObject* object, Vec3Operand& operand) {
+    if (Py_IS_TYPE(object, &s_vec3Type)) {
+        std::memcpy(operand.v, reinterpret_cast<Vec3Object*>(object)->v, sizeof(operand.v));
+        operand.isVector = true;
+        return true;
+    }
+    if (isNumber(object) && toFloat(object, operand.v[0])) {
+        operand.v[1] = operand.v[2] = operand.v[0];
+        operand.isVector = false;
+        return true;
+    }
+    PyErr_Clear();
+    return false;
+}
+
+enum class Vec3Op {
+    Add,
+    Subtract,
+    Multiply,
+    Divide
+};
+
+// Vectors combine component-wise; + and - need two vectors, * and / also
+// take a scalar on either side (a scalar may only be divided by nothing)
+PyObject* vec3Binary(PyObject* a, PyObject* b, Vec3Op op, bool inPlace) {
+    Vec3Operand x;
+    Vec3Operand y;
+    if (!getOperand(a, x) || !getOperand(b, y)) {
+        Py_RETURN_NOTIMPLEMENTED;
+    }
+    bool scalarAllowed = op == Vec3Op::Multiply || (op == Vec3Op::Divide && x.isVector);
+    if ((!x.isVector || !y.isVector) && !scalarAllowed) {
+        Py_RETURN_NOTIMPLEMENTED;
+    }
+
+    float result[3];
+    for (int i = 0; i < 3; ++i) {
+        switch (op) {
+            case Vec3Op::Add: result[i] = x.v[i] + y.v[i]; break;
+            case Vec3Op::Subtract: result[i] = x.v[i] - y.v[i]; break;
+            case Vec3Op::Multiply: result[i] = x.v[i] * y.v[i]; break;
+            case Vec3Op::Divide:
+                if (y.v[i] == 0.0f) {
+                    PyErr_SetString(PyExc_ZeroDivisionError, "Vec3 division by zero");
+                    return nullptr;
+                }
+                result[i] = x.v[i] / y.v[i];
+                break;
+        }
+    }
+
+    // In-place forms reuse the left operand instead of allocating
+    if (inPlace) {
+        std::memcpy(reinterpret_cast<Vec3Object*>(a)->v, result, sizeof(result));
+        Py_INCREF(a);
+        return a;
+    }
+    return vec3FromFloats(result[0], result[1], result[2]);
+}
+
+PyObject* vec3Add(PyObject* a, PyObject* b) { return vec3Binary(a, b, Vec3Op::Add, false); }
+PyObject* vec3Subtract(PyObject* a, PyObject* b) { return vec3Binary(a, b, Vec3Op::Subtract, false); }
+PyObject* vec3Multiply(PyObject* a, PyObject* b) { return vec3Binary(a, b, Vec3Op::Multiply, false); }
+PyObject* vec3Divide(PyObject* a, PyObject* b) { return vec3Binary(a, b, Vec3Op::Divide, false); }
+PyObject* vec3InPlaceAdd(PyObject* a, PyObject* b) { return vec3Binary(a, b, Vec3Op::Add, true); }
+PyObject* vec3InPlaceSubtract(PyObject* a, PyObject* b) { return vec3Binary(a, b, Vec3Op::Subtract, true); }
+PyObject* vec3InPlaceMultiply(PyObject* a, PyObject* b) { return vec3Binary(a, b, Vec3Op::Multiply, true); }
+PyObject* vec3InPlaceDivide(PyObject* a, PyObject* b) { return vec3Binary(a, b, Vec3Op::Divide, true); }
+
+PyObject* vec3Negative(PyObject* self) {
+    const float* v = reinterpret_cast<Vec3Object*>(self)->v;
+    return vec3FromFloats(-v[0], -v[1], -v[2]);
+}
+
+Py_ssize_t vec3Length(PyObject*) {
+    return 3;
+}
+
+PyObject* vec3Item(PyObject* self, Py_ssize_t index) {
+    if (index < 0 || index >= 3) {
+        PyErr_SetString(PyExc_IndexError, "Vec3 index out of range");
+        return nullptr;
+    }
+    return PyFloat_FromDouble(reinterpret_cast<Vec3Object*>(self)->v[index]);
+}
+
+int vec3AssignItem(PyObject* self, Py_ssize_t index, PyObject* value) {
+    if (index < 0 || index >= 3) {
+        PyErr_SetString(PyExc_IndexError, "Vec3 index out of range");
+        return -1;
+    }
+    if (!value) {
+        PyErr_SetString(PyExc_TypeError, "Vec3 components cannot be deleted");
+        return -1;
+    }
+    return toFloat(value, reinterpret_cast<Vec3Object*>(self)->v[index]) ? 0 : -1;
+}
+
+bool getVec3Argument(PyObject* object, const char* method, float* v) {
+    if (Py_IS_TYPE(object, &s_vec3Type)) {
+        std::memcpy(v, reinterpret_cast<Vec3Object*>(object)->v, sizeof(float) * 3);
+        return true;
+    }
+    PyErr_Format(PyExc_TypeError, "Vec3.%s() expects a Vec3, got %s", method, Py_TYPE(object)->tp_name);
+    return false;
+}
+
+PyObject* vec3Dot(PyObject* self, PyObject* other) {
+    float w[3];
+    if (!getVec3Argument(other, "dot", w)) {
+        return nullptr;
+    }
+    const float* v = reinterpret_cast<Vec3Object*>(self)->v;
+    return PyFloat_FromDouble(v[0] * w[0] + v[1] * w[1] + v[2] * w[2]);
+}
+
+PyObject* vec3Cross(PyObject* self, PyObject* other) {
+    float w[3];
+    if (!getVec3Argument(other, "cross", w)) {
+        return nullptr;
+    }
+    const float* v = reinterpret_cast<Vec3Object*>(self)->v;
+    return vec3FromFloats(v[1] * w[2] - v[2] * w[1], v[2] * w[0] - v[0] * w[2], v[0] * w[1] - v[1] * w[0]);
+}
+
+PyObject* vec3LengthMethod(PyObject* self, PyObject*) {
+    const float* v = reinterpret_cast<Vec3Object*>(self)->v;
+    return PyFloat_FromDouble(std::sqrt(v[0] * v[0] + v[1] * v[1] + v[2] * v[2]));
+}
+
+PyObject* vec3LengthSquared(PyObject* self, PyObject*) {
+    const float* v = reinterpret_cast<Vec3Object*>(self)->v;
+    return PyFloat_FromDouble(v[0] * v[0] + v[1] * v[1] + v[2] * v[2]);
+}
+
+PyObject* vec3Normalized(PyObject* self, PyObject*) {
+    const float* v = reinterpret_cast<Vec3Object*>(self)->v;
+    float length = std::sqrt(v[0] * v[0] + v[1] * v[1] + v[2] * v[2]);
+    if (length == 0.0f) {
+        return vec3FromFloats(0.0f, 0.0f, 0.0f);
+    }
+    return vec3FromFloats(v[0] / length, v[1] / length, v[2] / length);
+}
+
+PyObject* vec3Lerp(PyObject* self, PyObject* const* args, Py_ssize_t nargs) {
+    if (nargs != 2) {
+        PyErr_Format(PyExc_TypeError, "Vec3.lerp() takes 2 arguments (%zd given)", nargs);
+        return nullptr;
+    }
+    float w[3];
+    float t = 0.0f;
+    if (!getVec3Argument(args[0], "lerp", w) || !toFloat(args[1], t)) {
+        return nullptr;
+    }
+    const float* v = reinterpret_cast<Vec3Object*>(self)->v;
+    return vec3FromFloats(v[0] + (w[0] - v[0]) * t, v[1] + (w[1] - v[1]) * t, v[2] + (w[2] - v[2]) * t);
+}
+
+PyObject* vec3Reduce(PyObject* self, PyObject*) {
+    const float* v = reinterpret_cast<Vec3Object*>(self)->v;
+    return Py_BuildValue("(O(fff))", reinterpret_cast<PyObject*>(&s_vec3Type), v[0], v[1], v[2]);
+}
+
+PyMethodDef s_vec3Methods[] = {
+    {"dot", vec3Dot, METH_O, "dot(other) -> float"},
+    {"cross", vec3Cross, METH_O, "cross(other) -> Vec3"},
+    {"length", vec3LengthMethod, METH_NOARGS, "length() -> float"},
+    {"length_squared", vec3LengthSquared, METH_NOARGS, "length_squared() -> float"},
+    {"normalized", vec3Normalized, METH_NOARGS, "normalized() -> Vec3 (zero stays zero)"},
+    {"lerp", reinterpret_cast<PyCFunction>(reinterpret_cast<void*>(vec3Lerp)), METH_FASTCALL, "lerp(other, t) -> Vec3"},
+    {"__reduce__", vec3Reduce, METH_NOARGS, nullptr},
+    {nullptr, nullptr, 0, nullptr}
+};
+
+PyMemberDef s_vec3Members[] = {
+    {"x", Py_T_FLOAT, offsetof(Vec3Object, v), 0, nullptr},
+    {"y", Py_T_FLOAT, offsetof(Vec3Object, v) + sizeof(float), 0, nullptr},
+    {"z", Py_T_FLOAT, offsetof(Vec3Object, v) + 2 * sizeof(float), 0, nullptr},
+    {nullptr, 0, 0, 0, nullptr}
+};
+
+PyNumberMethods s_vec3Number = [] {
+    PyNumberMethods methods{};
+    methods.nb_add = vec3Add;
+    methods.nb_subtract = vec3Subtract;
+    methods.nb_multiply = vec3Multiply;
+    methods.nb_true_divide = vec3Divide;
+    methods.nb_inplace_add = vec3InPlaceAdd;
+    methods.nb_inplace_subtract = vec3InPlaceSubtract;
+    methods.nb_inplace_multiply = vec3InPlaceMultiply;
+    methods.nb_inplace_true_divide = vec3InPlaceDivide;
+    methods.nb_negative = vec3Negative;
+    return methods;
+}();
+
+PySequenceMethods s_vec3Sequence = [] {
+    PySequenceMethods methods{};
+    methods.sq_length = vec3Length;
+    methods.sq_item = vec3Item;
+    methods.sq_ass_item = vec3AssignItem;
+    return methods;
+}();
+
+// ---------------------------------------------------------------------------
+// Mat4
+
+PyObject* mat4FromFloats(const float* m) {
+    Mat4Object* result = allocObject<Mat4Object>(&s_mat4Type);
+    if (result) {
+        std::memcpy(result->m, m, sizeof(result->m));
+    }
+    return reinterpret_cast<PyObject*>(result);
+}
+
+PyObject* mat4Vectorcall(PyObject*, PyObject* const* args, size_t nargsf, PyObject* kwnames) {
+    Py_ssize_t nargs = PyVectorcall_NARGS(nargsf);
+    if (!checkNoKeywords("Mat4", kwnames)) {
+        return nullptr;
+    }
+
+    float m[16];
+    if (nargs == 0) {
+        mat4Identity(m);
+    } else if (nargs == 1 && Py_IS_TYPE(args[0], &s_mat4Type)) {
+        std::memcpy(m, reinterpret_cast<Mat4Object*>(args[0])->m, sizeof(m));
+    } else if (nargs == 1 && PySequence_Check(args[0])) {
+        if (!toFloats(args[0], m, 16, "Mat4")) {
+            return nullptr;
+        }
+    } else if (nargs == 1) {
+        PyErr_Format(PyExc_TypeError, "Mat4() takes no arguments, a Mat4 or a sequence of 16 column-major numbers, "
+                     "got %s", Py_TYPE(args[0])->tp_name);
+        return nullptr;
+    } else {
+        PyErr_Format(PyExc_TypeError, "Mat4() takes no arguments, a Mat4 or a sequence of 16 column-major numbers "
+                     "(%zd arguments given)", nargs);
+        return nullptr;
+    }
+    return mat4FromFloats(m);
+}
+
+PyObject* mat4Repr(PyObject* self) {
+    const float* m = reinterpret_cast<Mat4Object*>(self)->m;
+    std::string text = "Mat4((";
+    for (int i = 0; i < 16; ++i) {
+        appendFloat(text, m[i]);
+        text += i == 15 ? "))" : ", ";
+    }
+    return PyUnicode_FromStringAndSize(text.data(), static_cast<Py_ssize_t>(text.size()));
+}
+
+PyObject* mat4RichCompare(PyObject* a, PyObject* b, int op) {
+    if (!Py_IS_TYPE(a, &s_mat4Type) || !Py_IS_TYPE(b, &s_mat4Type) || (op != Py_EQ && op != Py_NE)) {
+        Py_RETURN_NOTIMPLEMENTED;
+    }
+    bool equal = true;
+    for (int i = 0; i < 16 && equal; ++i) {
+        equal = reinterpret_cast<Mat4Object*>(a)->m[i] == reinterpret_cast<Mat4Object*>(b)->m[i];
+    }
+    return PyBool_FromLong((op == Py_EQ) == equal);
+}
+
+// m @ n composes, m @ v transforms the point v
+PyObject* mat4MatrixMultiply(PyObject* a, PyObject* b) {
+    if (!Py_IS_TYPE(a, &s_mat4Type)) {
+        Py_RETURN_NOTIMPLEMENTED;
+    }
+    const float* m = reinterpret_cast<Mat4Object*>(a)->m;
+
+    if (Py_IS_TYPE(b, &s_mat4Type)) {
+        float result[16];
+        mat4Multiply(m, reinterpret_cast<Mat4Object*>(b)->m, result);
+        return mat4FromFloats(result);
+    }
+    if (Py_IS_TYPE(b, &s_vec3Type)) {
+        const float* v = reinterpret_cast<Vec3Object*>(b)->v;
+        return vec3FromFloats(m[0] * v[0] + m[4] * v[1] + m[8] * v[2] + m[12],
+                              m[1] * v[0] + m[5] * v[1] + m[9] * v[2] + m[13],
+                              m[2] * v[0] + m[6] * v[1] + m[10] * v[2] + m[14]);
+    }
+    Py_RETURN_NOTIMPLEMENTED;
+}
+
+PyObject* mat4InPlaceMatrixMultiply(PyObject* a, PyObject* b) {
+    if (!Py_IS_TYPE(a, &s_mat4Type) || !Py_IS_TYPE(b, &s_mat4Type)) {
+        Py_RETURN_NOTIMPLEMENTED;
+    }
+    float* m = reinterpret_cast<Mat4Object*>(a)->m;
+    float result[16];
+    mat4Multiply(m, reinterpret_cast<Mat4Object*>(b)->m, result);
+    std::memcpy(m, result, sizeof(result));
+    Py_INCREF(a);
+    return a;
+}
+
+// m[column, row], as glm's m[column][row]
+bool getMat4Index(PyObject* key, int& index) {
+    if (!PyTuple_Check(key) || PyTuple_GET_SIZE(key) != 2) {
+        PyErr_SetString(PyExc_TypeError, "Mat4 indices are (column, row) pairs");
+        return false;
+    }
+    long column = PyLong_AsLong(PyTuple_GET_ITEM(key, 0));
+    long row = PyLong_AsLong(PyTuple_GET_ITEM(key, 1));
+    if (PyErr_Occurred()) {
+        return false;
+    }
+    if (column < 0 || column > 3 || row < 0 || row > 3) {
+        PyErr_SetString(PyExc_IndexError, "Mat4 index out of range");
+        return false;
+    }
+    index = static_cast<int>(column * 4 + row);
+    return true;
+}
+
+PyObject* mat4Subscript(PyObject* self, PyObject* key) {
+    int index = 0;
+    if (!getMat4Index(key, index)) {
+        return nullptr;
+    }
+    return PyFloat_FromDouble(reinterpret_cast<Mat4Object*>(self)->m[index]);
+}
+
+int mat4AssignSubscript(PyObject* self, PyObject* key, PyObject* value) {
+    int index = 0;
+    if (!getMat4Index(key, index)) {
+        return -1;
+    }
+    if (!value) {
+        PyErr_SetString(PyExc_TypeError, "Mat4 elements cannot be deleted");
+        return -1;
+    }
+    return toFloat(value, reinterpret_cast<Mat4Object*>(self)->m[index]) ? 0 : -1;
+}
+
+PyObject* mat4TransformPoint(PyObject* self, PyObject* point) {
+    if (!Py_IS_TYPE(point, &s_vec3Type)) {
+        PyErr_Format(PyExc_TypeError, "Mat4.transform_point() expects a Vec3, got %s", Py_TYPE(point)->tp_name);
+        return nullptr;
+    }
+    return mat4MatrixMultiply(self, point);
+}
+
+PyObject* mat4TransformVector(PyObject* self, PyObject* vector) {
+    if (!Py_IS_TYPE(vector, &s_vec3Type)) {
+        PyErr_Format(PyExc_TypeError, "Mat4.transform_vector() expects a Vec3, got %s", Py_TYPE(vector)->tp_name);
+        return nullptr;
+    }
+    const float* m = reinterpret_cast<Mat4Object*>(self)->m;
+    const float* v = reinterpret_cast<Vec3Object*>(vector)->v;
+    return vec3FromFloats(m[0] * v[0] + m[4] * v[1] + m[8] * v[2],
+                          m[1] * v[0] + m[5] * v[1] + m[9] * v[2],
+                          m[2] * v[0] + m[6] * v[1] + m[10] * v[2]);
+}
+
+PyObject* mat4Transposed(PyObject* self, PyObject*) {
+    const float* m = reinterpret_cast<Mat4Object*>(self)->m;
+    float result[16];
+    for (int column = 0; column < 4; ++column) {
+        for (int row = 0; row < 4; ++row) {
+            result[column * 4 + row] = m[row * 4 + column];
+        }
+    }
+    return mat4FromFloats(result);
+}
+
+PyObject* mat4Inverse(PyObject* self, PyObject*) {
+    float result[16];
+    if (!mat4Inverse(reinterpret_cast<Mat4Object*>(self)->m, result)) {
+        PyErr_SetString(PyExc_ValueError, "Mat4 is singular");
+        return nullptr;
+    }
+    return mat4FromFloats(result);
+}
+
+PyObject* mat4StaticIdentity(PyObject*, PyObject*) {
+    float m[16];
+    mat4Identity(m);
+    return mat4FromFloats(m);
+}
+
+PyObject* mat4StaticTranslation(PyObject*, PyObject* offset) {
+    float v[3];
+    if (!readVec3(offset, v)) {
+        return nullptr;
+    }
+    float m[16];
+    mat4Identity(m);
+    m[12] = v[0];
+    m[13] = v[1];
+    m[14] = v[2];
+    return mat4FromFloats(m);
+}
+
+PyObject* mat4StaticScaling(PyObject*, PyObject* factors) {
+    float v[3];
+    if (!readVec3(factors, v)) {
+        return nullptr;
+    }
+    float m[16];
+    mat4Identity(m);
+    m[0] = v[0];
+    m[5] = v[1];
+    m[10] = v[2];
+    return mat4FromFloats(m);
+}
+
+PyObject* mat4StaticRotation(PyObject*, PyObject* const* args, Py_ssize_t nargs) {
+    if (nargs != 2) {
+        PyErr_Format(PyExc_TypeError, "Mat4.rotation() takes 2 arguments (%zd given)", nargs);
+        return nullptr;
+    }
+    float angle = 0.0f;
+    float axis[3];
+    if (!toFloat(args[0], angle) || !readVec3(args[1], axis)) {
+        return nullptr;
+    }
+    float m[16];
+    mat4Rotation(angle, axis, m);
+    return mat4FromFloats(m);
+}
+
+PyObject* mat4Reduce(PyObject* self, PyObject*) {
+    const float* m = reinterpret_cast<Mat4Object*>(self)->m;
+    PyObject* values = PyTuple_New(16);
+    if (!values) {
+        return nullptr;
+    }
+    for (int i = 0; i < 16; ++i) {
+        PyObject* value = PyFloat_FromDouble(m[i]);
+        if (!value) {
+            Py_DECREF(values);
+            return nullptr;
+        }
+        PyTuple_SET_ITEM(values, i, value);
+    }
+    return Py_BuildValue("(O(N))", reinterpret_cast<PyObject*>(&s_mat4Type), values);
+}
+
+PyMethodDef s_mat4Methods[] = {
+    {"identity", mat4StaticIdentity, METH_NOARGS | METH_STATIC, "identity() -> Mat4"},
+    {"translation", mat4StaticTranslation, METH_O | METH_STATIC, "translation(offset) -> Mat4"},
+    {"scaling", mat4StaticScaling, METH_O | METH_STATIC, "scaling(factors) -> Mat4"},
+    {"rotation", reinterpret_cast<PyCFunction>(reinterpret_cast<void*>(mat4StaticRotation)), METH_FASTCALL | METH_STATIC,
+     "rotation(radians, axis) -> Mat4"},
+    {"transform_point", mat4TransformPoint, METH_O, "transform_point(v) -> Vec3 (same as m @ v)"},
+    {"transform_vector", mat4TransformVector, METH_O, "transform_vector(v) -> Vec3 (ignores translation)"},
+    {"transposed", mat4Transposed, METH_NOARGS, "transposed() -> Mat4"},
+    {"inverse", mat4Inverse, METH_NOARGS, "inverse() -> Mat4; raises ValueError if singular"},
+    {"__reduce__", mat4Reduce, METH_NOARGS, nullptr},
+    {nullptr, nullptr, 0, nullptr}
+};
+
+PyNumberMethods s_mat4Number = [] {
+    PyNumberMethods methods{};
+    methods.nb_matrix_multiply = mat4MatrixMultiply;
+    methods.nb_inplace_matrix_multiply = mat4InPlaceMatrixMultiply;
+    return methods;
+}();
+
+PyMappingMethods s_mat4Mapping = [] {
+    PyMappingMethods methods{};
+    methods.mp_subscript = mat4Subscript;
+    methods.mp_ass_subscript = mat4AssignSubscript;
+    return methods;
+}();
+
+// ---------------------------------------------------------------------------
+// Entity
+
+PyObject* entityFromId(uint32_t id) {
+    EntityObject* result = allocObject<EntityObject>(&s_entityType);
+    if (result) {
+        result->id = id;
+    }
+    return reinterpret_cast<PyObject*>(result);
+}
+
+PyObject* entityVectorcall(PyObject*, PyObject* const* args, size_t nargsf, PyObject* kwnames) {
+    Py_ssize_t nargs = PyVectorcall_NARGS(nargsf);
+    if (!checkNoKeywords("Entity", kwnames)) {
+        return nullptr;
+    }
+    if (nargs != 1) {
+        PyErr_Format(PyExc_TypeError, "Entity() takes 1 argument (%zd given)", nargs);
+        return nullptr;
+    }
+
+    unsigned long id = PyLong_AsUnsignedLong(args[0]);
+    if (PyErr_Occurred()) {
+        return nullptr;
+    }
+    if (id > UINT32_MAX) {
+        PyErr_SetString(PyExc_OverflowError, "entity id does not fit in 32 bits");
+        return nullptr;
+    }
+    return entityFromId(static_cast<uint32_t>(id));
+}
+
+PyObject* entityRepr(PyObject* self) {
+    return PyUnicode_FromFormat("Entity(%u)", reinterpret_cast<EntityObject*>(self)->id);
+}
+
+Py_hash_t entityHash(PyObject* self) {
+    return static_cast<Py_hash_t>(reinterpret_cast<EntityObject*>(self)->id);
+}
+
+PyObject* entityRichCompare(PyObject* a, PyObject* b, int op) {
+    if (!Py_IS_TYPE(a, &s_entityType) || !Py_IS_TYPE(b, &s_entityType)) {
+        Py_RETURN_NOTIMPLEMENTED;
+    }
+    Py_RETURN_RICHCOMPARE(reinterpret_cast<EntityObject*>(a)->id, reinterpret_cast<EntityObject*>(b)->id, op);
+}
+
+PyObject* entityIndex(PyObject* self) {
+    return PyLong_FromUnsignedLong(reinterpret_cast<EntityObject*>(self)->id);
+}
+
+int entityBool(PyObject* self) {
+    return reinterpret_cast<EntityObject*>(self)->id != 0;
+}
+
+PyObject* entityReduce(PyObject* self, PyObject*) {
+    return Py_BuildValue("(O(I))", reinterpret_cast<PyObject*>(&s_entityType), reinterpret_cast<EntityObject*>(self)->id);
+}
+
+PyMethodDef s_entityMethods[] = {
+    {"__reduce__", entityReduce, METH_NOARGS, nullptr},
+    {nullptr, nullptr, 0, nullptr}
+};
+
+PyMemberDef s_entityMembers[] = {
+    {"id", Py_T_UINT, offsetof(EntityObject, id), Py_READONLY, nullptr},
+    {nullptr, 0, 0, 0, nullptr}
+};
+
+PyNumberMethods s_entityNumber = [] {
+    PyNumberMethods methods{};
+    methods.nb_bool = entityBool;
+    methods.nb_int = entityIndex;
+    methods.nb_index = entityIndex;
+    return methods;
+}();
+
+// ---------------------------------------------------------------------------
+// Transform
+
+PyObject* transformFromFloats(const float* position, const float* rotation, const float* scale) {
+    TransformObject* result = allocObject<TransformObject>(&s_transformType);
+    if (result) {
+        std::memcpy(result->position, position, sizeof(result->position));
+        std::memcpy(result->rotation, rotation, sizeof(result->rotation));
+        std::memcpy(result->scale, scale, sizeof(result->scale));
+    }
+    return reinterpret_cast<PyObject*>(result);
+}
+
+PyObject* transformVectorcall(PyObject*, PyObject* const* args, size_t nargsf, PyObject* kwnames) {
+    static const char* const names[] = {"position", "rotation", "scale"};
+
+    Py_ssize_t nargs = PyVectorcall_NARGS(nargsf);
+    if (nargs > 3) {
+        PyErr_Format(PyExc_TypeError, "Transform() takes at most 3 arguments (%zd given)", nargs);
+        return nullptr;
+    }
+
+    PyObject* values[3] = {nullptr, nullptr, nullptr};
+    for (Py_ssize_t i = 0; i < nargs; ++i) {
+        values[i] = args[i];
+    }
+
+    Py_ssize_t keywordCount = kwnames ? PyTuple_GET_SIZE(kwnames) : 0;
+    for (Py_ssize_t i = 0; i < keywordCount; ++i) {
+        PyObject* name = PyTuple_GET_ITEM(kwnames, i);
+        int slot = -1;
+        for (int j = 0; j < 3 && slot < 0; ++j) {
+            if (PyUnicode_CompareWithASCIIString(name, names[j]) == 0) {
+                slot = j;
+            }
+        }
+        if (slot < 0) {
+            PyErr_Format(PyExc_TypeError, "Transform() got an unexpected keyword argument '%U'", name);
+            return nullptr;
+        }
+        if (values[slot]) {
+            PyErr_Format(PyExc_TypeError, "Transform() got multiple values for argument '%s'", names[slot]);
+            return nullptr;
+        }
+        values[slot] = args[nargs + i];
+    }
+
+    float fields[3][3] = {{0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 0.0f}, {1.0f, 1.0f, 1.0f}};
+    for (int i = 0; i < 3; ++i) {
+        if (values[i] && !readVec3(values[i], fields[i])) {
+            return nullptr;
+        }
+    }
+    return transformFromFloats(fields[0], fields[1], fields[2]);
+}
+
+PyObject* transformRepr(PyObject* self) {
+    auto* transform = reinterpret_cast<TransformObject*>(self);
+    const float* fields[] = {transform->position, transform->rotation, transform->scale};
+    const char* names[] = {"position=(", "), rotation=(", "), scale=("};
+
+    std::string text = "Transform(";
+    for (int i = 0; i < 3; ++i) {
+        text += names[i];
+        for (int j = 0; j < 3; ++j) {
+            appendFloat(text, fields[i][j]);
+            text += j < 2 ? ", " : "";
+        }
+    }
+    text += "))";
+    return PyUnicode_FromStringAndSize(text.data(), static_cast<Py_ssize_t>(text.size()));
+}
+
+// Getters copy so a Vec3 never aliases the transform; setters take any vec3
+PyObject* transformGetField(PyObject* self, void* closure) {
+    auto offset = reinterpret_cast<uintptr_t>(closure);
+    const float* v = reinterpret_cast<const float*>(reinterpret_cast<char*>(self) + offset);
+    return vec3FromFloats(v[0], v[1], v[2]);
+}
+
+int transformSetField(PyObject* self, PyObject* value, void* closure) {
+    if (!value) {
+        PyErr_SetString(PyExc_TypeError, "Transform fields cannot be deleted");
+        return -1;
+    }
+    auto offset = reinterpret_cast<uintptr_t>(closure);
+    float* v = reinterpret_cast<float*>(reinterpret_cast<char*>(self) + offset);
+    return readVec3(value, v) ? 0 : -1;
+}
+
+PyObject* transformMatrixMethod(PyObject* self, PyObject*) {
+    float m[16];
+    transformMatrix(reinterpret_cast<TransformObject*>(self), m);
+    return mat4FromFloats(m);
+}
+
+PyObject* transformTranslate(PyObject* self, PyObject* offset) {
+    float v[3];
+    if (!readVec3(offset, v)) {
+        return nullptr;
+    }
+    float* position = reinterpret_cast<TransformObject*>(self)->position;
+    position[0] += v[0];
+    position[1] += v[1];
+    position[2] += v[2];
+    Py_RETURN_NONE;
+}
+
+PyObject* transformReduce(PyObject* self, PyObject*) {
+    auto* transform = reinterpret_cast<TransformObject*>(self);
+    const float* p = transform->position;
+    const float* r = transform->rotation;
+    const float* s = transform->scale;
+    return Py_BuildValue("(O((fff)(fff)(fff)))", reinterpret_cast<PyObject*>(&s_transformType),
+                         p[0], p[1], p[2], r[0], r[1], r[2], s[0], s[1], s[2]);
+}
+
+PyMethodDef s_transformMethods[] = {
+    {"matrix", transformMatrixMethod, METH_NOARGS, "matrix() -> Mat4 (translation * rotation Y, X, Z * scale)"},
+    {"translate", transformTranslate, METH_O, "translate(offset): moves the position in place"},
+    {"__reduce__", transformReduce, METH_NOARGS, nullptr},
+    {nullptr, nullptr, 0, nullptr}
+};
+
+PyGetSetDef s_transformGetSet[] = {
+    {"position", transformGetField, transformSetField, "Vec3 (copy)",
+     reinterpret_cast<void*>(static_cast<uintptr_t>(offsetof(TransformObject, position)))},
+    {"rotation", transformGetField, transformSetField, "Vec3 of Euler angles in radians (copy)",
+     reinterpret_cast<void*>(static_cast<uintptr_t>(offsetof(TransformObject, rotation)))},
+    {"scale", transformGetField, transformSetField, "Vec3 (copy)",
+     reinterpret_cast<void*>(static_cast<uintptr_t>(offsetof(TransformObject, scale)))},
+    {nullptr, nullptr, nullptr, nullptr, nullptr}
+};
+
+// ---------------------------------------------------------------------------
+// Type objects
+
+PyTypeObject makeType(const char* name, const char* doc, Py_ssize_t size, vectorcallfunc vectorcall, newfunc newFunction,
+                      allocfunc alloc, freefunc free) {
+    // Static types hold one reference that is never released; PyType_Ready
+    // fills in ob_type
+    PyTypeObject type{};
+    Py_SET_REFCNT(reinterpret_cast<PyObject*>(&type), 1);
+    type.tp_name = name;
+    type.tp_doc = doc;
+    type.tp_basicsize = size;
+    type.tp_flags = Py_TPFLAGS_DEFAULT;
+    type.tp_vectorcall = vectorcall;
+    type.tp_new = newFunction;
+    type.tp_alloc = alloc;
+    type.tp_free = free;
+    type.tp_dealloc = nativeDealloc;
+    return type;
+}
+
+PyTypeObject s_vec3Type = [] {
+    PyTypeObject type = makeType("vortex.Vec3", "Vec3(x, y, z), Vec3(s) or Vec3(sequence)", sizeof(Vec3Object),
+                                 vec3Vectorcall, newFromTuple<vec3Vectorcall>,
+                                 arenaAlloc<Vec3Object, s_vec3Arena>, arenaFree<s_vec3Arena>);
+    type.tp_repr = vec3Repr;
+    type.tp_hash = PyObject_HashNotImplemented;
+    type.tp_richcompare = vec3RichCompare;
+    type.tp_as_number = &s_vec3Number;
+    type.tp_as_sequence = &s_vec3Sequence;
+    type.tp_methods = s_vec3Methods;
+    type.tp_members = s_vec3Members;
+    return type;
+}();
+
+PyTypeObject s_mat4Type = [] {
+    PyTypeObject type = makeType("vortex.Mat4", "Mat4() (identity), Mat4(m) or Mat4(16 column-major numbers)",
+                                 sizeof(Mat4Object), mat4Vectorcall, newFromTuple<mat4Vectorcall>,
+                                 arenaAlloc<Mat4Object, s_mat4Arena>, arenaFree<s_mat4Arena>);
+    type.tp_repr = mat4Repr;
+    type.tp_hash = PyObject_HashNotImplemented;
+    type.tp_richcompare = mat4RichCompare;
+    type.tp_as_number = &s_mat4Number;
+    type.tp_as_mapping = &s_mat4Mapping;
+    type.tp_methods = s_mat4Methods;
+    return type;
+}();
+
+PyTypeObject s_entityType = [] {
+    PyTypeObject type = makeType("vortex.Entity", "Entity(id); id 0 is the invalid entity", sizeof(EntityObject),
+                                 entityVectorcall, newFromTuple<entityVectorcall>,
+                                 arenaAlloc<EntityObject, s_entityArena>, arenaFree<s_entityArena>);
+    type.tp_repr = entityRepr;
+    type.tp_hash = entityHash;
+    type.tp_richcompare = entityRichCompare;
+    type.tp_as_number = &s_entityNumber;
+    type.tp_methods = s_entityMethods;
+    type.tp_members = s_entityMembers;
+    return type;
+}();
+
+PyTypeObject s_transformType = [] {
+    PyTypeObject type = makeType("vortex.Transform", "Transform(position=Vec3(0), rotation=Vec3(0), scale=Vec3(1))",
+                                 sizeof(TransformObject), transformVectorcall, newFromTuple<transformVectorcall>,
+                                 arenaAlloc<TransformObject, s_transformArena>, arenaFree<s_transformArena>);
+    type.tp_repr = transformRepr;
+    type.tp_hash = PyObject_HashNotImplemented;
+    type.tp_methods = s_transformMethods;
+    type.tp_getset = s_transformGetSet;
+    return type;
+}();
+
+bool s_typesReady = false;
+
+} // namespace
+
+bool NativeTypes::registerTypes(PyObject* module) {
+    PyTypeObject* types[] = {&s_vec3Type, &s_mat4Type, &s_entityType, &s_transformType};
+
+    if (!s_typesReady) {
+        for (PyTypeObject* type : types) {
+            if (PyType_Ready(type) < 0) {
+                PyErr_Print();
+                return false;
+            }
+        }
+        s_typesReady = true;
+    }
+
+    if (!module) {
+        return true;
+    }
+
+    for (PyTypeObject* type : types) {
+        const char* name = std::strrchr(type->tp_name, '.') + 1;
+        if (PyModule_AddObjectRef(module, name, reinterpret_cast<PyObject*>(type)) < 0) {
+            PyErr_Print();
+            return false;
+        }
+    }
+    return true;
+}
+
+PyTypeObject* NativeTypes::getVec3Type() { return &s_vec3Type; }
+PyTypeObject* NativeTypes::getMat4Type() { return &s_mat4Type; }
+PyTypeObject* NativeTypes::getEntityType() { return &s_entityType; }
+PyTypeObject* NativeTypes::getTransformType() { return &s_transformType; }
+
+PyObject* NativeTypes::newVec3(const float* xyz) {
+    return vec3FromFloats(xyz[0], xyz[1], xyz[2]);
+}
+
+PyObject* NativeTypes::newMat4(const float* columnMajor) {
+    return mat4FromFloats(columnMajor);
+}
+
+PyObject* NativeTypes::newEntity(uint32_t id) {
+    return entityFromId(id);
+}
+
+PyObject* NativeTypes::newTransform(const float* position, const float* rotation, const float* scale) {
+    return transformFromFloats(position, rotation, scale);
+}
+
+float* NativeTypes::getVec3Data(PyObject* object) {
+    return Py_IS_TYPE(object, &s_vec3Type) ? reinterpret_cast<Vec3Object*>(object)->v : nullptr;
+}
+
+float* NativeTypes::getMat4Data(PyObject* object) {
+    return Py_IS_TYPE(object, &s_mat4Type) ? reinterpret_cast<Mat4Object*>(object)->m : nullptr;
+}
+
+float* NativeTypes::getTransformData(PyObject* object) {
+    static_assert(offsetof(TransformObject, rotation) == offsetof(TransformObject, position) + 3 * sizeof(float) &&
+                  offsetof(TransformObject, scale) == offsetof(TransformObject, position) + 6 * sizeof(float),
+                  "Transform fields must be contiguous");
+    return Py_IS_TYPE(object, &s_transformType) ? reinterpret_cast<TransformObject*>(object)->position : nullptr;
+}
+
+bool NativeTypes::getEntityId(PyObject* object, uint32_t& id) {
+    if (!Py_IS_TYPE(object, &s_entityType)) {
+        return false;
+    }
+    id = reinterpret_cast<EntityObject*>(object)->id;
+    return true;
+}
+
+bool NativeTypes::toVec3(PyObject* object, float* xyz) {
+    return readVec3(object, xyz);
+}
+
+size_t NativeTypes::trimArenas() {
+    return (s_vec3Arena.trim() + s_mat4Arena.trim() + s_entityArena.trim() + s_transformArena.trim()) *
+           ObjectArena::CHUNK_SIZE;
+}
+
+NativeArenaStats NativeTypes::getArenaStats() {
+    NativeArenaStats stats;
+    s_vec3Arena.addStats(stats);
+    s_mat4Arena.addStats(stats);
+    s_entityArena.addStats(stats);
+    s_transformArena.addStats(stats);
+    return stats;
+}
+
+} // namespace VortexEngine
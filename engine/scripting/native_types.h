@@ -0,0 +1,74 @@
+#pragma once
+
+#include <Python.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace VortexEngine {
+
+// Native memory statistics of the engine value types
+struct NativeArenaStats {
+    size_t liveObjects = 0;
+    size_t reservedBytes = 0;
+    uint64_t totalAllocations = 0;
+    uint64_t chunkAllocations = 0;
+    uint64_t chunkReleases = 0;
+};
+
+// Fixed-layout Python types for engine values
+//
+// Vec3, Mat4, Entity and Transform are static PyTypeObjects whose instances
+// store their values inline (float[3], column-major float[16], uint32 id,
+// position/rotation/scale float[3] each), matching glm::vec3, glm::mat4,
+// Entity and SceneComponents::Transform. They have no __dict__ and cannot
+// be subclassed, so attribute access is a fixed-offset load and a
+// temporary like a + b is one allocation with no dict. Construction and
+// methods use vectorcall/METH_FASTCALL, so calls build no argument tuples.
+//
+// Instances are carved out of per-type arenas with intrusive free lists
+// rather than the general allocator, so the temporaries of vector math are
+// recycled in place. trimArenas() returns emptied chunks to the system and
+// is called once per frame by PythonEngine. The arenas are not locked: the
+// types must only be used from the main interpreter, which registerTypes()
+// is called in; worker interpreters do not get them.
+//
+// Vec3 and Mat4 are mutable (v.x = 1, v += w, m[column, row] = 1) and thus
+// unhashable. Transform.position and friends return copies; assign to
+// write back. Entity is an immutable, hashable id where 0 is invalid.
+class NativeTypes {
+public:
+    // Readies the types (once) and adds them to module if given
+    static bool registerTypes(PyObject* module = nullptr);
+
+    static PyTypeObject* getVec3Type();
+    static PyTypeObject* getMat4Type();
+    static PyTypeObject* getEntityType();
+    static PyTypeObject* getTransformType();
+
+    // Creation (new references, null with a Python error set on failure)
+    static PyObject* newVec3(const float* xyz);
+    static PyObject* newMat4(const float* columnMajor);
+    static PyObject* newEntity(uint32_t id);
+    static PyObject* newTransform(const float* position, const float* rotation, const float* scale);
+
+    // Direct access to the stored values; null (no error set) if object is
+    // not exactly of that type. Pointers stay valid while object is alive.
+    static float* getVec3Data(PyObject* object);
+    static float* getMat4Data(PyObject* object);
+    static float* getTransformData(PyObject* object);   // position, rotation, scale
+    static bool getEntityId(PyObject* object, uint32_t& id);
+
+    // Conversion that also accepts any sequence of numbers (Python error set
+    // on failure)
+    static bool toVec3(PyObject* object, float* xyz);
+
+    // Frees arena chunks that no longer hold live objects; returns the bytes
+    // released
+    static size_t trimArenas();
+
+    // Information
+    static NativeArenaStats getArenaStats();
+};
+
+} // namespace VortexEngine
@@ -1,8 +1,17 @@
+#include <algorithm>
+#include <filesystem>
 #include <iostream>
 #include "python_engine.h"
+#include "scene_native_types.h"
+#include "../utils/file_watcher.h"
 
 namespace VortexEngine {
 
+struct PythonEngine::ScriptWatcher {
+    FileWatcher watcher;
+    std::vector<FileChangeEvent> events;
+};
+
 PythonEngine::PythonEngine() {
     std::cout << "PythonEngine created" << std::endl;
 }
@@ -17,6 +26,17 @@ bool PythonEngine::initialize() {
 }
 
 void PythonEngine::shutdown() {
+    stopScriptWatcher();
+    m_scriptWorkers.shutdown();
+    m_scriptDispatcher.clear();
+    if (Py_IsInitialized()) {
+        for (auto& [name, module] : m_loadedModules) {
+            Py_DECREF(module);
+        }
+        m_scriptBundle.uninstall();
+    }
+    m_loadedModules.clear();
+    ComponentArray::unregisterType();
     std::cout << "PythonEngine shutdown" << std::endl;
 }
 
@@ -37,22 +57,51 @@ bool PythonEngine::executeFunction(const std::string& moduleName, const std::str
 
 bool PythonEngine::loadModule(const std::string& moduleName) {
     std::cout << "Loading module: " << moduleName << std::endl;
+    if (!Py_IsInitialized()) {
+        return false;
+    }
+    if (isModuleLoaded(moduleName)) {
+        return true;
+    }
+
+    // Goes through sys.meta_path, so an installed script bundle is used first
+    PyObject* module = PyImport_ImportModule(moduleName.c_str());
+    if (!module) {
+        handleScriptError();
+        return false;
+    }
+
+    m_loadedModules[moduleName] = module;
     return true;
 }
 
 bool PythonEngine::unloadModule(const std::string& moduleName) {
     std::cout << "Unloading module: " << moduleName << std::endl;
+    auto it = m_loadedModules.find(moduleName);
+    if (it == m_loadedModules.end()) {
+        return false;
+    }
+
+    PyObject* modules = PyImport_GetModuleDict();
+    if (PyDict_GetItemString(modules, moduleName.c_str())) {
+        PyDict_DelItemString(modules, moduleName.c_str());
+    }
+    Py_DECREF(it->second);
+    m_loadedModules.erase(it);
     return true;
 }
 
 bool PythonEngine::isModuleLoaded(const std::string& moduleName) const {
-    std::cout << "Checking if module is loaded: " << moduleName << std::endl;
-    return false;
+    return m_loadedModules.find(moduleName) != m_loadedModules.end();
 }
 
 std::vector<std::string> PythonEngine::getLoadedModules() const {
-    std::cout << "Getting loaded modules" << std::endl;
-    return std::vector<std::string>();
+    std::vector<std::string> modules;
+    modules.reserve(m_loadedModules.size());
+    for (const auto& [name, module] : m_loadedModules) {
+        modules.push_back(name);
+    }
+    return modules;
 }
 
 bool PythonEngine::createEntityScript(const std::string& scriptPath, Entity entity) {
@@ -67,12 +116,12 @@ bool PythonEngine::attachScriptToEntity(const std::string& scriptPath, Entity en
 
 bool PythonEngine::detachScriptFromEntity(Entity entity) {
     std::cout << "Detaching script from entity: " << entity << std::endl;
+    m_scriptDispatcher.removeScript(entity);
     return true;
 }
 
 bool PythonEngine::hasScript(Entity entity) const {
-    std::cout << "Checking if entity has script: " << entity << std::endl;
-    return false;
+    return m_scriptDispatcher.hasScript(entity);
 }
 
 std::string PythonEngine::getEntityScript(Entity entity) const {
@@ -80,6 +129,84 @@ std::string PythonEngine::getEntityScript(Entity entity) const {
     return "";
 }
 
+bool PythonEngine::attachScriptObject(Entity entity, PyObject* instance) {
+    if (!m_scriptDispatcher.addScript(entity, instance)) {
+        m_lastError = "Failed to attach script object to entity " + std::to_string(entity);
+        return false;
+    }
+    return true;
+}
+
+void PythonEngine::updateScripts(float deltaTime) {
+    // Nothing can have been registered before the interpreter exists
+    if (!Py_IsInitialized()) {
+        return;
+    }
+
+    // Sync point for last frame's worker scripts, then overlap this frame's
+    // with the main-thread scripts and the rest of the frame
+    if (m_scriptWorkers.isInitialized()) {
+        m_scriptWorkers.sync();
+        m_scriptWorkers.dispatch(deltaTime);
+    }
+
+    updateEntityScripts(deltaTime);
+
+    // Frame boundary: give chunks emptied by this frame's temporaries back
+    NativeTypes::trimArenas();
+}
+
+bool PythonEngine::enableScriptWorkers(JobSystem* jobSystem, uint32_t interpreterCount) {
+    if (!m_scriptWorkers.initialize(jobSystem, interpreterCount)) {
+        m_lastError = "Failed to start script worker interpreters";
+        return false;
+    }
+
+    m_scriptWorkers.setCommandHandler([this](const ScriptCommand& command) { applyScriptCommand(command); });
+    return true;
+}
+
+void PythonEngine::applyScriptCommand(const ScriptCommand& command) {
+    static const StringId SET_POSITION("set_position");
+    static const StringId SET_ROTATION("set_rotation");
+    static const StringId SET_SCALE("set_scale");
+    static const StringId TRANSLATE("translate");
+    static const StringId DESTROY("destroy");
+
+    // The entity may have been destroyed since the worker saw it
+    if (!m_ecsManager || !m_ecsManager->isEntityValid(command.entity)) {
+        return;
+    }
+
+    if (command.type == DESTROY) {
+        m_ecsManager->destroyEntity(command.entity);
+        return;
+    }
+
+    bool isTransformCommand = command.type == SET_POSITION || command.type == SET_ROTATION ||
+                              command.type == SET_SCALE || command.type == TRANSLATE;
+    if (!isTransformCommand || command.argCount < 3 ||
+        !m_ecsManager->hasComponent<SceneComponents::Transform>(command.entity)) {
+        return;
+    }
+
+    glm::vec3 value(command.args[0], command.args[1], command.args[2]);
+    auto& transform = m_ecsManager->getComponent<SceneComponents::Transform>(command.entity);
+    if (command.type == SET_POSITION) {
+        transform.position = value;
+    } else if (command.type == SET_ROTATION) {
+        transform.rotation = value;
+    } else if (command.type == SET_SCALE) {
+        transform.scale = value;
+    } else {
+        transform.position += value;
+    }
+}
+
+void PythonEngine::updateEntityScripts(float deltaTime) {
+    m_scriptDispatcher.update(deltaTime);
+}
+
 void PythonEngine::registerUpdateCallback(ScriptUpdateCallback callback) {
     std::cout << "Registering update callback" << std::endl;
 }
@@ -173,10 +300,134 @@ void PythonEngine::enableDebugMode(bool enable) {
 
 void PythonEngine::enableHotReload(bool enable) {
     std::cout << "Hot reload: " << (enable ? "enabled" : "disabled") << std::endl;
+    m_hotReload = enable;
+    m_scriptBundle.setCheckSources(enable);
+    if (enable) {
+        startScriptWatcher();
+    } else {
+        stopScriptWatcher();
+    }
 }
 
 void PythonEngine::checkForScriptUpdates() {
-    std::cout << "Checking for script updates" << std::endl;
+    if (!m_scriptWatcher) {
+        return;
+    }
+
+    // Non-blocking: only drains notifications the kernel already queued
+    auto& events = m_scriptWatcher->events;
+    events.clear();
+    if (m_scriptWatcher->watcher.poll(events) == 0 || !Py_IsInitialized()) {
+        return;
+    }
+
+    PyObject* modules = PyImport_GetModuleDict();
+    for (const auto& event : events) {
+        if (event.change == FileChange::Deleted) {
+            continue;
+        }
+
+        std::string moduleName = scriptPathToModuleName(event.path);
+        PyObject* module = moduleName.empty() ? nullptr : PyDict_GetItemString(modules, moduleName.c_str());
+        if (!module) {
+            continue;
+        }
+
+        std::cout << "Reloading script module: " << moduleName << std::endl;
+        PyObject* reloaded = PyImport_ReloadModule(module);
+        if (!reloaded) {
+            handleScriptError();
+            continue;
+        }
+
+        auto it = m_loadedModules.find(moduleName);
+        if (it != m_loadedModules.end() && it->second != reloaded) {
+            Py_INCREF(reloaded);
+            Py_DECREF(it->second);
+            it->second = reloaded;
+        }
+        Py_DECREF(reloaded);
+    }
+}
+
+void PythonEngine::handleScriptError() {
+    if (!PyErr_Occurred()) {
+        return;
+    }
+
+#if PY_VERSION_HEX >= 0x030C0000
+    PyObject* exception = PyErr_GetRaisedException();
+    PyObject* message = PyObject_Str(exception);
+#else
+    PyObject* type = nullptr;
+    PyObject* exception = nullptr;
+    PyObject* traceback = nullptr;
+    PyErr_Fetch(&type, &exception, &traceback);
+    PyErr_NormalizeException(&type, &exception, &traceback);
+    PyObject* message = exception ? PyObject_Str(exception) : nullptr;
+#endif
+
+    const char* text = message ? PyUnicode_AsUTF8(message) : nullptr;
+    m_lastError = text ? text : "unknown Python error";
+    Py_XDECREF(message);
+    PyErr_Clear();
+
+#if PY_VERSION_HEX >= 0x030C0000
+    PyErr_SetRaisedException(exception);
+#else
+    PyErr_Restore(type, exception, traceback);
+#endif
+    PyErr_Print();
+}
+
+bool PythonEngine::loadScriptBundle(const std::string& bundlePath) {
+    // The source root is always recorded so hot reload can be enabled later;
+    // while it is on, edited sources win over stale bytecode
+    if (!m_scriptBundle.install(bundlePath, m_scriptDirectory)) {
+        m_lastError = "Failed to load script bundle: " + bundlePath;
+        return false;
+    }
+    m_scriptBundle.setCheckSources(m_hotReload);
+    return true;
+}
+
+void PythonEngine::startScriptWatcher() {
+    if (m_scriptWatcher) {
+        return;
+    }
+
+    auto watcher = std::make_unique<ScriptWatcher>();
+    if (!watcher->watcher.initialize() || !watcher->watcher.watchDirectory(m_scriptDirectory, true)) {
+        std::cerr << "Failed to watch script directory: " << m_scriptDirectory << std::endl;
+        return;
+    }
+    m_scriptWatcher = std::move(watcher);
+}
+
+void PythonEngine::stopScriptWatcher() {
+    m_scriptWatcher.reset();
+}
+
+std::string PythonEngine::scriptPathToModuleName(const std::string& path) const {
+    std::filesystem::path scriptPath(path);
+    if (scriptPath.extension() != ".py") {
+        return std::string();
+    }
+
+    std::error_code ec;
+    std::filesystem::path relative = std::filesystem::relative(scriptPath, m_scriptDirectory, ec);
+    if (ec || relative.empty() || *relative.begin() == "..") {
+        return std::string();
+    }
+
+    relative.replace_extension();
+    if (relative.filename() == "__init__") {
+        relative = relative.parent_path();
+    }
+
+    std::string moduleName = relative.generic_string();
+    std::replace(moduleName.begin(), moduleName.end(), '/', '.');
+    return moduleName;
 }
 
 PyObject* PythonEngine::createPyObject(const std::string& type) {
@@ -197,6 +448,25 @@ void PythonEngine::releaseReference(PyObject* obj) {
     std::cout << "Releasing Python object reference" << std::endl;
 }
 
+// Engine value types are static, fixed-layout types; see NativeTypes
+PyObject* PythonEngine::createEntityClass() {
+    if (!NativeTypes::registerTypes()) {
+        return nullptr;
+    }
+    PyTypeObject* type = NativeTypes::getEntityType();
+    Py_INCREF(type);
+    return reinterpret_cast<PyObject*>(type);
+}
+
+PyObject* PythonEngine::createTransformClass() {
+    if (!NativeTypes::registerTypes()) {
+        return nullptr;
+    }
+    PyTypeObject* type = NativeTypes::getTransformType();
+    Py_INCREF(type);
+    return reinterpret_cast<PyObject*>(type);
+}
+
 void PythonEngine::printPythonInfo() const {
     std::cout << "Python info: Version 3.13.7" << std::endl;
 }
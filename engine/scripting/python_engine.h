@@ -9,6 +9,10 @@
 #include <vector>
 
 #include "../ecs/ecs_manager.h"
+#include "component_array.h"
+#include "script_bundle.h"
+#include "script_dispatcher.h"
+#include "script_worker_pool.h"
 
 namespace VortexEngine {
 
@@ -44,6 +48,33 @@ class PythonEngine {
     bool hasScript(Entity entity) const;
     std::string getEntityScript(Entity entity) const;
 
+    // Per-frame script dispatch (instances must define update(dt) or a
+    // classmethod update_batch(entity_ids, dt); see ScriptDispatcher)
+    bool attachScriptObject(Entity entity, PyObject* instance);
+    void updateScripts(float deltaTime);
+    void setBatchedScriptDispatch(bool enable) { m_scriptDispatcher.setBatchingEnabled(enable); }
+    bool isBatchedScriptDispatch() const { return m_scriptDispatcher.isBatchingEnabled(); }
+    ScriptDispatchStats getScriptDispatchStats() const { return m_scriptDispatcher.getStats(); }
+
+    // Script profiling and frame budget for main-thread scripts. Scripts
+    // over budget are deferred by class update_priority; see ScriptDispatcher
+    ScriptProfile getScriptProfile() const { return m_scriptDispatcher.getProfile(); }
+    void resetScriptProfile() { m_scriptDispatcher.resetProfile(); }
+    void setScriptProfiling(bool enable) { m_scriptDispatcher.setProfilingEnabled(enable); }
+    void setScriptFrameBudget(double milliseconds) { m_scriptDispatcher.setFrameBudget(milliseconds); }
+    double getScriptFrameBudget() const { return m_scriptDispatcher.getFrameBudget(); }
+
+    // Worker interpreters (Python 3.12+). When enabled, updateScripts() first
+    // applies the commands worker scripts emitted last frame, then starts this
+    // frame's worker updates and returns without waiting for them. Commands
+    // go to the ECS manager by default: set_position, set_rotation and
+    // set_scale (x, y, z) and translate (dx, dy, dz) write the entity's
+    // Transform, destroy removes the entity. Replace the handler through
+    // getScriptWorkers().setCommandHandler() for anything else.
+    bool enableScriptWorkers(JobSystem* jobSystem, uint32_t interpreterCount);
+    void disableScriptWorkers() { m_scriptWorkers.shutdown(); }
+    ScriptWorkerPool& getScriptWorkers() { return m_scriptWorkers; }
+
     // Script callbacks
     using ScriptUpdateCallback = std::function<void(Entity, float)>;
     using ScriptStartCallback = std::function<void(Entity)>;
@@ -83,24 +114,43 @@ class PythonEngine {
     void setScriptDirectory(const std::string& directory) { m_scriptDirectory = directory; }
     const std::string& getScriptDirectory() const { return m_scriptDirectory; }
 
-    // Script hot-reload
+    // Script hot-reload (inotify on Linux; modules whose .py changed are
+    // re-imported, taking precedence over a loaded script bundle)
     void enableHotReload(bool enable);
     bool isHotReloadEnabled() const { return m_hotReload; }
     void checkForScriptUpdates();
 
+    // Precompiled script bundles; see ScriptBundle
+    bool loadScriptBundle(const std::string& bundlePath);
+    void unloadScriptBundle() { m_scriptBundle.uninstall(); }
+    const ScriptBundle& getScriptBundle() const { return m_scriptBundle; }
+
     // Python object management
     PyObject* createPyObject(const std::string& type);
     void destroyPyObject(PyObject* obj);
     PyObject* borrowReference(PyObject* obj);
     void releaseReference(PyObject* obj);
 
-    // Type conversion helpers
+    // Type conversion helpers (glm and component specializations are in
+    // scene_native_types.h)
     template <typename T>
     T* pythonToCpp(PyObject* obj) const;
 
     template <typename T>
     PyObject* cppToPython(const T& value) const;
 
+    // Zero-copy views of dense ECS component storage (new reference, null
+    // with a Python error set on failure); see ComponentArray
+    template <typename T>
+    PyObject* createComponentArray(ComponentArray::Column column = ComponentArray::Column::Components,
+                                   bool readOnly = false) {
+        if (!m_ecsManager) {
+            PyErr_SetString(PyExc_RuntimeError, "no ECS manager attached");
+            return nullptr;
+        }
+        return ComponentArray::create<T>(*m_ecsManager, column, readOnly);
+    }
+
     // Script environment
     void setECSManager(ECSManager* ecsManager) { m_ecsManager = ecsManager; }
     void setSceneManager(SceneManager* sceneManager) { m_sceneManager = sceneManager; }
@@ -122,6 +172,9 @@ class PythonEngine {
     std::unordered_map<std::string, PyObject*> m_loadedModules;
     std::unordered_map<Entity, std::string> m_entityScripts;
     std::unordered_map<Entity, PyObject*> m_entityScriptObjects;
+    ScriptDispatcher m_scriptDispatcher;
+    ScriptWorkerPool m_scriptWorkers;
+    ScriptBundle m_scriptBundle;
 
     // Configuration
     bool m_initialized = false;
@@ -150,6 +203,7 @@ class PythonEngine {
     void cleanupModules();
     void cleanupEntityScripts();
     void updateEntityScripts(float deltaTime);
+    void applyScriptCommand(const ScriptCommand& command);
     void notifyScriptStart(Entity entity);
     void notifyScriptStop(Entity entity);
     void handleScriptError();
@@ -168,7 +222,7 @@ class PythonEngine {
 
     void startScriptWatcher();
     void stopScriptWatcher();
-    void updateScriptWatchTimes();
+    std::string scriptPathToModuleName(const std::string& path) const;
 };
 
 // Python type definitions
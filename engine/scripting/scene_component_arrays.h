@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstddef>
+
+#include <glm/glm.hpp>
+
+#include "../scene/scene_manager.h"
+#include "component_array.h"
+
+namespace VortexEngine {
+
+// Buffer layouts of the scene components scripts can view in bulk
+//
+// Given a Transform ComponentArray, with NumPy:
+//     transforms = numpy.asarray(transform_array)     # structured dtype
+//     transforms["position"] += velocities * dt
+// or without it, through a flat float view:
+//     floats = memoryview(scalar_array)               # shape (count, 9)
+
+template<>
+struct ComponentBufferTraits<SceneComponents::Transform> {
+    static_assert(sizeof(glm::vec3) == 3 * sizeof(float), "glm::vec3 must be tightly packed");
+    static_assert(offsetof(SceneComponents::Transform, position) == 0 &&
+                  offsetof(SceneComponents::Transform, rotation) == sizeof(glm::vec3) &&
+                  offsetof(SceneComponents::Transform, scale) == 2 * sizeof(glm::vec3) &&
+                  sizeof(SceneComponents::Transform) == 3 * sizeof(glm::vec3),
+                  "Transform layout changed; update its buffer format");
+
+    static constexpr ComponentBufferLayout layout = {
+        "Transform",
+        "T{(3)f:position:(3)f:rotation:(3)f:scale:}",
+        "f",
+        sizeof(float),
+        9
+    };
+};
+
+} // namespace VortexEngine
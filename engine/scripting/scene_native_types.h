@@ -0,0 +1,54 @@
+#pragma once
+
+#include <glm/glm.hpp>
+
+#include "../scene/scene_manager.h"
+#include "native_types.h"
+#include "python_engine.h"
+
+namespace VortexEngine {
+
+// PythonEngine conversions for the engine value types
+//
+// The native Python objects store exactly the glm / component layout, so
+// pythonToCpp returns a pointer into the object itself (null if it is not
+// of that type) and cppToPython is a single arena allocation plus a copy.
+// Entity ids are plain uint32_t and have no specialization; use
+// NativeTypes::newEntity / getEntityId.
+
+static_assert(sizeof(glm::vec3) == 3 * sizeof(float), "glm::vec3 must be tightly packed");
+static_assert(sizeof(glm::mat4) == 16 * sizeof(float), "glm::mat4 must be tightly packed");
+static_assert(sizeof(SceneComponents::Transform) == 3 * sizeof(glm::vec3),
+              "Transform layout changed; update the native Transform type");
+
+template<>
+inline glm::vec3* PythonEngine::pythonToCpp<glm::vec3>(PyObject* obj) const {
+    return reinterpret_cast<glm::vec3*>(NativeTypes::getVec3Data(obj));
+}
+
+template<>
+inline PyObject* PythonEngine::cppToPython<glm::vec3>(const glm::vec3& value) const {
+    return NativeTypes::newVec3(&value.x);
+}
+
+template<>
+inline glm::mat4* PythonEngine::pythonToCpp<glm::mat4>(PyObject* obj) const {
+    return reinterpret_cast<glm::mat4*>(NativeTypes::getMat4Data(obj));
+}
+
+template<>
+inline PyObject* PythonEngine::cppToPython<glm::mat4>(const glm::mat4& value) const {
+    return NativeTypes::newMat4(&value[0][0]);
+}
+
+template<>
+inline SceneComponents::Transform* PythonEngine::pythonToCpp<SceneComponents::Transform>(PyObject* obj) const {
+    return reinterpret_cast<SceneComponents::Transform*>(NativeTypes::getTransformData(obj));
+}
+
+template<>
+inline PyObject* PythonEngine::cppToPython<SceneComponents::Transform>(const SceneComponents::Transform& value) const {
+    return NativeTypes::newTransform(&value.position.x, &value.rotation.x, &value.scale.x);
+}
+
+} // namespace VortexEngine
@@ -0,0 +1,453 @@
+#include "script_bundle.h"
+#include <marshal.h>
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <vector>
+
+#include "../utils/mapped_file.h"
+
+namespace VortexEngine {
+
+namespace fs = std::filesystem;
+
+namespace {
+
+// PEP 552 header: magic, flags, then the source hash for hash-based pycs
+constexpr size_t PYC_HEADER_SIZE = 16;
+constexpr uint32_t PYC_FLAG_HASH_BASED = 0x1;
+constexpr uint32_t PYC_FLAG_CHECK_SOURCE = 0x2;
+
+// Python half of the import hook; the bundle argument is the native module
+// created in install()
+const char* FINDER_SOURCE = R"(
+from importlib.machinery import ModuleSpec
+
+class VortexBundleFinder:
+    def __init__(self, bundle):
+        self._bundle = bundle
+
+    def find_spec(self, fullname, path=None, target=None):
+        is_package = self._bundle.find(fullname)
+        if is_package is None:
+            return None
+        spec = ModuleSpec(fullname, self, origin=self._bundle.origin(fullname), is_package=is_package)
+        spec.has_location = True
+        return spec
+
+    def create_module(self, spec):
+        return None
+
+    def exec_module(self, module):
+        exec(self._bundle.get_code(module.__spec__.name), module.__dict__)
+
+    def invalidate_caches(self):
+        pass
+)";
+
+uint32_t readLittleEndian32(const std::byte* data) {
+    return static_cast<uint32_t>(data[0]) | (static_cast<uint32_t>(data[1]) << 8) |
+           (static_cast<uint32_t>(data[2]) << 16) | (static_cast<uint32_t>(data[3]) << 24);
+}
+
+void writeLittleEndian32(std::vector<std::byte>& out, uint32_t value) {
+    for (int i = 0; i < 4; ++i) {
+        out.push_back(static_cast<std::byte>((value >> (8 * i)) & 0xFF));
+    }
+}
+
+std::string moduleToPath(std::string_view moduleName) {
+    std::string path(moduleName);
+    std::replace(path.begin(), path.end(), '.', '/');
+    return path;
+}
+
+bool readSource(const std::string& path, std::string& source) {
+    MappedFile file;
+    if (!file.open(path, MappedFile::AccessHint::Sequential)) {
+        return false;
+    }
+    source.assign(reinterpret_cast<const char*>(file.data()), file.getSize());
+    return true;
+}
+
+PyObject* getSourceHashFunction() {
+    PyObject* util = PyImport_ImportModule("importlib.util");
+    if (!util) {
+        return nullptr;
+    }
+    PyObject* sourceHash = PyObject_GetAttrString(util, "source_hash");
+    Py_DECREF(util);
+    return sourceHash;
+}
+
+PyObject* hashSource(PyObject* sourceHash, const std::string& source) {
+    PyObject* bytes = PyBytes_FromStringAndSize(source.data(), static_cast<Py_ssize_t>(source.size()));
+    if (!bytes) {
+        return nullptr;
+    }
+    PyObject* hash = PyObject_CallOneArg(sourceHash, bytes);
+    Py_DECREF(bytes);
+    return hash;
+}
+
+} // namespace
+
+// Native module backing VortexBundleFinder
+struct ScriptBundleAccess {
+    struct ModuleState {
+        ScriptBundle* bundle;
+    };
+
+    static ScriptBundle* getBundle(PyObject* module) {
+        auto* state = static_cast<ModuleState*>(PyModule_GetState(module));
+        if (!state->bundle) {
+            PyErr_SetString(PyExc_ImportError, "script bundle has been uninstalled");
+        }
+        return state->bundle;
+    }
+
+    static PyObject* find(PyObject* module, PyObject* name) {
+        ScriptBundle* bundle = getBundle(module);
+        const char* moduleName = bundle ? PyUnicode_AsUTF8(name) : nullptr;
+        if (!moduleName) {
+            return nullptr;
+        }
+
+        bool isPackage = false;
+        if (!bundle->findModule(moduleName, isPackage)) {
+            Py_RETURN_NONE;
+        }
+        return PyBool_FromLong(isPackage);
+    }
+
+    static PyObject* origin(PyObject* module, PyObject* name) {
+        ScriptBundle* bundle = getBundle(module);
+        const char* moduleName = bundle ? PyUnicode_AsUTF8(name) : nullptr;
+        if (!moduleName) {
+            return nullptr;
+        }
+
+        std::string sourcePath = bundle->getSourcePath(moduleName);
+        if (!sourcePath.empty()) {
+            return PyUnicode_FromString(sourcePath.c_str());
+        }
+
+        bool isPackage = false;
+        const VPak::TocEntry* entry = bundle->findModule(moduleName, isPackage);
+        std::string entryOrigin = bundle->getPath() + "/" + std::string(entry ? bundle->m_archive.getEntryPath(*entry) : "");
+        return PyUnicode_FromString(entryOrigin.c_str());
+    }
+
+    static PyObject* getCode(PyObject* module, PyObject* name) {
+        ScriptBundle* bundle = getBundle(module);
+        const char* moduleName = bundle ? PyUnicode_AsUTF8(name) : nullptr;
+        if (!moduleName) {
+            return nullptr;
+        }
+        return bundle->loadCode(moduleName);
+    }
+};
+
+namespace {
+
+PyMethodDef s_bundleMethods[] = {
+    {"find", ScriptBundleAccess::find, METH_O, "None if absent, else whether the module is a package"},
+    {"origin", ScriptBundleAccess::origin, METH_O, "Source path, or bundle path of the entry"},
+    {"get_code", ScriptBundleAccess::getCode, METH_O, "Code object for a module in the bundle"},
+    {nullptr, nullptr, 0, nullptr}
+};
+
+PyModuleDef s_bundleModule = {
+    PyModuleDef_HEAD_INIT,
+    "_vortex_bundle",
+    "Native part of the script bundle importer",
+    sizeof(ScriptBundleAccess::ModuleState),
+    s_bundleMethods,
+    nullptr, nullptr, nullptr, nullptr
+};
+
+} // namespace
+
+ScriptBundle::~ScriptBundle() {
+    if (Py_IsInitialized()) {
+        uninstall();
+    }
+}
+
+bool ScriptBundle::build(const std::string& sourceDirectory, const std::string& bundlePath, bool compress) {
+    std::error_code ec;
+    if (!fs::is_directory(sourceDirectory, ec)) {
+        std::cerr << "Script directory not found: " << sourceDirectory << std::endl;
+        return false;
+    }
+
+    PyObject* sourceHash = getSourceHashFunction();
+    if (!sourceHash) {
+        PyErr_Print();
+        return false;
+    }
+
+    std::vector<fs::path> sources;
+    for (auto it = fs::recursive_directory_iterator(sourceDirectory, ec); it != fs::recursive_directory_iterator(); ++it) {
+        if (it->is_directory() && it->path().filename() == "__pycache__") {
+            it.disable_recursion_pending();
+        } else if (it->is_regular_file() && it->path().extension() == ".py") {
+            sources.push_back(it->path());
+        }
+    }
+    std::sort(sources.begin(), sources.end());
+
+    uint32_t magic = static_cast<uint32_t>(PyImport_GetMagicNumber());
+    ArchiveWriter writer;
+    bool success = true;
+
+    for (const auto& sourcePath : sources) {
+        std::string relativePath = fs::relative(sourcePath, sourceDirectory).generic_string();
+        std::string source;
+        if (!readSource(sourcePath.string(), source)) {
+            std::cerr << "Failed to read script: " << sourcePath << std::endl;
+            success = false;
+            break;
+        }
+
+        PyObject* code = Py_CompileStringExFlags(source.c_str(), relativePath.c_str(), Py_file_input, nullptr, -1);
+        PyObject* bytecode = code ? PyMarshal_WriteObjectToString(code, Py_MARSHAL_VERSION) : nullptr;
+        PyObject* hash = bytecode ? hashSource(sourceHash, source) : nullptr;
+        Py_XDECREF(code);
+
+        if (!hash || PyBytes_GET_SIZE(hash) != 8) {
+            std::cerr << "Failed to compile script: " << relativePath << std::endl;
+            if (PyErr_Occurred()) {
+                PyErr_Print();
+            }
+            Py_XDECREF(bytecode);
+            Py_XDECREF(hash);
+            success = false;
+            break;
+        }
+
+        std::vector<std::byte> pyc;
+        pyc.reserve(PYC_HEADER_SIZE + static_cast<size_t>(PyBytes_GET_SIZE(bytecode)));
+        writeLittleEndian32(pyc, magic);
+        writeLittleEndian32(pyc, PYC_FLAG_HASH_BASED | PYC_FLAG_CHECK_SOURCE);
+        const auto* hashBytes = reinterpret_cast<const std::byte*>(PyBytes_AS_STRING(hash));
+        pyc.insert(pyc.end(), hashBytes, hashBytes + 8);
+        const auto* codeBytes = reinterpret_cast<const std::byte*>(PyBytes_AS_STRING(bytecode));
+        pyc.insert(pyc.end(), codeBytes, codeBytes + PyBytes_GET_SIZE(bytecode));
+        Py_DECREF(bytecode);
+        Py_DECREF(hash);
+
+        std::string entryPath = relativePath.substr(0, relativePath.size() - 3) + ".pyc";
+        if (!writer.addData(entryPath, pyc, compress)) {
+            success = false;
+            break;
+        }
+    }
+
+    Py_DECREF(sourceHash);
+
+    if (!success || !writer.write(bundlePath)) {
+        return false;
+    }
+
+    std::cout << "Compiled " << writer.getEntryCount() << " scripts into " << bundlePath << std::endl;
+    return true;
+}
+
+bool ScriptBundle::install(const std::string& bundlePath, const std::string& sourceDirectory) {
+    uninstall();
+
+    if (!m_archive.open(bundlePath)) {
+        return false;
+    }
+    m_sourceDirectory = sourceDirectory;
+
+    m_sourceHash = getSourceHashFunction();
+    m_module = m_sourceHash ? PyModule_Create(&s_bundleModule) : nullptr;
+    if (!m_module) {
+        PyErr_Print();
+        uninstall();
+        return false;
+    }
+    static_cast<ScriptBundleAccess::ModuleState*>(PyModule_GetState(m_module))->bundle = this;
+
+    PyObject* globals = PyDict_New();
+    PyDict_SetItemString(globals, "__builtins__", PyEval_GetBuiltins());
+    PyObject* result = PyRun_String(FINDER_SOURCE, Py_file_input, globals, globals);
+    PyObject* finderType = result ? PyDict_GetItemString(globals, "VortexBundleFinder") : nullptr;
+    m_finder = finderType ? PyObject_CallOneArg(finderType, m_module) : nullptr;
+    Py_XDECREF(result);
+    Py_DECREF(globals);
+
+    PyObject* metaPath = PySys_GetObject("meta_path");
+    if (!m_finder || !metaPath || PyList_Insert(metaPath, 0, m_finder) < 0) {
+        std::cerr << "Failed to install script bundle importer" << std::endl;
+        if (PyErr_Occurred()) {
+            PyErr_Print();
+        }
+        uninstall();
+        return false;
+    }
+
+    std::cout << "Installed script bundle " << bundlePath << " (" << getStats().moduleCount << " modules)" << std::endl;
+    return true;
+}
+
+void ScriptBundle::uninstall() {
+    if (m_finder) {
+        PyObject* metaPath = PySys_GetObject("meta_path");
+        if (metaPath) {
+            PyObject* result = PyObject_CallMethod(metaPath, "remove", "O", m_finder);
+            if (result) {
+                Py_DECREF(result);
+            } else {
+                PyErr_Clear();
+            }
+        }
+        Py_CLEAR(m_finder);
+    }
+
+    // Modules imported from the bundle keep the finder as their loader
+    if (m_module) {
+        static_cast<ScriptBundleAccess::ModuleState*>(PyModule_GetState(m_module))->bundle = nullptr;
+        Py_CLEAR(m_module);
+    }
+
+    Py_CLEAR(m_sourceHash);
+    m_archive.close();
+    m_sourceDirectory.clear();
+}
+
+bool ScriptBundle::containsModule(std::string_view moduleName) const {
+    bool isPackage = false;
+    return findModule(moduleName, isPackage) != nullptr;
+}
+
+std::string ScriptBundle::getSourcePath(std::string_view moduleName) const {
+    if (!isCheckingSources()) {
+        return std::string();
+    }
+
+    bool isPackage = false;
+    if (!findModule(moduleName, isPackage)) {
+        return std::string();
+    }
+
+    std::string path = moduleToPath(moduleName);
+    fs::path sourcePath = fs::path(m_sourceDirectory) / (isPackage ? path + "/__init__.py" : path + ".py");
+    std::error_code ec;
+    return fs::is_regular_file(sourcePath, ec) ? sourcePath.string() : std::string();
+}
+
+ScriptBundleStats ScriptBundle::getStats() const {
+    ScriptBundleStats stats;
+    for (const auto& entry : m_archive.getEntries()) {
+        std::string_view path = m_archive.getEntryPath(entry);
+        if (path.size() > 4 && path.substr(path.size() - 4) == ".pyc") {
+            stats.moduleCount++;
+        }
+    }
+    stats.modulesLoaded = m_modulesLoaded;
+    stats.modulesRecompiled = m_modulesRecompiled;
+    return stats;
+}
+
+const VPak::TocEntry* ScriptBundle::findModule(std::string_view moduleName, bool& isPackage) const {
+    if (!m_archive.isOpen()) {
+        return nullptr;
+    }
+
+    std::string path = moduleToPath(moduleName);
+    if (const VPak::TocEntry* entry = m_archive.findEntry(path + "/__init__.pyc")) {
+        isPackage = true;
+        return entry;
+    }
+
+    isPackage = false;
+    return m_archive.findEntry(path + ".pyc");
+}
+
+PyObject* ScriptBundle::loadCode(std::string_view moduleName) {
+    bool isPackage = false;
+    const VPak::TocEntry* entry = findModule(moduleName, isPackage);
+    if (!entry) {
+        PyErr_Format(PyExc_ImportError, "%s is not in the script bundle", std::string(moduleName).c_str());
+        return nullptr;
+    }
+
+    // Uncompressed entries are unmarshalled straight from the mapping
+    std::vector<uint8_t> buffer;
+    std::span<const std::byte> data = m_archive.getView(*entry);
+    if (entry->compression != VPak::Compression::None) {
+        if (!m_archive.readEntry(*entry, buffer)) {
+            PyErr_Format(PyExc_ImportError, "failed to decompress %s", std::string(moduleName).c_str());
+            return nullptr;
+        }
+        data = std::as_bytes(std::span<const uint8_t>(buffer));
+    }
+
+    std::string sourcePath = getSourcePath(moduleName);
+    if (data.size() < PYC_HEADER_SIZE) {
+        PyErr_Format(PyExc_ImportError, "truncated bytecode for %s", std::string(moduleName).c_str());
+        return nullptr;
+    }
+
+    uint32_t magic = readLittleEndian32(data.data());
+    uint32_t flags = readLittleEndian32(data.data() + 4);
+
+    if (magic != static_cast<uint32_t>(PyImport_GetMagicNumber())) {
+        if (!sourcePath.empty()) {
+            return compileSource(sourcePath);
+        }
+        PyErr_Format(PyExc_ImportError, "%s was compiled for a different Python version", std::string(moduleName).c_str());
+        return nullptr;
+    }
+
+    bool checkSource = (flags & PYC_FLAG_HASH_BASED) && (flags & PYC_FLAG_CHECK_SOURCE);
+    if (checkSource && !sourcePath.empty() && !sourceMatches(sourcePath, data.first(PYC_HEADER_SIZE))) {
+        return compileSource(sourcePath);
+    }
+
+    PyObject* code = PyMarshal_ReadObjectFromString(reinterpret_cast<const char*>(data.data() + PYC_HEADER_SIZE),
+                                                    static_cast<Py_ssize_t>(data.size() - PYC_HEADER_SIZE));
+    if (code) {
+        m_modulesLoaded++;
+    }
+    return code;
+}
+
+PyObject* ScriptBundle::compileSource(const std::string& sourcePath) {
+    std::string source;
+    if (!readSource(sourcePath, source)) {
+        PyErr_Format(PyExc_ImportError, "failed to read %s", sourcePath.c_str());
+        return nullptr;
+    }
+
+    PyObject* code = Py_CompileStringExFlags(source.c_str(), sourcePath.c_str(), Py_file_input, nullptr, -1);
+    if (code) {
+        m_modulesRecompiled++;
+    }
+    return code;
+}
+
+bool ScriptBundle::sourceMatches(const std::string& sourcePath, std::span<const std::byte> header) {
+    std::string source;
+    if (!readSource(sourcePath, source)) {
+        return true;
+    }
+
+    PyObject* hash = hashSource(m_sourceHash, source);
+    if (!hash) {
+        PyErr_Clear();
+        return true;
+    }
+
+    bool matches = PyBytes_GET_SIZE(hash) == 8 && std::memcmp(PyBytes_AS_STRING(hash), header.data() + 8, 8) == 0;
+    Py_DECREF(hash);
+    return matches;
+}
+
+} // namespace VortexEngine
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <Python.h>
+
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+
+#include "../utils/asset_archive.h"
+
+namespace VortexEngine {
+
+// Script bundle statistics
+struct ScriptBundleStats {
+    uint32_t moduleCount = 0;
+    uint64_t modulesLoaded = 0;     // Imported from precompiled bytecode
+    uint64_t modulesRecompiled = 0; // Source hash no longer matched, compiled from source
+};
+
+// Precompiled Python scripts in a single .vpak archive
+//
+// build() compiles every .py file below a directory into checked hash-based
+// .pyc entries (PEP 552): "ai/patrol.py" is stored as "ai/patrol.pyc" and
+// imported as ai.patrol, "ai/__init__.py" makes ai a package. Bytecode is
+// version specific, so bundles must be built by the same Python version that
+// loads them; vortex_bundle_scripts does this offline.
+//
+// install() mounts the archive and puts a finder at the front of
+// sys.meta_path. Bytecode is unmarshalled straight from the archive mapping.
+// If a source directory is given, the hash stored in each entry is checked
+// against the matching .py file and modules whose source changed are
+// compiled from source instead, so a stale bundle never hides an edit during
+// development. Without one, no source file is touched. setCheckSources()
+// turns the check off and on again while keeping the directory.
+//
+// Every method must be called with the GIL held.
+class ScriptBundle {
+public:
+    ScriptBundle() = default;
+    ~ScriptBundle();
+
+    ScriptBundle(const ScriptBundle&) = delete;
+    ScriptBundle& operator=(const ScriptBundle&) = delete;
+
+    // Offline compilation
+    static bool build(const std::string& sourceDirectory, const std::string& bundlePath, bool compress = false);
+
+    // Import hook
+    bool install(const std::string& bundlePath, const std::string& sourceDirectory = "");
+    void uninstall();
+    bool isInstalled() const { return m_finder != nullptr; }
+    void setCheckSources(bool check) { m_checkSources = check; }
+    bool isCheckingSources() const { return m_checkSources && !m_sourceDirectory.empty(); }
+    const std::string& getPath() const { return m_archive.getPath(); }
+
+    // Module lookup (module names use dots, e.g. "ai.patrol")
+    bool containsModule(std::string_view moduleName) const;
+    std::string getSourcePath(std::string_view moduleName) const;
+
+    // Information
+    ScriptBundleStats getStats() const;
+
+private:
+    AssetArchive m_archive;
+    std::string m_sourceDirectory;
+    bool m_checkSources = true;
+    PyObject* m_module = nullptr;     // Native half of the finder, points back here
+    PyObject* m_finder = nullptr;     // Entry in sys.meta_path
+    PyObject* m_sourceHash = nullptr; // importlib.util.source_hash
+
+    uint64_t m_modulesLoaded = 0;
+    uint64_t m_modulesRecompiled = 0;
+
+    friend struct ScriptBundleAccess;
+
+    // Internal methods
+    const VPak::TocEntry* findModule(std::string_view moduleName, bool& isPackage) const;
+    PyObject* loadCode(std::string_view moduleName);
+    PyObject* compileSource(const std::string& sourcePath);
+    bool sourceMatches(const std::string& sourcePath, std::span<const std::byte> header);
+};
+
+} // namespace VortexEngine
@@ -0,0 +1,450 @@
+#include "script_dispatcher.h"
+#include <algorithm>
+#include <iostream>
+#include <string>
+
+namespace VortexEngine {
+
+ScriptDispatcher::~ScriptDispatcher() {
+    if (Py_IsInitialized()) {
+        clear();
+    }
+}
+
+bool ScriptDispatcher::addScript(uint32_t entity, PyObject* instance) {
+    if (!instance) {
+        return false;
+    }
+
+    removeScript(entity);
+
+    PyObject* update = PyObject_GetAttrString(instance, "update");
+    if (!update) {
+        PyErr_Clear();
+    } else if (!PyCallable_Check(update)) {
+        Py_CLEAR(update);
+    }
+
+    PyObject* type = reinterpret_cast<PyObject*>(Py_TYPE(instance));
+    size_t classIndex = getClassIndex(type);
+    ScriptClass& scriptClass = m_classes[classIndex];
+
+    if (!update && !scriptClass.batchUpdate) {
+        std::cerr << "Script class " << Py_TYPE(instance)->tp_name << " has neither update() nor update_batch()" << std::endl;
+        return false;
+    }
+
+    Py_INCREF(instance);
+    Py_CLEAR(scriptClass.batchIds);
+    scriptClass.entities.push_back(entity);
+    scriptClass.instances.push_back(instance);
+    scriptClass.updates.push_back(update);
+    scriptClass.deferred.emplace_back();
+    scriptClass.timings.emplace_back();
+
+    m_scripts[entity] = ScriptSlot{classIndex, scriptClass.entities.size() - 1};
+    return true;
+}
+
+bool ScriptDispatcher::removeScript(uint32_t entity) {
+    auto it = m_scripts.find(entity);
+    if (it == m_scripts.end()) {
+        return false;
+    }
+
+    ScriptClass& scriptClass = m_classes[it->second.classIndex];
+    size_t index = it->second.index;
+    size_t last = scriptClass.entities.size() - 1;
+
+    Py_DECREF(scriptClass.instances[index]);
+    Py_XDECREF(scriptClass.updates[index]);
+    Py_CLEAR(scriptClass.batchIds);
+
+    // Swap-remove keeps each class's arrays dense for the batch view
+    if (index != last) {
+        scriptClass.entities[index] = scriptClass.entities[last];
+        scriptClass.instances[index] = scriptClass.instances[last];
+        scriptClass.updates[index] = scriptClass.updates[last];
+        scriptClass.deferred[index] = scriptClass.deferred[last];
+        scriptClass.timings[index] = scriptClass.timings[last];
+        m_scripts[scriptClass.entities[index]].index = index;
+    }
+    scriptClass.entities.pop_back();
+    scriptClass.instances.pop_back();
+    scriptClass.updates.pop_back();
+    scriptClass.deferred.pop_back();
+    scriptClass.timings.pop_back();
+
+    m_scripts.erase(it);
+    return true;
+}
+
+void ScriptDispatcher::clear() {
+    for (auto& scriptClass : m_classes) {
+        for (PyObject* instance : scriptClass.instances) {
+            Py_DECREF(instance);
+        }
+        for (PyObject* update : scriptClass.updates) {
+            Py_XDECREF(update);
+        }
+        Py_XDECREF(scriptClass.batchUpdate);
+        Py_XDECREF(scriptClass.batchIds);
+        Py_DECREF(scriptClass.type);
+    }
+
+    m_classes.clear();
+    m_classIndices.clear();
+    m_scripts.clear();
+    m_classOrder.clear();
+}
+
+PyObject* ScriptDispatcher::getScript(uint32_t entity) const {
+    auto it = m_scripts.find(entity);
+    if (it == m_scripts.end()) {
+        return nullptr;
+    }
+    return m_classes[it->second.classIndex].instances[it->second.index];
+}
+
+void ScriptDispatcher::resetProfile() {
+    for (auto& scriptClass : m_classes) {
+        for (auto& timing : scriptClass.timings) {
+            timing.reset();
+        }
+        scriptClass.calls.reset();
+        scriptClass.frames.reset();
+    }
+    m_frameTimes.reset();
+}
+
+void ScriptDispatcher::setFrameBudget(double milliseconds) {
+    auto budget = std::chrono::duration<double, std::milli>(std::max(milliseconds, 0.0));
+    m_frameBudget = std::chrono::duration_cast<Clock::duration>(budget);
+}
+
+double ScriptDispatcher::getFrameBudget() const {
+    return std::chrono::duration<double, std::milli>(m_frameBudget).count();
+}
+
+uint32_t ScriptDispatcher::update(float deltaTime) {
+    if (m_classes.empty()) {
+        return 0;
+    }
+
+    uint32_t calls = 0;
+    uint32_t deferred = 0;
+
+    PyObject* dt = PyFloat_FromDouble(deltaTime);
+    if (!dt) {
+        PyErr_Clear();
+        return 0;
+    }
+
+    // One clock read per call: the end of one call is the start of the next
+    bool budgeted = m_frameBudget.count() > 0;
+    bool timed = m_profilingEnabled || budgeted;
+    Clock::time_point frameStart = timed ? Clock::now() : Clock::time_point();
+    Clock::time_point last = frameStart;
+    bool overBudget = false;
+
+    auto endCall = [&](ScriptTimingWindow& timing) {
+        Clock::time_point now = Clock::now();
+        if (m_profilingEnabled) {
+            timing.record(now - last);
+        }
+        last = now;
+        overBudget = overBudget || (budgeted && now - frameStart >= m_frameBudget);
+    };
+
+    for (size_t classIndex : m_classOrder) {
+        ScriptClass& scriptClass = m_classes[classIndex];
+        if (scriptClass.entities.empty()) {
+            continue;
+        }
+
+        Clock::time_point classStart = last;
+        uint32_t classCalls = 0;
+
+        if (m_batchingEnabled && scriptClass.batchUpdate) {
+            if (shouldDefer(scriptClass.batchDeferred, deltaTime, overBudget, m_maxDeferredFrames)) {
+                deferred += static_cast<uint32_t>(scriptClass.entities.size());
+                continue;
+            }
+
+            PyObject* ids = getIdView(scriptClass);
+            if (!ids) {
+                reportError(scriptClass);
+                continue;
+            }
+
+            PyObject* batchDt = takeDeltaTime(scriptClass.batchDeferred, deltaTime, dt);
+            PyObject* args[] = {ids, batchDt};
+            PyObject* result = PyObject_Vectorcall(scriptClass.batchUpdate, args, 2, nullptr);
+            Py_DECREF(batchDt);
+            calls++;
+            classCalls++;
+            if (result) {
+                Py_DECREF(result);
+            } else {
+                reportError(scriptClass);
+            }
+            Py_DECREF(ids);
+
+            if (timed) {
+                endCall(scriptClass.calls);
+            }
+        } else {
+            for (size_t i = 0; i < scriptClass.entities.size(); ++i) {
+                PyObject* update = scriptClass.updates[i];
+                if (!update) {
+                    continue;
+                }
+                if (shouldDefer(scriptClass.deferred[i], deltaTime, overBudget, m_maxDeferredFrames)) {
+                    deferred++;
+                    continue;
+                }
+
+                PyObject* scriptDt = takeDeltaTime(scriptClass.deferred[i], deltaTime, dt);
+                PyObject* result = PyObject_CallOneArg(update, scriptDt);
+                Py_DECREF(scriptDt);
+                calls++;
+                classCalls++;
+                if (result) {
+                    Py_DECREF(result);
+                } else {
+                    reportError(scriptClass, scriptClass.entities[i]);
+                }
+
+                if (timed) {
+                    endCall(scriptClass.timings[i]);
+                }
+            }
+        }
+
+        if (m_profilingEnabled && classCalls > 0) {
+            scriptClass.frames.record(last - classStart);
+        }
+    }
+
+    Py_DECREF(dt);
+
+    if (m_profilingEnabled) {
+        m_frameTimes.record(Clock::now() - frameStart);
+    }
+
+    m_callsLastUpdate = calls;
+    m_totalCalls += calls;
+    m_deferredLastUpdate = deferred;
+    m_totalDeferred += deferred;
+    return calls;
+}
+
+ScriptDispatchStats ScriptDispatcher::getStats() const {
+    ScriptDispatchStats stats;
+    stats.scriptCount = static_cast<uint32_t>(m_scripts.size());
+    stats.classCount = static_cast<uint32_t>(m_classes.size());
+    for (const auto& scriptClass : m_classes) {
+        if (scriptClass.batchUpdate) {
+            stats.batchedClassCount++;
+        }
+    }
+    stats.callsLastUpdate = m_callsLastUpdate;
+    stats.totalCalls = m_totalCalls;
+    stats.totalErrors = m_totalErrors;
+    stats.deferredLastUpdate = m_deferredLastUpdate;
+    stats.totalDeferred = m_totalDeferred;
+    return stats;
+}
+
+ScriptProfile ScriptDispatcher::getProfile() const {
+    ScriptProfile profile;
+    profile.frames = m_frameTimes.summarize();
+    profile.frameBudget = getFrameBudget();
+    profile.deferredLastUpdate = m_deferredLastUpdate;
+    profile.totalDeferred = m_totalDeferred;
+
+    for (const auto& scriptClass : m_classes) {
+        if (scriptClass.entities.empty() && scriptClass.frames.getTotalSamples() == 0) {
+            continue;
+        }
+
+        const char* name = reinterpret_cast<PyTypeObject*>(scriptClass.type)->tp_name;
+        bool batched = m_batchingEnabled && scriptClass.batchUpdate;
+
+        ScriptClassProfile classProfile;
+        classProfile.name = name;
+        classProfile.priority = scriptClass.priority;
+        classProfile.scriptCount = static_cast<uint32_t>(scriptClass.entities.size());
+        classProfile.batched = batched;
+        classProfile.calls = batched ? scriptClass.calls.summarize() : ScriptTimingWindow::summarize(scriptClass.timings);
+        classProfile.frames = scriptClass.frames.summarize();
+        profile.classes.push_back(std::move(classProfile));
+
+        for (size_t i = 0; i < scriptClass.entities.size(); ++i) {
+            if (scriptClass.timings[i].getTotalSamples() == 0) {
+                continue;
+            }
+
+            ScriptEntityProfile entityProfile;
+            entityProfile.entity = scriptClass.entities[i];
+            entityProfile.className = name;
+            entityProfile.deferredFrames = batched ? scriptClass.batchDeferred.frames : scriptClass.deferred[i].frames;
+            entityProfile.calls = scriptClass.timings[i].summarize();
+            profile.entities.push_back(std::move(entityProfile));
+        }
+    }
+
+    std::sort(profile.classes.begin(), profile.classes.end(), [](const auto& a, const auto& b) {
+        return a.frames.averageTime > b.frames.averageTime;
+    });
+    std::sort(profile.entities.begin(), profile.entities.end(), [](const auto& a, const auto& b) {
+        return a.calls.averageTime > b.calls.averageTime;
+    });
+    return profile;
+}
+
+size_t ScriptDispatcher::getClassIndex(PyObject* type) {
+    auto it = m_classIndices.find(type);
+    if (it != m_classIndices.end()) {
+        return it->second;
+    }
+
+    ScriptClass scriptClass;
+    Py_INCREF(type);
+    scriptClass.type = type;
+    scriptClass.batchUpdate = findBatchUpdate(type);
+    scriptClass.priority = findPriority(type);
+
+    size_t classIndex = m_classes.size();
+    m_classes.push_back(std::move(scriptClass));
+    m_classIndices[type] = classIndex;
+
+    // Equal priorities keep registration order
+    auto position = std::upper_bound(m_classOrder.begin(), m_classOrder.end(), m_classes[classIndex].priority,
+                                     [this](int priority, size_t index) { return priority > m_classes[index].priority; });
+    m_classOrder.insert(position, classIndex);
+    return classIndex;
+}
+
+PyObject* ScriptDispatcher::findBatchUpdate(PyObject* type) {
+    // Only a classmethod or staticmethod can be called without an instance;
+    // a plain method named update_batch is ignored
+    PyObject* mro = reinterpret_cast<PyTypeObject*>(type)->tp_mro;
+    if (!mro || !PyTuple_Check(mro)) {
+        return nullptr;
+    }
+
+    for (Py_ssize_t i = 0; i < PyTuple_GET_SIZE(mro); ++i) {
+        PyObject* base = PyTuple_GET_ITEM(mro, i);
+#if PY_VERSION_HEX >= 0x030C0000
+        PyObject* dict = PyType_GetDict(reinterpret_cast<PyTypeObject*>(base));
+#else
+        PyObject* dict = reinterpret_cast<PyTypeObject*>(base)->tp_dict;
+        Py_XINCREF(dict);
+#endif
+        if (!dict) {
+            continue;
+        }
+
+        PyObject* descriptor = PyDict_GetItemString(dict, "update_batch");
+        bool batchable = descriptor && (PyObject_TypeCheck(descriptor, &PyClassMethod_Type) ||
+                                        PyObject_TypeCheck(descriptor, &PyStaticMethod_Type));
+        bool found = descriptor != nullptr;
+        Py_DECREF(dict);
+
+        if (found) {
+            if (!batchable) {
+                return nullptr;
+            }
+
+            PyObject* batchUpdate = PyObject_GetAttrString(type, "update_batch");
+            if (!batchUpdate) {
+                PyErr_Clear();
+            }
+            return batchUpdate;
+        }
+    }
+
+    return nullptr;
+}
+
+int ScriptDispatcher::findPriority(PyObject* type) {
+    PyObject* value = PyObject_GetAttrString(type, "update_priority");
+    if (!value) {
+        PyErr_Clear();
+        return 0;
+    }
+
+    int overflow = 0;
+    long priority = PyLong_Check(value) ? PyLong_AsLongAndOverflow(value, &overflow) : 0;
+    if (!PyLong_Check(value) || overflow != 0 || priority < INT32_MIN || priority > INT32_MAX) {
+        std::cerr << "Ignoring invalid update_priority on " << reinterpret_cast<PyTypeObject*>(type)->tp_name << std::endl;
+        priority = 0;
+    }
+    Py_DECREF(value);
+    return static_cast<int>(priority);
+}
+
+bool ScriptDispatcher::shouldDefer(DeferredTime& deferred, float deltaTime, bool overBudget, uint32_t maxFrames) {
+    if (!overBudget || deferred.frames >= maxFrames) {
+        return false;
+    }
+    deferred.pendingTime += deltaTime;
+    deferred.frames++;
+    return true;
+}
+
+PyObject* ScriptDispatcher::takeDeltaTime(DeferredTime& deferred, float deltaTime, PyObject* frameDeltaTime) {
+    // Returns a new reference; only scripts catching up need their own float
+    if (deferred.frames != 0) {
+        PyObject* caughtUp = PyFloat_FromDouble(deferred.pendingTime + deltaTime);
+        deferred = DeferredTime();
+        if (caughtUp) {
+            return caughtUp;
+        }
+        PyErr_Clear();
+    }
+    Py_INCREF(frameDeltaTime);
+    return frameDeltaTime;
+}
+
+PyObject* ScriptDispatcher::getIdView(ScriptClass& scriptClass) {
+    if (!scriptClass.batchIds) {
+        // The view owns a copy of the ids, so a script that keeps it (or a
+        // slice, or an array over it) never sees the entities vector move
+        PyObject* bytes = PyBytes_FromStringAndSize(reinterpret_cast<const char*>(scriptClass.entities.data()),
+                                                    static_cast<Py_ssize_t>(scriptClass.entities.size() * sizeof(uint32_t)));
+        if (!bytes) {
+            return nullptr;
+        }
+        PyObject* view = PyMemoryView_FromObject(bytes);
+        Py_DECREF(bytes);
+        if (!view) {
+            return nullptr;
+        }
+        scriptClass.batchIds = PyObject_CallMethod(view, "cast", "s", "I");
+        Py_DECREF(view);
+        if (!scriptClass.batchIds) {
+            return nullptr;
+        }
+    }
+
+    Py_INCREF(scriptClass.batchIds);
+    return scriptClass.batchIds;
+}
+
+void ScriptDispatcher::reportError(const ScriptClass& scriptClass, std::optional<uint32_t> entity) {
+    m_totalErrors++;
+
+    std::cerr << "Script error in " << reinterpret_cast<PyTypeObject*>(scriptClass.type)->tp_name;
+    if (entity) {
+        std::cerr << " (entity " << *entity << ")";
+    }
+    std::cerr << ":" << std::endl;
+
+    if (PyErr_Occurred()) {
+        PyErr_Print();
+    }
+}
+
+} // namespace VortexEngine
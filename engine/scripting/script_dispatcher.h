@@ -0,0 +1,149 @@
+#pragma once
+
+#include <Python.h>
+
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+#include "script_profiler.h"
+
+namespace VortexEngine {
+
+// Script dispatch statistics (last update plus running totals)
+struct ScriptDispatchStats {
+    uint32_t scriptCount = 0;
+    uint32_t classCount = 0;
+    uint32_t batchedClassCount = 0;
+    uint32_t callsLastUpdate = 0;
+    uint64_t totalCalls = 0;
+    uint64_t totalErrors = 0;
+    uint32_t deferredLastUpdate = 0;
+    uint64_t totalDeferred = 0;
+};
+
+// Per-frame entity script dispatch
+//
+// Script instances are grouped by their Python class. When batching is
+// enabled, a class that defines update_batch as a classmethod or staticmethod
+// is updated with a single call per frame:
+//
+//     @classmethod
+//     def update_batch(cls, entity_ids, dt): ...
+//
+// entity_ids is a read-only memoryview of uint32 ids. It owns a snapshot of
+// the class's ids, shared by every call until a script of that class is
+// added or removed, so scripts may keep it or slice it safely. Every other
+// script gets instance.update(dt) through a bound method cached when the
+// script was added, so no attribute lookup or argument tuple is built per
+// entity per frame. Scripts that only define update_batch are skipped while
+// batching is disabled.
+//
+// Classes run in order of their update_priority class attribute (an int,
+// default 0, higher first). With profiling enabled every update() and
+// update_batch() call is timed, per entity and per class. With a frame
+// budget set, once the scripts run so far have used it up the remaining
+// scripts are deferred: they skip the frame and receive the accumulated dt
+// when they next run. A script is never deferred more than the maximum
+// number of consecutive frames, so low priority scripts slow down under
+// load instead of stopping.
+//
+// Every method must be called with the GIL held.
+class ScriptDispatcher {
+public:
+    ScriptDispatcher() = default;
+    ~ScriptDispatcher();
+
+    ScriptDispatcher(const ScriptDispatcher&) = delete;
+    ScriptDispatcher& operator=(const ScriptDispatcher&) = delete;
+
+    // Script registration
+    bool addScript(uint32_t entity, PyObject* instance);
+    bool removeScript(uint32_t entity);
+    void clear();
+    bool hasScript(uint32_t entity) const { return m_scripts.count(entity) != 0; }
+    PyObject* getScript(uint32_t entity) const;
+
+    // Batching
+    void setBatchingEnabled(bool enable) { m_batchingEnabled = enable; }
+    bool isBatchingEnabled() const { return m_batchingEnabled; }
+
+    // Profiling
+    void setProfilingEnabled(bool enable) { m_profilingEnabled = enable; }
+    bool isProfilingEnabled() const { return m_profilingEnabled; }
+    ScriptProfile getProfile() const;
+    void resetProfile();
+
+    // Frame budget (0 disables deferral)
+    void setFrameBudget(double milliseconds);
+    double getFrameBudget() const;
+    void setMaxDeferredFrames(uint32_t frames) { m_maxDeferredFrames = frames; }
+    uint32_t getMaxDeferredFrames() const { return m_maxDeferredFrames; }
+
+    // Runs one update for every script that is not deferred; returns the
+    // number of Python calls made
+    uint32_t update(float deltaTime);
+
+    // Information
+    ScriptDispatchStats getStats() const;
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    // Deferral state of a script (or of a whole batched class)
+    struct DeferredTime {
+        float pendingTime = 0.0f;   // dt accumulated while deferred
+        uint32_t frames = 0;        // Consecutive frames deferred
+    };
+
+    struct ScriptClass {
+        PyObject* type = nullptr;           // Strong reference
+        PyObject* batchUpdate = nullptr;    // Strong reference, null if not batchable
+        int priority = 0;
+        std::vector<uint32_t> entities;
+        std::vector<PyObject*> instances;   // Strong references, parallel to entities
+        std::vector<PyObject*> updates;     // Cached bound update methods (may be null)
+        std::vector<DeferredTime> deferred; // Parallel to entities
+        std::vector<ScriptTimingWindow> timings; // Parallel to entities
+        DeferredTime batchDeferred;
+        ScriptTimingWindow calls;
+        ScriptTimingWindow frames;
+        PyObject* batchIds = nullptr;       // Cached entity_ids view, cleared when entities change
+    };
+
+    struct ScriptSlot {
+        size_t classIndex = 0;
+        size_t index = 0;
+    };
+
+    std::vector<ScriptClass> m_classes;
+    std::unordered_map<PyObject*, size_t> m_classIndices;
+    std::unordered_map<uint32_t, ScriptSlot> m_scripts;
+    std::vector<size_t> m_classOrder;   // Class indices by descending priority
+    bool m_batchingEnabled = true;
+
+    // Profiling and budget
+    bool m_profilingEnabled = true;
+    Clock::duration m_frameBudget{0};
+    uint32_t m_maxDeferredFrames = 4;
+    ScriptTimingWindow m_frameTimes;
+
+    uint32_t m_callsLastUpdate = 0;
+    uint64_t m_totalCalls = 0;
+    uint64_t m_totalErrors = 0;
+    uint32_t m_deferredLastUpdate = 0;
+    uint64_t m_totalDeferred = 0;
+
+    // Internal methods
+    size_t getClassIndex(PyObject* type);
+    static PyObject* findBatchUpdate(PyObject* type);
+    static int findPriority(PyObject* type);
+    static bool shouldDefer(DeferredTime& deferred, float deltaTime, bool overBudget, uint32_t maxFrames);
+    static PyObject* takeDeltaTime(DeferredTime& deferred, float deltaTime, PyObject* frameDeltaTime);
+    PyObject* getIdView(ScriptClass& scriptClass);
+    void reportError(const ScriptClass& scriptClass, std::optional<uint32_t> entity = std::nullopt);
+};
+
+} // namespace VortexEngine
@@ -0,0 +1,63 @@
+#include "script_profiler.h"
+#include <algorithm>
+#include <cstddef>
+
+namespace VortexEngine {
+
+namespace {
+
+double toMilliseconds(uint64_t nanoseconds) {
+    return static_cast<double>(nanoseconds) / 1e6;
+}
+
+} // namespace
+
+ScriptTimingSummary ScriptTimingWindow::summarize() const {
+    ScriptTimingSummary summary;
+    summary.sampleCount = m_count;
+    summary.totalSamples = m_totalSamples;
+    summary.totalTime = toMilliseconds(m_totalSum);
+    if (m_count == 0) {
+        return summary;
+    }
+
+    summary.averageTime = toMilliseconds(m_windowSum) / m_count;
+    summary.lastTime = toMilliseconds(m_samples[(m_head + CAPACITY - 1) & (CAPACITY - 1)]);
+
+    // Until the window is full the valid samples are the first m_count
+    std::array<uint32_t, CAPACITY> sorted = m_samples;
+    auto end = sorted.begin() + m_count;
+    size_t rank = (static_cast<size_t>(m_count) * 99 + 99) / 100 - 1;
+    std::nth_element(sorted.begin(), sorted.begin() + rank, end);
+    summary.p99Time = toMilliseconds(sorted[rank]);
+    summary.maxTime = toMilliseconds(*std::max_element(sorted.begin() + rank, end));
+    return summary;
+}
+
+ScriptTimingSummary ScriptTimingWindow::summarize(std::span<const ScriptTimingWindow> windows) {
+    ScriptTimingSummary summary;
+    std::vector<uint32_t> samples;
+    uint64_t windowSum = 0;
+    uint64_t totalSum = 0;
+    for (const auto& window : windows) {
+        samples.insert(samples.end(), window.m_samples.begin(), window.m_samples.begin() + window.m_count);
+        windowSum += window.m_windowSum;
+        totalSum += window.m_totalSum;
+        summary.totalSamples += window.m_totalSamples;
+    }
+
+    summary.sampleCount = static_cast<uint32_t>(samples.size());
+    summary.totalTime = toMilliseconds(totalSum);
+    if (samples.empty()) {
+        return summary;
+    }
+
+    summary.averageTime = toMilliseconds(windowSum) / static_cast<double>(samples.size());
+    size_t rank = (samples.size() * 99 + 99) / 100 - 1;
+    std::nth_element(samples.begin(), samples.begin() + static_cast<std::ptrdiff_t>(rank), samples.end());
+    summary.p99Time = toMilliseconds(samples[rank]);
+    summary.maxTime = toMilliseconds(*std::max_element(samples.begin() + static_cast<std::ptrdiff_t>(rank), samples.end()));
+    return summary;
+}
+
+} // namespace VortexEngine
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace VortexEngine {
+
+// Summary of a timing window; times are in milliseconds
+struct ScriptTimingSummary {
+    uint32_t sampleCount = 0;   // Samples currently in the window
+    uint64_t totalSamples = 0;  // Samples since the last reset
+    double averageTime = 0.0;   // Over the window
+    double p99Time = 0.0;       // Over the window
+    double maxTime = 0.0;       // Over the window
+    double lastTime = 0.0;
+    double totalTime = 0.0;     // Since the last reset
+};
+
+// Rolling window of the last CAPACITY durations
+//
+// record() is a ring buffer store plus a running sum update, so it can sit
+// inside the per-entity dispatch loop. Percentiles are only computed by
+// summarize(), which copies the window.
+class ScriptTimingWindow {
+public:
+    static constexpr uint32_t CAPACITY = 128;
+
+    using Clock = std::chrono::steady_clock;
+
+    void record(Clock::duration duration) {
+        auto nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
+        uint32_t sample = nanoseconds > static_cast<int64_t>(UINT32_MAX) ? UINT32_MAX : static_cast<uint32_t>(nanoseconds);
+
+        uint32_t& slot = m_samples[m_head];
+        m_windowSum += sample;
+        m_windowSum -= slot;
+        slot = sample;
+        m_head = (m_head + 1) & (CAPACITY - 1);
+        m_count += m_count < CAPACITY ? 1 : 0;
+        m_totalSum += sample;
+        m_totalSamples++;
+    }
+
+    ScriptTimingSummary summarize() const;
+    static ScriptTimingSummary summarize(std::span<const ScriptTimingWindow> windows);
+    void reset() { *this = ScriptTimingWindow(); }
+
+    uint64_t getTotalSamples() const { return m_totalSamples; }
+
+private:
+    static_assert((CAPACITY & (CAPACITY - 1)) == 0, "CAPACITY must be a power of two");
+
+    uint64_t m_windowSum = 0;
+    uint64_t m_totalSum = 0;
+    uint64_t m_totalSamples = 0;
+    uint32_t m_head = 0;
+    uint32_t m_count = 0;
+    std::array<uint32_t, CAPACITY> m_samples{}; // Nanoseconds
+};
+
+// Timing of one script class. calls covers update_batch() calls for batched
+// classes and the windows of all its entities otherwise (lastTime is then
+// unset); frames is the time the whole class took per update either way.
+struct ScriptClassProfile {
+    std::string name;
+    int priority = 0;
+    uint32_t scriptCount = 0;
+    bool batched = false;
+    ScriptTimingSummary calls;
+    ScriptTimingSummary frames;
+};
+
+// Timing of one entity's update() calls (not reported for batched classes)
+struct ScriptEntityProfile {
+    uint32_t entity = 0;
+    std::string className;
+    uint32_t deferredFrames = 0; // Consecutive frames skipped by the budget
+    ScriptTimingSummary calls;
+};
+
+// Snapshot returned by ScriptDispatcher::getProfile(). Classes and entities
+// are sorted by average time, most expensive first.
+struct ScriptProfile {
+    std::vector<ScriptClassProfile> classes;
+    std::vector<ScriptEntityProfile> entities;
+    ScriptTimingSummary frames;         // Whole update() per frame
+    double frameBudget = 0.0;           // Milliseconds, 0 when unlimited
+    uint32_t deferredLastUpdate = 0;
+    uint64_t totalDeferred = 0;
+};
+
+} // namespace VortexEngine
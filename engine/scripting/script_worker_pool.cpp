@@ -0,0 +1,390 @@
+#include "script_worker_pool.h"
+#include <algorithm>
+#include <iostream>
+
+namespace VortexEngine {
+
+namespace {
+
+#if PY_VERSION_HEX >= 0x030D0000
+PyThreadState* getCurrentThreadState() { return PyThreadState_GetUnchecked(); }
+#else
+PyThreadState* getCurrentThreadState() { return _PyThreadState_UncheckedGet(); }
+#endif
+
+// vortex_worker module, created directly in every worker interpreter; its
+// state points back at the owning interpreter's command buffer
+struct WorkerModuleState {
+    std::vector<ScriptCommand>* commands;
+};
+
+PyObject* workerEmit(PyObject* module, PyObject* const* args, Py_ssize_t nargs) {
+    if (nargs < 2 || nargs > 2 + static_cast<Py_ssize_t>(ScriptCommand::MAX_ARGS)) {
+        PyErr_Format(PyExc_TypeError, "emit(type, entity, *args) takes 2 to %u arguments",
+                     2 + ScriptCommand::MAX_ARGS);
+        return nullptr;
+    }
+
+    Py_ssize_t typeLength = 0;
+    const char* type = PyUnicode_AsUTF8AndSize(args[0], &typeLength);
+    if (!type) {
+        return nullptr;
+    }
+
+    unsigned long entity = PyLong_AsUnsignedLong(args[1]);
+    if (PyErr_Occurred()) {
+        return nullptr;
+    }
+
+    ScriptCommand command;
+    command.type = StringId::intern(std::string_view(type, static_cast<size_t>(typeLength)));
+    command.entity = static_cast<uint32_t>(entity);
+    command.argCount = static_cast<uint32_t>(nargs - 2);
+    for (uint32_t i = 0; i < command.argCount; ++i) {
+        double value = PyFloat_AsDouble(args[2 + i]);
+        if (value == -1.0 && PyErr_Occurred()) {
+            return nullptr;
+        }
+        command.args[i] = static_cast<float>(value);
+    }
+
+    auto* state = static_cast<WorkerModuleState*>(PyModule_GetState(module));
+    state->commands->push_back(command);
+    Py_RETURN_NONE;
+}
+
+PyMethodDef s_workerMethods[] = {
+    {"emit", reinterpret_cast<PyCFunction>(reinterpret_cast<void*>(workerEmit)), METH_FASTCALL,
+     "emit(type, entity, *args): queue a command for the main thread"},
+    {nullptr, nullptr, 0, nullptr}
+};
+
+PyModuleDef s_workerModule = {
+    PyModuleDef_HEAD_INIT,
+    "vortex_worker",
+    "Engine interface for scripts running in worker interpreters",
+    sizeof(WorkerModuleState),
+    s_workerMethods,
+    nullptr, nullptr, nullptr, nullptr
+};
+
+} // namespace
+
+// InterpreterScope implementation
+ScriptWorkerPool::InterpreterScope::InterpreterScope(Interpreter& interpreter)
+    : m_interpreter(interpreter), m_lock(interpreter.mutex) {
+    m_previous = getCurrentThreadState();
+    if (m_previous) {
+        PyEval_SaveThread();
+    }
+
+    m_threadState = PyThreadState_New(m_interpreter.state);
+    PyEval_RestoreThread(m_threadState);
+}
+
+ScriptWorkerPool::InterpreterScope::~InterpreterScope() {
+    PyThreadState_Clear(m_threadState);
+    PyThreadState_DeleteCurrent();
+
+    if (m_previous) {
+        PyEval_RestoreThread(m_previous);
+    }
+}
+
+// ScriptWorkerPool implementation
+ScriptWorkerPool::~ScriptWorkerPool() {
+    shutdown();
+}
+
+bool ScriptWorkerPool::isSupported() {
+    return PY_VERSION_HEX >= 0x030C0000;
+}
+
+bool ScriptWorkerPool::initialize(JobSystem* jobSystem, uint32_t interpreterCount) {
+    if (m_initialized) {
+        return true;
+    }
+
+    if (!isSupported()) {
+        std::cerr << "Script workers require Python 3.12 or newer (built against " << PY_VERSION << ")" << std::endl;
+        return false;
+    }
+    if (!Py_IsInitialized()) {
+        std::cerr << "Script workers require an initialized Python runtime" << std::endl;
+        return false;
+    }
+
+    m_jobSystem = jobSystem;
+    interpreterCount = std::max(interpreterCount, 1u);
+
+    PyGILState_STATE gilState = PyGILState_Ensure();
+    bool success = true;
+    for (uint32_t i = 0; i < interpreterCount && success; ++i) {
+        success = createInterpreter(i);
+    }
+    PyGILState_Release(gilState);
+
+    if (!success) {
+        for (auto& interpreter : m_interpreters) {
+            destroyInterpreter(*interpreter);
+        }
+        m_interpreters.clear();
+        return false;
+    }
+
+    m_initialized = true;
+    std::cout << "Script workers initialized with " << interpreterCount << " interpreters" << std::endl;
+    return true;
+}
+
+void ScriptWorkerPool::shutdown() {
+    if (!m_initialized) {
+        return;
+    }
+
+    sync();
+
+    for (auto& interpreter : m_interpreters) {
+        destroyInterpreter(*interpreter);
+    }
+    m_interpreters.clear();
+    m_scriptInterpreters.clear();
+    m_jobSystem = nullptr;
+    m_initialized = false;
+}
+
+bool ScriptWorkerPool::runSource(const std::string& source) {
+    if (!m_initialized) {
+        return false;
+    }
+
+    bool success = true;
+    for (auto& interpreter : m_interpreters) {
+        InterpreterScope scope(*interpreter);
+
+        PyObject* globals = PyModule_GetDict(PyImport_AddModule("__main__"));
+        PyObject* result = PyRun_String(source.c_str(), Py_file_input, globals, globals);
+        if (!result) {
+            std::cerr << "Script error in worker interpreter " << interpreter->index << ":" << std::endl;
+            PyErr_Print();
+            success = false;
+            continue;
+        }
+        Py_DECREF(result);
+    }
+    return success;
+}
+
+bool ScriptWorkerPool::addScript(uint32_t entity, const std::string& className) {
+    if (!m_initialized) {
+        return false;
+    }
+
+    removeScript(entity);
+
+    // Least loaded interpreter keeps the per-frame jobs balanced
+    auto it = std::min_element(m_interpreters.begin(), m_interpreters.end(), [](const auto& a, const auto& b) {
+        return a->scriptCount < b->scriptCount;
+    });
+    Interpreter& interpreter = **it;
+
+    bool success = false;
+    {
+        InterpreterScope scope(interpreter);
+
+        PyObject* globals = PyModule_GetDict(PyImport_AddModule("__main__"));
+        PyObject* type = PyRun_String(className.c_str(), Py_eval_input, globals, globals);
+        PyObject* instance = type ? PyObject_CallFunction(type, "I", entity) : nullptr;
+        if (instance) {
+            success = interpreter.dispatcher->addScript(entity, instance);
+        } else {
+            std::cerr << "Failed to create worker script " << className << " for entity " << entity << ":" << std::endl;
+            PyErr_Print();
+        }
+        Py_XDECREF(instance);
+        Py_XDECREF(type);
+    }
+
+    if (success) {
+        interpreter.scriptCount++;
+        m_scriptInterpreters[entity] = interpreter.index;
+    }
+    return success;
+}
+
+bool ScriptWorkerPool::removeScript(uint32_t entity) {
+    auto it = m_scriptInterpreters.find(entity);
+    if (it == m_scriptInterpreters.end()) {
+        return false;
+    }
+
+    Interpreter& interpreter = *m_interpreters[it->second];
+    {
+        InterpreterScope scope(interpreter);
+        interpreter.dispatcher->removeScript(entity);
+    }
+    interpreter.scriptCount--;
+    m_scriptInterpreters.erase(it);
+    return true;
+}
+
+void ScriptWorkerPool::dispatch(float deltaTime) {
+    if (!m_initialized) {
+        return;
+    }
+
+    // A frame still in flight must be applied before the next one starts
+    sync();
+
+    for (auto& interpreter : m_interpreters) {
+        if (interpreter->scriptCount == 0) {
+            continue;
+        }
+
+        Interpreter* target = interpreter.get();
+        auto job = [target, deltaTime]() {
+            InterpreterScope scope(*target);
+            target->dispatcher->update(deltaTime);
+        };
+
+        if (m_jobSystem) {
+            m_jobSystem->run(job, &m_frameCounter);
+        } else {
+            job();
+        }
+    }
+
+    m_dispatched = true;
+    m_framesDispatched++;
+}
+
+void ScriptWorkerPool::sync() {
+    if (m_dispatched) {
+        if (m_jobSystem) {
+            // A failing worker script may need the main interpreter's GIL
+            // (PyErr_Print imports single-phase modules there), so never
+            // wait while holding it
+            PyThreadState* mainThreadState = getCurrentThreadState();
+            if (mainThreadState) {
+                PyEval_SaveThread();
+            }
+            m_jobSystem->wait(&m_frameCounter);
+            if (mainThreadState) {
+                PyEval_RestoreThread(mainThreadState);
+            }
+        }
+        m_dispatched = false;
+    }
+
+    // Commands may also come from script constructors, so drain regardless
+    for (auto& interpreter : m_interpreters) {
+        for (const auto& command : interpreter->commands) {
+            if (m_commandHandler) {
+                m_commandHandler(command);
+                m_commandsApplied++;
+            } else {
+                m_commandsDropped++;
+            }
+        }
+        interpreter->commands.clear();
+    }
+}
+
+ScriptWorkerStats ScriptWorkerPool::getStats() const {
+    ScriptWorkerStats stats;
+    stats.interpreterCount = static_cast<uint32_t>(m_interpreters.size());
+    stats.scriptCount = static_cast<uint32_t>(m_scriptInterpreters.size());
+    stats.framesDispatched = m_framesDispatched;
+    stats.commandsApplied = m_commandsApplied;
+    stats.commandsDropped = m_commandsDropped;
+    return stats;
+}
+
+bool ScriptWorkerPool::createInterpreter(uint32_t index) {
+#if PY_VERSION_HEX >= 0x030C0000
+    // Called with the main interpreter's GIL held
+    PyThreadState* mainThreadState = PyThreadState_Get();
+
+    PyInterpreterConfig config = {
+        .use_main_obmalloc = 0,
+        .allow_fork = 0,
+        .allow_exec = 0,
+        .allow_threads = 1,
+        .allow_daemon_threads = 0,
+        .check_multi_interp_extensions = 1,
+        .gil = PyInterpreterConfig_OWN_GIL,
+    };
+
+    auto interpreter = std::make_unique<Interpreter>();
+    interpreter->index = index;
+
+    PyThreadState* threadState = nullptr;
+    PyStatus status = Py_NewInterpreterFromConfig(&threadState, &config);
+    if (PyStatus_Exception(status)) {
+        // The main thread state is current again after a failed creation
+        std::cerr << "Failed to create worker interpreter: " << (status.err_msg ? status.err_msg : "unknown error") << std::endl;
+        return false;
+    }
+
+    // The new interpreter's GIL is now held and the main one released
+    interpreter->state = PyThreadState_GetInterpreter(threadState);
+    interpreter->initialThreadState = threadState;
+    interpreter->dispatcher = std::make_unique<ScriptDispatcher>();
+
+    bool installed = installWorkerModule(*interpreter);
+    PyEval_SaveThread();
+    PyEval_RestoreThread(mainThreadState);
+
+    m_interpreters.push_back(std::move(interpreter));
+    return installed;
+#else
+    (void)index;
+    return false;
+#endif
+}
+
+void ScriptWorkerPool::destroyInterpreter(Interpreter& interpreter) {
+    if (!interpreter.initialThreadState) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(interpreter.mutex);
+
+    PyThreadState* previous = getCurrentThreadState();
+    if (previous) {
+        PyEval_SaveThread();
+    }
+
+    PyEval_RestoreThread(interpreter.initialThreadState);
+    interpreter.dispatcher->clear();
+    Py_EndInterpreter(interpreter.initialThreadState);
+    interpreter.initialThreadState = nullptr;
+    interpreter.state = nullptr;
+
+    if (previous) {
+        PyEval_RestoreThread(previous);
+    }
+}
+
+bool ScriptWorkerPool::installWorkerModule(Interpreter& interpreter) {
+    PyObject* module = PyModule_Create(&s_workerModule);
+    if (!module) {
+        PyErr_Print();
+        return false;
+    }
+
+    auto* state = static_cast<WorkerModuleState*>(PyModule_GetState(module));
+    state->commands = &interpreter.commands;
+
+    PyModule_AddIntConstant(module, "interpreter_index", static_cast<long>(interpreter.index));
+
+    PyObject* modules = PyImport_GetModuleDict();
+    bool success = PyDict_SetItemString(modules, "vortex_worker", module) == 0;
+    if (!success) {
+        PyErr_Print();
+    }
+    Py_DECREF(module);
+    return success;
+}
+
+} // namespace VortexEngine
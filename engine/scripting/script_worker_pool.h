@@ -0,0 +1,135 @@
+#pragma once
+
+#include <Python.h>
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "../core/job_system.h"
+#include "../utils/string_id.h"
+#include "script_dispatcher.h"
+
+namespace VortexEngine {
+
+// Command emitted by a worker script, applied on the main thread
+//
+// Python objects cannot cross interpreters, so scripts running in worker
+// interpreters report their results as plain data:
+//
+//     import vortex_worker
+//     vortex_worker.emit("set_position", entity, x, y, z)
+struct ScriptCommand {
+    static constexpr uint32_t MAX_ARGS = 4;
+
+    StringId type;
+    uint32_t entity = 0;
+    uint32_t argCount = 0;
+    std::array<float, MAX_ARGS> args{};
+};
+
+// Script worker statistics
+struct ScriptWorkerStats {
+    uint32_t interpreterCount = 0;
+    uint32_t scriptCount = 0;
+    uint64_t framesDispatched = 0;
+    uint64_t commandsApplied = 0;
+    uint64_t commandsDropped = 0;
+};
+
+// Entity scripts in subinterpreters with their own GIL (Python 3.12+)
+//
+// Each worker interpreter owns a ScriptDispatcher and is updated by one job
+// per frame on the job system, in parallel with the other interpreters and
+// with whatever the main thread does between dispatch() and sync(). Scripts
+// only see their own interpreter: they cannot share objects with the main
+// interpreter, use ComponentArray views, or import extension modules that do
+// not support multiple interpreters (NumPy included). Their effects come back
+// as ScriptCommands, handed to the command handler in interpreter order at
+// sync().
+//
+// initialize(), shutdown(), runSource(), addScript() and removeScript() are
+// main-thread calls made outside dispatch()/sync(); the calling thread may
+// hold the main interpreter's GIL, which is released around the call. The
+// same holds for the wait in sync() (and so dispatch()).
+class ScriptWorkerPool {
+public:
+    using CommandHandler = std::function<void(const ScriptCommand&)>;
+
+    ScriptWorkerPool() = default;
+    ~ScriptWorkerPool();
+
+    ScriptWorkerPool(const ScriptWorkerPool&) = delete;
+    ScriptWorkerPool& operator=(const ScriptWorkerPool&) = delete;
+
+    // Lifecycle (Python must already be initialized)
+    bool initialize(JobSystem* jobSystem, uint32_t interpreterCount);
+    void shutdown();
+    bool isInitialized() const { return m_initialized; }
+    static bool isSupported();
+
+    // Script setup
+    bool runSource(const std::string& source);
+    bool addScript(uint32_t entity, const std::string& className);
+    bool removeScript(uint32_t entity);
+    bool hasScript(uint32_t entity) const { return m_scriptInterpreters.count(entity) != 0; }
+
+    // Frame
+    void setCommandHandler(CommandHandler handler) { m_commandHandler = std::move(handler); }
+    void dispatch(float deltaTime);
+    void sync();
+    bool isDispatched() const { return m_dispatched; }
+
+    // Information
+    ScriptWorkerStats getStats() const;
+
+private:
+    struct Interpreter {
+        uint32_t index = 0;
+        PyInterpreterState* state = nullptr;
+        PyThreadState* initialThreadState = nullptr;  // Main thread only, used for teardown
+        std::mutex mutex;                             // Held while the interpreter runs
+        std::unique_ptr<ScriptDispatcher> dispatcher;
+        std::vector<ScriptCommand> commands;
+        uint32_t scriptCount = 0;
+    };
+
+    // Makes an interpreter current on the calling thread through a temporary
+    // thread state, so any thread (worker or main) can enter any interpreter
+    class InterpreterScope {
+    public:
+        explicit InterpreterScope(Interpreter& interpreter);
+        ~InterpreterScope();
+
+    private:
+        Interpreter& m_interpreter;
+        std::unique_lock<std::mutex> m_lock;
+        PyThreadState* m_previous = nullptr;
+        PyThreadState* m_threadState = nullptr;
+    };
+
+    bool m_initialized = false;
+    JobSystem* m_jobSystem = nullptr;
+    std::vector<std::unique_ptr<Interpreter>> m_interpreters;
+    std::unordered_map<uint32_t, uint32_t> m_scriptInterpreters;
+
+    CommandHandler m_commandHandler;
+    JobCounter m_frameCounter;
+    bool m_dispatched = false;
+
+    uint64_t m_framesDispatched = 0;
+    uint64_t m_commandsApplied = 0;
+    uint64_t m_commandsDropped = 0;
+
+    // Internal methods
+    bool createInterpreter(uint32_t index);
+    void destroyInterpreter(Interpreter& interpreter);
+    static bool installWorkerModule(Interpreter& interpreter);
+};
+
+} // namespace VortexEngine
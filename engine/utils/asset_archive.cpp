@@ -0,0 +1,345 @@
+#include "asset_archive.h"
+#include "compression.h"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <unordered_set>
+#include <utility>
+
+namespace VortexEngine {
+
+namespace VPak {
+
+std::string normalizePath(std::string_view path) {
+    std::string normalized(path);
+    std::replace(normalized.begin(), normalized.end(), '\\', '/');
+
+    size_t start = 0;
+    while (start < normalized.size()) {
+        if (normalized[start] == '/') {
+            start++;
+        } else if (normalized.compare(start, 2, "./") == 0) {
+            start += 2;
+        } else {
+            break;
+        }
+    }
+    normalized.erase(0, start);
+
+    for (size_t segment = 0; segment <= normalized.size();) {
+        size_t end = std::min(normalized.find('/', segment), normalized.size());
+        if (normalized.compare(segment, end - segment, "..") == 0) {
+            return std::string();
+        }
+        segment = end + 1;
+    }
+    return normalized;
+}
+
+bool isSafeEntryPath(std::string_view normalizedPath) {
+    if (normalizedPath.empty() || normalizedPath.find_first_of(":\\") != std::string_view::npos) {
+        return false;
+    }
+
+    for (size_t segment = 0; segment <= normalizedPath.size();) {
+        size_t end = std::min(normalizedPath.find('/', segment), normalizedPath.size());
+        std::string_view name = normalizedPath.substr(segment, end - segment);
+        if (name.empty() || name == "." || name == "..") {
+            return false;
+        }
+        segment = end + 1;
+    }
+    return true;
+}
+
+uint64_t hashPath(std::string_view normalizedPath) {
+    uint64_t hash = 14695981039346656037ull;
+    for (char c : normalizedPath) {
+        hash ^= static_cast<uint8_t>(c);
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+} // namespace VPak
+
+namespace {
+
+void writePadding(std::ofstream& out, uint64_t alignment) {
+    static const char zeros[VPak::ALIGNMENT] = {};
+    uint64_t position = static_cast<uint64_t>(out.tellp());
+    uint64_t padding = (alignment - position % alignment) % alignment;
+    out.write(zeros, static_cast<std::streamsize>(padding));
+}
+
+// Rooted or drive-qualified; entries must be relative to the archive root
+bool isAbsoluteArchivePath(std::string_view path) {
+    return !path.empty() && (path[0] == '/' || path[0] == '\\' || (path.size() > 1 && path[1] == ':'));
+}
+
+} // namespace
+
+bool ArchiveWriter::addFile(const std::string& archivePath, const std::string& sourcePath, bool compress) {
+    PendingEntry entry;
+    entry.path = VPak::normalizePath(archivePath);
+    entry.sourcePath = sourcePath;
+    entry.compress = compress;
+
+    if (isAbsoluteArchivePath(archivePath) || !VPak::isSafeEntryPath(entry.path) || entry.path.size() > UINT16_MAX) {
+        std::cerr << "Invalid archive path: " << archivePath << std::endl;
+        return false;
+    }
+
+    m_entries.push_back(std::move(entry));
+    return true;
+}
+
+bool ArchiveWriter::addData(const std::string& archivePath, std::span<const std::byte> data, bool compress) {
+    PendingEntry entry;
+    entry.path = VPak::normalizePath(archivePath);
+    entry.compress = compress;
+
+    if (isAbsoluteArchivePath(archivePath) || !VPak::isSafeEntryPath(entry.path) || entry.path.size() > UINT16_MAX) {
+        std::cerr << "Invalid archive path: " << archivePath << std::endl;
+        return false;
+    }
+
+    const uint8_t* bytes = reinterpret_cast<const uint8_t*>(data.data());
+    entry.data.assign(bytes, bytes + data.size());
+    m_entries.push_back(std::move(entry));
+    return true;
+}
+
+bool ArchiveWriter::write(const std::string& outputPath) {
+    // Order entries by hash so readers can binary search the TOC
+    std::vector<std::pair<uint64_t, size_t>> order;
+    order.reserve(m_entries.size());
+    std::unordered_set<std::string_view> seen;
+    for (size_t i = 0; i < m_entries.size(); ++i) {
+        if (!seen.insert(m_entries[i].path).second) {
+            std::cerr << "Duplicate archive path: " << m_entries[i].path << std::endl;
+            return false;
+        }
+        order.emplace_back(VPak::hashPath(m_entries[i].path), i);
+    }
+    std::sort(order.begin(), order.end(), [this](const auto& a, const auto& b) {
+        return a.first != b.first ? a.first < b.first : m_entries[a.second].path < m_entries[b.second].path;
+    });
+
+    std::ofstream out(outputPath, std::ios::binary | std::ios::trunc);
+    if (!out.is_open()) {
+        std::cerr << "Failed to create archive: " << outputPath << std::endl;
+        return false;
+    }
+
+    VPak::Header header{};
+    std::memcpy(header.magic, VPak::MAGIC, sizeof(header.magic));
+    header.version = VPak::VERSION;
+    header.entryCount = static_cast<uint32_t>(m_entries.size());
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    std::vector<VPak::TocEntry> toc;
+    toc.reserve(order.size());
+    std::string strings;
+    std::vector<uint8_t> compressed;
+
+    for (const auto& [hash, index] : order) {
+        PendingEntry& pending = m_entries[index];
+
+        // Source files are mapped one at a time rather than held in memory
+        MappedFile source;
+        std::span<const std::byte> data = std::as_bytes(std::span<const uint8_t>(pending.data));
+        if (!pending.sourcePath.empty()) {
+            if (!source.open(pending.sourcePath, MappedFile::AccessHint::Sequential)) {
+                std::cerr << "Failed to read archive input: " << pending.sourcePath << std::endl;
+                return false;
+            }
+            data = source.getData();
+        }
+
+        VPak::TocEntry entry{};
+        entry.pathHash = hash;
+        entry.size = data.size();
+        entry.pathOffset = static_cast<uint32_t>(strings.size());
+        entry.pathLength = static_cast<uint16_t>(pending.path.size());
+        entry.compression = VPak::Compression::None;
+        strings.append(pending.path);
+
+        std::span<const std::byte> stored = data;
+        if (pending.compress && !data.empty()) {
+            Compression::compressLZ4(data, compressed);
+            if (compressed.size() <= data.size() * (1.0f - MIN_COMPRESSION_SAVING)) {
+                stored = std::as_bytes(std::span<const uint8_t>(compressed));
+                entry.compression = VPak::Compression::LZ4;
+            }
+        }
+
+        writePadding(out, VPak::ALIGNMENT);
+        entry.offset = static_cast<uint64_t>(out.tellp());
+        entry.storedSize = stored.size();
+        out.write(reinterpret_cast<const char*>(stored.data()), static_cast<std::streamsize>(stored.size()));
+        toc.push_back(entry);
+    }
+
+    writePadding(out, alignof(VPak::TocEntry));
+    header.tocOffset = static_cast<uint64_t>(out.tellp());
+    out.write(reinterpret_cast<const char*>(toc.data()), static_cast<std::streamsize>(toc.size() * sizeof(VPak::TocEntry)));
+
+    header.stringTableOffset = static_cast<uint64_t>(out.tellp());
+    header.stringTableSize = strings.size();
+    out.write(strings.data(), static_cast<std::streamsize>(strings.size()));
+
+    out.seekp(0);
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    if (!out.good()) {
+        std::cerr << "Failed to write archive: " << outputPath << std::endl;
+        return false;
+    }
+    return true;
+}
+
+bool AssetArchive::open(const std::string& path) {
+    close();
+
+    if (!m_file.open(path, MappedFile::AccessHint::Random)) {
+        return false;
+    }
+
+    auto fail = [this, &path](const char* reason) {
+        std::cerr << "Invalid archive " << path << ": " << reason << std::endl;
+        close();
+        return false;
+    };
+
+    std::span<const std::byte> bytes = m_file.getData();
+    if (bytes.size() < sizeof(VPak::Header)) {
+        return fail("file too small");
+    }
+
+    VPak::Header header;
+    std::memcpy(&header, bytes.data(), sizeof(header));
+    if (std::memcmp(header.magic, VPak::MAGIC, sizeof(header.magic)) != 0) {
+        return fail("bad magic");
+    }
+    if (header.version != VPak::VERSION) {
+        return fail("unsupported version");
+    }
+
+    uint64_t tocSize = uint64_t(header.entryCount) * sizeof(VPak::TocEntry);
+    if (header.tocOffset % alignof(VPak::TocEntry) != 0 || header.tocOffset > bytes.size() ||
+        tocSize > bytes.size() - header.tocOffset) {
+        return fail("table of contents out of range");
+    }
+    if (header.stringTableOffset > bytes.size() || header.stringTableSize > bytes.size() - header.stringTableOffset) {
+        return fail("string table out of range");
+    }
+
+    m_entries = {reinterpret_cast<const VPak::TocEntry*>(bytes.data() + header.tocOffset), header.entryCount};
+    m_strings = {reinterpret_cast<const char*>(bytes.data() + header.stringTableOffset), header.stringTableSize};
+
+    for (const auto& entry : m_entries) {
+        if (entry.offset > bytes.size() || entry.storedSize > bytes.size() - entry.offset ||
+            uint64_t(entry.pathOffset) + entry.pathLength > m_strings.size()) {
+            return fail("entry out of range");
+        }
+        if (!VPak::isSafeEntryPath(getEntryPath(entry))) {
+            return fail("entry path escapes the archive root");
+        }
+    }
+
+    m_path = path;
+    return true;
+}
+
+AssetArchive::AssetArchive(AssetArchive&& other) noexcept
+    : m_file(std::move(other.m_file))
+    , m_path(std::move(other.m_path))
+    , m_entries(std::exchange(other.m_entries, {}))
+    , m_strings(std::exchange(other.m_strings, {})) {
+    other.m_path.clear();
+}
+
+AssetArchive& AssetArchive::operator=(AssetArchive&& other) noexcept {
+    if (this != &other) {
+        m_file = std::move(other.m_file);
+        m_path = std::move(other.m_path);
+        m_entries = std::exchange(other.m_entries, {});
+        m_strings = std::exchange(other.m_strings, {});
+        other.m_path.clear();
+    }
+    return *this;
+}
+
+void AssetArchive::close() {
+    m_file.close();
+    m_path.clear();
+    m_entries = {};
+    m_strings = {};
+}
+
+const VPak::TocEntry* AssetArchive::findEntry(std::string_view path) const {
+    std::string normalized = VPak::normalizePath(path);
+    uint64_t hash = VPak::hashPath(normalized);
+
+    auto it = std::lower_bound(m_entries.begin(), m_entries.end(), hash, [](const VPak::TocEntry& entry, uint64_t value) {
+        return entry.pathHash < value;
+    });
+
+    for (; it != m_entries.end() && it->pathHash == hash; ++it) {
+        if (getEntryPath(*it) == normalized) {
+            return &*it;
+        }
+    }
+    return nullptr;
+}
+
+std::string_view AssetArchive::getEntryPath(const VPak::TocEntry& entry) const {
+    return std::string_view(m_strings.data() + entry.pathOffset, entry.pathLength);
+}
+
+std::span<const std::byte> AssetArchive::getView(const VPak::TocEntry& entry) const {
+    if (entry.compression != VPak::Compression::None) {
+        return {};
+    }
+    return getStoredData(entry);
+}
+
+std::span<const std::byte> AssetArchive::getStoredData(const VPak::TocEntry& entry) const {
+    return m_file.getRange(entry.offset, entry.storedSize);
+}
+
+bool AssetArchive::readEntry(const VPak::TocEntry& entry, std::vector<uint8_t>& data) const {
+    std::span<const std::byte> stored = getStoredData(entry);
+
+    switch (entry.compression) {
+        case VPak::Compression::None: {
+            const uint8_t* bytes = reinterpret_cast<const uint8_t*>(stored.data());
+            data.assign(bytes, bytes + stored.size());
+            return true;
+        }
+        case VPak::Compression::LZ4:
+            data.resize(entry.size);
+            if (!Compression::decompressLZ4(stored, std::as_writable_bytes(std::span<uint8_t>(data)))) {
+                std::cerr << "Corrupt archive entry " << getEntryPath(entry) << " in " << m_path << std::endl;
+                data.clear();
+                return false;
+            }
+            return true;
+        default:
+            std::cerr << "Unknown compression for archive entry " << getEntryPath(entry) << std::endl;
+            return false;
+    }
+}
+
+bool AssetArchive::readFile(std::string_view path, std::vector<uint8_t>& data) const {
+    const VPak::TocEntry* entry = findEntry(path);
+    return entry && readEntry(*entry, data);
+}
+
+void AssetArchive::prefetch(const VPak::TocEntry& entry) const {
+    m_file.advise(MappedFile::AccessHint::WillNeed, entry.offset, entry.storedSize);
+}
+
+} // namespace VortexEngine
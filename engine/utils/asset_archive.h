@@ -0,0 +1,139 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "mapped_file.h"
+
+namespace VortexEngine {
+
+// .vpak archive format
+//
+//   Header        fixed 64 bytes at offset 0
+//   Entry data    each entry starts on an ALIGNMENT boundary
+//   TOC           TocEntry array sorted by path hash
+//   String table  entry paths, not null-terminated
+//
+// All integers are little-endian. Lookups hash the normalized path and
+// binary search the TOC, then compare the stored path to rule out collisions.
+namespace VPak {
+    constexpr char MAGIC[4] = {'V', 'P', 'A', 'K'};
+    constexpr uint32_t VERSION = 1;
+    constexpr uint64_t ALIGNMENT = 4096;
+
+    enum class Compression : uint8_t {
+        None = 0,
+        LZ4 = 1
+    };
+
+    struct Header {
+        char magic[4];
+        uint32_t version;
+        uint32_t entryCount;
+        uint32_t reserved0;
+        uint64_t tocOffset;
+        uint64_t stringTableOffset;
+        uint64_t stringTableSize;
+        uint8_t reserved[24];
+    };
+    static_assert(sizeof(Header) == 64, "VPak header layout changed");
+
+    struct TocEntry {
+        uint64_t pathHash;
+        uint64_t offset;        // Start of the stored bytes
+        uint64_t storedSize;    // Size in the archive (compressed size if compressed)
+        uint64_t size;          // Original size
+        uint32_t pathOffset;    // Into the string table
+        uint16_t pathLength;
+        Compression compression;
+        uint8_t reserved;
+    };
+    static_assert(sizeof(TocEntry) == 40, "VPak TOC entry layout changed");
+
+    // Separators become '/', leading "./" and "/" are dropped. A path with a
+    // ".." segment normalizes to "", which no entry can have
+    std::string normalizePath(std::string_view path);
+
+    // Relative, non-empty, and made only of plain segments (no "", "." or
+    // "..", no drive or stream ':'), so it stays inside any directory it is
+    // extracted to
+    bool isSafeEntryPath(std::string_view normalizedPath);
+
+    // FNV-1a over the normalized path
+    uint64_t hashPath(std::string_view normalizedPath);
+} // namespace VPak
+
+// Builds a .vpak archive
+class ArchiveWriter {
+public:
+    // Entries are compressed only when that saves at least this fraction
+    static constexpr float MIN_COMPRESSION_SAVING = 0.1f;
+
+    bool addFile(const std::string& archivePath, const std::string& sourcePath, bool compress = false);
+    bool addData(const std::string& archivePath, std::span<const std::byte> data, bool compress = false);
+    bool write(const std::string& outputPath);
+
+    size_t getEntryCount() const { return m_entries.size(); }
+
+private:
+    struct PendingEntry {
+        std::string path;
+        std::string sourcePath;          // Read at write() time when set
+        std::vector<uint8_t> data;
+        bool compress = false;
+    };
+
+    std::vector<PendingEntry> m_entries;
+};
+
+// Read-only view of a .vpak archive
+//
+// The archive is memory mapped; uncompressed entries can be viewed in place
+// without any copy for as long as the archive stays open.
+class AssetArchive {
+public:
+    AssetArchive() = default;
+    ~AssetArchive() = default;
+
+    AssetArchive(const AssetArchive&) = delete;
+    AssetArchive& operator=(const AssetArchive&) = delete;
+    // The table views point into the mapping, so they move with it and the
+    // source is left closed
+    AssetArchive(AssetArchive&& other) noexcept;
+    AssetArchive& operator=(AssetArchive&& other) noexcept;
+
+    // Lifecycle
+    bool open(const std::string& path);
+    void close();
+    bool isOpen() const { return m_file.isOpen(); }
+    const std::string& getPath() const { return m_path; }
+
+    // Lookup
+    const VPak::TocEntry* findEntry(std::string_view path) const;
+    bool contains(std::string_view path) const { return findEntry(path) != nullptr; }
+    std::string_view getEntryPath(const VPak::TocEntry& entry) const;
+    std::span<const VPak::TocEntry> getEntries() const { return m_entries; }
+    size_t getEntryCount() const { return m_entries.size(); }
+
+    // Data access. getView() is zero-copy and returns an empty span for
+    // compressed entries; readEntry() always produces the original bytes.
+    std::span<const std::byte> getView(const VPak::TocEntry& entry) const;
+    std::span<const std::byte> getStoredData(const VPak::TocEntry& entry) const;
+    bool readEntry(const VPak::TocEntry& entry, std::vector<uint8_t>& data) const;
+    bool readFile(std::string_view path, std::vector<uint8_t>& data) const;
+
+    // Paging hint for an entry that is about to be read
+    void prefetch(const VPak::TocEntry& entry) const;
+
+private:
+    MappedFile m_file;
+    std::string m_path;
+    std::span<const VPak::TocEntry> m_entries;
+    std::span<const char> m_strings;
+};
+
+} // namespace VortexEngine
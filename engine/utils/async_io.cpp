@@ -0,0 +1,687 @@
+#include "async_io.h"
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#include <fcntl.h>
+#include <io.h>
+#include <malloc.h>
+#include <sys/stat.h>
+#else
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#ifdef __linux__
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#endif
+
+namespace VortexEngine {
+
+namespace {
+
+// user_data of the no-op that tells the completion thread to exit
+constexpr uint64_t SHUTDOWN_TAG = ~uint64_t(0);
+
+bool isDirectAligned(uint64_t value) {
+    return value % AsyncIOService::DIRECT_IO_ALIGNMENT == 0;
+}
+
+// Positional read that retries short reads; stops early only at end of file
+int64_t readAt(int fd, void* buffer, uint32_t size, uint64_t offset) {
+    uint32_t total = 0;
+    while (total < size) {
+        char* destination = static_cast<char*>(buffer) + total;
+        uint64_t position = offset + total;
+
+#ifdef _WIN32
+        OVERLAPPED overlapped{};
+        overlapped.Offset = static_cast<DWORD>(position);
+        overlapped.OffsetHigh = static_cast<DWORD>(position >> 32);
+        DWORD bytes = 0;
+        if (!ReadFile(reinterpret_cast<HANDLE>(_get_osfhandle(fd)), destination, size - total, &bytes, &overlapped)) {
+            if (GetLastError() == ERROR_HANDLE_EOF) {
+                break;
+            }
+            return -EIO;
+        }
+        int64_t result = bytes;
+#else
+        ssize_t result = pread(fd, destination, size - total, static_cast<off_t>(position));
+        if (result < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return -errno;
+        }
+#endif
+
+        if (result == 0) {
+            break;
+        }
+        total += static_cast<uint32_t>(result);
+    }
+
+    return total;
+}
+
+} // namespace
+
+#ifdef __linux__
+
+// Minimal io_uring wrapper over the raw system calls
+//
+// Only the submitting side (under m_submitMutex) touches the submission ring
+// and only the completion thread touches the completion ring.
+struct AsyncIOService::IoUring {
+    int fd = -1;
+
+    void* sqRing = nullptr;
+    size_t sqRingSize = 0;
+    void* cqRing = nullptr;
+    size_t cqRingSize = 0;
+    io_uring_sqe* sqes = nullptr;
+    size_t sqesSize = 0;
+
+    unsigned* sqHead = nullptr;
+    unsigned* sqTail = nullptr;
+    unsigned* sqArray = nullptr;
+    unsigned sqMask = 0;
+    unsigned sqEntries = 0;
+    unsigned sqLocalTail = 0;
+
+    unsigned* cqHead = nullptr;
+    unsigned* cqTail = nullptr;
+    io_uring_cqe* cqes = nullptr;
+    unsigned cqMask = 0;
+    unsigned cqEntries = 0;
+
+    ~IoUring() { destroy(); }
+
+    bool setup(uint32_t entries) {
+        io_uring_params params{};
+        int ringFd = static_cast<int>(syscall(__NR_io_uring_setup, entries, &params));
+        if (ringFd < 0) {
+            std::cerr << "io_uring_setup failed: " << std::strerror(errno) << std::endl;
+            return false;
+        }
+        fd = ringFd;
+
+        // IORING_OP_READ needs Linux 5.6, which is also when RW_CUR_POS appeared
+        if (!(params.features & IORING_FEAT_RW_CUR_POS)) {
+            std::cerr << "io_uring is too old for IORING_OP_READ" << std::endl;
+            return false;
+        }
+
+        sqRingSize = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+        cqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+        bool singleMapping = params.features & IORING_FEAT_SINGLE_MMAP;
+        if (singleMapping) {
+            sqRingSize = cqRingSize = std::max(sqRingSize, cqRingSize);
+        }
+
+        sqRing = mapRegion(sqRingSize, IORING_OFF_SQ_RING);
+        cqRing = singleMapping ? sqRing : mapRegion(cqRingSize, IORING_OFF_CQ_RING);
+        sqesSize = params.sq_entries * sizeof(io_uring_sqe);
+        sqes = static_cast<io_uring_sqe*>(mapRegion(sqesSize, IORING_OFF_SQES));
+        if (!sqRing || !cqRing || !sqes) {
+            std::cerr << "Failed to map io_uring rings: " << std::strerror(errno) << std::endl;
+            return false;
+        }
+
+        char* sq = static_cast<char*>(sqRing);
+        sqHead = reinterpret_cast<unsigned*>(sq + params.sq_off.head);
+        sqTail = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+        sqArray = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+        sqMask = *reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+        sqEntries = *reinterpret_cast<unsigned*>(sq + params.sq_off.ring_entries);
+        sqLocalTail = *sqTail;
+
+        char* cq = static_cast<char*>(cqRing);
+        cqHead = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+        cqTail = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+        cqes = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+        cqMask = *reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+        cqEntries = *reinterpret_cast<unsigned*>(cq + params.cq_off.ring_entries);
+        return true;
+    }
+
+    void destroy() {
+        if (sqes) {
+            munmap(sqes, sqesSize);
+        }
+        if (cqRing && cqRing != sqRing) {
+            munmap(cqRing, cqRingSize);
+        }
+        if (sqRing) {
+            munmap(sqRing, sqRingSize);
+        }
+        if (fd >= 0) {
+            ::close(fd);
+        }
+        sqes = nullptr;
+        sqRing = cqRing = nullptr;
+        fd = -1;
+    }
+
+    void* mapRegion(size_t size, off_t offset) {
+        void* region = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, offset);
+        return region == MAP_FAILED ? nullptr : region;
+    }
+
+    // Returns a cleared entry, or nullptr when the submission ring is full.
+    // Entries become visible to the kernel on the next submit().
+    io_uring_sqe* acquireSqe() {
+        unsigned head = std::atomic_ref<unsigned>(*sqHead).load(std::memory_order_acquire);
+        if (sqLocalTail - head >= sqEntries) {
+            return nullptr;
+        }
+
+        unsigned index = sqLocalTail & sqMask;
+        sqArray[index] = index;
+        sqLocalTail++;
+
+        io_uring_sqe* sqe = &sqes[index];
+        std::memset(sqe, 0, sizeof(*sqe));
+        return sqe;
+    }
+
+    // Publishes acquired entries and submits everything the kernel has not consumed
+    int submit() {
+        std::atomic_ref<unsigned>(*sqTail).store(sqLocalTail, std::memory_order_release);
+        unsigned head = std::atomic_ref<unsigned>(*sqHead).load(std::memory_order_acquire);
+        unsigned toSubmit = sqLocalTail - head;
+        if (toSubmit == 0) {
+            return 0;
+        }
+
+        int result;
+        do {
+            result = enter(toSubmit, 0, 0);
+        } while (result == -EINTR);
+        return result;
+    }
+
+    int enter(unsigned toSubmit, unsigned minComplete, unsigned flags) {
+        int result = static_cast<int>(syscall(__NR_io_uring_enter, fd, toSubmit, minComplete, flags, nullptr, 0));
+        return result < 0 ? -errno : result;
+    }
+};
+
+#else
+
+struct AsyncIOService::IoUring {};
+
+#endif
+
+AsyncIOService::AsyncIOService() = default;
+
+AsyncIOService::~AsyncIOService() {
+    shutdown();
+}
+
+bool AsyncIOService::initialize(JobSystem* jobSystem, AsyncIOBackend backend, uint32_t queueDepth, uint32_t threadCount) {
+    if (m_initialized) {
+        return true;
+    }
+
+    m_jobSystem = jobSystem;
+    queueDepth = std::max(queueDepth, 1u);
+    threadCount = std::max(threadCount, 1u);
+
+    if (backend != AsyncIOBackend::ThreadPool && initializeIoUring(queueDepth)) {
+        m_backend = AsyncIOBackend::IoUring;
+    } else if (backend == AsyncIOBackend::IoUring) {
+        std::cerr << "io_uring backend requested but not available" << std::endl;
+        return false;
+    } else {
+        m_backend = AsyncIOBackend::ThreadPool;
+        m_stopThreads = false;
+        try {
+            for (uint32_t i = 0; i < threadCount; ++i) {
+                m_threads.emplace_back(&AsyncIOService::threadPoolMain, this);
+            }
+        }
+        catch (const std::system_error& e) {
+            std::cerr << "Failed to start I/O thread: " << e.what() << std::endl;
+            m_initialized = true;
+            shutdown();
+            return false;
+        }
+    }
+
+    m_initialized = true;
+    std::cout << "Async I/O initialized with " << backendToString(m_backend) << " backend" << std::endl;
+    return true;
+}
+
+void AsyncIOService::shutdown() {
+    if (!m_initialized) {
+        return;
+    }
+
+    // Finish everything already queued so no callback is lost
+    waitIdle();
+
+    if (m_backend == AsyncIOBackend::IoUring) {
+        shutdownIoUring();
+    } else {
+        {
+            std::lock_guard<std::mutex> lock(m_threadQueueMutex);
+            m_stopThreads = true;
+        }
+        m_threadQueueCondition.notify_all();
+
+        for (auto& thread : m_threads) {
+            if (thread.joinable()) {
+                thread.join();
+            }
+        }
+        m_threads.clear();
+    }
+
+    m_jobSystem = nullptr;
+    m_initialized = false;
+}
+
+AsyncFile AsyncIOService::openFile(const std::string& path, bool direct) {
+    AsyncFile file;
+
+#ifdef _WIN32
+    // Unbuffered reads on Windows have different rules; always go through the cache
+    direct = false;
+    int fd = _open(path.c_str(), _O_RDONLY | _O_BINARY);
+#else
+    int flags = O_RDONLY | O_CLOEXEC;
+#ifdef O_DIRECT
+    if (direct) {
+        flags |= O_DIRECT;
+    }
+#else
+    direct = false;
+#endif
+
+    int fd = ::open(path.c_str(), flags);
+    if (fd < 0 && direct && errno == EINVAL) {
+        // The file system does not support O_DIRECT (tmpfs, some FUSE mounts)
+        direct = false;
+        fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    }
+#endif
+
+    if (fd < 0) {
+        std::cerr << "Failed to open file for async reads: " << path << " (" << std::strerror(errno) << ")" << std::endl;
+        return file;
+    }
+
+#ifdef _WIN32
+    struct _stat64 info;
+    bool statOk = _fstat64(fd, &info) == 0;
+#else
+    struct stat info;
+    bool statOk = fstat(fd, &info) == 0;
+#endif
+
+    file.fd = fd;
+    file.size = statOk ? static_cast<uint64_t>(info.st_size) : 0;
+    file.direct = direct;
+    return file;
+}
+
+void AsyncIOService::closeFile(AsyncFile& file) {
+    if (!file.isValid()) {
+        return;
+    }
+
+#ifdef _WIN32
+    _close(file.fd);
+#else
+    ::close(file.fd);
+#endif
+    file = AsyncFile{};
+}
+
+void AsyncIOService::read(AsyncReadRequest request) {
+    enqueue(new Request{std::move(request), nullptr});
+}
+
+void AsyncIOService::enqueue(Request* entry) {
+    m_readsSubmitted.fetch_add(1, std::memory_order_relaxed);
+    m_pending.fetch_add(1);
+
+    const AsyncReadRequest& read = entry->read;
+
+    if (!read.file.isValid() || !read.buffer) {
+        complete(entry, -EBADF);
+        return;
+    }
+
+    if (read.file.direct && !(isDirectAligned(read.offset) && isDirectAligned(read.size) &&
+                              isDirectAligned(reinterpret_cast<uintptr_t>(read.buffer)))) {
+        complete(entry, -EINVAL);
+        return;
+    }
+
+    if (!m_initialized) {
+        // No service running - behave like a plain blocking read
+        complete(entry, readAt(read.file.fd, read.buffer, read.size, read.offset));
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(m_submitMutex);
+    m_queued.push_back(entry);
+}
+
+uint32_t AsyncIOService::submit() {
+    std::unique_lock<std::mutex> lock(m_submitMutex);
+    if (m_queued.empty()) {
+        return 0;
+    }
+
+    uint32_t count = static_cast<uint32_t>(m_queued.size());
+    m_submitCalls.fetch_add(1, std::memory_order_relaxed);
+
+    if (m_backend == AsyncIOBackend::IoUring) {
+        m_backlog.insert(m_backlog.end(), m_queued.begin(), m_queued.end());
+        m_queued.clear();
+        flushBacklog();
+        return count;
+    }
+
+    std::vector<Request*> batch;
+    batch.swap(m_queued);
+    lock.unlock();
+
+    {
+        std::lock_guard<std::mutex> queueLock(m_threadQueueMutex);
+        m_threadQueue.insert(m_threadQueue.end(), batch.begin(), batch.end());
+    }
+    if (count == 1) {
+        m_threadQueueCondition.notify_one();
+    } else {
+        m_threadQueueCondition.notify_all();
+    }
+    return count;
+}
+
+void AsyncIOService::readBatch(std::span<AsyncReadRequest> requests) {
+    for (auto& request : requests) {
+        read(std::move(request));
+    }
+    submit();
+}
+
+std::future<AsyncReadResult> AsyncIOService::readAsync(const AsyncFile& file, uint64_t offset, void* buffer, uint32_t size) {
+    Request* entry = new Request{};
+    entry->read.file = file;
+    entry->read.offset = offset;
+    entry->read.buffer = buffer;
+    entry->read.size = size;
+    entry->promise = std::make_shared<std::promise<AsyncReadResult>>();
+    std::future<AsyncReadResult> future = entry->promise->get_future();
+
+    enqueue(entry);
+    submit();
+    return future;
+}
+
+void AsyncIOService::waitIdle() {
+    submit();
+
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(m_idleMutex);
+            m_idleCondition.wait(lock, [this] { return m_pending.load() == 0; });
+        }
+
+        if (!m_jobSystem) {
+            return;
+        }
+
+        // Help run completion callbacks; they may have queued more reads
+        m_jobSystem->wait(&m_callbackJobs);
+        if (m_pending.load() == 0) {
+            return;
+        }
+    }
+}
+
+void* AsyncIOService::allocateAligned(size_t size, size_t alignment) {
+    size = (size + alignment - 1) & ~(alignment - 1);
+#ifdef _WIN32
+    return _aligned_malloc(size, alignment);
+#else
+    return std::aligned_alloc(alignment, size);
+#endif
+}
+
+void AsyncIOService::freeAligned(void* buffer) {
+#ifdef _WIN32
+    _aligned_free(buffer);
+#else
+    std::free(buffer);
+#endif
+}
+
+AsyncIOStats AsyncIOService::getStats() const {
+    AsyncIOStats stats;
+    stats.readsSubmitted = m_readsSubmitted.load(std::memory_order_relaxed);
+    stats.readsCompleted = m_readsCompleted.load(std::memory_order_relaxed);
+    stats.readsFailed = m_readsFailed.load(std::memory_order_relaxed);
+    stats.bytesRead = m_bytesRead.load(std::memory_order_relaxed);
+    stats.submitCalls = m_submitCalls.load(std::memory_order_relaxed);
+    stats.readsPending = m_pending.load(std::memory_order_relaxed);
+    return stats;
+}
+
+const char* AsyncIOService::backendToString(AsyncIOBackend backend) {
+    switch (backend) {
+        case AsyncIOBackend::Auto: return "auto";
+        case AsyncIOBackend::IoUring: return "io_uring";
+        case AsyncIOBackend::ThreadPool: return "thread pool";
+        default: return "unknown";
+    }
+}
+
+bool AsyncIOService::initializeIoUring(uint32_t queueDepth) {
+#ifdef __linux__
+    m_ring = std::make_unique<IoUring>();
+    if (!m_ring->setup(queueDepth)) {
+        m_ring.reset();
+        return false;
+    }
+
+    m_ringInFlight = 0;
+    try {
+        m_completionThread = std::thread(&AsyncIOService::completionThreadMain, this);
+    }
+    catch (const std::system_error& e) {
+        std::cerr << "Failed to start I/O completion thread: " << e.what() << std::endl;
+        m_ring.reset();
+        return false;
+    }
+    return true;
+#else
+    (void)queueDepth;
+    return false;
+#endif
+}
+
+void AsyncIOService::shutdownIoUring() {
+#ifdef __linux__
+    {
+        std::lock_guard<std::mutex> lock(m_submitMutex);
+        io_uring_sqe* sqe = m_ring->acquireSqe();
+        if (sqe) {
+            sqe->opcode = IORING_OP_NOP;
+            sqe->user_data = SHUTDOWN_TAG;
+            m_ring->submit();
+        }
+    }
+
+    if (m_completionThread.joinable()) {
+        m_completionThread.join();
+    }
+    m_ring.reset();
+#endif
+}
+
+uint32_t AsyncIOService::flushBacklog() {
+#ifdef __linux__
+    // Caller holds m_submitMutex. In-flight reads are capped at the completion
+    // ring size so completions can never overflow it.
+    uint32_t count = 0;
+    while (!m_backlog.empty() && m_ringInFlight < m_ring->cqEntries) {
+        io_uring_sqe* sqe = m_ring->acquireSqe();
+        if (!sqe) {
+            break;
+        }
+
+        Request* request = m_backlog.front();
+        m_backlog.pop_front();
+
+        sqe->opcode = IORING_OP_READ;
+        sqe->fd = request->read.file.fd;
+        sqe->off = request->read.offset;
+        sqe->addr = reinterpret_cast<uint64_t>(request->read.buffer);
+        sqe->len = request->read.size;
+        sqe->user_data = reinterpret_cast<uint64_t>(request);
+
+        m_ringInFlight++;
+        count++;
+    }
+
+    if (count > 0) {
+        int result = m_ring->submit();
+        if (result < 0) {
+            // Entries stay in the ring and go out with the next submit
+            std::cerr << "io_uring_enter failed: " << std::strerror(-result) << std::endl;
+        }
+    }
+    return count;
+#else
+    return 0;
+#endif
+}
+
+void AsyncIOService::completionThreadMain() {
+#ifdef __linux__
+    std::vector<std::pair<Request*, int64_t>> completed;
+    bool stopRequested = false;
+
+    while (!stopRequested) {
+        int result = m_ring->enter(0, 1, IORING_ENTER_GETEVENTS);
+        if (result < 0 && result != -EINTR && result != -EAGAIN && result != -EBUSY) {
+            std::cerr << "io_uring wait failed: " << std::strerror(-result) << std::endl;
+            std::this_thread::yield();
+        }
+
+        completed.clear();
+        unsigned head = *m_ring->cqHead;
+        unsigned tail = std::atomic_ref<unsigned>(*m_ring->cqTail).load(std::memory_order_acquire);
+        for (; head != tail; ++head) {
+            const io_uring_cqe& cqe = m_ring->cqes[head & m_ring->cqMask];
+            if (cqe.user_data == SHUTDOWN_TAG) {
+                stopRequested = true;
+            } else {
+                completed.emplace_back(reinterpret_cast<Request*>(cqe.user_data), cqe.res);
+            }
+        }
+        std::atomic_ref<unsigned>(*m_ring->cqHead).store(head, std::memory_order_release);
+
+        if (completed.empty()) {
+            continue;
+        }
+
+        // Refill the ring from the backlog before running callbacks
+        {
+            std::lock_guard<std::mutex> lock(m_submitMutex);
+            m_ringInFlight -= static_cast<uint32_t>(completed.size());
+            flushBacklog();
+        }
+
+        for (auto& [request, bytes] : completed) {
+            // A short read of a regular file means end of file; finish it off
+            // with a blocking read only if the kernel stopped early for
+            // another reason
+            if (bytes > 0 && static_cast<uint64_t>(bytes) < request->read.size && !request->read.file.direct &&
+                request->read.offset + bytes < request->read.file.size) {
+                uint32_t done = static_cast<uint32_t>(bytes);
+                int64_t rest = readAt(request->read.file.fd, static_cast<char*>(request->read.buffer) + done,
+                                      request->read.size - done, request->read.offset + done);
+                bytes = rest < 0 ? rest : bytes + rest;
+            }
+            complete(request, bytes);
+        }
+    }
+#endif
+}
+
+void AsyncIOService::threadPoolMain() {
+    while (true) {
+        Request* request = nullptr;
+        {
+            std::unique_lock<std::mutex> lock(m_threadQueueMutex);
+            m_threadQueueCondition.wait(lock, [this] { return m_stopThreads || !m_threadQueue.empty(); });
+            if (m_threadQueue.empty()) {
+                return;
+            }
+            request = m_threadQueue.front();
+            m_threadQueue.pop_front();
+        }
+
+        const AsyncReadRequest& read = request->read;
+        complete(request, readAt(read.file.fd, read.buffer, read.size, read.offset));
+    }
+}
+
+void AsyncIOService::complete(Request* request, int64_t result) {
+    AsyncReadResult readResult;
+    readResult.bytesRead = result;
+    readResult.buffer = request->read.buffer;
+    readResult.offset = request->read.offset;
+    readResult.requested = request->read.size;
+
+    if (result < 0) {
+        m_readsFailed.fetch_add(1, std::memory_order_relaxed);
+    } else {
+        m_bytesRead.fetch_add(static_cast<uint64_t>(result), std::memory_order_relaxed);
+    }
+    m_readsCompleted.fetch_add(1, std::memory_order_relaxed);
+
+    AsyncReadCallback callback = std::move(request->read.callback);
+    if (request->promise) {
+        request->promise->set_value(readResult);
+    }
+    delete request;
+
+    if (callback) {
+        if (m_jobSystem && m_jobSystem->isInitialized()) {
+            m_jobSystem->run([callback = std::move(callback), readResult]() {
+                callback(readResult);
+            }, &m_callbackJobs);
+        } else {
+            callback(readResult);
+        }
+    }
+
+    finishRequest();
+}
+
+void AsyncIOService::finishRequest() {
+    if (m_pending.fetch_sub(1) == 1) {
+        std::lock_guard<std::mutex> lock(m_idleMutex);
+        m_idleCondition.notify_all();
+    }
+}
+
+} // namespace VortexEngine
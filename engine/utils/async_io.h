@@ -0,0 +1,173 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../core/job_system.h"
+
+namespace VortexEngine {
+
+// File opened for asynchronous reads
+struct AsyncFile {
+    int fd = -1;
+    uint64_t size = 0;
+    bool direct = false;    // Opened with O_DIRECT - reads bypass the page cache
+
+    bool isValid() const { return fd >= 0; }
+};
+
+// Outcome of one read
+struct AsyncReadResult {
+    int64_t bytesRead = 0;  // Negative errno on failure
+    void* buffer = nullptr;
+    uint64_t offset = 0;
+    uint32_t requested = 0;
+
+    bool succeeded() const { return bytesRead >= 0; }
+};
+
+using AsyncReadCallback = std::function<void(const AsyncReadResult& result)>;
+
+// One read of size bytes at offset into buffer. For direct files the
+// buffer, offset and size must all be multiples of DIRECT_IO_ALIGNMENT.
+struct AsyncReadRequest {
+    AsyncFile file;
+    uint64_t offset = 0;
+    void* buffer = nullptr;
+    uint32_t size = 0;
+    AsyncReadCallback callback;
+};
+
+enum class AsyncIOBackend {
+    Auto,        // io_uring when the kernel allows it, otherwise ThreadPool
+    IoUring,
+    ThreadPool   // Blocking pread on a small pool of threads
+};
+
+// Async I/O statistics
+struct AsyncIOStats {
+    uint64_t readsSubmitted = 0;
+    uint64_t readsCompleted = 0;
+    uint64_t readsFailed = 0;
+    uint64_t bytesRead = 0;
+    uint64_t submitCalls = 0;
+    uint32_t readsPending = 0;
+};
+
+// Asynchronous file reads
+//
+// Keeps many reads outstanding without a thread per file. read() only queues a
+// request; submit() hands everything queued to the kernel in one system call,
+// so a loader can queue a whole batch and pay for a single submission.
+// Completion callbacks run as jobs on the job system when one is given, or on
+// the I/O completion thread otherwise, and must not block for long. Futures
+// from readAsync() are fulfilled on the completion thread itself, so waiting
+// on one is safe even when every job worker is busy.
+class AsyncIOService {
+public:
+    static constexpr size_t DIRECT_IO_ALIGNMENT = 4096;
+
+    AsyncIOService();
+    ~AsyncIOService();
+
+    AsyncIOService(const AsyncIOService&) = delete;
+    AsyncIOService& operator=(const AsyncIOService&) = delete;
+
+    // Lifecycle
+    bool initialize(JobSystem* jobSystem = nullptr, AsyncIOBackend backend = AsyncIOBackend::Auto,
+                    uint32_t queueDepth = 256, uint32_t threadCount = 4);
+    void shutdown();
+    bool isInitialized() const { return m_initialized; }
+    AsyncIOBackend getBackend() const { return m_backend; }
+
+    // File handles
+    AsyncFile openFile(const std::string& path, bool direct = false);
+    void closeFile(AsyncFile& file);
+
+    // Reads
+    void read(AsyncReadRequest request);
+    uint32_t submit();
+    void readBatch(std::span<AsyncReadRequest> requests);
+    std::future<AsyncReadResult> readAsync(const AsyncFile& file, uint64_t offset, void* buffer, uint32_t size);
+
+    // Submits anything queued, then blocks until every read has completed and
+    // its callback has run. Must not be called from a completion callback.
+    void waitIdle();
+
+    // Buffers for direct reads
+    static void* allocateAligned(size_t size, size_t alignment = DIRECT_IO_ALIGNMENT);
+    static void freeAligned(void* buffer);
+
+    // Information
+    AsyncIOStats getStats() const;
+    static const char* backendToString(AsyncIOBackend backend);
+
+private:
+    struct Request {
+        AsyncReadRequest read;
+
+        // readAsync() only; fulfilled on the completing thread so a waiter
+        // never depends on a free job system worker
+        std::shared_ptr<std::promise<AsyncReadResult>> promise;
+    };
+
+    struct IoUring;
+
+    bool m_initialized = false;
+    AsyncIOBackend m_backend = AsyncIOBackend::Auto;
+    JobSystem* m_jobSystem = nullptr;
+
+    // Requests queued by read() and not yet submitted
+    std::mutex m_submitMutex;
+    std::vector<Request*> m_queued;
+
+    // io_uring backend (requests wait in the backlog while the ring is full)
+    std::unique_ptr<IoUring> m_ring;
+    std::deque<Request*> m_backlog;
+    uint32_t m_ringInFlight = 0;
+    std::thread m_completionThread;
+
+    // Thread pool backend
+    std::vector<std::thread> m_threads;
+    std::mutex m_threadQueueMutex;
+    std::condition_variable m_threadQueueCondition;
+    std::deque<Request*> m_threadQueue;
+    bool m_stopThreads = false;
+
+    // Reads whose completion has not been dispatched yet, and callbacks
+    // dispatched to the job system that have not run yet
+    std::atomic<uint32_t> m_pending{0};
+    JobCounter m_callbackJobs;
+    std::mutex m_idleMutex;
+    std::condition_variable m_idleCondition;
+
+    // Statistics
+    std::atomic<uint64_t> m_readsSubmitted{0};
+    std::atomic<uint64_t> m_readsCompleted{0};
+    std::atomic<uint64_t> m_readsFailed{0};
+    std::atomic<uint64_t> m_bytesRead{0};
+    std::atomic<uint64_t> m_submitCalls{0};
+
+    // Internal methods
+    bool initializeIoUring(uint32_t queueDepth);
+    void shutdownIoUring();
+    uint32_t flushBacklog();
+    void completionThreadMain();
+    void threadPoolMain();
+    void enqueue(Request* request);
+    void complete(Request* request, int64_t result);
+    void finishRequest();
+};
+
+} // namespace VortexEngine
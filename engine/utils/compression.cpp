@@ -0,0 +1,351 @@
+#include "compression.h"
+#include <cstring>
+
+namespace VortexEngine {
+
+namespace {
+
+constexpr size_t MIN_MATCH = 4;
+constexpr size_t LAST_LITERALS = 5;     // The block always ends with this many literals
+constexpr size_t MATCH_LIMIT = 12;      // No match may start this close to the end
+constexpr size_t MAX_OFFSET = 65535;
+constexpr uint32_t HASH_BITS = 16;
+
+uint32_t read32(const uint8_t* p) {
+    uint32_t value;
+    std::memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+uint32_t hashSequence(uint32_t sequence) {
+    return (sequence * 2654435761u) >> (32 - HASH_BITS);
+}
+
+void writeLength(std::vector<uint8_t>& out, size_t length) {
+    while (length >= 255) {
+        out.push_back(255);
+        length -= 255;
+    }
+    out.push_back(static_cast<uint8_t>(length));
+}
+
+void writeSequence(std::vector<uint8_t>& out, const uint8_t* literals, size_t literalLength, size_t offset, size_t matchLength) {
+    size_t matchCode = matchLength - MIN_MATCH;
+    uint8_t token = static_cast<uint8_t>((literalLength >= 15 ? 15 : literalLength) << 4);
+    token |= static_cast<uint8_t>(matchCode >= 15 ? 15 : matchCode);
+    out.push_back(token);
+
+    if (literalLength >= 15) {
+        writeLength(out, literalLength - 15);
+    }
+    out.insert(out.end(), literals, literals + literalLength);
+
+    out.push_back(static_cast<uint8_t>(offset));
+    out.push_back(static_cast<uint8_t>(offset >> 8));
+    if (matchCode >= 15) {
+        writeLength(out, matchCode - 15);
+    }
+}
+
+void writeLastLiterals(std::vector<uint8_t>& out, const uint8_t* literals, size_t literalLength) {
+    out.push_back(static_cast<uint8_t>((literalLength >= 15 ? 15 : literalLength) << 4));
+    if (literalLength >= 15) {
+        writeLength(out, literalLength - 15);
+    }
+    out.insert(out.end(), literals, literals + literalLength);
+}
+
+// Reads an extended length; false if it runs off the end of the input
+bool readLength(const uint8_t*& ip, const uint8_t* end, size_t& length) {
+    uint8_t byte;
+    do {
+        if (ip >= end) {
+            return false;
+        }
+        byte = *ip++;
+        length += byte;
+    } while (byte == 255);
+    return true;
+}
+
+// DEFLATE limits
+constexpr size_t DEFLATE_MAX_MATCH = 258;
+constexpr size_t DEFLATE_MAX_DISTANCE = 32768;
+
+constexpr uint16_t DEFLATE_LENGTH_BASE[29] = {
+    3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+    35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258
+};
+constexpr uint8_t DEFLATE_LENGTH_EXTRA[29] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+    3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0
+};
+constexpr uint16_t DEFLATE_DISTANCE_BASE[30] = {
+    1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+    257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577
+};
+constexpr uint8_t DEFLATE_DISTANCE_EXTRA[30] = {
+    0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+    7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13
+};
+
+// LSB-first bit packer; Huffman codes are reversed before writing
+class BitWriter {
+public:
+    explicit BitWriter(std::vector<uint8_t>& out) : m_out(out) {}
+
+    void writeBits(uint32_t value, uint32_t count) {
+        m_buffer |= uint64_t(value) << m_count;
+        m_count += count;
+        while (m_count >= 8) {
+            m_out.push_back(static_cast<uint8_t>(m_buffer));
+            m_buffer >>= 8;
+            m_count -= 8;
+        }
+    }
+
+    void writeCode(uint32_t code, uint32_t length) {
+        uint32_t reversed = 0;
+        for (uint32_t i = 0; i < length; ++i) {
+            reversed = (reversed << 1) | ((code >> i) & 1u);
+        }
+        writeBits(reversed, length);
+    }
+
+    void flush() {
+        if (m_count > 0) {
+            m_out.push_back(static_cast<uint8_t>(m_buffer));
+        }
+        m_buffer = 0;
+        m_count = 0;
+    }
+
+private:
+    std::vector<uint8_t>& m_out;
+    uint64_t m_buffer = 0;
+    uint32_t m_count = 0;
+};
+
+// Fixed literal/length code (RFC 1951, 3.2.6)
+void writeFixedSymbol(BitWriter& bits, uint32_t symbol) {
+    if (symbol < 144) {
+        bits.writeCode(0x30 + symbol, 8);
+    } else if (symbol < 256) {
+        bits.writeCode(0x190 + symbol - 144, 9);
+    } else if (symbol < 280) {
+        bits.writeCode(symbol - 256, 7);
+    } else {
+        bits.writeCode(0xC0 + symbol - 280, 8);
+    }
+}
+
+void writeDeflateMatch(BitWriter& bits, size_t length, size_t distance) {
+    uint32_t lengthCode = 28;
+    while (DEFLATE_LENGTH_BASE[lengthCode] > length) {
+        lengthCode--;
+    }
+    writeFixedSymbol(bits, 257 + lengthCode);
+    bits.writeBits(static_cast<uint32_t>(length - DEFLATE_LENGTH_BASE[lengthCode]), DEFLATE_LENGTH_EXTRA[lengthCode]);
+
+    uint32_t distanceCode = 29;
+    while (DEFLATE_DISTANCE_BASE[distanceCode] > distance) {
+        distanceCode--;
+    }
+    bits.writeCode(distanceCode, 5);
+    bits.writeBits(static_cast<uint32_t>(distance - DEFLATE_DISTANCE_BASE[distanceCode]), DEFLATE_DISTANCE_EXTRA[distanceCode]);
+}
+
+uint32_t adler32(const uint8_t* data, size_t size) {
+    uint32_t a = 1;
+    uint32_t b = 0;
+    while (size > 0) {
+        // Largest run that cannot overflow before the modulo
+        size_t run = size < 5552 ? size : 5552;
+        size -= run;
+        while (run-- > 0) {
+            a += *data++;
+            b += a;
+        }
+        a %= 65521;
+        b %= 65521;
+    }
+    return (b << 16) | a;
+}
+
+} // namespace
+
+size_t Compression::getMaxCompressedSize(size_t inputSize) {
+    return inputSize + inputSize / 255 + 16;
+}
+
+size_t Compression::compressLZ4(std::span<const std::byte> input, std::vector<uint8_t>& output) {
+    const uint8_t* src = reinterpret_cast<const uint8_t*>(input.data());
+    size_t size = input.size();
+
+    output.clear();
+    output.reserve(getMaxCompressedSize(size));
+
+    if (size <= MATCH_LIMIT) {
+        writeLastLiterals(output, src, size);
+        return output.size();
+    }
+
+    // Last position seen for each 4-byte sequence hash
+    std::vector<uint32_t> table(size_t(1) << HASH_BITS, 0);
+
+    size_t anchor = 0;
+    size_t position = 0;
+    size_t searchLimit = size - MATCH_LIMIT;
+    size_t matchEnd = size - LAST_LITERALS;
+
+    while (position < searchLimit) {
+        uint32_t sequence = read32(src + position);
+        uint32_t hash = hashSequence(sequence);
+        size_t candidate = table[hash];
+        table[hash] = static_cast<uint32_t>(position);
+
+        if (candidate >= position || position - candidate > MAX_OFFSET || read32(src + candidate) != sequence) {
+            position++;
+            continue;
+        }
+
+        // Extend backwards over literals that also match
+        while (position > anchor && candidate > 0 && src[position - 1] == src[candidate - 1]) {
+            position--;
+            candidate--;
+        }
+
+        size_t matchLength = MIN_MATCH;
+        while (position + matchLength < matchEnd && src[candidate + matchLength] == src[position + matchLength]) {
+            matchLength++;
+        }
+
+        writeSequence(output, src + anchor, position - anchor, position - candidate, matchLength);
+        position += matchLength;
+        anchor = position;
+    }
+
+    writeLastLiterals(output, src + anchor, size - anchor);
+    return output.size();
+}
+
+size_t Compression::compressZlib(std::span<const std::byte> input, std::vector<uint8_t>& output) {
+    const uint8_t* src = reinterpret_cast<const uint8_t*>(input.data());
+    size_t size = input.size();
+
+    output.clear();
+    output.reserve(size + size / 8 + 16);
+
+    // zlib header: deflate, 32K window, fastest level (FCHECK makes it a multiple of 31)
+    output.push_back(0x78);
+    output.push_back(0x01);
+
+    // One final block with fixed Huffman codes
+    BitWriter bits(output);
+    bits.writeBits(1, 1);
+    bits.writeBits(1, 2);
+
+    std::vector<uint32_t> table(size_t(1) << HASH_BITS, UINT32_MAX);
+    size_t position = 0;
+
+    while (position + MIN_MATCH <= size) {
+        uint32_t sequence = read32(src + position);
+        uint32_t hash = hashSequence(sequence);
+        size_t candidate = table[hash];
+        table[hash] = static_cast<uint32_t>(position);
+
+        if (candidate == UINT32_MAX || position - candidate > DEFLATE_MAX_DISTANCE || read32(src + candidate) != sequence) {
+            writeFixedSymbol(bits, src[position]);
+            position++;
+            continue;
+        }
+
+        size_t matchLength = MIN_MATCH;
+        size_t maxLength = size - position < DEFLATE_MAX_MATCH ? size - position : DEFLATE_MAX_MATCH;
+        while (matchLength < maxLength && src[candidate + matchLength] == src[position + matchLength]) {
+            matchLength++;
+        }
+
+        writeDeflateMatch(bits, matchLength, position - candidate);
+        position += matchLength;
+    }
+
+    while (position < size) {
+        writeFixedSymbol(bits, src[position++]);
+    }
+
+    writeFixedSymbol(bits, 256);
+    bits.flush();
+
+    uint32_t checksum = adler32(src, size);
+    output.push_back(static_cast<uint8_t>(checksum >> 24));
+    output.push_back(static_cast<uint8_t>(checksum >> 16));
+    output.push_back(static_cast<uint8_t>(checksum >> 8));
+    output.push_back(static_cast<uint8_t>(checksum));
+    return output.size();
+}
+
+bool Compression::decompressLZ4(std::span<const std::byte> input, std::span<std::byte> output) {
+    const uint8_t* ip = reinterpret_cast<const uint8_t*>(input.data());
+    const uint8_t* inputEnd = ip + input.size();
+    uint8_t* op = reinterpret_cast<uint8_t*>(output.data());
+    uint8_t* outputStart = op;
+    uint8_t* outputEnd = op + output.size();
+
+    while (ip < inputEnd) {
+        uint8_t token = *ip++;
+
+        // Literals
+        size_t literalLength = token >> 4;
+        if (literalLength == 15 && !readLength(ip, inputEnd, literalLength)) {
+            return false;
+        }
+        if (literalLength > static_cast<size_t>(inputEnd - ip) || literalLength > static_cast<size_t>(outputEnd - op)) {
+            return false;
+        }
+        if (literalLength > 0) {
+            // memcpy needs valid pointers even for zero bytes, and op may be
+            // null when the output is empty
+            std::memcpy(op, ip, literalLength);
+            ip += literalLength;
+            op += literalLength;
+        }
+
+        // The final sequence has no match part
+        if (ip == inputEnd) {
+            break;
+        }
+
+        // Match
+        if (inputEnd - ip < 2) {
+            return false;
+        }
+        size_t offset = size_t(ip[0]) | (size_t(ip[1]) << 8);
+        ip += 2;
+
+        size_t matchLength = token & 0x0F;
+        if (matchLength == 15 && !readLength(ip, inputEnd, matchLength)) {
+            return false;
+        }
+        matchLength += MIN_MATCH;
+
+        if (offset == 0 || offset > static_cast<size_t>(op - outputStart) || matchLength > static_cast<size_t>(outputEnd - op)) {
+            return false;
+        }
+
+        const uint8_t* match = op - offset;
+        if (offset >= matchLength) {
+            std::memcpy(op, match, matchLength);
+            op += matchLength;
+        } else {
+            // Overlapping copy repeats the last offset bytes
+            for (size_t i = 0; i < matchLength; ++i) {
+                *op++ = *match++;
+            }
+        }
+    }
+
+    return op == outputEnd;
+}
+
+} // namespace VortexEngine
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace VortexEngine {
+
+// Fast block compression
+//
+// Produces the LZ4 block format (no frame header), so data can also be
+// inspected with standard LZ4 tools. Decompression favours speed over ratio,
+// which suits asset loading where data is decompressed far more often than it
+// is compressed.
+class Compression {
+public:
+    // Worst-case output size for compressLZ4
+    static size_t getMaxCompressedSize(size_t inputSize);
+
+    // Replaces output with the compressed block and returns its size
+    static size_t compressLZ4(std::span<const std::byte> input, std::vector<uint8_t>& output);
+
+    // Decompresses into output, which must be exactly the original size.
+    // Returns false if the block is malformed or does not fill output.
+    static bool decompressLZ4(std::span<const std::byte> input, std::span<std::byte> output);
+
+    // Replaces output with a zlib stream (RFC 1950) and returns its size.
+    // Uses the same greedy matcher with DEFLATE's fixed Huffman codes: fast,
+    // and readable by anything that reads zlib/PNG, at some cost in ratio.
+    static size_t compressZlib(std::span<const std::byte> input, std::vector<uint8_t>& output);
+};
+
+} // namespace VortexEngine
@@ -0,0 +1,154 @@
+#include "file_utils.h"
+#include "asset_archive.h"
+#include <algorithm>
+#include <iostream>
+
+namespace VortexEngine {
+
+namespace {
+
+// Reads a whole file into a byte container, sized once up front
+template<typename Container>
+FileResult readWholeFile(const std::string& path, Container& data) {
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file.is_open()) {
+        std::error_code ec;
+        return fs::exists(path, ec) ? FileResult::PermissionDenied : FileResult::FileNotFound;
+    }
+
+    std::streamoff size = file.tellg();
+    if (size < 0) {
+        return FileResult::Error;
+    }
+
+    data.resize(static_cast<size_t>(size));
+    file.seekg(0);
+    file.read(reinterpret_cast<char*>(data.data()), size);
+    if (file.gcount() != size) {
+        data.clear();
+        return FileResult::Error;
+    }
+    return FileResult::Success;
+}
+
+} // namespace
+
+// File reading
+
+FileResult FileUtils::readFile(const std::string& path, std::vector<uint8_t>& data) {
+    return readWholeFile(path, data);
+}
+
+FileResult FileUtils::readFile(const std::string& path, std::string& content) {
+    return readWholeFile(path, content);
+}
+
+// Archive operations (.vpak)
+
+FileResult FileUtils::createArchive(const std::string& archivePath, const std::vector<std::string>& files) {
+    ArchiveWriter writer;
+    for (const auto& file : files) {
+        std::error_code ec;
+        if (!fs::is_regular_file(file, ec)) {
+            std::cerr << "Archive input not found: " << file << std::endl;
+            return FileResult::FileNotFound;
+        }
+
+        // Entries keep the path they were given, so they resolve the same way
+        // through the virtual file system as the loose file did
+        if (!writer.addFile(file, file)) {
+            return FileResult::InvalidPath;
+        }
+    }
+
+    return writer.write(archivePath) ? FileResult::Success : FileResult::Error;
+}
+
+FileResult FileUtils::extractArchive(const std::string& archivePath, const std::string& destination) {
+    if (!fs::exists(archivePath)) {
+        return FileResult::FileNotFound;
+    }
+
+    AssetArchive archive;
+    if (!archive.open(archivePath)) {
+        return FileResult::Error;
+    }
+
+    std::error_code ec;
+    fs::path root = fs::weakly_canonical(fs::absolute(destination, ec), ec);
+    if (ec) {
+        return convertFilesystemError(ec);
+    }
+
+    std::vector<uint8_t> data;
+    for (const auto& entry : archive.getEntries()) {
+        // open() already rejects such entries; check again against symlinks
+        // inside the destination
+        std::string_view entryPath = archive.getEntryPath(entry);
+        fs::path target = fs::weakly_canonical(root / std::string(entryPath), ec);
+        auto [rootEnd, targetIt] = std::mismatch(root.begin(), root.end(), target.begin(), target.end());
+        if (ec || !VPak::isSafeEntryPath(entryPath) || rootEnd != root.end() || targetIt == target.end()) {
+            std::cerr << "Refusing to extract " << entryPath << " outside " << destination << std::endl;
+            return FileResult::InvalidPath;
+        }
+
+        fs::create_directories(target.parent_path(), ec);
+        if (ec) {
+            return convertFilesystemError(ec);
+        }
+
+        if (!archive.readEntry(entry, data)) {
+            return FileResult::Error;
+        }
+
+        std::ofstream out(target, std::ios::binary | std::ios::trunc);
+        if (!out.is_open()) {
+            return FileResult::PermissionDenied;
+        }
+        out.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
+        if (!out.good()) {
+            return FileResult::Error;
+        }
+    }
+
+    return FileResult::Success;
+}
+
+FileResult FileUtils::listArchive(const std::string& archivePath, std::vector<std::string>& files) {
+    if (!fs::exists(archivePath)) {
+        return FileResult::FileNotFound;
+    }
+
+    AssetArchive archive;
+    if (!archive.open(archivePath)) {
+        return FileResult::Error;
+    }
+
+    files.clear();
+    files.reserve(archive.getEntryCount());
+    for (const auto& entry : archive.getEntries()) {
+        files.emplace_back(archive.getEntryPath(entry));
+    }
+    return FileResult::Success;
+}
+
+FileResult FileUtils::convertFilesystemError(const std::error_code& ec) {
+    if (!ec) {
+        return FileResult::Success;
+    }
+    if (ec == std::errc::no_such_file_or_directory) {
+        return FileResult::FileNotFound;
+    }
+    if (ec == std::errc::permission_denied || ec == std::errc::operation_not_permitted) {
+        return FileResult::PermissionDenied;
+    }
+    if (ec == std::errc::file_exists) {
+        return FileResult::AlreadyExists;
+    }
+    if (ec == std::errc::invalid_argument || ec == std::errc::filename_too_long) {
+        return FileResult::InvalidPath;
+    }
+    return FileResult::Error;
+}
+
+} // namespace VortexEngine
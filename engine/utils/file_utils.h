@@ -6,6 +6,9 @@
 #include <filesystem>
 #include <memory>
 #include <functional>
+#include <cerrno>
+
+#include "mapped_file.h"
 
 namespace VortexEngine {
 
@@ -85,6 +88,21 @@ public:
     static FileResult writeFile(const std::string& path, const std::string& content);
     static FileResult appendFile(const std::string& path, const std::string& content);
 
+    // Zero-copy reading - maps the file instead of copying it into a buffer
+    static FileResult mapFile(const std::string& path, MappedFile& file,
+                              MappedFile::AccessHint hint = MappedFile::AccessHint::Sequential) {
+        if (file.open(path, hint)) {
+            return FileResult::Success;
+        }
+        switch (file.getLastErrorCode()) {
+            case ENOENT: return FileResult::FileNotFound;
+            case EACCES: return FileResult::PermissionDenied;
+            case ENAMETOOLONG:
+            case EINVAL: return FileResult::InvalidPath;
+            default: return FileResult::Error;
+        }
+    }
+
     // Directory operations
     static std::vector<FileInfo> listFiles(const std::string& path, bool recursive = false);
     static std::vector<DirectoryInfo> listDirectories(const std::string& path, bool recursive = false);
@@ -155,7 +173,7 @@ public:
 
 private:
     // File system monitoring
-    static class FileSystemWatcher;
+    class FileSystemWatcher;
     static std::unique_ptr<FileSystemWatcher> m_watcher;
 
     // Internal methods
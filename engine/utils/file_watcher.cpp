@@ -0,0 +1,364 @@
+#include "file_watcher.h"
+#include <iostream>
+
+#ifdef __linux__
+#include <cerrno>
+#include <cstring>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+namespace VortexEngine {
+
+namespace fs = std::filesystem;
+
+namespace {
+
+#ifdef __linux__
+// IN_CREATE is only acted on for directories, which need a watch of their own
+constexpr uint32_t WATCH_MASK = IN_CREATE | IN_CLOSE_WRITE | IN_MOVED_TO | IN_MOVED_FROM | IN_DELETE |
+                                IN_DELETE_SELF | IN_MOVE_SELF;
+constexpr size_t EVENT_BUFFER_SIZE = 64 * 1024;
+#endif
+
+// True if path is directory itself or lies below it
+bool isWithin(const std::string& path, const std::string& directory) {
+    return path.size() >= directory.size() && path.compare(0, directory.size(), directory) == 0 &&
+           (path.size() == directory.size() || path[directory.size()] == '/');
+}
+
+} // namespace
+
+void FileWatcher::PendingChanges::record(const std::string& path, FileChange change) {
+    auto it = indices.find(path);
+    if (it == indices.end()) {
+        indices.emplace(path, events.size());
+        events.push_back({path, change});
+        return;
+    }
+
+    // Created stays Created until deleted; a deleted file that reappears was replaced
+    FileChange& current = events[it->second].change;
+    if (change == FileChange::Deleted) {
+        current = FileChange::Deleted;
+    } else if (current == FileChange::Deleted) {
+        current = FileChange::Modified;
+    } else if (current != FileChange::Created) {
+        current = change;
+    }
+}
+
+FileWatcher::~FileWatcher() {
+    shutdown();
+}
+
+bool FileWatcher::initialize() {
+    if (m_initialized) {
+        return true;
+    }
+
+#ifdef __linux__
+    m_inotifyFd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (m_inotifyFd < 0) {
+        std::cerr << "inotify unavailable (" << std::strerror(errno) << "), falling back to polling" << std::endl;
+    } else {
+        m_eventBuffer.resize(EVENT_BUFFER_SIZE);
+    }
+#endif
+
+    m_lastScan = std::chrono::steady_clock::now();
+    m_initialized = true;
+    return true;
+}
+
+void FileWatcher::shutdown() {
+    if (!m_initialized) {
+        return;
+    }
+
+    unwatchAll();
+
+#ifdef __linux__
+    if (m_inotifyFd >= 0) {
+        close(m_inotifyFd);
+        m_inotifyFd = -1;
+    }
+#endif
+
+    m_eventBuffer.clear();
+    m_initialized = false;
+}
+
+bool FileWatcher::watchDirectory(const std::string& directory, bool recursive) {
+    if (!m_initialized && !initialize()) {
+        return false;
+    }
+
+    std::error_code ec;
+    if (!fs::is_directory(directory, ec)) {
+        std::cerr << "Cannot watch missing directory: " << directory << std::endl;
+        return false;
+    }
+
+    if (isNative()) {
+        return addWatch(directory, recursive);
+    }
+
+    // Fallback: remember current times so only later changes are reported
+    m_scannedDirectories.push_back({directory, recursive});
+    auto remember = [this](const fs::directory_entry& entry) {
+        std::error_code entryError;
+        if (entry.is_regular_file(entryError)) {
+            m_fileTimes[entry.path().string()] = entry.last_write_time(entryError);
+        }
+    };
+    if (recursive) {
+        for (const auto& entry : fs::recursive_directory_iterator(directory, ec)) {
+            remember(entry);
+        }
+    } else {
+        for (const auto& entry : fs::directory_iterator(directory, ec)) {
+            remember(entry);
+        }
+    }
+    return true;
+}
+
+void FileWatcher::unwatchAll() {
+#ifdef __linux__
+    for (const auto& [descriptor, directory] : m_watches) {
+        inotify_rm_watch(m_inotifyFd, descriptor);
+    }
+#endif
+    m_watches.clear();
+    m_scannedDirectories.clear();
+    m_fileTimes.clear();
+}
+
+size_t FileWatcher::poll(std::vector<FileChangeEvent>& events) {
+    if (!m_initialized) {
+        return 0;
+    }
+
+    PendingChanges changes;
+    if (isNative()) {
+        readEvents(changes);
+    } else {
+        auto now = std::chrono::steady_clock::now();
+        if (now - m_lastScan >= m_scanInterval) {
+            m_lastScan = now;
+            scanDirectories(changes);
+        }
+    }
+
+    events.insert(events.end(), changes.events.begin(), changes.events.end());
+    return changes.events.size();
+}
+
+bool FileWatcher::addWatch(const std::string& directory, bool recursive) {
+#ifdef __linux__
+    int descriptor = inotify_add_watch(m_inotifyFd, directory.c_str(), WATCH_MASK);
+    if (descriptor < 0) {
+        std::cerr << "Failed to watch " << directory << ": " << std::strerror(errno) << std::endl;
+        return false;
+    }
+    m_watches[descriptor] = {directory, recursive};
+
+    // inotify is not recursive; every subdirectory needs its own watch
+    if (recursive) {
+        std::error_code ec;
+        for (const auto& entry : fs::directory_iterator(directory, ec)) {
+            std::error_code entryError;
+            if (entry.is_directory(entryError) && !entry.is_symlink(entryError)) {
+                addWatch(entry.path().string(), true);
+            }
+        }
+    }
+    return true;
+#else
+    (void)directory;
+    (void)recursive;
+    return false;
+#endif
+}
+
+bool FileWatcher::moveWatches(const std::string& from, const std::string& to) {
+    bool moved = false;
+    for (auto& [descriptor, directory] : m_watches) {
+        if (isWithin(directory.path, from)) {
+            directory.path = to + directory.path.substr(from.size());
+            moved = true;
+        }
+    }
+    return moved;
+}
+
+void FileWatcher::removeWatches(const std::string& directory) {
+    for (auto it = m_watches.begin(); it != m_watches.end();) {
+        if (isWithin(it->second.path, directory)) {
+#ifdef __linux__
+            inotify_rm_watch(m_inotifyFd, it->first);
+#endif
+            it = m_watches.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+void FileWatcher::readEvents(PendingChanges& changes) {
+#ifdef __linux__
+    // Directories renamed away from a watched parent, by inotify cookie; the
+    // matching IN_MOVED_TO follows in the same batch if the target is watched
+    std::unordered_map<uint32_t, std::string> movedDirectories;
+
+    while (true) {
+        ssize_t length = read(m_inotifyFd, m_eventBuffer.data(), m_eventBuffer.size());
+        if (length <= 0) {
+            if (length < 0 && errno != EAGAIN && errno != EINTR) {
+                std::cerr << "inotify read failed: " << std::strerror(errno) << std::endl;
+            }
+            break;
+        }
+
+        for (ssize_t offset = 0; offset < length;) {
+            const auto* event = reinterpret_cast<const inotify_event*>(m_eventBuffer.data() + offset);
+            offset += static_cast<ssize_t>(sizeof(inotify_event) + event->len);
+
+            if (event->mask & IN_Q_OVERFLOW) {
+                std::cerr << "inotify queue overflowed; some file changes were missed" << std::endl;
+                continue;
+            }
+
+            auto it = m_watches.find(event->wd);
+            if (it == m_watches.end()) {
+                continue;
+            }
+            if (event->mask & (IN_DELETE_SELF | IN_IGNORED)) {
+                m_watches.erase(it);
+                continue;
+            }
+            if (event->mask & IN_MOVE_SELF) {
+                // Renames inside the tree have already updated the path; one
+                // that no longer exists was moved out (or is a renamed root)
+                std::string moved = it->second.path;
+                std::error_code ec;
+                if (!fs::is_directory(moved, ec)) {
+                    removeWatches(moved);
+                }
+                continue;
+            }
+            if (event->len == 0) {
+                continue;
+            }
+
+            const WatchedDirectory directory = it->second;
+            std::string path = (fs::path(directory.path) / event->name).string();
+
+            if (event->mask & IN_ISDIR) {
+                if (event->mask & IN_MOVED_FROM) {
+                    movedDirectories[event->cookie] = path;
+                    continue;
+                }
+
+                auto moved = event->mask & IN_MOVED_TO ? movedDirectories.find(event->cookie) : movedDirectories.end();
+                if (moved != movedDirectories.end()) {
+                    std::string from = std::move(moved->second);
+                    movedDirectories.erase(moved);
+
+                    bool watched = directory.recursive ? moveWatches(from, path) : false;
+                    if (!directory.recursive) {
+                        removeWatches(from);
+                    }
+
+                    std::error_code ec;
+                    for (const auto& entry : fs::recursive_directory_iterator(path, ec)) {
+                        std::error_code entryError;
+                        if (entry.is_regular_file(entryError)) {
+                            std::string newPath = entry.path().string();
+                            changes.record(from + newPath.substr(path.size()), FileChange::Deleted);
+                            changes.record(newPath, FileChange::Created);
+                        }
+                    }
+
+                    if (watched || !directory.recursive) {
+                        continue;
+                    }
+                    // The source parent was not watched recursively; watch it as new
+                }
+
+                // Files written before the new watch existed are reported as created
+                if ((event->mask & (IN_CREATE | IN_MOVED_TO)) && directory.recursive && addWatch(path, true)) {
+                    std::error_code ec;
+                    for (const auto& entry : fs::recursive_directory_iterator(path, ec)) {
+                        std::error_code entryError;
+                        if (entry.is_regular_file(entryError)) {
+                            changes.record(entry.path().string(), FileChange::Created);
+                        }
+                    }
+                }
+                continue;
+            }
+
+            // A created file is still empty or half written; wait for the writer to close it
+            if (event->mask & (IN_DELETE | IN_MOVED_FROM)) {
+                changes.record(path, FileChange::Deleted);
+            } else if (event->mask & (IN_CLOSE_WRITE | IN_MOVED_TO)) {
+                changes.record(path, FileChange::Modified);
+            }
+        }
+    }
+
+    // No matching IN_MOVED_TO: the directory left the watched tree
+    for (const auto& [cookie, directory] : movedDirectories) {
+        removeWatches(directory);
+    }
+#else
+    (void)changes;
+#endif
+}
+
+void FileWatcher::scanDirectories(PendingChanges& changes) {
+    std::unordered_map<std::string, fs::file_time_type> current;
+
+    auto visit = [&](const fs::directory_entry& entry) {
+        std::error_code entryError;
+        if (!entry.is_regular_file(entryError)) {
+            return;
+        }
+
+        std::string path = entry.path().string();
+        fs::file_time_type time = entry.last_write_time(entryError);
+        current[path] = time;
+
+        auto it = m_fileTimes.find(path);
+        if (it == m_fileTimes.end()) {
+            changes.record(path, FileChange::Created);
+        } else if (it->second != time) {
+            changes.record(path, FileChange::Modified);
+        }
+    };
+
+    for (const auto& directory : m_scannedDirectories) {
+        std::error_code ec;
+        if (directory.recursive) {
+            for (const auto& entry : fs::recursive_directory_iterator(directory.path, ec)) {
+                visit(entry);
+            }
+        } else {
+            for (const auto& entry : fs::directory_iterator(directory.path, ec)) {
+                visit(entry);
+            }
+        }
+    }
+
+    for (const auto& [path, time] : m_fileTimes) {
+        if (current.find(path) == current.end()) {
+            changes.record(path, FileChange::Deleted);
+        }
+    }
+
+    m_fileTimes = std::move(current);
+}
+
+} // namespace VortexEngine
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace VortexEngine {
+
+// Kind of change reported by FileWatcher
+enum class FileChange {
+    Created,
+    Modified,
+    Deleted
+};
+
+struct FileChangeEvent {
+    std::string path;
+    FileChange change;
+};
+
+// Directory change notifications
+//
+// On Linux this is backed by a non-blocking inotify descriptor: poll() only
+// reads the events the kernel has already queued and never touches the file
+// system, so it is cheap enough to call every frame. Files are reported once
+// their writer closes them or they are renamed into place, never while still
+// being written, so new files and saves that replace a file through a rename
+// are both reported as Modified. A watched subdirectory that is renamed
+// keeps its watches under the new path, and its files are reported as
+// Deleted at the old path and Created at the new one; one moved out of the
+// watched tree stops being watched. Elsewhere poll() falls back
+// to rescanning modification times, at most once per scan interval.
+class FileWatcher {
+public:
+    FileWatcher() = default;
+    ~FileWatcher();
+
+    FileWatcher(const FileWatcher&) = delete;
+    FileWatcher& operator=(const FileWatcher&) = delete;
+
+    // Lifecycle
+    bool initialize();
+    void shutdown();
+    bool isInitialized() const { return m_initialized; }
+    bool isNative() const { return m_inotifyFd >= 0; }
+
+    // Watches
+    bool watchDirectory(const std::string& directory, bool recursive = true);
+    void unwatchAll();
+
+    // Appends the changes since the last call (one event per path); returns
+    // the number of events added
+    size_t poll(std::vector<FileChangeEvent>& events);
+
+    // Fallback scanner
+    void setScanInterval(std::chrono::milliseconds interval) { m_scanInterval = interval; }
+
+private:
+    struct WatchedDirectory {
+        std::string path;
+        bool recursive = true;
+    };
+
+    // Changes gathered during one poll(), coalesced per path in first-seen order
+    struct PendingChanges {
+        std::vector<FileChangeEvent> events;
+        std::unordered_map<std::string, size_t> indices;
+
+        void record(const std::string& path, FileChange change);
+    };
+
+    bool m_initialized = false;
+    int m_inotifyFd = -1;
+    std::unordered_map<int, WatchedDirectory> m_watches;  // inotify watch descriptor -> directory
+    std::vector<char> m_eventBuffer;
+
+    // Fallback state
+    std::vector<WatchedDirectory> m_scannedDirectories;
+    std::unordered_map<std::string, std::filesystem::file_time_type> m_fileTimes;
+    std::chrono::milliseconds m_scanInterval{500};
+    std::chrono::steady_clock::time_point m_lastScan;
+
+    // Internal methods
+    bool addWatch(const std::string& directory, bool recursive);
+    bool moveWatches(const std::string& from, const std::string& to);
+    void removeWatches(const std::string& directory);
+    void readEvents(PendingChanges& changes);
+    void scanDirectories(PendingChanges& changes);
+};
+
+} // namespace VortexEngine
@@ -0,0 +1,291 @@
+#include "image_writer.h"
+#include "compression.h"
+#include <array>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+namespace VortexEngine {
+
+namespace {
+
+constexpr uint8_t PNG_SIGNATURE[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+
+// PNG row filter types
+constexpr uint8_t FILTER_NONE = 0;
+constexpr uint8_t FILTER_SUB = 1;
+constexpr uint8_t FILTER_UP = 2;
+constexpr uint8_t FILTER_AVERAGE = 3;
+constexpr uint8_t FILTER_PAETH = 4;
+
+// EXR attribute values
+constexpr int32_t EXR_PIXEL_HALF = 1;
+constexpr int32_t EXR_PIXEL_FLOAT = 2;
+
+const std::array<uint32_t, 256>& crcTable() {
+    static const std::array<uint32_t, 256> table = [] {
+        std::array<uint32_t, 256> result{};
+        for (uint32_t n = 0; n < 256; ++n) {
+            uint32_t c = n;
+            for (int k = 0; k < 8; ++k) {
+                c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+            }
+            result[n] = c;
+        }
+        return result;
+    }();
+    return table;
+}
+
+uint32_t crc32(const uint8_t* data, size_t size) {
+    const auto& table = crcTable();
+    uint32_t crc = 0xFFFFFFFFu;
+    for (size_t i = 0; i < size; ++i) {
+        crc = table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+    }
+    return crc ^ 0xFFFFFFFFu;
+}
+
+void writeBigEndian32(std::vector<uint8_t>& out, uint32_t value) {
+    out.push_back(static_cast<uint8_t>(value >> 24));
+    out.push_back(static_cast<uint8_t>(value >> 16));
+    out.push_back(static_cast<uint8_t>(value >> 8));
+    out.push_back(static_cast<uint8_t>(value));
+}
+
+void writePngChunk(std::vector<uint8_t>& out, const char type[4], const uint8_t* data, size_t size) {
+    writeBigEndian32(out, static_cast<uint32_t>(size));
+    size_t typeStart = out.size();
+    out.insert(out.end(), type, type + 4);
+    out.insert(out.end(), data, data + size);
+    writeBigEndian32(out, crc32(out.data() + typeStart, size + 4));
+}
+
+uint8_t paethPredictor(int a, int b, int c) {
+    int p = a + b - c;
+    int pa = std::abs(p - a);
+    int pb = std::abs(p - b);
+    int pc = std::abs(p - c);
+    if (pa <= pb && pa <= pc) {
+        return static_cast<uint8_t>(a);
+    }
+    return static_cast<uint8_t>(pb <= pc ? b : c);
+}
+
+// Filters one row with the given filter type into out (without the type byte)
+void filterRow(uint8_t type, const uint8_t* row, const uint8_t* previous, size_t rowBytes, uint8_t* out) {
+    constexpr size_t bpp = 4;
+    for (size_t i = 0; i < rowBytes; ++i) {
+        int left = i >= bpp ? row[i - bpp] : 0;
+        int up = previous ? previous[i] : 0;
+        int upLeft = (previous && i >= bpp) ? previous[i - bpp] : 0;
+
+        uint8_t predicted = 0;
+        switch (type) {
+            case FILTER_SUB: predicted = static_cast<uint8_t>(left); break;
+            case FILTER_UP: predicted = static_cast<uint8_t>(up); break;
+            case FILTER_AVERAGE: predicted = static_cast<uint8_t>((left + up) / 2); break;
+            case FILTER_PAETH: predicted = paethPredictor(left, up, upLeft); break;
+            default: break;
+        }
+        out[i] = static_cast<uint8_t>(row[i] - predicted);
+    }
+}
+
+// Sum of residuals as signed bytes; the usual heuristic for picking a filter
+uint64_t filterCost(const uint8_t* filtered, size_t rowBytes) {
+    uint64_t cost = 0;
+    for (size_t i = 0; i < rowBytes; ++i) {
+        cost += static_cast<uint64_t>(std::abs(static_cast<int>(static_cast<int8_t>(filtered[i]))));
+    }
+    return cost;
+}
+
+void writeLittleEndian32(std::vector<uint8_t>& out, uint32_t value) {
+    out.push_back(static_cast<uint8_t>(value));
+    out.push_back(static_cast<uint8_t>(value >> 8));
+    out.push_back(static_cast<uint8_t>(value >> 16));
+    out.push_back(static_cast<uint8_t>(value >> 24));
+}
+
+void writeLittleEndian64(std::vector<uint8_t>& out, uint64_t value) {
+    writeLittleEndian32(out, static_cast<uint32_t>(value));
+    writeLittleEndian32(out, static_cast<uint32_t>(value >> 32));
+}
+
+void writeFloat(std::vector<uint8_t>& out, float value) {
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    writeLittleEndian32(out, bits);
+}
+
+void writeExrAttribute(std::vector<uint8_t>& out, const char* name, const char* type, const std::vector<uint8_t>& value) {
+    out.insert(out.end(), name, name + std::strlen(name) + 1);
+    out.insert(out.end(), type, type + std::strlen(type) + 1);
+    writeLittleEndian32(out, static_cast<uint32_t>(value.size()));
+    out.insert(out.end(), value.begin(), value.end());
+}
+
+} // namespace
+
+bool ImageWriter::encodePNG(uint32_t width, uint32_t height, const uint8_t* rgba, size_t rowPitch,
+                            std::vector<uint8_t>& output) {
+    if (width == 0 || height == 0 || rgba == nullptr) {
+        std::cerr << "Cannot encode an empty PNG image" << std::endl;
+        return false;
+    }
+
+    size_t rowBytes = size_t(width) * 4;
+    if (rowPitch == 0) {
+        rowPitch = rowBytes;
+    }
+
+    // Each row is stored with its filter type byte, using the filter with
+    // the smallest residuals
+    std::vector<uint8_t> filtered(size_t(height) * (rowBytes + 1));
+    std::vector<uint8_t> candidate(rowBytes);
+    for (uint32_t y = 0; y < height; ++y) {
+        const uint8_t* row = rgba + size_t(y) * rowPitch;
+        const uint8_t* previous = y > 0 ? rgba + size_t(y - 1) * rowPitch : nullptr;
+        uint8_t* out = filtered.data() + size_t(y) * (rowBytes + 1);
+
+        uint64_t bestCost = UINT64_MAX;
+        for (uint8_t type = FILTER_NONE; type <= FILTER_PAETH; ++type) {
+            filterRow(type, row, previous, rowBytes, candidate.data());
+            uint64_t cost = filterCost(candidate.data(), rowBytes);
+            if (cost < bestCost) {
+                bestCost = cost;
+                out[0] = type;
+                std::memcpy(out + 1, candidate.data(), rowBytes);
+            }
+        }
+    }
+
+    std::vector<uint8_t> compressed;
+    Compression::compressZlib(std::as_bytes(std::span<const uint8_t>(filtered)), compressed);
+
+    // IHDR: 8-bit RGBA, deflate, adaptive filtering, no interlace
+    std::vector<uint8_t> header;
+    writeBigEndian32(header, width);
+    writeBigEndian32(header, height);
+    header.insert(header.end(), {8, 6, 0, 0, 0});
+
+    output.clear();
+    output.reserve(sizeof(PNG_SIGNATURE) + compressed.size() + 64);
+    output.insert(output.end(), PNG_SIGNATURE, PNG_SIGNATURE + sizeof(PNG_SIGNATURE));
+    writePngChunk(output, "IHDR", header.data(), header.size());
+    writePngChunk(output, "IDAT", compressed.data(), compressed.size());
+    writePngChunk(output, "IEND", nullptr, 0);
+    return true;
+}
+
+bool ImageWriter::encodeEXR(uint32_t width, uint32_t height, const void* rgba, size_t rowPitch,
+                            ExrPixelType pixelType, std::vector<uint8_t>& output) {
+    if (width == 0 || height == 0 || rgba == nullptr) {
+        std::cerr << "Cannot encode an empty EXR image" << std::endl;
+        return false;
+    }
+
+    size_t channelSize = pixelType == ExrPixelType::Half ? 2 : 4;
+    size_t pixelSize = channelSize * 4;
+    if (rowPitch == 0) {
+        rowPitch = size_t(width) * pixelSize;
+    }
+
+    output.clear();
+
+    // Magic number and version 2, single-part scanline
+    writeLittleEndian32(output, 20000630);
+    writeLittleEndian32(output, 2);
+
+    // Channels must be listed in alphabetical order
+    std::vector<uint8_t> channels;
+    for (const char* name : {"A", "B", "G", "R"}) {
+        channels.push_back(static_cast<uint8_t>(name[0]));
+        channels.push_back(0);
+        writeLittleEndian32(channels, static_cast<uint32_t>(pixelType == ExrPixelType::Half ? EXR_PIXEL_HALF : EXR_PIXEL_FLOAT));
+        channels.insert(channels.end(), {0, 0, 0, 0});  // pLinear, reserved
+        writeLittleEndian32(channels, 1);               // xSampling
+        writeLittleEndian32(channels, 1);               // ySampling
+    }
+    channels.push_back(0);
+
+    std::vector<uint8_t> window;
+    writeLittleEndian32(window, 0);
+    writeLittleEndian32(window, 0);
+    writeLittleEndian32(window, width - 1);
+    writeLittleEndian32(window, height - 1);
+
+    std::vector<uint8_t> one;
+    writeFloat(one, 1.0f);
+    std::vector<uint8_t> center;
+    writeFloat(center, 0.0f);
+    writeFloat(center, 0.0f);
+
+    writeExrAttribute(output, "channels", "chlist", channels);
+    writeExrAttribute(output, "compression", "compression", {0});
+    writeExrAttribute(output, "dataWindow", "box2i", window);
+    writeExrAttribute(output, "displayWindow", "box2i", window);
+    writeExrAttribute(output, "lineOrder", "lineOrder", {0});
+    writeExrAttribute(output, "pixelAspectRatio", "float", one);
+    writeExrAttribute(output, "screenWindowCenter", "v2f", center);
+    writeExrAttribute(output, "screenWindowWidth", "float", one);
+    output.push_back(0);
+
+    // Offset table, then one block per scanline: y, size, then each channel's
+    // samples for the whole row (A, B, G, R)
+    size_t lineBytes = size_t(width) * pixelSize;
+    size_t blockSize = 8 + lineBytes;
+    size_t tableStart = output.size();
+    size_t dataStart = tableStart + size_t(height) * 8;
+    output.reserve(dataStart + size_t(height) * blockSize);
+    for (uint32_t y = 0; y < height; ++y) {
+        writeLittleEndian64(output, dataStart + size_t(y) * blockSize);
+    }
+
+    static constexpr size_t CHANNEL_ORDER[4] = {3, 2, 1, 0};  // A, B, G, R from RGBA
+    const uint8_t* source = static_cast<const uint8_t*>(rgba);
+    for (uint32_t y = 0; y < height; ++y) {
+        writeLittleEndian32(output, y);
+        writeLittleEndian32(output, static_cast<uint32_t>(lineBytes));
+
+        const uint8_t* row = source + size_t(y) * rowPitch;
+        for (size_t channel : CHANNEL_ORDER) {
+            for (uint32_t x = 0; x < width; ++x) {
+                const uint8_t* sample = row + size_t(x) * pixelSize + channel * channelSize;
+                output.insert(output.end(), sample, sample + channelSize);
+            }
+        }
+    }
+    return true;
+}
+
+bool ImageWriter::writePNG(const std::string& path, uint32_t width, uint32_t height, const uint8_t* rgba,
+                           size_t rowPitch) {
+    std::vector<uint8_t> data;
+    return encodePNG(width, height, rgba, rowPitch, data) && writeFile(path, data);
+}
+
+bool ImageWriter::writeEXR(const std::string& path, uint32_t width, uint32_t height, const void* rgba,
+                           ExrPixelType pixelType, size_t rowPitch) {
+    std::vector<uint8_t> data;
+    return encodeEXR(width, height, rgba, rowPitch, pixelType, data) && writeFile(path, data);
+}
+
+bool ImageWriter::writeFile(const std::string& path, const std::vector<uint8_t>& data) {
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file) {
+        std::cerr << "Failed to open image file for writing: " << path << std::endl;
+        return false;
+    }
+
+    file.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
+    if (!file) {
+        std::cerr << "Failed to write image file: " << path << std::endl;
+        return false;
+    }
+    return true;
+}
+
+} // namespace VortexEngine
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace VortexEngine {
+
+// Channel type for EXR output
+enum class ExrPixelType {
+    Half,   // 16-bit float, written as-is (e.g. R16G16B16A16_SFLOAT readbacks)
+    Float   // 32-bit float
+};
+
+// Image file output for frame captures
+//
+// Both writers take tightly or loosely packed RGBA rows (rowPitch in bytes,
+// 0 for tightly packed), top row first, so a mapped readback buffer can be
+// passed directly. PNG output is 8-bit RGBA compressed with
+// Compression::compressZlib; EXR output is uncompressed scanline RGBA.
+class ImageWriter {
+public:
+    // Encoding to memory
+    static bool encodePNG(uint32_t width, uint32_t height, const uint8_t* rgba, size_t rowPitch,
+                          std::vector<uint8_t>& output);
+    static bool encodeEXR(uint32_t width, uint32_t height, const void* rgba, size_t rowPitch,
+                          ExrPixelType pixelType, std::vector<uint8_t>& output);
+
+    // Encoding to a file
+    static bool writePNG(const std::string& path, uint32_t width, uint32_t height, const uint8_t* rgba,
+                         size_t rowPitch = 0);
+    static bool writeEXR(const std::string& path, uint32_t width, uint32_t height, const void* rgba,
+                         ExrPixelType pixelType, size_t rowPitch = 0);
+
+private:
+    static bool writeFile(const std::string& path, const std::vector<uint8_t>& data);
+};
+
+} // namespace VortexEngine
@@ -1,51 +1,1149 @@
 #include "logger.h"
-#include <iostream>
-#include <chrono>
-#include <iomanip>
+#include <array>
+#include <cerrno>
+#include <cmath>
+#include <ctime>
+#include <deque>
+#include <unordered_map>
+
+#ifdef _WIN32
+#include <io.h>
+#include <fcntl.h>
+#define VORTEX_WRITE _write
+#define VORTEX_CLOSE _close
+#define VORTEX_ISATTY _isatty
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#define VORTEX_WRITE ::write
+#define VORTEX_CLOSE ::close
+#define VORTEX_ISATTY ::isatty
+#endif
 
 namespace VortexEngine {
-    Logger& Logger::getInstance() {
-        static Logger instance;
-        return instance;
-    }
-
-    void Logger::log(LogLevel level, const std::string& message) {
-        auto now = std::chrono::system_clock::now();
-        auto time_t = std::chrono::system_clock::to_time_t(now);
-        
-        std::cout << "[" << std::put_time(std::localtime(&time_t), "%H:%M:%S") << "] ";
-        
-        switch (level) {
-            case LogLevel::DEBUG:
-                std::cout << "[DEBUG] ";
-                break;
-            case LogLevel::INFO:
-                std::cout << "[INFO] ";
-                break;
-            case LogLevel::WARNING:
-                std::cout << "[WARNING] ";
+
+namespace {
+
+// Per-thread ring size in records (must be a power of two)
+constexpr size_t RING_CAPACITY = 1024;
+
+// Batches are written once they grow past this size
+constexpr size_t WRITE_BATCH_SIZE = 64 * 1024;
+
+// Upper bound on how long an idle writer sleeps between producer wakeups
+constexpr auto WRITER_IDLE_INTERVAL = std::chrono::milliseconds(250);
+
+// Relative tick-rate drift that warrants a new calibration entry in the binary log
+constexpr double CALIBRATION_DRIFT_THRESHOLD = 1e-4;
+
+// Single-producer/single-consumer ring owned by one logging thread
+struct ThreadLogRing {
+    alignas(64) std::atomic<uint64_t> head{0};     // Written by the owning thread
+    uint64_t cachedTail = 0;                        // Owning thread's view of tail
+    alignas(64) std::atomic<uint64_t> tail{0};     // Written by the consumer
+    std::atomic<bool> retired{false};
+    std::unique_ptr<LogRecord[]> records{new LogRecord[RING_CAPACITY]};
+};
+
+struct RingRegistry {
+    std::mutex mutex;
+    std::vector<std::shared_ptr<ThreadLogRing>> rings;
+};
+
+// The registries are never destroyed: the writer thread may still be draining
+// when static destructors run if the logger was not shut down before exit
+RingRegistry& getRingRegistry() {
+    static RingRegistry* registry = new RingRegistry();
+    return *registry;
+}
+
+// Keeps the ring alive until the consumer has drained it after thread exit
+struct ThreadRingHandle {
+    std::shared_ptr<ThreadLogRing> ring;
+
+    ~ThreadRingHandle() {
+        if (ring) {
+            ring->retired.store(true, std::memory_order_release);
+        }
+    }
+};
+
+thread_local ThreadLogRing* t_ring = nullptr;
+thread_local ThreadRingHandle t_ringHandle;
+
+ThreadLogRing* getThreadRing() {
+    if (!t_ring) {
+        auto ring = std::make_shared<ThreadLogRing>();
+        RingRegistry& registry = getRingRegistry();
+        {
+            std::lock_guard<std::mutex> lock(registry.mutex);
+            registry.rings.push_back(ring);
+        }
+        t_ringHandle.ring = ring;
+        t_ring = ring.get();
+    }
+
+    return t_ring;
+}
+
+// True if any registered ring holds records the writer has not consumed
+bool hasPendingRecords() {
+    RingRegistry& registry = getRingRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    for (const auto& ring : registry.rings) {
+        if (ring->tail.load(std::memory_order_relaxed) != ring->head.load(std::memory_order_seq_cst)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Call site registry
+//
+// Locations live in fixed chunks that never move, so the writer thread can
+// read any published id without taking the lock.
+constexpr size_t SOURCE_CHUNK_SIZE = 256;
+constexpr size_t SOURCE_CHUNK_COUNT = 256;
+
+struct SourceRegistry {
+    std::mutex mutex;
+    std::array<std::unique_ptr<SourceLocation[]>, SOURCE_CHUNK_COUNT> chunks;
+    std::atomic<uint32_t> count{0};
+    std::unordered_map<std::string, uint32_t> ids;   // String API sites by "file:line"
+    std::deque<std::string> ownedStrings;
+};
+
+SourceRegistry& getSourceRegistry() {
+    static SourceRegistry* registry = new SourceRegistry();
+    return *registry;
+}
+
+// Every call appends a new id: the macros call this once per site through a
+// function-local static, so two statements on one line stay distinct
+uint32_t registerLocation(SourceRegistry& registry, const char* file, uint32_t line, const char* function, const char* format) {
+    // Caller holds registry.mutex
+    uint32_t id = registry.count.load(std::memory_order_relaxed);
+    if (id >= SOURCE_CHUNK_SIZE * SOURCE_CHUNK_COUNT) {
+        // Registry full; report against the first site rather than fail
+        return 0;
+    }
+
+    auto& chunk = registry.chunks[id / SOURCE_CHUNK_SIZE];
+    if (!chunk) {
+        chunk.reset(new SourceLocation[SOURCE_CHUNK_SIZE]);
+    }
+    chunk[id % SOURCE_CHUNK_SIZE] = SourceLocation{file, function, format ? format : "{}", line};
+
+    registry.count.store(id + 1, std::memory_order_release);
+    return id;
+}
+
+const char* getLevelColorCode(LogLevel level) {
+    switch (level) {
+        case LogLevel::Trace: return LogColors::White;
+        case LogLevel::Debug: return LogColors::Cyan;
+        case LogLevel::Info: return LogColors::Green;
+        case LogLevel::Warning: return LogColors::Yellow;
+        case LogLevel::Error: return LogColors::Red;
+        case LogLevel::Critical: return LogColors::BrightRed;
+        default: return LogColors::Reset;
+    }
+}
+
+std::string_view getFileName(std::string_view path) {
+    size_t slash = path.find_last_of("/\\");
+    return slash == std::string_view::npos ? path : path.substr(slash + 1);
+}
+
+void appendTimestamp(std::string& out, std::chrono::system_clock::time_point time) {
+    std::time_t seconds = std::chrono::system_clock::to_time_t(time);
+    auto milliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(time.time_since_epoch()).count() % 1000;
+
+    std::tm localTime{};
+#ifdef _WIN32
+    localtime_s(&localTime, &seconds);
+#else
+    localtime_r(&seconds, &localTime);
+#endif
+
+    char buffer[32];
+    size_t length = std::strftime(buffer, sizeof(buffer), "%H:%M:%S", &localTime);
+    out.append(buffer, length);
+
+    char millis[8];
+    std::snprintf(millis, sizeof(millis), ".%03d", static_cast<int>(milliseconds));
+    out.append(millis);
+}
+
+// Expands %timestamp, %level, %source, %message, %thread, %file, %line and %function
+void appendPattern(std::string& out, const std::string& pattern, std::string_view timestamp, LogLevel level,
+                   std::string_view file, uint32_t line, std::string_view function, uint32_t threadId,
+                   std::string_view message) {
+    struct Token {
+        std::string_view name;
+        int field;
+    };
+    static constexpr Token tokens[] = {
+        {"%timestamp", 0}, {"%level", 1}, {"%source", 2}, {"%message", 3},
+        {"%thread", 4}, {"%file", 5}, {"%line", 6}, {"%function", 7},
+    };
+
+    std::string_view rest(pattern);
+    while (!rest.empty()) {
+        size_t percent = rest.find('%');
+        out.append(rest.substr(0, percent));
+        if (percent == std::string_view::npos) {
+            break;
+        }
+        rest.remove_prefix(percent);
+
+        const Token* match = nullptr;
+        for (const Token& token : tokens) {
+            if (rest.substr(0, token.name.size()) == token.name) {
+                match = &token;
                 break;
-            case LogLevel::ERROR:
-                std::cout << "[ERROR] ";
+            }
+        }
+
+        if (!match) {
+            out.push_back('%');
+            rest.remove_prefix(1);
+            continue;
+        }
+
+        switch (match->field) {
+            case 0: out.append(timestamp); break;
+            case 1: out.append(Logger::levelToString(level)); break;
+            case 2:
+                out.append(getFileName(file));
+                if (line > 0) {
+                    out.push_back(':');
+                    out.append(std::to_string(line));
+                }
                 break;
+            case 3: out.append(message); break;
+            case 4: out.append(std::to_string(threadId)); break;
+            case 5: out.append(file); break;
+            case 6: out.append(std::to_string(line)); break;
+            case 7: out.append(function); break;
         }
-        
-        std::cout << message << std::endl;
+        rest.remove_prefix(match->name.size());
+    }
+}
+
+template<typename T>
+void appendBinary(std::string& out, const T& value) {
+    out.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+void appendBinaryString(std::string& out, std::string_view text) {
+    uint16_t length = static_cast<uint16_t>(std::min<size_t>(text.size(), UINT16_MAX));
+    appendBinary(out, length);
+    out.append(text.data(), length);
+}
+
+std::string formatLogMessage(const std::string& pattern, const LogMessage& message) {
+    std::string out;
+    appendPattern(out, pattern, message.timestamp, message.level, message.file, message.line,
+                  message.function, message.threadId, message.message);
+    return out;
+}
+
+} // namespace
+
+// ConsoleLogger implementation
+ConsoleLogger::ConsoleLogger() = default;
+
+ConsoleLogger::~ConsoleLogger() {
+    std::cout.flush();
+}
+
+void ConsoleLogger::log(const LogMessage& message) {
+    if (message.level < m_logLevel) {
+        return;
+    }
+
+    if (m_colorsEnabled) {
+        std::cout << getLevelColor(message.level) << formatMessage(message) << LogColors::Reset << '\n';
+    } else {
+        std::cout << formatMessage(message) << '\n';
+    }
+
+    if (m_flushAfterLog) {
+        std::cout.flush();
+    }
+}
+
+std::string ConsoleLogger::getLevelColor(LogLevel level) const {
+    return getLevelColorCode(level);
+}
+
+std::string ConsoleLogger::formatMessage(const LogMessage& message) const {
+    return formatLogMessage(m_pattern, message);
+}
+
+// FileLogger implementation
+FileLogger::FileLogger() = default;
+
+FileLogger::~FileLogger() {
+    closeFile();
+}
+
+void FileLogger::log(const LogMessage& message) {
+    if (message.level < m_logLevel || !m_fileStream.is_open()) {
+        return;
+    }
+
+    m_fileStream << formatMessage(message) << '\n';
+
+    if (m_rotationEnabled && shouldRotate()) {
+        rotateFile();
+    }
+}
+
+bool FileLogger::openFile(const std::string& filename) {
+    closeFile();
+
+    m_fileStream.open(filename, std::ios::out | std::ios::app);
+    if (!m_fileStream.is_open()) {
+        std::cerr << "Failed to open log file: " << filename << std::endl;
+        return false;
     }
 
-    void Logger::debug(const std::string& message) {
-        log(LogLevel::DEBUG, message);
+    m_filename = filename;
+    return true;
+}
+
+void FileLogger::closeFile() {
+    if (m_fileStream.is_open()) {
+        m_fileStream.flush();
+        m_fileStream.close();
+    }
+}
+
+bool FileLogger::shouldRotate() const {
+    // tellp is non-const on ofstream
+    auto& stream = const_cast<std::ofstream&>(m_fileStream);
+    auto position = stream.tellp();
+    return position >= 0 && static_cast<size_t>(position) >= m_maxFileSize;
+}
+
+void FileLogger::rotateFile() {
+    closeFile();
+
+    for (size_t i = m_rotationCount; i > 1; --i) {
+        std::string from = m_filename + "." + std::to_string(i - 1);
+        std::string to = m_filename + "." + std::to_string(i);
+        std::rename(from.c_str(), to.c_str());
+    }
+    if (m_rotationCount > 0) {
+        std::rename(m_filename.c_str(), (m_filename + ".1").c_str());
+    }
+
+    m_fileStream.open(m_filename, std::ios::out | std::ios::trunc);
+}
+
+std::string FileLogger::getTimestamp() const {
+    return Logger::getCurrentTimestamp();
+}
+
+std::string FileLogger::formatMessage(const LogMessage& message) const {
+    return formatLogMessage(m_pattern, message);
+}
+
+// MultiLogger implementation
+MultiLogger::MultiLogger() = default;
+MultiLogger::~MultiLogger() = default;
+
+void MultiLogger::log(const LogMessage& message) {
+    if (message.level < m_logLevel) {
+        return;
     }
 
-    void Logger::info(const std::string& message) {
-        log(LogLevel::INFO, message);
+    for (auto& logger : m_loggers) {
+        logger->log(message);
     }
+}
 
-    void Logger::warning(const std::string& message) {
-        log(LogLevel::WARNING, message);
+void MultiLogger::setLogLevel(LogLevel level) {
+    m_logLevel = level;
+    for (auto& logger : m_loggers) {
+        logger->setLogLevel(level);
     }
+}
+
+void MultiLogger::setPattern(const std::string& pattern) {
+    m_pattern = pattern;
+    for (auto& logger : m_loggers) {
+        logger->setPattern(pattern);
+    }
+}
+
+void MultiLogger::addLogger(std::shared_ptr<ILogger> logger) {
+    if (logger) {
+        m_loggers.push_back(std::move(logger));
+    }
+}
+
+void MultiLogger::removeLogger(std::shared_ptr<ILogger> logger) {
+    m_loggers.erase(std::remove(m_loggers.begin(), m_loggers.end(), logger), m_loggers.end());
+}
+
+void MultiLogger::clearLoggers() {
+    m_loggers.clear();
+}
+
+// Logger implementation
+Logger::Logger() = default;
+
+Logger::~Logger() {
+    shutdown();
+}
+
+bool Logger::initialize() {
+    if (m_initialized) {
+        return true;
+    }
+
+    m_consoleColors = VORTEX_ISATTY(1) != 0;
+
+    // Sample both clocks over a short interval for the initial tick rate;
+    // the writer thread keeps refining it
+    m_startTicks = readLogTimestamp();
+    m_startSteady = std::chrono::steady_clock::now();
+    m_startSystem = std::chrono::system_clock::now();
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    calibrateTimestamps();
+
+    m_stopRequested = false;
+    try {
+        m_writerThread = std::thread(&Logger::writerThreadMain, this);
+    }
+    catch (const std::system_error& e) {
+        std::cerr << "Failed to start log writer thread: " << e.what() << std::endl;
+        return false;
+    }
+
+    m_writerRunning.store(true, std::memory_order_release);
+    m_initialized = true;
+    return true;
+}
 
-    void Logger::error(const std::string& message) {
-        log(LogLevel::ERROR, message);
+void Logger::shutdown() {
+    if (!m_initialized) {
+        return;
     }
-}
\ No newline at end of file
+
+    // New records fall back to synchronous output from here on
+    m_writerRunning.store(false, std::memory_order_release);
+
+    {
+        std::lock_guard<std::mutex> lock(m_writerMutex);
+        m_stopRequested = true;
+    }
+    m_writerWakeup.notify_all();
+
+    if (m_writerThread.joinable()) {
+        m_writerThread.join();
+    }
+
+    // Records committed while the writer was stopping
+    flush();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_fileDescriptor >= 0) {
+        VORTEX_CLOSE(m_fileDescriptor);
+        m_fileDescriptor = -1;
+    }
+    if (m_binaryFileDescriptor >= 0) {
+        VORTEX_CLOSE(m_binaryFileDescriptor);
+        m_binaryFileDescriptor = -1;
+    }
+
+    m_initialized = false;
+}
+
+void Logger::trace(const std::string& message, const std::string& source, uint32_t line, const std::string& file, const std::string& function) {
+    logInternal(LogLevel::Trace, message, source, line, file, function);
+}
+
+void Logger::debug(const std::string& message, const std::string& source, uint32_t line, const std::string& file, const std::string& function) {
+    logInternal(LogLevel::Debug, message, source, line, file, function);
+}
+
+void Logger::info(const std::string& message, const std::string& source, uint32_t line, const std::string& file, const std::string& function) {
+    logInternal(LogLevel::Info, message, source, line, file, function);
+}
+
+void Logger::warning(const std::string& message, const std::string& source, uint32_t line, const std::string& file, const std::string& function) {
+    logInternal(LogLevel::Warning, message, source, line, file, function);
+}
+
+void Logger::error(const std::string& message, const std::string& source, uint32_t line, const std::string& file, const std::string& function) {
+    logInternal(LogLevel::Error, message, source, line, file, function);
+}
+
+void Logger::critical(const std::string& message, const std::string& source, uint32_t line, const std::string& file, const std::string& function) {
+    logInternal(LogLevel::Critical, message, source, line, file, function);
+}
+
+void Logger::setLogLevel(LogLevel level) {
+    m_logLevel.store(level, std::memory_order_relaxed);
+}
+
+void Logger::setPattern(const std::string& pattern) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_pattern = pattern;
+}
+
+void Logger::addConsoleLogger() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_consoleOutput = true;
+}
+
+void Logger::addFileLogger(const std::string& filename) {
+#ifdef _WIN32
+    int fileDescriptor = _open(filename.c_str(), _O_WRONLY | _O_CREAT | _O_APPEND, 0644);
+#else
+    int fileDescriptor = ::open(filename.c_str(), O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0644);
+#endif
+    if (fileDescriptor < 0) {
+        std::cerr << "Failed to open log file: " << filename << std::endl;
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_fileDescriptor >= 0) {
+        VORTEX_CLOSE(m_fileDescriptor);
+    }
+    m_fileDescriptor = fileDescriptor;
+}
+
+bool Logger::addBinaryLogger(const std::string& filename) {
+#ifdef _WIN32
+    int fileDescriptor = _open(filename.c_str(), _O_WRONLY | _O_CREAT | _O_TRUNC | _O_BINARY, 0644);
+#else
+    int fileDescriptor = ::open(filename.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+#endif
+    if (fileDescriptor < 0) {
+        std::cerr << "Failed to open binary log file: " << filename << std::endl;
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_binaryFileDescriptor >= 0) {
+        VORTEX_CLOSE(m_binaryFileDescriptor);
+    }
+    m_binaryFileDescriptor = fileDescriptor;
+    m_binarySourcesWritten.clear();
+
+    std::string header(BinaryLog::MAGIC, sizeof(BinaryLog::MAGIC));
+    appendBinary(header, BinaryLog::VERSION);
+    appendBinaryCalibration(header);
+    writeBatch(m_binaryFileDescriptor, header);
+    return true;
+}
+
+void Logger::setConsoleOutput(bool enable) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_consoleOutput = enable;
+}
+
+void Logger::addMultiLogger() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_logger = std::make_shared<MultiLogger>();
+}
+
+void Logger::setLogger(std::shared_ptr<ILogger> logger) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_logger = std::move(logger);
+}
+
+void Logger::flush() {
+    if (m_writerRunning.load(std::memory_order_acquire)) {
+        // Two full passes guarantee every record committed before this call
+        // has been written
+        std::unique_lock<std::mutex> lock(m_writerMutex);
+        uint64_t target = m_passCount + 2;
+        m_writerWakeup.notify_all();
+        m_passCompleted.wait(lock, [this, target] {
+            return m_passCount >= target || !m_writerRunning.load(std::memory_order_acquire);
+        });
+        return;
+    }
+
+    // No writer thread - drain on the calling thread
+    std::lock_guard<std::mutex> lock(m_writerMutex);
+    if (m_writerThread.joinable()) {
+        return;
+    }
+
+    std::string consoleBatch;
+    std::string fileBatch;
+    drainRings(consoleBatch, fileBatch);
+}
+
+LogRecord* Logger::beginRecord(uint32_t sourceId, LogLevel level) {
+    if (!m_writerRunning.load(std::memory_order_relaxed)) {
+        return nullptr;
+    }
+
+    ThreadLogRing* ring = getThreadRing();
+    uint64_t head = ring->head.load(std::memory_order_relaxed);
+    if (head - ring->cachedTail >= RING_CAPACITY) {
+        ring->cachedTail = ring->tail.load(std::memory_order_acquire);
+        if (head - ring->cachedTail >= RING_CAPACITY) {
+            m_droppedRecords.fetch_add(1, std::memory_order_relaxed);
+            return nullptr;
+        }
+    }
+
+    static thread_local uint32_t threadId = getCurrentThreadId();
+
+    LogRecord* record = &ring->records[head & (RING_CAPACITY - 1)];
+    record->timestamp = readLogTimestamp();
+    record->sourceId = sourceId;
+    record->threadId = threadId;
+    record->level = level;
+    record->length = 0;
+    record->flags = 0;
+    return record;
+}
+
+void Logger::commitRecord(LogRecord* record) {
+    ThreadLogRing* ring = t_ring;
+    ring->head.store(ring->head.load(std::memory_order_relaxed) + 1, std::memory_order_seq_cst);
+
+    if (record->level >= LogLevel::Critical) {
+        flush();
+        return;
+    }
+
+    // Pairs with the writer publishing m_writerSleeping before its final
+    // emptiness check, so either it sees this record or we see it asleep
+    if (m_writerSleeping.load(std::memory_order_seq_cst)) {
+        {
+            std::lock_guard<std::mutex> lock(m_writerMutex);
+            m_writerSleeping.store(false, std::memory_order_relaxed);
+        }
+        m_writerWakeup.notify_one();
+    }
+}
+
+void Logger::writeRecordNow(const LogRecord& record) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (m_logger) {
+        SourceLocation location = getSourceLocation(record.sourceId);
+        std::string text;
+        formatArguments(text, location.format, record.data, record.length, record.flags & LOG_RECORD_TRUNCATED);
+        m_logger->log(createLogMessage(record.level, text, location.file,
+                                       location.line, location.file, location.function));
+        return;
+    }
+
+    if (m_binaryFileDescriptor >= 0) {
+        appendBinaryRecord(record, m_binaryBatch);
+        writeBatch(m_binaryFileDescriptor, m_binaryBatch);
+    }
+
+    std::string line;
+    formatRecord(record, line, m_consoleColors && m_consoleOutput);
+    if (m_consoleOutput) {
+        writeBatch(1, line);
+    }
+    if (m_fileDescriptor >= 0) {
+        formatRecord(record, line, false);
+        writeBatch(m_fileDescriptor, line);
+    }
+}
+
+uint32_t Logger::registerSourceLocation(const char* file, uint32_t line, const char* function, const char* format) {
+    SourceRegistry& registry = getSourceRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    return registerLocation(registry, file, line, function, format);
+}
+
+SourceLocation Logger::getSourceLocation(uint32_t sourceId) {
+    SourceRegistry& registry = getSourceRegistry();
+    if (sourceId >= registry.count.load(std::memory_order_acquire)) {
+        return SourceLocation{};
+    }
+
+    return registry.chunks[sourceId / SOURCE_CHUNK_SIZE][sourceId % SOURCE_CHUNK_SIZE];
+}
+
+Logger& Logger::getInstance() {
+    static Logger instance;
+    return instance;
+}
+
+void Logger::initializeSingleton() {
+    getInstance().initialize();
+}
+
+void Logger::shutdownSingleton() {
+    getInstance().shutdown();
+}
+
+std::string Logger::levelToString(LogLevel level) {
+    switch (level) {
+        case LogLevel::Trace: return "TRACE";
+        case LogLevel::Debug: return "DEBUG";
+        case LogLevel::Info: return "INFO";
+        case LogLevel::Warning: return "WARNING";
+        case LogLevel::Error: return "ERROR";
+        case LogLevel::Critical: return "CRITICAL";
+        case LogLevel::Off: return "OFF";
+    }
+    return "UNKNOWN";
+}
+
+LogLevel Logger::stringToLevel(const std::string& level) {
+    if (level == "TRACE" || level == "trace") return LogLevel::Trace;
+    if (level == "DEBUG" || level == "debug") return LogLevel::Debug;
+    if (level == "INFO" || level == "info") return LogLevel::Info;
+    if (level == "WARNING" || level == "warning") return LogLevel::Warning;
+    if (level == "ERROR" || level == "error") return LogLevel::Error;
+    if (level == "CRITICAL" || level == "critical") return LogLevel::Critical;
+    if (level == "OFF" || level == "off") return LogLevel::Off;
+    return LogLevel::Info;
+}
+
+std::string Logger::getCurrentTimestamp() {
+    std::string timestamp;
+    appendTimestamp(timestamp, std::chrono::system_clock::now());
+    return timestamp;
+}
+
+uint32_t Logger::getCurrentThreadId() {
+    static std::atomic<uint32_t> nextThreadId{1};
+    static thread_local uint32_t threadId = nextThreadId.fetch_add(1, std::memory_order_relaxed);
+    return threadId;
+}
+
+void Logger::logInternal(LogLevel level, const std::string& message, const std::string& source, uint32_t line, const std::string& file, const std::string& function) {
+    if (!isEnabled(level)) {
+        return;
+    }
+
+    // The string API has no static call-site storage; intern copies once per site
+    uint32_t sourceId;
+    {
+        SourceRegistry& registry = getSourceRegistry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        const std::string& sourceFile = source.empty() ? file : source;
+        std::string key = sourceFile + ":" + std::to_string(line);
+        auto it = registry.ids.find(key);
+        if (it != registry.ids.end()) {
+            sourceId = it->second;
+        } else {
+            const char* filePtr = registry.ownedStrings.emplace_back(sourceFile).c_str();
+            const char* functionPtr = registry.ownedStrings.emplace_back(function.empty() ? file : function).c_str();
+            sourceId = registerLocation(registry, filePtr, line, functionPtr, "{}");
+            registry.ids.emplace(std::move(key), sourceId);
+        }
+    }
+
+    LogRecordWriter writer(sourceId, level);
+    writer.write(message);
+}
+
+LogMessage Logger::createLogMessage(LogLevel level, const std::string& message, const std::string& source, uint32_t line, const std::string& file, const std::string& function) const {
+    LogMessage logMessage;
+    logMessage.level = level;
+    logMessage.message = message;
+    logMessage.timestamp = getCurrentTimestamp();
+    logMessage.source = source;
+    logMessage.threadId = getCurrentThreadId();
+    logMessage.line = line;
+    logMessage.file = file;
+    logMessage.function = function;
+    return logMessage;
+}
+
+std::string Logger::formatTimestamp(const std::string& timestamp) const {
+    return "[" + timestamp + "]";
+}
+
+void Logger::writerThreadMain() {
+    std::string consoleBatch;
+    std::string fileBatch;
+    consoleBatch.reserve(WRITE_BATCH_SIZE * 2);
+    fileBatch.reserve(WRITE_BATCH_SIZE * 2);
+
+    while (true) {
+        bool stopping;
+        {
+            std::lock_guard<std::mutex> lock(m_writerMutex);
+            stopping = m_stopRequested;
+        }
+
+        calibrateTimestamps();
+        size_t drained = drainRings(consoleBatch, fileBatch);
+
+        {
+            std::lock_guard<std::mutex> lock(m_writerMutex);
+            m_passCount++;
+        }
+        m_passCompleted.notify_all();
+
+        if (stopping && drained == 0) {
+            break;
+        }
+
+        if (drained == 0) {
+            std::unique_lock<std::mutex> lock(m_writerMutex);
+            m_writerSleeping.store(true, std::memory_order_seq_cst);
+            if (!m_stopRequested && !hasPendingRecords()) {
+                m_writerWakeup.wait_for(lock, WRITER_IDLE_INTERVAL);
+            }
+            m_writerSleeping.store(false, std::memory_order_relaxed);
+        }
+    }
+
+    m_passCompleted.notify_all();
+}
+
+size_t Logger::drainRings(std::string& consoleBatch, std::string& fileBatch) {
+    std::vector<std::shared_ptr<ThreadLogRing>> rings;
+    {
+        RingRegistry& registry = getRingRegistry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+
+        // Drop rings of exited threads once they are empty
+        registry.rings.erase(std::remove_if(registry.rings.begin(), registry.rings.end(), [](const auto& ring) {
+            return ring->retired.load(std::memory_order_acquire) &&
+                   ring->tail.load(std::memory_order_relaxed) == ring->head.load(std::memory_order_acquire);
+        }), registry.rings.end());
+
+        rings = registry.rings;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    size_t drained = 0;
+    bool calibrationChecked = false;
+
+    for (auto& ring : rings) {
+        uint64_t tail = ring->tail.load(std::memory_order_relaxed);
+        uint64_t head = ring->head.load(std::memory_order_acquire);
+
+        for (; tail != head; ++tail) {
+            const LogRecord& record = ring->records[tail & (RING_CAPACITY - 1)];
+
+            if (m_binaryFileDescriptor >= 0) {
+                // Only re-emit calibration ahead of real records, and only once
+                // the measured tick rate has actually drifted
+                if (!calibrationChecked) {
+                    double drift = std::abs(m_nanosecondsPerTick - m_binaryNanosecondsPerTick);
+                    if (drift > m_binaryNanosecondsPerTick * CALIBRATION_DRIFT_THRESHOLD) {
+                        appendBinaryCalibration(m_binaryBatch);
+                    }
+                    calibrationChecked = true;
+                }
+                appendBinaryRecord(record, m_binaryBatch);
+                if (m_binaryBatch.size() >= WRITE_BATCH_SIZE) {
+                    writeBatch(m_binaryFileDescriptor, m_binaryBatch);
+                }
+            }
+
+            if (m_logger) {
+                SourceLocation location = getSourceLocation(record.sourceId);
+                std::string text;
+                formatArguments(text, location.format, record.data, record.length, record.flags & LOG_RECORD_TRUNCATED);
+                LogMessage message = createLogMessage(record.level, text,
+                                                      location.file, location.line, location.file, location.function);
+                message.threadId = record.threadId;
+                message.timestamp.clear();
+                appendTimestamp(message.timestamp, ticksToTime(record.timestamp));
+                m_logger->log(message);
+            } else {
+                if (m_consoleOutput) {
+                    formatRecord(record, consoleBatch, m_consoleColors);
+                }
+                if (m_fileDescriptor >= 0) {
+                    formatRecord(record, fileBatch, false);
+                }
+            }
+            drained++;
+
+            if (consoleBatch.size() >= WRITE_BATCH_SIZE) {
+                writeBatch(1, consoleBatch);
+            }
+            if (fileBatch.size() >= WRITE_BATCH_SIZE) {
+                writeBatch(m_fileDescriptor, fileBatch);
+            }
+        }
+
+        ring->tail.store(tail, std::memory_order_release);
+    }
+
+    if (!consoleBatch.empty()) {
+        writeBatch(1, consoleBatch);
+    }
+    if (!fileBatch.empty()) {
+        writeBatch(m_fileDescriptor, fileBatch);
+    }
+    if (!m_binaryBatch.empty()) {
+        writeBatch(m_binaryFileDescriptor, m_binaryBatch);
+    }
+
+    return drained;
+}
+
+void Logger::formatRecord(const LogRecord& record, std::string& out, bool colors) {
+    SourceLocation location = getSourceLocation(record.sourceId);
+
+    m_messageScratch.clear();
+    formatArguments(m_messageScratch, location.format, record.data, record.length, record.flags & LOG_RECORD_TRUNCATED);
+
+    std::string timestamp;
+    if (m_initialized) {
+        appendTimestamp(timestamp, ticksToTime(record.timestamp));
+    } else {
+        appendTimestamp(timestamp, std::chrono::system_clock::now());
+    }
+
+    if (colors) {
+        out.append(getLevelColorCode(record.level));
+    }
+
+    appendPattern(out, m_pattern, timestamp, record.level, location.file, location.line, location.function,
+                  record.threadId, m_messageScratch);
+
+    if (colors) {
+        out.append(LogColors::Reset);
+    }
+    out.push_back('\n');
+}
+
+void Logger::writeBatch(int fileDescriptor, std::string& batch) {
+    const char* data = batch.data();
+    size_t remaining = batch.size();
+
+    while (remaining > 0 && fileDescriptor >= 0) {
+        auto written = VORTEX_WRITE(fileDescriptor, data, static_cast<unsigned int>(remaining));
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            break;
+        }
+        data += written;
+        remaining -= static_cast<size_t>(written);
+    }
+
+    batch.clear();
+}
+
+void Logger::appendBinaryRecord(const LogRecord& record, std::string& out) {
+    if (record.sourceId >= m_binarySourcesWritten.size()) {
+        m_binarySourcesWritten.resize(record.sourceId + 1, false);
+    }
+
+    if (!m_binarySourcesWritten[record.sourceId]) {
+        SourceLocation location = getSourceLocation(record.sourceId);
+        appendBinary(out, BinaryLog::EntryType::Source);
+        appendBinary(out, record.sourceId);
+        appendBinary(out, location.line);
+        appendBinaryString(out, location.file);
+        appendBinaryString(out, location.function);
+        appendBinaryString(out, location.format);
+        m_binarySourcesWritten[record.sourceId] = true;
+    }
+
+    appendBinary(out, BinaryLog::EntryType::Record);
+    appendBinary(out, record.timestamp);
+    appendBinary(out, record.sourceId);
+    appendBinary(out, record.threadId);
+    appendBinary(out, record.level);
+    appendBinary(out, record.flags);
+    appendBinary(out, record.length);
+    out.append(record.data, record.length);
+}
+
+void Logger::appendBinaryCalibration(std::string& out) {
+    int64_t startSystem = std::chrono::duration_cast<std::chrono::nanoseconds>(m_startSystem.time_since_epoch()).count();
+
+    appendBinary(out, BinaryLog::EntryType::Calibration);
+    appendBinary(out, m_startTicks);
+    appendBinary(out, startSystem);
+    appendBinary(out, m_nanosecondsPerTick);
+    m_binaryNanosecondsPerTick = m_nanosecondsPerTick;
+}
+
+void Logger::calibrateTimestamps() {
+    uint64_t ticks = readLogTimestamp();
+    auto steady = std::chrono::steady_clock::now();
+
+    if (ticks <= m_startTicks) {
+        return;
+    }
+
+    double elapsedNanoseconds = std::chrono::duration<double, std::nano>(steady - m_startSteady).count();
+    if (elapsedNanoseconds > 0.0) {
+        m_nanosecondsPerTick = elapsedNanoseconds / static_cast<double>(ticks - m_startTicks);
+    }
+}
+
+std::chrono::system_clock::time_point Logger::ticksToTime(uint64_t ticks) const {
+    double offset = static_cast<double>(static_cast<int64_t>(ticks - m_startTicks)) * m_nanosecondsPerTick;
+    return m_startSystem + std::chrono::duration_cast<std::chrono::system_clock::duration>(
+        std::chrono::duration<double, std::nano>(offset));
+}
+
+void Logger::formatArguments(std::string& out, std::string_view format, const char* data, size_t length, bool truncated) {
+    const char* cursor = data;
+    const char* end = data + length;
+
+    for (size_t i = 0; i < format.size(); ++i) {
+        char c = format[i];
+
+        if (c == '{' && i + 1 < format.size() && format[i + 1] == '{') {
+            out.push_back('{');
+            ++i;
+            continue;
+        }
+        if (c == '}' && i + 1 < format.size() && format[i + 1] == '}') {
+            out.push_back('}');
+            ++i;
+            continue;
+        }
+        if (c != '{') {
+            out.push_back(c);
+            continue;
+        }
+
+        size_t close = format.find('}', i);
+        if (close == std::string_view::npos) {
+            out.append(format.substr(i));
+            break;
+        }
+
+        // Optional spec after ':' - ".N" (precision) and "x" (hex) are understood
+        std::string_view spec = format.substr(i + 1, close - i - 1);
+        if (!spec.empty() && spec.front() == ':') {
+            spec.remove_prefix(1);
+        }
+        i = close;
+
+        if (cursor >= end) {
+            // Missing argument (dropped by truncation)
+            out.append("{?}");
+            continue;
+        }
+
+        auto type = static_cast<LogArgType>(*cursor++);
+        size_t remaining = static_cast<size_t>(end - cursor);
+        char buffer[64];
+        std::to_chars_result result{buffer, std::errc()};
+
+        // Every payload read is checked against what is left of the record;
+        // a short payload marks the record malformed and stops decoding
+        auto malformed = [&]() {
+            out.append("{malformed}");
+            cursor = end;
+        };
+
+        switch (type) {
+            case LogArgType::Int: {
+                int64_t value;
+                if (remaining < sizeof(value)) {
+                    malformed();
+                    continue;
+                }
+                std::memcpy(&value, cursor, sizeof(value));
+                cursor += sizeof(value);
+                result = std::to_chars(buffer, buffer + sizeof(buffer), value, spec == "x" ? 16 : 10);
+                break;
+            }
+            case LogArgType::UInt:
+            case LogArgType::Pointer: {
+                uint64_t value;
+                if (remaining < sizeof(value)) {
+                    malformed();
+                    continue;
+                }
+                std::memcpy(&value, cursor, sizeof(value));
+                cursor += sizeof(value);
+                bool hex = type == LogArgType::Pointer || spec == "x";
+                if (type == LogArgType::Pointer) {
+                    out.append("0x");
+                }
+                result = std::to_chars(buffer, buffer + sizeof(buffer), value, hex ? 16 : 10);
+                break;
+            }
+            case LogArgType::Double: {
+                double value;
+                if (remaining < sizeof(value)) {
+                    malformed();
+                    continue;
+                }
+                std::memcpy(&value, cursor, sizeof(value));
+                cursor += sizeof(value);
+                int precision = -1;
+                if (spec.size() >= 2 && spec.front() == '.') {
+                    std::from_chars(spec.data() + 1, spec.data() + spec.size(), precision);
+                }
+                result = precision >= 0
+                    ? std::to_chars(buffer, buffer + sizeof(buffer), value, std::chars_format::fixed, precision)
+                    : std::to_chars(buffer, buffer + sizeof(buffer), value);
+                break;
+            }
+            case LogArgType::Bool:
+                if (remaining < 1) {
+                    malformed();
+                    continue;
+                }
+                out.append(*cursor++ ? "true" : "false");
+                continue;
+            case LogArgType::Char:
+                if (remaining < 1) {
+                    malformed();
+                    continue;
+                }
+                out.push_back(*cursor++);
+                continue;
+            case LogArgType::String: {
+                uint16_t size;
+                if (remaining < sizeof(size)) {
+                    malformed();
+                    continue;
+                }
+                std::memcpy(&size, cursor, sizeof(size));
+                cursor += sizeof(size);
+                if (size > static_cast<size_t>(end - cursor)) {
+                    malformed();
+                    continue;
+                }
+                out.append(cursor, size);
+                cursor += size;
+                continue;
+            }
+            default:
+                malformed();
+                continue;
+        }
+
+        if (result.ec == std::errc()) {
+            out.append(buffer, result.ptr);
+        }
+    }
+
+    if (truncated) {
+        out.append(" [truncated]");
+    }
+}
+
+// ScopeTimer implementation
+ScopeTimer::ScopeTimer(const std::string& name)
+    : m_name(name)
+    , m_startTime(std::chrono::high_resolution_clock::now()) {
+}
+
+ScopeTimer::~ScopeTimer() {
+    auto elapsed = std::chrono::high_resolution_clock::now() - m_startTime;
+    VORTEX_DEBUG("{} took {:.3f} ms", m_name, std::chrono::duration<double, std::milli>(elapsed).count());
+}
+
+} // namespace VortexEngine
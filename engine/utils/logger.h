@@ -1,20 +1,36 @@
 #pragma once
 
 #include <string>
+#include <string_view>
+#include <algorithm>
 #include <iostream>
 #include <fstream>
 #include <sstream>
+#include <atomic>
+#include <charconv>
 #include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
 #include <iomanip>
 #include <mutex>
 #include <memory>
+#include <thread>
+#include <tuple>
+#include <type_traits>
 #include <vector>
 #include <functional>
 
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#elif defined(_M_X64) || defined(_M_IX86)
+#include <intrin.h>
+#endif
+
 namespace VortexEngine {
 
 // Log level enumeration
-enum class LogLevel {
+enum class LogLevel : uint8_t {
     Trace,
     Debug,
     Info,
@@ -55,6 +71,43 @@ struct LogMessage {
     std::string function;
 };
 
+// Call site of a logging macro, registered once per site
+struct SourceLocation {
+    const char* file = "";
+    const char* function = "";
+    const char* format = "{}";
+    uint32_t line = 0;
+};
+
+// Compact record handed from a logging thread to the writer thread
+//
+// Records are fixed size so a per-thread ring is a flat array. The data block
+// holds the encoded arguments (see LogArgType); arguments that do not fit are
+// dropped and the record is flagged as truncated.
+constexpr size_t LOG_RECORD_SIZE = 256;
+constexpr size_t LOG_RECORD_HEADER_SIZE = 20;
+constexpr size_t LOG_RECORD_DATA_SIZE = LOG_RECORD_SIZE - LOG_RECORD_HEADER_SIZE;
+
+struct LogRecord {
+    uint64_t timestamp;     // Raw ticks from readLogTimestamp()
+    uint32_t sourceId;
+    uint32_t threadId;
+    LogLevel level;
+    uint8_t flags;
+    uint16_t length;
+    char data[LOG_RECORD_DATA_SIZE];
+};
+static_assert(sizeof(LogRecord) == LOG_RECORD_SIZE, "LogRecord must stay one fixed-size ring slot");
+
+// Cheap monotonic timestamp (TSC where available), converted on the writer thread
+inline uint64_t readLogTimestamp() {
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+    return __rdtsc();
+#else
+    return static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+}
+
 // Logger interface
 class ILogger {
 public:
@@ -181,13 +234,16 @@ public:
 
     // Logger configuration
     void setLogLevel(LogLevel level);
-    LogLevel getLogLevel() const { return m_logLevel; }
+    LogLevel getLogLevel() const { return m_logLevel.load(std::memory_order_relaxed); }
+    bool isEnabled(LogLevel level) const { return level >= m_logLevel.load(std::memory_order_relaxed); }
     void setPattern(const std::string& pattern);
     const std::string& getPattern() const { return m_pattern; }
 
     // Logger targets
     void addConsoleLogger();
     void addFileLogger(const std::string& filename);
+    bool addBinaryLogger(const std::string& filename);
+    void setConsoleOutput(bool enable);
     void addMultiLogger();
     void setLogger(std::shared_ptr<ILogger> logger);
     std::shared_ptr<ILogger> getLogger() const { return m_logger; }
@@ -196,6 +252,23 @@ public:
     void setThreadSafe(bool enable) { m_threadSafe = enable; }
     bool isThreadSafe() const { return m_threadSafe; }
 
+    // Asynchronous output
+    void flush();
+    uint64_t getDroppedRecordCount() const { return m_droppedRecords.load(std::memory_order_relaxed); }
+    bool isWriterRunning() const { return m_writerRunning.load(std::memory_order_acquire); }
+
+    // Record interface used by the logging macros
+    LogRecord* beginRecord(uint32_t sourceId, LogLevel level);
+    void commitRecord(LogRecord* record);
+    void writeRecordNow(const LogRecord& record);
+
+    // Call site registry
+    static uint32_t registerSourceLocation(const char* file, uint32_t line, const char* function, const char* format = "{}");
+    static SourceLocation getSourceLocation(uint32_t sourceId);
+
+    // Expands a format string against encoded record arguments
+    static void formatArguments(std::string& out, std::string_view format, const char* data, size_t length, bool truncated);
+
     // Singleton access
     static Logger& getInstance();
     static void initializeSingleton();
@@ -210,7 +283,7 @@ public:
 private:
     // Logger state
     bool m_initialized = false;
-    LogLevel m_logLevel = LogLevel::Info;
+    std::atomic<LogLevel> m_logLevel{LogLevel::Info};
     std::string m_pattern = "[%timestamp] [%level] [%source]: %message";
     bool m_threadSafe = true;
     std::mutex m_mutex;
@@ -218,27 +291,253 @@ private:
     // Logger implementation
     std::shared_ptr<ILogger> m_logger;
 
+    // Built-in outputs written by the writer thread
+    bool m_consoleOutput = true;
+    bool m_consoleColors = false;
+    int m_fileDescriptor = -1;
+    int m_binaryFileDescriptor = -1;
+    std::vector<bool> m_binarySourcesWritten;
+    std::string m_binaryBatch;
+    double m_binaryNanosecondsPerTick = 0.0;
+
+    // Writer thread
+    std::thread m_writerThread;
+    std::atomic<bool> m_writerRunning{false};
+    std::atomic<bool> m_stopRequested{false};
+    std::mutex m_writerMutex;
+    std::condition_variable m_writerWakeup;
+    std::condition_variable m_passCompleted;
+    std::atomic<bool> m_writerSleeping{false};
+    uint64_t m_passCount = 0;
+    std::atomic<uint64_t> m_droppedRecords{0};
+
+    // Timestamp calibration (ticks -> wall clock)
+    uint64_t m_startTicks = 0;
+    std::chrono::steady_clock::time_point m_startSteady;
+    std::chrono::system_clock::time_point m_startSystem;
+    double m_nanosecondsPerTick = 1.0;
+    std::string m_messageScratch;
+
     // Internal methods
+    void writerThreadMain();
+    size_t drainRings(std::string& consoleBatch, std::string& fileBatch);
+    void formatRecord(const LogRecord& record, std::string& out, bool colors);
+    void writeBatch(int fileDescriptor, std::string& batch);
+    void appendBinaryRecord(const LogRecord& record, std::string& out);
+    void appendBinaryCalibration(std::string& out);
+    void calibrateTimestamps();
+    std::chrono::system_clock::time_point ticksToTime(uint64_t ticks) const;
     void logInternal(LogLevel level, const std::string& message, const std::string& source, uint32_t line, const std::string& file, const std::string& function);
     LogMessage createLogMessage(LogLevel level, const std::string& message, const std::string& source, uint32_t line, const std::string& file, const std::string& function) const;
     std::string formatTimestamp(const std::string& timestamp) const;
 };
 
+// Binary log file layout (.vlog)
+//
+// A header (magic + version) followed by tagged entries. Each call site is
+// written once as a Source entry the first time it logs; Record entries then
+// carry only the source id, raw ticks and encoded arguments. Calibration
+// entries map ticks to wall-clock time and are rewritten as the tick rate
+// estimate is refined. Decode with the vortex_logdecode tool.
+namespace BinaryLog {
+    constexpr char MAGIC[4] = {'V', 'L', 'O', 'G'};
+    constexpr uint32_t VERSION = 1;
+
+    enum class EntryType : uint8_t {
+        Calibration = 'C',  // u64 startTicks, i64 startSystemNanoseconds, f64 nanosecondsPerTick
+        Source = 'S',       // u32 id, u32 line, then file, function, format as (u16 length + bytes)
+        Record = 'R'        // u64 ticks, u32 sourceId, u32 threadId, u8 level, u8 flags, u16 length, data
+    };
+}
+
+// Argument encoding inside a LogRecord
+//
+// Each argument is a one-byte type tag followed by its raw value; strings are
+// a 16-bit length and their bytes. Formatting against the call site's format
+// string happens later, on the writer thread.
+enum class LogArgType : uint8_t {
+    Int,
+    UInt,
+    Double,
+    Bool,
+    Char,
+    Pointer,
+    String
+};
+
+// LogRecord::flags
+constexpr uint8_t LOG_RECORD_TRUNCATED = 0x01;
+
+// Counts "{}" style placeholders ("{{" is an escaped brace)
+consteval size_t countLogPlaceholders(std::string_view format) {
+    size_t count = 0;
+    for (size_t i = 0; i < format.size(); ++i) {
+        if (format[i] == '{') {
+            if (i + 1 < format.size() && format[i + 1] == '{') {
+                ++i;
+            } else {
+                ++count;
+            }
+        }
+    }
+    return count;
+}
+
+// Writes one log record in place
+//
+// Claims a slot in the calling thread's ring on construction, copies the raw
+// arguments into it and publishes it on destruction. No text formatting
+// happens here; the writer thread expands the format string. If the ring is
+// full the record is dropped and counted rather than blocking the caller.
+class LogRecordWriter {
+public:
+    LogRecordWriter(uint32_t sourceId, LogLevel level)
+        : m_logger(Logger::getInstance()) {
+        m_record = m_logger.beginRecord(sourceId, level);
+        if (!m_record && !m_logger.isWriterRunning()) {
+            // No writer thread yet (or any more) - format and write synchronously
+            m_record = &m_local;
+            m_local.timestamp = readLogTimestamp();
+            m_local.sourceId = sourceId;
+            m_local.threadId = Logger::getCurrentThreadId();
+            m_local.level = level;
+            m_local.flags = 0;
+            m_local.length = 0;
+            m_synchronous = true;
+        }
+    }
+
+    ~LogRecordWriter() {
+        if (m_synchronous) {
+            m_logger.writeRecordNow(m_local);
+        } else if (m_record) {
+            m_logger.commitRecord(m_record);
+        }
+    }
+
+    LogRecordWriter(const LogRecordWriter&) = delete;
+    LogRecordWriter& operator=(const LogRecordWriter&) = delete;
+
+    template<typename... Args>
+    void write(const Args&... args) {
+        if (m_record) {
+            (append(args), ...);
+        }
+    }
+
+private:
+    Logger& m_logger;
+    LogRecord* m_record = nullptr;
+    LogRecord m_local;
+    bool m_synchronous = false;
+
+    template<typename T>
+    void appendRaw(LogArgType type, const T& value) {
+        if (m_record->length + 1 + sizeof(T) > LOG_RECORD_DATA_SIZE) {
+            m_record->flags |= LOG_RECORD_TRUNCATED;
+            return;
+        }
+
+        char* out = m_record->data + m_record->length;
+        *out = static_cast<char>(type);
+        std::memcpy(out + 1, &value, sizeof(T));
+        m_record->length = static_cast<uint16_t>(m_record->length + 1 + sizeof(T));
+    }
+
+    void appendString(std::string_view text) {
+        size_t available = LOG_RECORD_DATA_SIZE - m_record->length;
+        if (available < 1 + sizeof(uint16_t)) {
+            m_record->flags |= LOG_RECORD_TRUNCATED;
+            return;
+        }
+
+        size_t count = std::min(text.size(), available - 1 - sizeof(uint16_t));
+        if (count < text.size()) {
+            m_record->flags |= LOG_RECORD_TRUNCATED;
+        }
+
+        char* out = m_record->data + m_record->length;
+        uint16_t length = static_cast<uint16_t>(count);
+        *out = static_cast<char>(LogArgType::String);
+        std::memcpy(out + 1, &length, sizeof(length));
+        std::memcpy(out + 1 + sizeof(length), text.data(), count);
+        m_record->length = static_cast<uint16_t>(m_record->length + 1 + sizeof(length) + count);
+    }
+
+    template<typename T>
+    void append(const T& value) {
+        using Type = std::decay_t<T>;
+
+        if constexpr (std::is_same_v<Type, bool>) {
+            appendRaw(LogArgType::Bool, value);
+        } else if constexpr (std::is_same_v<Type, char>) {
+            appendRaw(LogArgType::Char, value);
+        } else if constexpr (std::is_same_v<Type, const char*> || std::is_same_v<Type, char*>) {
+            // Before the string_view case, which would take these too and crash on null
+            appendString(value ? std::string_view(value) : std::string_view("(null)"));
+        } else if constexpr (std::is_convertible_v<const T&, std::string_view>) {
+            appendString(std::string_view(value));
+        } else if constexpr (std::is_enum_v<Type>) {
+            appendRaw(LogArgType::Int, static_cast<int64_t>(value));
+        } else if constexpr (std::is_integral_v<Type> && std::is_signed_v<Type>) {
+            appendRaw(LogArgType::Int, static_cast<int64_t>(value));
+        } else if constexpr (std::is_integral_v<Type>) {
+            appendRaw(LogArgType::UInt, static_cast<uint64_t>(value));
+        } else if constexpr (std::is_floating_point_v<Type>) {
+            appendRaw(LogArgType::Double, static_cast<double>(value));
+        } else if constexpr (std::is_pointer_v<Type> || std::is_null_pointer_v<Type>) {
+            appendRaw(LogArgType::Pointer, static_cast<uint64_t>(reinterpret_cast<uintptr_t>(value)));
+        } else {
+            static_assert(sizeof(T) == 0, "Unsupported log argument type");
+        }
+    }
+};
+
+// Compile-time minimum level (0 = Trace ... 5 = Critical, 6 = Off). Calls below
+// it are removed entirely; VORTEX_LOG_MIN_LEVEL is normally set by CMake.
+#ifndef VORTEX_LOG_MIN_LEVEL
+#define VORTEX_LOG_MIN_LEVEL 0
+#endif
+
+constexpr bool isLogLevelCompiled(LogLevel level) {
+    return static_cast<int>(level) - VORTEX_LOG_MIN_LEVEL >= 0;
+}
+
 // Macro definitions for easy logging
-#define VORTEX_TRACE(message) Logger::getInstance().trace(message, __FILE__, __LINE__, __FUNCTION__)
-#define VORTEX_DEBUG(message) Logger::getInstance().debug(message, __FILE__, __LINE__, __FUNCTION__)
-#define VORTEX_INFO(message) Logger::getInstance().info(message, __FILE__, __LINE__, __FUNCTION__)
-#define VORTEX_WARNING(message) Logger::getInstance().warning(message, __FILE__, __LINE__, __FUNCTION__)
-#define VORTEX_ERROR(message) Logger::getInstance().error(message, __FILE__, __LINE__, __FUNCTION__)
-#define VORTEX_CRITICAL(message) Logger::getInstance().critical(message, __FILE__, __LINE__, __FUNCTION__)
+//
+// Usage: VORTEX_INFO("Loaded {} meshes in {:.2f} ms", count, milliseconds).
+// The format must be a string literal; it is stored once per call site and
+// only the raw arguments are copied per call. Arguments are not evaluated
+// when the level is disabled at compile time or at run time.
+#define VORTEX_LOG(level, format, ...) \
+    do { \
+        if constexpr (::VortexEngine::isLogLevelCompiled(level)) { \
+            static_assert(::VortexEngine::countLogPlaceholders(format) == \
+                          std::tuple_size_v<decltype(std::make_tuple(__VA_ARGS__))>, \
+                          "Log format placeholder count does not match argument count"); \
+            if (::VortexEngine::Logger::getInstance().isEnabled(level)) { \
+                static const uint32_t vortexLogSourceId = ::VortexEngine::Logger::registerSourceLocation( \
+                    __FILE__, __LINE__, __FUNCTION__, format); \
+                ::VortexEngine::LogRecordWriter vortexLogWriter(vortexLogSourceId, level); \
+                vortexLogWriter.write(__VA_ARGS__); \
+            } \
+        } \
+    } while (0)
+
+#define VORTEX_TRACE(...) VORTEX_LOG(::VortexEngine::LogLevel::Trace, __VA_ARGS__)
+#define VORTEX_DEBUG(...) VORTEX_LOG(::VortexEngine::LogLevel::Debug, __VA_ARGS__)
+#define VORTEX_INFO(...) VORTEX_LOG(::VortexEngine::LogLevel::Info, __VA_ARGS__)
+#define VORTEX_WARNING(...) VORTEX_LOG(::VortexEngine::LogLevel::Warning, __VA_ARGS__)
+#define VORTEX_ERROR(...) VORTEX_LOG(::VortexEngine::LogLevel::Error, __VA_ARGS__)
+#define VORTEX_CRITICAL(...) VORTEX_LOG(::VortexEngine::LogLevel::Critical, __VA_ARGS__)
 
 // Conditional logging macros
-#define VORTEX_TRACE_IF(condition, message) if (condition) VORTEX_TRACE(message)
-#define VORTEX_DEBUG_IF(condition, message) if (condition) VORTEX_DEBUG(message)
-#define VORTEX_INFO_IF(condition, message) if (condition) VORTEX_INFO(message)
-#define VORTEX_WARNING_IF(condition, message) if (condition) VORTEX_WARNING(message)
-#define VORTEX_ERROR_IF(condition, message) if (condition) VORTEX_ERROR(message)
-#define VORTEX_CRITICAL_IF(condition, message) if (condition) VORTEX_CRITICAL(message)
+#define VORTEX_TRACE_IF(condition, ...) if (condition) VORTEX_TRACE(__VA_ARGS__)
+#define VORTEX_DEBUG_IF(condition, ...) if (condition) VORTEX_DEBUG(__VA_ARGS__)
+#define VORTEX_INFO_IF(condition, ...) if (condition) VORTEX_INFO(__VA_ARGS__)
+#define VORTEX_WARNING_IF(condition, ...) if (condition) VORTEX_WARNING(__VA_ARGS__)
+#define VORTEX_ERROR_IF(condition, ...) if (condition) VORTEX_ERROR(__VA_ARGS__)
+#define VORTEX_CRITICAL_IF(condition, ...) if (condition) VORTEX_CRITICAL(__VA_ARGS__)
 
 // Performance timing macros
 #define VORTEX_SCOPE_TIMER(name) \
@@ -0,0 +1,237 @@
+#include "mapped_file.h"
+#include <cerrno>
+#include <cstring>
+#include <iostream>
+#include <utility>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace VortexEngine {
+
+namespace {
+
+#ifndef _WIN32
+int toMadvise(MappedFile::AccessHint hint) {
+    switch (hint) {
+        case MappedFile::AccessHint::Sequential: return MADV_SEQUENTIAL;
+        case MappedFile::AccessHint::Random: return MADV_RANDOM;
+        case MappedFile::AccessHint::WillNeed: return MADV_WILLNEED;
+        case MappedFile::AccessHint::DontNeed: return MADV_DONTNEED;
+        case MappedFile::AccessHint::Normal:
+        default: return MADV_NORMAL;
+    }
+}
+
+size_t getPageSize() {
+    static const size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    return pageSize;
+}
+#endif
+
+} // namespace
+
+MappedFile::~MappedFile() {
+    close();
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept {
+    *this = std::move(other);
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+    if (this != &other) {
+        close();
+
+        m_data = other.m_data;
+        m_size = other.m_size;
+        m_path = std::move(other.m_path);
+        m_open = other.m_open;
+        m_errorCode = other.m_errorCode;
+#ifdef _WIN32
+        m_fileHandle = other.m_fileHandle;
+        m_mappingHandle = other.m_mappingHandle;
+#endif
+
+        other.reset();
+    }
+    return *this;
+}
+
+bool MappedFile::open(const std::string& path, AccessHint hint) {
+    close();
+    m_path = path;
+    m_errorCode = 0;
+
+#ifdef _WIN32
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                              hint == AccessHint::Random ? FILE_FLAG_RANDOM_ACCESS : FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        DWORD error = GetLastError();
+        m_errorCode = (error == ERROR_FILE_NOT_FOUND || error == ERROR_PATH_NOT_FOUND) ? ENOENT
+                    : (error == ERROR_ACCESS_DENIED) ? EACCES : EIO;
+        std::cerr << "Failed to open file for mapping: " << path << std::endl;
+        return false;
+    }
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize)) {
+        m_errorCode = EIO;
+        CloseHandle(file);
+        std::cerr << "Failed to get size of file: " << path << std::endl;
+        return false;
+    }
+
+    m_fileHandle = file;
+    m_size = static_cast<size_t>(fileSize.QuadPart);
+    m_open = true;
+
+    // Zero-length files cannot be mapped; they open as an empty view
+    if (m_size == 0) {
+        return true;
+    }
+
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    void* view = mapping ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+    if (!view) {
+        if (mapping) {
+            CloseHandle(mapping);
+        }
+        m_errorCode = EIO;
+        std::cerr << "Failed to map file: " << path << std::endl;
+        close();
+        return false;
+    }
+
+    m_mappingHandle = mapping;
+    m_data = static_cast<const std::byte*>(view);
+
+    if (hint == AccessHint::WillNeed) {
+        advise(hint);
+    }
+    return true;
+#else
+    int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        m_errorCode = errno;
+        std::cerr << "Failed to open file for mapping: " << path << " (" << std::strerror(m_errorCode) << ")" << std::endl;
+        return false;
+    }
+
+    struct stat info;
+    if (fstat(fd, &info) != 0) {
+        m_errorCode = errno;
+        ::close(fd);
+        std::cerr << "Failed to stat file: " << path << " (" << std::strerror(m_errorCode) << ")" << std::endl;
+        return false;
+    }
+    if (!S_ISREG(info.st_mode)) {
+        m_errorCode = EINVAL;
+        ::close(fd);
+        std::cerr << "Cannot map non-regular file: " << path << std::endl;
+        return false;
+    }
+
+    m_size = static_cast<size_t>(info.st_size);
+    m_open = true;
+
+    // Zero-length files cannot be mapped; they open as an empty view
+    if (m_size == 0) {
+        ::close(fd);
+        return true;
+    }
+
+    void* view = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    m_errorCode = view == MAP_FAILED ? errno : 0;
+
+    // The mapping holds its own reference to the file
+    ::close(fd);
+
+    if (view == MAP_FAILED) {
+        std::cerr << "Failed to map file: " << path << " (" << std::strerror(m_errorCode) << ")" << std::endl;
+        reset();
+        m_path = path;
+        return false;
+    }
+
+    m_data = static_cast<const std::byte*>(view);
+    advise(hint);
+    return true;
+#endif
+}
+
+void MappedFile::close() {
+    if (!m_open) {
+        return;
+    }
+
+#ifdef _WIN32
+    if (m_data) {
+        UnmapViewOfFile(m_data);
+    }
+    if (m_mappingHandle) {
+        CloseHandle(m_mappingHandle);
+    }
+    if (m_fileHandle) {
+        CloseHandle(m_fileHandle);
+    }
+#else
+    if (m_data) {
+        munmap(const_cast<std::byte*>(m_data), m_size);
+    }
+#endif
+
+    reset();
+}
+
+std::span<const std::byte> MappedFile::getRange(size_t offset, size_t length) const {
+    if (offset >= m_size) {
+        return {};
+    }
+    if (length > m_size - offset) {
+        length = m_size - offset;
+    }
+    return {m_data + offset, length};
+}
+
+void MappedFile::advise(AccessHint hint, size_t offset, size_t length) const {
+    if (!m_data || offset >= m_size) {
+        return;
+    }
+    if (length == 0 || length > m_size - offset) {
+        length = m_size - offset;
+    }
+
+#ifdef _WIN32
+    if (hint == AccessHint::WillNeed) {
+        WIN32_MEMORY_RANGE_ENTRY range{const_cast<std::byte*>(m_data + offset), length};
+        PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+    }
+#else
+    // madvise wants a page-aligned start address
+    size_t alignedOffset = offset & ~(getPageSize() - 1);
+    length += offset - alignedOffset;
+    madvise(const_cast<std::byte*>(m_data + alignedOffset), length, toMadvise(hint));
+#endif
+}
+
+void MappedFile::reset() {
+    m_data = nullptr;
+    m_size = 0;
+    m_path.clear();
+    m_open = false;
+#ifdef _WIN32
+    m_fileHandle = nullptr;
+    m_mappingHandle = nullptr;
+#endif
+}
+
+} // namespace VortexEngine
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+
+namespace VortexEngine {
+
+// Read-only memory-mapped file
+//
+// Maps a whole file into the address space so loaders can parse it in place
+// instead of copying it into a heap buffer first. Pages are faulted in by the
+// kernel on demand and are shared with the page cache, so a large asset costs
+// its size once rather than twice. The view stays valid until close(), the
+// destructor or a move.
+class MappedFile {
+public:
+    // Paging hints passed to madvise
+    enum class AccessHint {
+        Normal,
+        Sequential,   // Read front to back once - aggressive read-ahead
+        Random,       // Scattered reads (archives, tables) - no read-ahead
+        WillNeed,     // Start reading the range in now
+        DontNeed      // Range has been consumed - its pages may be dropped
+    };
+
+    MappedFile() = default;
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    // Lifecycle
+    bool open(const std::string& path, AccessHint hint = AccessHint::Sequential);
+    void close();
+    bool isOpen() const { return m_open; }
+
+    // Data access
+    std::span<const std::byte> getData() const { return {m_data, m_size}; }
+    std::span<const std::byte> getRange(size_t offset, size_t length) const;
+    const std::byte* data() const { return m_data; }
+    size_t getSize() const { return m_size; }
+    bool isEmpty() const { return m_size == 0; }
+
+    // Reinterprets the mapping as an array of T. The mapping is page aligned,
+    // so any T is suitably aligned; trailing bytes that do not fill a whole
+    // element are ignored.
+    template<typename T>
+    std::span<const T> getDataAs() const {
+        return {reinterpret_cast<const T*>(m_data), m_size / sizeof(T)};
+    }
+
+    // Paging hints for a byte range (length 0 means to the end of the file)
+    void advise(AccessHint hint, size_t offset = 0, size_t length = 0) const;
+
+    // Information
+    const std::string& getPath() const { return m_path; }
+    int getLastErrorCode() const { return m_errorCode; }
+
+private:
+    const std::byte* m_data = nullptr;
+    size_t m_size = 0;
+    std::string m_path;
+    bool m_open = false;
+    int m_errorCode = 0;
+
+#ifdef _WIN32
+    void* m_fileHandle = nullptr;
+    void* m_mappingHandle = nullptr;
+#endif
+
+    void reset();
+};
+
+} // namespace VortexEngine
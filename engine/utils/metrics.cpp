@@ -0,0 +1,321 @@
+#include "metrics.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <iostream>
+#include <limits>
+
+namespace VortexEngine {
+
+namespace {
+
+const char* metricTypeToString(MetricType type) {
+    switch (type) {
+        case MetricType::Counter: return "counter";
+        case MetricType::Gauge: return "gauge";
+        case MetricType::Histogram: return "histogram";
+    }
+    return "unknown";
+}
+
+// Value at quantile q, interpolated inside the bucket that contains it
+double estimatePercentile(const Histogram& histogram, const std::vector<uint64_t>& buckets, uint64_t count, double q) {
+    if (count == 0) {
+        return 0.0;
+    }
+
+    const std::vector<double>& bounds = histogram.getBounds();
+    double rank = q * static_cast<double>(count);
+    uint64_t cumulative = 0;
+    for (size_t i = 0; i < buckets.size(); ++i) {
+        if (buckets[i] == 0 || static_cast<double>(cumulative + buckets[i]) < rank) {
+            cumulative += buckets[i];
+            continue;
+        }
+
+        double lower = i == 0 ? histogram.getMin() : std::max(bounds[i - 1], histogram.getMin());
+        double upper = i < bounds.size() ? std::min(bounds[i], histogram.getMax()) : histogram.getMax();
+        double fraction = (rank - static_cast<double>(cumulative)) / static_cast<double>(buckets[i]);
+        return lower + (upper - lower) * std::clamp(fraction, 0.0, 1.0);
+    }
+    return histogram.getMax();
+}
+
+// Counter totals, gauge levels and sample counts are whole numbers
+void formatInteger(std::ostream& out, double value) {
+    out << static_cast<int64_t>(value);
+}
+
+// %.17g round-trips any double; JSON has no NaN or infinity, so those become null
+void formatNumber(std::ostream& out, double value, bool json, const char* format = "%.17g") {
+    if (json && !std::isfinite(value)) {
+        out << "null";
+        return;
+    }
+    char buffer[64];
+    std::snprintf(buffer, sizeof(buffer), format, value);
+    out << buffer;
+}
+
+} // namespace
+
+// Histogram implementation
+Histogram::Histogram(std::vector<double> bounds)
+    : m_bounds(std::move(bounds))
+    , m_buckets(new std::atomic<uint64_t>[m_bounds.size() + 1])
+    , m_min(std::numeric_limits<double>::max())
+    , m_max(std::numeric_limits<double>::lowest()) {
+    std::sort(m_bounds.begin(), m_bounds.end());
+    for (size_t i = 0; i <= m_bounds.size(); ++i) {
+        m_buckets[i].store(0, std::memory_order_relaxed);
+    }
+}
+
+void Histogram::record(double value) {
+    size_t bucket = static_cast<size_t>(std::lower_bound(m_bounds.begin(), m_bounds.end(), value) - m_bounds.begin());
+    m_buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+    m_sum.fetch_add(value, std::memory_order_relaxed);
+
+    double current = m_min.load(std::memory_order_relaxed);
+    while (value < current && !m_min.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+    }
+    current = m_max.load(std::memory_order_relaxed);
+    while (value > current && !m_max.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+    }
+
+    // Counted last so a reader seeing count n sees at least n bucket entries
+    m_count.fetch_add(1, std::memory_order_release);
+}
+
+std::vector<uint64_t> Histogram::getBucketCounts() const {
+    std::vector<uint64_t> counts(m_bounds.size() + 1);
+    for (size_t i = 0; i < counts.size(); ++i) {
+        counts[i] = m_buckets[i].load(std::memory_order_relaxed);
+    }
+    return counts;
+}
+
+std::vector<double> Histogram::millisecondBounds() {
+    return {0.05, 0.1, 0.25, 0.5, 1.0, 2.0, 4.0, 8.0, 12.0, 16.7, 25.0, 33.3, 50.0, 100.0, 250.0, 500.0, 1000.0};
+}
+
+// Snapshot lookup
+const MetricSample* MetricsSnapshot::find(std::string_view name) const {
+    auto it = std::lower_bound(metrics.begin(), metrics.end(), name,
+                               [](const MetricSample& sample, std::string_view key) { return sample.name < key; });
+    return it != metrics.end() && it->name == name ? &*it : nullptr;
+}
+
+// Registry implementation
+MetricsRegistry::MetricsRegistry()
+    : m_startTime(Clock::now()) {
+}
+
+MetricsRegistry& MetricsRegistry::getInstance() {
+    static MetricsRegistry instance;
+    return instance;
+}
+
+MetricsRegistry::Entry* MetricsRegistry::findOrCreate(std::string_view name, MetricType type, std::vector<double>* bounds) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    auto it = m_entries.find(name);
+    if (it != m_entries.end()) {
+        if (it->second.type != type) {
+            std::cerr << "Metric " << name << " is already registered as a " << metricTypeToString(it->second.type)
+                      << ", not a " << metricTypeToString(type) << std::endl;
+            return nullptr;
+        }
+        return &it->second;
+    }
+
+    Entry entry;
+    entry.type = type;
+    switch (type) {
+        case MetricType::Counter: entry.counter = std::make_unique<Counter>(); break;
+        case MetricType::Gauge: entry.gauge = std::make_unique<Gauge>(); break;
+        case MetricType::Histogram: entry.histogram = std::make_unique<Histogram>(std::move(*bounds)); break;
+    }
+    return &m_entries.emplace(std::string(name), std::move(entry)).first->second;
+}
+
+Counter& MetricsRegistry::counter(std::string_view name) {
+    Entry* entry = findOrCreate(name, MetricType::Counter, nullptr);
+    return entry ? *entry->counter : m_invalidCounter;
+}
+
+Gauge& MetricsRegistry::gauge(std::string_view name) {
+    Entry* entry = findOrCreate(name, MetricType::Gauge, nullptr);
+    return entry ? *entry->gauge : m_invalidGauge;
+}
+
+Histogram& MetricsRegistry::histogram(std::string_view name, std::vector<double> bounds) {
+    Entry* entry = findOrCreate(name, MetricType::Histogram, &bounds);
+    return entry ? *entry->histogram : m_invalidHistogram;
+}
+
+MetricsSnapshot MetricsRegistry::snapshot(uint64_t frameIndex) {
+    return takeSnapshot(frameIndex, false);
+}
+
+MetricsSnapshot MetricsRegistry::takeSnapshot(uint64_t frameIndex, bool advance) {
+    MetricsSnapshot result;
+    result.frameIndex = frameIndex;
+    result.time = std::chrono::duration<double, std::milli>(Clock::now() - m_startTime).count();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    result.metrics.reserve(m_entries.size());
+    for (auto& [name, entry] : m_entries) {
+        MetricSample sample;
+        sample.name = name;
+        sample.type = entry.type;
+
+        uint64_t total = 0;
+        switch (entry.type) {
+            case MetricType::Counter:
+                total = entry.counter->getValue();
+                sample.value = static_cast<double>(total);
+                break;
+            case MetricType::Gauge:
+                sample.value = static_cast<double>(entry.gauge->getValue());
+                break;
+            case MetricType::Histogram: {
+                const Histogram& histogram = *entry.histogram;
+                total = histogram.getCount();
+                std::vector<uint64_t> buckets = histogram.getBucketCounts();
+                sample.count = total;
+                sample.sum = histogram.getSum();
+                if (total > 0) {
+                    sample.value = sample.sum / static_cast<double>(total);
+                    sample.min = histogram.getMin();
+                    sample.max = histogram.getMax();
+                    sample.p50 = estimatePercentile(histogram, buckets, total, 0.50);
+                    sample.p95 = estimatePercentile(histogram, buckets, total, 0.95);
+                    sample.p99 = estimatePercentile(histogram, buckets, total, 0.99);
+                }
+                break;
+            }
+        }
+
+        if (entry.type != MetricType::Gauge) {
+            sample.delta = static_cast<double>(total - std::min(total, entry.previousCount));
+            if (advance) {
+                entry.previousCount = total;
+            }
+        }
+        result.metrics.push_back(std::move(sample));
+    }
+
+    return result;
+}
+
+void MetricsRegistry::endFrame(uint64_t frameIndex) {
+    MetricsSnapshot frame = takeSnapshot(frameIndex, true);
+
+    std::lock_guard<std::mutex> lock(m_frameMutex);
+    if (m_dumpFile.is_open() && frameIndex % m_dumpInterval == 0) {
+        if (m_dumpFormat == MetricsDumpFormat::Csv) {
+            writeCsv(m_dumpFile, frame);
+        } else {
+            writeJson(m_dumpFile, frame);
+            m_dumpFile << '\n';
+        }
+        m_dumpFile.flush();
+    }
+    m_lastFrame = std::move(frame);
+}
+
+MetricsSnapshot MetricsRegistry::getLastFrame() const {
+    std::lock_guard<std::mutex> lock(m_frameMutex);
+    return m_lastFrame;
+}
+
+bool MetricsRegistry::setDumpFile(const std::string& path, MetricsDumpFormat format, uint32_t intervalFrames) {
+    std::lock_guard<std::mutex> lock(m_frameMutex);
+    if (m_dumpFile.is_open()) {
+        m_dumpFile.close();
+    }
+
+    m_dumpFile.open(path, std::ios::out | std::ios::trunc);
+    if (!m_dumpFile) {
+        std::cerr << "Failed to open metrics dump file: " << path << std::endl;
+        return false;
+    }
+
+    m_dumpFormat = format;
+    m_dumpInterval = std::max(intervalFrames, 1u);
+    if (format == MetricsDumpFormat::Csv) {
+        writeCsvHeader(m_dumpFile);
+    }
+    return true;
+}
+
+void MetricsRegistry::closeDumpFile() {
+    std::lock_guard<std::mutex> lock(m_frameMutex);
+    if (m_dumpFile.is_open()) {
+        m_dumpFile.close();
+    }
+}
+
+void MetricsRegistry::writeCsvHeader(std::ostream& out) {
+    out << "frame,time_ms,name,type,value,delta,count,sum,min,max,p50,p95,p99\n";
+}
+
+void MetricsRegistry::writeCsv(std::ostream& out, const MetricsSnapshot& snapshot) {
+    for (const MetricSample& sample : snapshot.metrics) {
+        out << snapshot.frameIndex << ',';
+        formatNumber(out, snapshot.time, false, "%.3f");
+        out << ',' << sample.name << ',' << metricTypeToString(sample.type) << ',';
+        if (sample.type == MetricType::Histogram) {
+            formatNumber(out, sample.value, false);
+        } else {
+            formatInteger(out, sample.value);
+        }
+        out << ',';
+        formatInteger(out, sample.delta);
+        out << ',' << sample.count;
+        for (double field : {sample.sum, sample.min, sample.max, sample.p50, sample.p95, sample.p99}) {
+            out << ',';
+            formatNumber(out, field, false);
+        }
+        out << '\n';
+    }
+}
+
+void MetricsRegistry::writeJson(std::ostream& out, const MetricsSnapshot& snapshot) {
+    // Metric names are dotted identifiers, so they need no escaping
+    out << "{\"frame\":" << snapshot.frameIndex << ",\"time_ms\":";
+    formatNumber(out, snapshot.time, true, "%.3f");
+    out << ",\"metrics\":{";
+
+    bool first = true;
+    for (const MetricSample& sample : snapshot.metrics) {
+        out << (first ? "" : ",") << '"' << sample.name << "\":{\"type\":\"" << metricTypeToString(sample.type)
+            << "\",\"value\":";
+        if (sample.type == MetricType::Histogram) {
+            formatNumber(out, sample.value, true);
+        } else {
+            formatInteger(out, sample.value);
+        }
+        if (sample.type != MetricType::Gauge) {
+            out << ",\"delta\":";
+            formatInteger(out, sample.delta);
+        }
+        if (sample.type == MetricType::Histogram) {
+            out << ",\"count\":" << sample.count;
+            const std::pair<const char*, double> fields[] = {
+                {"sum", sample.sum}, {"min", sample.min}, {"max", sample.max},
+                {"p50", sample.p50}, {"p95", sample.p95}, {"p99", sample.p99},
+            };
+            for (const auto& [key, field] : fields) {
+                out << ",\"" << key << "\":";
+                formatNumber(out, field, true);
+            }
+        }
+        out << '}';
+        first = false;
+    }
+    out << "}}";
+}
+
+} // namespace VortexEngine
@@ -0,0 +1,185 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace VortexEngine {
+
+// Stable metric names. Dumps and regression checks key on these strings, so
+// rename only together with whatever consumes them.
+namespace MetricNames {
+    constexpr const char* BufferBytesAllocated = "buffer_allocator.bytes_allocated";
+    constexpr const char* BufferAllocations = "buffer_allocator.allocations";
+    constexpr const char* MemoryBytesAllocated = "memory.bytes_allocated";
+    constexpr const char* MemoryAllocations = "memory.allocations";
+    constexpr const char* PipelineCompileMs = "pipeline.compile_ms";
+    constexpr const char* PipelinesCreated = "pipeline.created";
+    constexpr const char* EcsEntities = "ecs.entities";
+    constexpr const char* FrameCpuMs = "frame.cpu_ms";
+    constexpr const char* Frames = "frame.count";
+    constexpr const char* DrawCalls = "cmd.draw_calls";
+    constexpr const char* PipelineBinds = "cmd.pipeline_binds";
+}
+
+enum class MetricType {
+    Counter,     // Monotonic total
+    Gauge,       // Current level, moved up and down
+    Histogram    // Distribution of samples
+};
+
+// Monotonic counter
+class Counter {
+public:
+    void add(uint64_t amount = 1) { m_value.fetch_add(amount, std::memory_order_relaxed); }
+    uint64_t getValue() const { return m_value.load(std::memory_order_relaxed); }
+
+private:
+    std::atomic<uint64_t> m_value{0};
+};
+
+// Level that may be shared by several owners, so it is moved by deltas
+class Gauge {
+public:
+    void add(int64_t amount) { m_value.fetch_add(amount, std::memory_order_relaxed); }
+    void sub(int64_t amount) { m_value.fetch_sub(amount, std::memory_order_relaxed); }
+    void set(int64_t value) { m_value.store(value, std::memory_order_relaxed); }
+    int64_t getValue() const { return m_value.load(std::memory_order_relaxed); }
+
+private:
+    std::atomic<int64_t> m_value{0};
+};
+
+// Fixed-bucket histogram
+//
+// bounds are inclusive upper edges in ascending order; samples above the last
+// bound land in an overflow bucket. Percentiles are interpolated within the
+// bucket, so their resolution is the bucket width.
+class Histogram {
+public:
+    explicit Histogram(std::vector<double> bounds);
+
+    void record(double value);
+
+    const std::vector<double>& getBounds() const { return m_bounds; }
+    uint64_t getCount() const { return m_count.load(std::memory_order_relaxed); }
+    double getSum() const { return m_sum.load(std::memory_order_relaxed); }
+    double getMin() const { return m_min.load(std::memory_order_relaxed); }
+    double getMax() const { return m_max.load(std::memory_order_relaxed); }
+    std::vector<uint64_t> getBucketCounts() const;
+
+    // Default bounds for millisecond timings (0.05 ms to 1 s)
+    static std::vector<double> millisecondBounds();
+
+private:
+    std::vector<double> m_bounds;
+    std::unique_ptr<std::atomic<uint64_t>[]> m_buckets;   // bounds.size() + 1
+    std::atomic<uint64_t> m_count{0};
+    std::atomic<double> m_sum{0.0};
+    std::atomic<double> m_min;
+    std::atomic<double> m_max;
+};
+
+// One metric in a snapshot
+struct MetricSample {
+    std::string name;
+    MetricType type = MetricType::Counter;
+    double value = 0.0;     // Counter total, gauge level or histogram mean
+    double delta = 0.0;     // Change since the last endFrame() (counter total or histogram count)
+    uint64_t count = 0;     // Histogram samples
+    double sum = 0.0;
+    double min = 0.0;
+    double max = 0.0;
+    double p50 = 0.0;
+    double p95 = 0.0;
+    double p99 = 0.0;
+};
+
+struct MetricsSnapshot {
+    uint64_t frameIndex = 0;
+    double time = 0.0;      // Milliseconds since the registry was created
+    std::vector<MetricSample> metrics;   // Sorted by name
+
+    const MetricSample* find(std::string_view name) const;
+};
+
+enum class MetricsDumpFormat {
+    Csv,         // One row per metric per dump: frame,time_ms,name,type,value,...
+    JsonLines    // One JSON object per dump
+};
+
+// Engine-wide metrics registry
+//
+// Metrics are registered by name on first use and live for the whole
+// process, so call sites cache the returned reference (typically in a
+// function-local static) and update it with relaxed atomics. The engine calls
+// endFrame() once per frame to take the frame's snapshot and, if configured,
+// append it to a dump file every dumpInterval frames.
+class MetricsRegistry {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    static MetricsRegistry& getInstance();
+
+    MetricsRegistry(const MetricsRegistry&) = delete;
+    MetricsRegistry& operator=(const MetricsRegistry&) = delete;
+
+    // Registration (returns the existing metric if the name is known)
+    Counter& counter(std::string_view name);
+    Gauge& gauge(std::string_view name);
+    Histogram& histogram(std::string_view name, std::vector<double> bounds = Histogram::millisecondBounds());
+
+    // Snapshots
+    MetricsSnapshot snapshot(uint64_t frameIndex = 0);
+    void endFrame(uint64_t frameIndex);
+    MetricsSnapshot getLastFrame() const;
+
+    // Periodic dump
+    bool setDumpFile(const std::string& path, MetricsDumpFormat format, uint32_t intervalFrames = 60);
+    void closeDumpFile();
+
+    // Formatting
+    static void writeCsvHeader(std::ostream& out);
+    static void writeCsv(std::ostream& out, const MetricsSnapshot& snapshot);
+    static void writeJson(std::ostream& out, const MetricsSnapshot& snapshot);
+
+private:
+    struct Entry {
+        MetricType type = MetricType::Counter;
+        std::unique_ptr<Counter> counter;
+        std::unique_ptr<Gauge> gauge;
+        std::unique_ptr<Histogram> histogram;
+        uint64_t previousCount = 0;   // Counter value or histogram count at the last snapshot
+    };
+
+    MetricsRegistry();
+    ~MetricsRegistry() = default;
+
+    Entry* findOrCreate(std::string_view name, MetricType type, std::vector<double>* bounds);
+    MetricsSnapshot takeSnapshot(uint64_t frameIndex, bool advance);
+
+    const Clock::time_point m_startTime;
+
+    mutable std::mutex m_mutex;
+    std::map<std::string, Entry, std::less<>> m_entries;
+
+    // Returned for a name already registered with another type
+    Counter m_invalidCounter;
+    Gauge m_invalidGauge;
+    Histogram m_invalidHistogram{{}};
+
+    mutable std::mutex m_frameMutex;
+    MetricsSnapshot m_lastFrame;
+    std::ofstream m_dumpFile;
+    MetricsDumpFormat m_dumpFormat = MetricsDumpFormat::Csv;
+    uint32_t m_dumpInterval = 60;
+};
+
+} // namespace VortexEngine
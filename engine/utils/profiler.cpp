@@ -0,0 +1,236 @@
+#include "profiler.h"
+#include "spsc_ring.h"
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+
+namespace VortexEngine {
+
+namespace {
+
+// Per-thread buffer size in events (must be a power of two). collect() runs
+// every frame, so this only has to hold one frame of zones per thread.
+constexpr size_t THREAD_BUFFER_CAPACITY = 16384;
+
+// Trace-event process ids for the CPU threads and the GPU queue track
+constexpr uint32_t TRACE_CPU_PID = 0;
+constexpr uint32_t TRACE_GPU_PID = 1;
+
+void appendJsonString(std::string& out, const char* text) {
+    out.push_back('"');
+    for (const char* c = text ? text : ""; *c; ++c) {
+        switch (*c) {
+            case '"': out += "\\\""; break;
+            case '\\': out += "\\\\"; break;
+            case '\n': out += "\\n"; break;
+            case '\t': out += "\\t"; break;
+            default:
+                if (static_cast<unsigned char>(*c) < 0x20) {
+                    char escaped[8];
+                    std::snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned>(*c));
+                    out += escaped;
+                } else {
+                    out.push_back(*c);
+                }
+                break;
+        }
+    }
+    out.push_back('"');
+}
+
+void appendMicroseconds(std::string& out, uint64_t nanoseconds) {
+    char buffer[32];
+    std::snprintf(buffer, sizeof(buffer), "%.3f", static_cast<double>(nanoseconds) / 1000.0);
+    out += buffer;
+}
+
+} // namespace
+
+// Per-thread event ring; the owning thread pushes, collect() pops
+struct ProfileThreadBuffer {
+    SpscRing<ProfileEvent, THREAD_BUFFER_CAPACITY> ring;
+    uint32_t threadId = 0;
+    std::atomic<uint64_t> dropped{0};
+    std::atomic<bool> retired{false};
+};
+
+namespace {
+
+// Keeps the buffer alive until collect() has drained it after thread exit
+struct ThreadBufferHandle {
+    std::shared_ptr<ProfileThreadBuffer> buffer;
+
+    ~ThreadBufferHandle() {
+        if (buffer) {
+            buffer->retired.store(true, std::memory_order_release);
+        }
+    }
+};
+
+thread_local ProfileThreadBuffer* t_buffer = nullptr;
+thread_local ThreadBufferHandle t_bufferHandle;
+
+} // namespace
+
+Profiler& Profiler::getInstance() {
+    static Profiler instance;
+    return instance;
+}
+
+ProfileThreadBuffer* Profiler::getThreadBuffer() {
+    if (!t_buffer) {
+        auto buffer = std::make_shared<ProfileThreadBuffer>();
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            buffer->threadId = m_nextThreadId++;
+            m_threads.push_back(buffer);
+        }
+        t_bufferHandle.buffer = buffer;
+        t_buffer = buffer.get();
+    }
+
+    return t_buffer;
+}
+
+void Profiler::beginCapture() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    // Discard zones that finished after the previous capture ended
+    ProfileEvent discarded[256];
+    for (auto& thread : m_threads) {
+        while (thread->ring.popBatch(discarded, std::size(discarded)) != 0) {
+        }
+        thread->dropped.store(0, std::memory_order_relaxed);
+    }
+
+    m_events.clear();
+    m_eventsDropped = 0;
+    s_capturing.store(true, std::memory_order_relaxed);
+}
+
+void Profiler::endCapture() {
+    s_capturing.store(false, std::memory_order_relaxed);
+    collect();
+}
+
+void Profiler::recordEvent(const char* name, uint64_t start, uint64_t end, uint32_t flags) {
+    ProfileThreadBuffer* buffer = getThreadBuffer();
+    ProfileEvent event;
+    event.name = name;
+    event.start = start;
+    event.end = end;
+    event.threadId = buffer->threadId;
+    event.flags = flags;
+
+    if (!buffer->ring.push(event)) {
+        buffer->dropped.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+void Profiler::setThreadName(const std::string& name) {
+    ProfileThreadBuffer* buffer = getThreadBuffer();
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_threadNames[buffer->threadId] = name;
+}
+
+void Profiler::collect() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    ProfileEvent batch[256];
+    for (auto& thread : m_threads) {
+        // Check retirement first so nothing pushed before exit is missed
+        bool retired = thread->retired.load(std::memory_order_acquire);
+
+        size_t count;
+        while ((count = thread->ring.popBatch(batch, std::size(batch))) != 0) {
+            size_t room = m_maxEvents > m_events.size() ? m_maxEvents - m_events.size() : 0;
+            size_t kept = std::min(count, room);
+            m_events.insert(m_events.end(), batch, batch + kept);
+            m_eventsDropped += count - kept;
+        }
+        m_eventsDropped += thread->dropped.exchange(0, std::memory_order_relaxed);
+
+        if (retired) {
+            thread.reset();
+        }
+    }
+
+    m_threads.erase(std::remove(m_threads.begin(), m_threads.end(), nullptr), m_threads.end());
+}
+
+bool Profiler::writeChromeTrace(const std::string& path) {
+    std::vector<ProfileEvent> events;
+    std::unordered_map<uint32_t, std::string> threadNames;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        events = m_events;
+        threadNames = m_threadNames;
+    }
+
+    std::sort(events.begin(), events.end(), [](const ProfileEvent& a, const ProfileEvent& b) {
+        return a.start < b.start;
+    });
+
+    std::string out;
+    out.reserve(events.size() * 96 + 1024);
+    out += "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+
+    // Metadata: process and thread names
+    out += "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":0,\"tid\":0,\"args\":{\"name\":\"CPU\"}},\n";
+    out += "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"tid\":0,\"args\":{\"name\":\"GPU\"}},\n";
+    out += "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":0,\"args\":{\"name\":\"Graphics queue\"}}";
+    for (const auto& [threadId, name] : threadNames) {
+        out += ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":";
+        out += std::to_string(threadId);
+        out += ",\"args\":{\"name\":";
+        appendJsonString(out, name.c_str());
+        out += "}}";
+    }
+
+    // Complete ("X") events; nesting is derived from the time ranges
+    for (const ProfileEvent& event : events) {
+        bool gpu = (event.flags & PROFILE_EVENT_GPU) != 0;
+        out += ",\n{\"name\":";
+        appendJsonString(out, event.name);
+        out += gpu ? ",\"cat\":\"gpu\",\"ph\":\"X\",\"ts\":" : ",\"cat\":\"cpu\",\"ph\":\"X\",\"ts\":";
+        appendMicroseconds(out, event.start);
+        out += ",\"dur\":";
+        appendMicroseconds(out, event.end > event.start ? event.end - event.start : 0);
+        out += ",\"pid\":";
+        out += std::to_string(gpu ? TRACE_GPU_PID : TRACE_CPU_PID);
+        out += ",\"tid\":";
+        out += std::to_string(gpu ? 0 : event.threadId);
+        out += "}";
+    }
+    out += "\n]}\n";
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file) {
+        std::cerr << "Failed to open trace file for writing: " << path << std::endl;
+        return false;
+    }
+
+    file.write(out.data(), static_cast<std::streamsize>(out.size()));
+    if (!file) {
+        std::cerr << "Failed to write trace file: " << path << std::endl;
+        return false;
+    }
+    return true;
+}
+
+std::vector<ProfileEvent> Profiler::getEvents() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_events;
+}
+
+ProfilerStats Profiler::getStats() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    ProfilerStats stats;
+    stats.eventsRecorded = m_events.size();
+    stats.eventsDropped = m_eventsDropped;
+    stats.threadCount = static_cast<uint32_t>(m_threads.size());
+    return stats;
+}
+
+} // namespace VortexEngine
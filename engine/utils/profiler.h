@@ -0,0 +1,148 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Compile-time switch for all profiling markers (normally set by CMake).
+// With 0 the VORTEX_PROFILE_* macros expand to nothing and
+// Profiler::isCapturing() is a constant false, so instrumented code compiles
+// to the same thing as uninstrumented code.
+#ifndef VORTEX_PROFILER_ENABLED
+#define VORTEX_PROFILER_ENABLED 1
+#endif
+
+namespace VortexEngine {
+
+struct ProfileThreadBuffer;
+
+// One completed zone. name must have static storage duration (a string
+// literal); only the pointer is recorded.
+struct ProfileEvent {
+    const char* name = nullptr;
+    uint64_t start = 0;       // Nanoseconds since the profiler epoch
+    uint64_t end = 0;
+    uint32_t threadId = 0;    // Profiler thread id (see Profiler::setThreadName)
+    uint32_t flags = 0;
+};
+
+constexpr uint32_t PROFILE_EVENT_GPU = 1u << 0;   // Zone on the GPU queue track
+
+// Profiler statistics
+struct ProfilerStats {
+    uint64_t eventsRecorded = 0;
+    uint64_t eventsDropped = 0;   // Thread buffer or capture full
+    uint32_t threadCount = 0;
+};
+
+// Frame profiler collecting scoped CPU zones and resolved GPU zones
+//
+// Each thread records into its own lock-free ring; collect() drains every
+// ring into the capture on the calling thread, so the engine calls it once a
+// frame. Nothing is recorded outside a capture. writeChromeTrace() emits
+// trace-event JSON that chrome://tracing and Perfetto open directly.
+class Profiler {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    static Profiler& getInstance();
+
+    Profiler(const Profiler&) = delete;
+    Profiler& operator=(const Profiler&) = delete;
+
+    // Capture control
+    void beginCapture();
+    void endCapture();
+    static bool isCapturing() {
+#if VORTEX_PROFILER_ENABLED
+        return s_capturing.load(std::memory_order_relaxed);
+#else
+        return false;
+#endif
+    }
+
+    // Recording (called by ProfileScope and GpuProfiler)
+    static uint64_t now() {
+        return static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - s_epoch).count());
+    }
+    void recordEvent(const char* name, uint64_t start, uint64_t end, uint32_t flags = 0);
+    void setThreadName(const std::string& name);
+
+    // Moves recorded events from all thread buffers into the capture
+    void collect();
+
+    // Output
+    bool writeChromeTrace(const std::string& path);
+    std::vector<ProfileEvent> getEvents() const;
+    ProfilerStats getStats() const;
+
+    // Capture size limit in events (older events are kept, newer ones dropped)
+    void setMaxEvents(size_t maxEvents) { m_maxEvents = maxEvents; }
+
+private:
+    Profiler() = default;
+    ~Profiler() = default;
+
+    ProfileThreadBuffer* getThreadBuffer();
+
+    static inline std::atomic<bool> s_capturing{false};
+    static inline const Clock::time_point s_epoch = Clock::now();
+
+    mutable std::mutex m_mutex;
+    std::vector<std::shared_ptr<ProfileThreadBuffer>> m_threads;
+    std::unordered_map<uint32_t, std::string> m_threadNames;   // Kept after a thread exits
+    std::vector<ProfileEvent> m_events;
+    size_t m_maxEvents = 4 * 1024 * 1024;
+    uint64_t m_eventsDropped = 0;
+    uint32_t m_nextThreadId = 0;
+};
+
+// Records the enclosing scope as one zone on the current thread
+class ProfileScope {
+public:
+    explicit ProfileScope(const char* name) {
+        if (Profiler::isCapturing()) {
+            m_name = name;
+            m_start = Profiler::now();
+        }
+    }
+
+    ~ProfileScope() {
+        if (m_name) {
+            Profiler::getInstance().recordEvent(m_name, m_start, Profiler::now());
+        }
+    }
+
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+
+private:
+    const char* m_name = nullptr;
+    uint64_t m_start = 0;
+};
+
+} // namespace VortexEngine
+
+// Profiling macros
+//
+// Usage: VORTEX_PROFILE_SCOPE("Physics"); the name must be a string literal.
+// VORTEX_PROFILE_FUNCTION() names the zone after the enclosing function.
+#define VORTEX_PROFILE_CONCAT_INNER(a, b) a##b
+#define VORTEX_PROFILE_CONCAT(a, b) VORTEX_PROFILE_CONCAT_INNER(a, b)
+
+#if VORTEX_PROFILER_ENABLED
+#define VORTEX_PROFILE_SCOPE(name) \
+    ::VortexEngine::ProfileScope VORTEX_PROFILE_CONCAT(vortexProfileScope, __LINE__)(name)
+#define VORTEX_PROFILE_FUNCTION() VORTEX_PROFILE_SCOPE(__func__)
+#define VORTEX_PROFILE_THREAD(name) ::VortexEngine::Profiler::getInstance().setThreadName(name)
+#else
+#define VORTEX_PROFILE_SCOPE(name) ((void)0)
+#define VORTEX_PROFILE_FUNCTION() ((void)0)
+#define VORTEX_PROFILE_THREAD(name) ((void)0)
+#endif
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace VortexEngine {
+
+// Fixed-capacity single-producer/single-consumer queue
+//
+// One thread may push and one (possibly the same) thread may pop, without
+// locks. Each side keeps a cached copy of the other side's index, so the
+// shared cache lines are only touched when the ring looks full or empty.
+// push() fails instead of blocking when the ring is full.
+template<typename T, size_t Capacity>
+class SpscRing {
+    static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+    static_assert(std::is_trivially_copyable_v<T>, "SpscRing stores trivially copyable items");
+
+public:
+    static constexpr size_t capacity() { return Capacity; }
+
+    // Producer side
+    bool push(const T& item) {
+        uint64_t head = m_head.load(std::memory_order_relaxed);
+        if (head - m_cachedTail >= Capacity) {
+            m_cachedTail = m_tail.load(std::memory_order_acquire);
+            if (head - m_cachedTail >= Capacity) {
+                return false;
+            }
+        }
+        m_items[head & (Capacity - 1)] = item;
+        m_head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer side
+    bool pop(T& item) {
+        return popBatch(&item, 1) == 1;
+    }
+
+    // Pops up to maxCount items in order; returns the number popped
+    size_t popBatch(T* items, size_t maxCount) {
+        uint64_t tail = m_tail.load(std::memory_order_relaxed);
+        if (m_cachedHead == tail) {
+            m_cachedHead = m_head.load(std::memory_order_acquire);
+        }
+
+        size_t count = static_cast<size_t>(m_cachedHead - tail);
+        count = count < maxCount ? count : maxCount;
+        for (size_t i = 0; i < count; ++i) {
+            items[i] = m_items[(tail + i) & (Capacity - 1)];
+        }
+        if (count != 0) {
+            m_tail.store(tail + count, std::memory_order_release);
+        }
+        return count;
+    }
+
+    // Approximate when called concurrently with push/pop
+    size_t size() const {
+        return static_cast<size_t>(m_head.load(std::memory_order_acquire) - m_tail.load(std::memory_order_acquire));
+    }
+
+private:
+    alignas(64) std::atomic<uint64_t> m_head{0};   // Written by the producer
+    uint64_t m_cachedTail = 0;                      // Producer's view of tail
+    alignas(64) std::atomic<uint64_t> m_tail{0};   // Written by the consumer
+    uint64_t m_cachedHead = 0;                      // Consumer's view of head
+    alignas(64) std::array<T, Capacity> m_items{};
+};
+
+} // namespace VortexEngine
@@ -0,0 +1,88 @@
+#include "string_id.h"
+#include <deque>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+
+namespace VortexEngine {
+
+namespace {
+
+// Global intern table. Strings live in a deque so the views used as map keys
+// and the references handed out by StringId::str() stay valid forever.
+struct StringTable {
+    std::shared_mutex mutex;
+    std::deque<std::string> strings;
+    std::unordered_map<std::string_view, StringId::ValueType> ids;
+
+    StringTable() {
+        // Slot 0 is reserved for the invalid id
+        strings.emplace_back();
+    }
+};
+
+StringTable& getStringTable() {
+    static StringTable table;
+    return table;
+}
+
+} // namespace
+
+StringId StringId::intern(std::string_view str) {
+    if (str.empty()) {
+        return StringId();
+    }
+
+    StringTable& table = getStringTable();
+
+    {
+        std::shared_lock<std::shared_mutex> lock(table.mutex);
+        auto it = table.ids.find(str);
+        if (it != table.ids.end()) {
+            return StringId(it->second);
+        }
+    }
+
+    std::unique_lock<std::shared_mutex> lock(table.mutex);
+
+    // Another thread may have interned the string while we waited for the lock
+    auto it = table.ids.find(str);
+    if (it != table.ids.end()) {
+        return StringId(it->second);
+    }
+
+    ValueType value = static_cast<ValueType>(table.strings.size());
+    const std::string& stored = table.strings.emplace_back(str);
+    table.ids.emplace(std::string_view(stored), value);
+    return StringId(value);
+}
+
+StringId StringId::find(std::string_view str) {
+    if (str.empty()) {
+        return StringId();
+    }
+
+    StringTable& table = getStringTable();
+    std::shared_lock<std::shared_mutex> lock(table.mutex);
+
+    auto it = table.ids.find(str);
+    if (it != table.ids.end()) {
+        return StringId(it->second);
+    }
+
+    return StringId();
+}
+
+const std::string& StringId::str() const {
+    StringTable& table = getStringTable();
+    std::shared_lock<std::shared_mutex> lock(table.mutex);
+    return table.strings[m_value];
+}
+
+size_t StringId::getInternedCount() {
+    StringTable& table = getStringTable();
+    std::shared_lock<std::shared_mutex> lock(table.mutex);
+    return table.strings.size() - 1;
+}
+
+} // namespace VortexEngine
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+
+namespace VortexEngine {
+
+// Interned string identifier
+//
+// Every distinct string is stored once in a global table and represented by a
+// small integer. Comparing or hashing a StringId never touches the characters,
+// so it can be used as a key in hot lookup tables. Interning an already known
+// string does not allocate.
+class StringId {
+public:
+    using ValueType = uint32_t;
+    static constexpr ValueType InvalidValue = 0;
+
+    constexpr StringId() = default;
+    explicit StringId(std::string_view str) : m_value(intern(str).m_value) {}
+
+    // Interning
+    static StringId intern(std::string_view str);
+    static StringId find(std::string_view str);
+
+    // Accessors
+    const std::string& str() const;
+    const char* c_str() const { return str().c_str(); }
+    constexpr ValueType getValue() const { return m_value; }
+    constexpr bool isValid() const { return m_value != InvalidValue; }
+    explicit constexpr operator bool() const { return isValid(); }
+
+    // Comparison
+    constexpr bool operator==(const StringId& other) const { return m_value == other.m_value; }
+    constexpr bool operator!=(const StringId& other) const { return m_value != other.m_value; }
+    constexpr bool operator<(const StringId& other) const { return m_value < other.m_value; }
+
+    // Debug information
+    static size_t getInternedCount();
+
+private:
+    explicit constexpr StringId(ValueType value) : m_value(value) {}
+
+    ValueType m_value = InvalidValue;
+};
+
+} // namespace VortexEngine
+
+template<>
+struct std::hash<VortexEngine::StringId> {
+    size_t operator()(const VortexEngine::StringId& id) const noexcept {
+        return std::hash<uint32_t>()(id.getValue());
+    }
+};
@@ -0,0 +1,158 @@
+#include "virtual_file_system.h"
+#include <algorithm>
+#include <filesystem>
+#include <iostream>
+#include <mutex>
+#include <unordered_set>
+
+namespace VortexEngine {
+
+bool VirtualFileSystem::mountArchive(const std::string& archivePath) {
+    auto archive = std::make_unique<AssetArchive>();
+    if (!archive->open(archivePath)) {
+        std::cerr << "Failed to mount archive: " << archivePath << std::endl;
+        return false;
+    }
+
+    std::unique_lock<std::shared_mutex> lock(m_mutex);
+    m_archives.push_back(std::move(archive));
+    std::cout << "Mounted archive " << archivePath << " (" << m_archives.back()->getEntryCount() << " entries)" << std::endl;
+    return true;
+}
+
+bool VirtualFileSystem::unmountArchive(const std::string& archivePath) {
+    std::unique_lock<std::shared_mutex> lock(m_mutex);
+    auto it = std::find_if(m_archives.begin(), m_archives.end(), [&archivePath](const auto& archive) {
+        return archive->getPath() == archivePath;
+    });
+    if (it == m_archives.end()) {
+        return false;
+    }
+
+    m_archives.erase(it);
+    return true;
+}
+
+void VirtualFileSystem::unmountAll() {
+    std::unique_lock<std::shared_mutex> lock(m_mutex);
+    m_archives.clear();
+}
+
+size_t VirtualFileSystem::getMountedArchiveCount() const {
+    std::shared_lock<std::shared_mutex> lock(m_mutex);
+    return m_archives.size();
+}
+
+void VirtualFileSystem::addSearchPath(const std::string& directory) {
+    std::unique_lock<std::shared_mutex> lock(m_mutex);
+    m_searchPaths.push_back(directory);
+}
+
+void VirtualFileSystem::clearSearchPaths() {
+    std::unique_lock<std::shared_mutex> lock(m_mutex);
+    m_searchPaths.clear();
+}
+
+bool VirtualFileSystem::exists(std::string_view path) const {
+    std::string normalized = VPak::normalizePath(path);
+
+    std::shared_lock<std::shared_mutex> lock(m_mutex);
+    for (auto it = m_archives.rbegin(); it != m_archives.rend(); ++it) {
+        if ((*it)->contains(normalized)) {
+            return true;
+        }
+    }
+    return !findLooseFile(path, normalized).empty();
+}
+
+VirtualFile VirtualFileSystem::openFile(std::string_view path) const {
+    VirtualFile file;
+    std::string normalized = VPak::normalizePath(path);
+
+    std::shared_lock<std::shared_mutex> lock(m_mutex);
+
+    // Archives first, newest mount wins
+    for (auto it = m_archives.rbegin(); it != m_archives.rend(); ++it) {
+        const AssetArchive& archive = **it;
+        const VPak::TocEntry* entry = archive.findEntry(normalized);
+        if (!entry) {
+            continue;
+        }
+
+        file.m_fromArchive = true;
+        if (entry->compression == VPak::Compression::None) {
+            file.m_data = archive.getView(*entry);
+            file.m_valid = true;
+        } else if (archive.readEntry(*entry, file.m_buffer)) {
+            file.m_data = std::as_bytes(std::span<const uint8_t>(file.m_buffer));
+            file.m_valid = true;
+        }
+        return file;
+    }
+
+    // Then loose files
+    std::string loosePath = findLooseFile(path, normalized);
+    if (!loosePath.empty() && file.m_mapping.open(loosePath, MappedFile::AccessHint::Sequential)) {
+        file.m_data = file.m_mapping.getData();
+        file.m_valid = true;
+    }
+    return file;
+}
+
+bool VirtualFileSystem::readFile(std::string_view path, std::vector<uint8_t>& data) const {
+    VirtualFile file = openFile(path);
+    if (!file.isValid()) {
+        return false;
+    }
+
+    if (!file.m_buffer.empty()) {
+        data = std::move(file.m_buffer);
+        return true;
+    }
+
+    const uint8_t* bytes = reinterpret_cast<const uint8_t*>(file.getData().data());
+    data.assign(bytes, bytes + file.getSize());
+    return true;
+}
+
+std::vector<std::string> VirtualFileSystem::listArchiveFiles() const {
+    std::vector<std::string> files;
+    std::unordered_set<std::string_view> seen;
+
+    std::shared_lock<std::shared_mutex> lock(m_mutex);
+    for (auto it = m_archives.rbegin(); it != m_archives.rend(); ++it) {
+        for (const auto& entry : (*it)->getEntries()) {
+            std::string_view entryPath = (*it)->getEntryPath(entry);
+            if (seen.insert(entryPath).second) {
+                files.emplace_back(entryPath);
+            }
+        }
+    }
+
+    std::sort(files.begin(), files.end());
+    return files;
+}
+
+std::string VirtualFileSystem::findLooseFile(std::string_view path, const std::string& normalizedPath) const {
+    std::error_code ec;
+
+    // Absolute paths bypass the search paths
+    if (std::filesystem::path(path).is_absolute()) {
+        std::string absolutePath(path);
+        return std::filesystem::is_regular_file(absolutePath, ec) ? absolutePath : std::string();
+    }
+
+    if (m_searchPaths.empty()) {
+        return std::filesystem::is_regular_file(normalizedPath, ec) ? normalizedPath : std::string();
+    }
+
+    for (const auto& directory : m_searchPaths) {
+        std::string candidate = (std::filesystem::path(directory) / normalizedPath).string();
+        if (std::filesystem::is_regular_file(candidate, ec)) {
+            return candidate;
+        }
+    }
+    return std::string();
+}
+
+} // namespace VortexEngine
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <memory>
+#include <shared_mutex>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "asset_archive.h"
+#include "mapped_file.h"
+
+namespace VortexEngine {
+
+// Contents of a file resolved through the virtual file system
+//
+// Uncompressed archive entries point straight into the archive mapping and
+// stay valid while that archive is mounted. Loose files are mapped, and
+// compressed entries are decompressed into a buffer owned by this object.
+class VirtualFile {
+public:
+    bool isValid() const { return m_valid; }
+    bool isFromArchive() const { return m_fromArchive; }
+    std::span<const std::byte> getData() const { return m_data; }
+    size_t getSize() const { return m_data.size(); }
+
+private:
+    friend class VirtualFileSystem;
+
+    bool m_valid = false;
+    bool m_fromArchive = false;
+    std::span<const std::byte> m_data;
+    MappedFile m_mapping;
+    std::vector<uint8_t> m_buffer;
+};
+
+// Virtual file system
+//
+// Resolves engine paths such as "shaders/basic.vert.spv" against mounted
+// .vpak archives first (most recently mounted wins) and then against loose
+// files in the search paths, in the order they were added. With no search
+// paths, loose files are looked up relative to the working directory;
+// absolute paths are only ever loose files.
+class VirtualFileSystem {
+public:
+    VirtualFileSystem() = default;
+    ~VirtualFileSystem() = default;
+
+    VirtualFileSystem(const VirtualFileSystem&) = delete;
+    VirtualFileSystem& operator=(const VirtualFileSystem&) = delete;
+
+    // Archives
+    bool mountArchive(const std::string& archivePath);
+    bool unmountArchive(const std::string& archivePath);
+    void unmountAll();
+    size_t getMountedArchiveCount() const;
+
+    // Loose files
+    void addSearchPath(const std::string& directory);
+    void clearSearchPaths();
+
+    // File access
+    bool exists(std::string_view path) const;
+    VirtualFile openFile(std::string_view path) const;
+    bool readFile(std::string_view path, std::vector<uint8_t>& data) const;
+
+    // Every path visible in mounted archives
+    std::vector<std::string> listArchiveFiles() const;
+
+private:
+    mutable std::shared_mutex m_mutex;
+    std::vector<std::unique_ptr<AssetArchive>> m_archives;
+    std::vector<std::string> m_searchPaths;
+
+    std::string findLooseFile(std::string_view path, const std::string& normalizedPath) const;
+};
+
+} // namespace VortexEngine
@@ -0,0 +1,252 @@
+// vortex_logdecode - converts binary engine logs (.vlog) to text or JSON
+//
+// Usage: vortex_logdecode [--json] <file.vlog>
+
+#include <chrono>
+#include <cstring>
+#include <ctime>
+#include <iostream>
+#include <span>
+#include <string>
+#include <unordered_map>
+
+#include "engine/utils/logger.h"
+#include "engine/utils/mapped_file.h"
+
+using namespace VortexEngine;
+
+namespace {
+
+struct DecodedSource {
+    uint32_t line = 0;
+    std::string file;
+    std::string function;
+    std::string format;
+};
+
+struct Calibration {
+    uint64_t startTicks = 0;
+    int64_t startSystemNanoseconds = 0;
+    double nanosecondsPerTick = 1.0;
+};
+
+class Reader {
+public:
+    explicit Reader(std::span<const char> data) : m_data(data) {}
+
+    bool atEnd() const { return m_offset >= m_data.size(); }
+    bool failed() const { return m_failed; }
+
+    template<typename T>
+    T read() {
+        T value{};
+        if (m_offset + sizeof(T) > m_data.size()) {
+            m_failed = true;
+            m_offset = m_data.size();
+            return value;
+        }
+        std::memcpy(&value, m_data.data() + m_offset, sizeof(T));
+        m_offset += sizeof(T);
+        return value;
+    }
+
+    const char* readBytes(size_t count) {
+        if (m_offset + count > m_data.size()) {
+            m_failed = true;
+            m_offset = m_data.size();
+            return nullptr;
+        }
+        const char* bytes = m_data.data() + m_offset;
+        m_offset += count;
+        return bytes;
+    }
+
+    std::string readString() {
+        uint16_t length = read<uint16_t>();
+        const char* bytes = readBytes(length);
+        return bytes ? std::string(bytes, length) : std::string();
+    }
+
+private:
+    std::span<const char> m_data;
+    size_t m_offset = 0;
+    bool m_failed = false;
+};
+
+int64_t ticksToNanoseconds(const Calibration& calibration, uint64_t ticks) {
+    double offset = static_cast<double>(static_cast<int64_t>(ticks - calibration.startTicks)) * calibration.nanosecondsPerTick;
+    return calibration.startSystemNanoseconds + static_cast<int64_t>(offset);
+}
+
+std::string formatTime(int64_t nanoseconds) {
+    std::time_t seconds = static_cast<std::time_t>(nanoseconds / 1000000000);
+    std::tm localTime{};
+#ifdef _WIN32
+    localtime_s(&localTime, &seconds);
+#else
+    localtime_r(&seconds, &localTime);
+#endif
+
+    char buffer[48];
+    size_t length = std::strftime(buffer, sizeof(buffer), "%Y-%m-%d %H:%M:%S", &localTime);
+    std::snprintf(buffer + length, sizeof(buffer) - length, ".%06d", static_cast<int>((nanoseconds / 1000) % 1000000));
+    return buffer;
+}
+
+void appendJsonString(std::string& out, std::string_view text) {
+    out.push_back('"');
+    for (char c : text) {
+        switch (c) {
+            case '"': out.append("\\\""); break;
+            case '\\': out.append("\\\\"); break;
+            case '\n': out.append("\\n"); break;
+            case '\r': out.append("\\r"); break;
+            case '\t': out.append("\\t"); break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    char escape[8];
+                    std::snprintf(escape, sizeof(escape), "\\u%04x", c);
+                    out.append(escape);
+                } else {
+                    out.push_back(c);
+                }
+        }
+    }
+    out.push_back('"');
+}
+
+void printUsage() {
+    std::cerr << "Usage: vortex_logdecode [--json] <file.vlog>" << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    bool json = false;
+    std::string path;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string argument = argv[i];
+        if (argument == "--json") {
+            json = true;
+        } else if (argument == "--help" || argument == "-h") {
+            printUsage();
+            return 0;
+        } else {
+            path = argument;
+        }
+    }
+
+    if (path.empty()) {
+        printUsage();
+        return 1;
+    }
+
+    // Logs can be large; decode straight from the mapping instead of a copy
+    MappedFile file;
+    if (!file.open(path, MappedFile::AccessHint::Sequential)) {
+        std::cerr << "Failed to open log file: " << path << std::endl;
+        return 1;
+    }
+
+    Reader reader(file.getDataAs<char>());
+    const char* magic = reader.readBytes(sizeof(BinaryLog::MAGIC));
+    if (!magic || std::memcmp(magic, BinaryLog::MAGIC, sizeof(BinaryLog::MAGIC)) != 0) {
+        std::cerr << "Not a Vortex binary log: " << path << std::endl;
+        return 1;
+    }
+
+    uint32_t version = reader.read<uint32_t>();
+    if (version != BinaryLog::VERSION) {
+        std::cerr << "Unsupported binary log version " << version << " (expected " << BinaryLog::VERSION << ")" << std::endl;
+        return 1;
+    }
+
+    std::unordered_map<uint32_t, DecodedSource> sources;
+    Calibration calibration;
+    std::string message;
+    std::string line;
+    size_t recordCount = 0;
+
+    while (!reader.atEnd()) {
+        auto type = static_cast<BinaryLog::EntryType>(reader.read<uint8_t>());
+
+        switch (type) {
+            case BinaryLog::EntryType::Calibration:
+                calibration.startTicks = reader.read<uint64_t>();
+                calibration.startSystemNanoseconds = reader.read<int64_t>();
+                calibration.nanosecondsPerTick = reader.read<double>();
+                break;
+
+            case BinaryLog::EntryType::Source: {
+                uint32_t id = reader.read<uint32_t>();
+                DecodedSource source;
+                source.line = reader.read<uint32_t>();
+                source.file = reader.readString();
+                source.function = reader.readString();
+                source.format = reader.readString();
+                sources[id] = std::move(source);
+                break;
+            }
+
+            case BinaryLog::EntryType::Record: {
+                uint64_t ticks = reader.read<uint64_t>();
+                uint32_t sourceId = reader.read<uint32_t>();
+                uint32_t threadId = reader.read<uint32_t>();
+                auto level = static_cast<LogLevel>(reader.read<uint8_t>());
+                uint8_t flags = reader.read<uint8_t>();
+                uint16_t length = reader.read<uint16_t>();
+                const char* arguments = reader.readBytes(length);
+                if (!arguments) {
+                    break;
+                }
+
+                static const DecodedSource unknownSource{0, "?", "?", "{}"};
+                auto it = sources.find(sourceId);
+                const DecodedSource& source = it != sources.end() ? it->second : unknownSource;
+
+                message.clear();
+                Logger::formatArguments(message, source.format, arguments, length, flags & LOG_RECORD_TRUNCATED);
+
+                int64_t nanoseconds = ticksToNanoseconds(calibration, ticks);
+                line.clear();
+                if (json) {
+                    line.append("{\"time_ns\":").append(std::to_string(nanoseconds));
+                    line.append(",\"time\":");
+                    appendJsonString(line, formatTime(nanoseconds));
+                    line.append(",\"level\":");
+                    appendJsonString(line, Logger::levelToString(level));
+                    line.append(",\"thread\":").append(std::to_string(threadId));
+                    line.append(",\"file\":");
+                    appendJsonString(line, source.file);
+                    line.append(",\"line\":").append(std::to_string(source.line));
+                    line.append(",\"function\":");
+                    appendJsonString(line, source.function);
+                    line.append(",\"message\":");
+                    appendJsonString(line, message);
+                    line.append("}\n");
+                } else {
+                    line.append("[").append(formatTime(nanoseconds)).append("] ");
+                    line.append("[").append(Logger::levelToString(level)).append("] ");
+                    line.append("[").append(source.file).append(":").append(std::to_string(source.line)).append("] ");
+                    line.append("[thread ").append(std::to_string(threadId)).append("]: ");
+                    line.append(message).append("\n");
+                }
+                std::cout << line;
+                recordCount++;
+                break;
+            }
+
+            default:
+                std::cerr << "Corrupt entry in " << path << ", stopping after " << recordCount << " records" << std::endl;
+                return 1;
+        }
+    }
+
+    if (reader.failed()) {
+        // A log cut short by a crash still decodes up to the last whole entry
+        std::cerr << "Log truncated after " << recordCount << " records" << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,40 @@
+// vortex_bundle_scripts - compiles a script directory into a .vpak bundle
+//
+// Usage: vortex_bundle_scripts [--compress] <script-directory> <bundle.vpak>
+//
+// Every .py file becomes a checked hash-based .pyc entry (see ScriptBundle).
+// Bytecode is tied to the Python version, so run the tool built against the
+// same Python the engine embeds.
+
+#include <Python.h>
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "engine/scripting/script_bundle.h"
+
+using namespace VortexEngine;
+
+int main(int argc, char* argv[]) {
+    bool compress = false;
+    std::vector<std::string> positional;
+    for (int i = 1; i < argc; ++i) {
+        std::string argument = argv[i];
+        if (argument == "--compress" || argument == "-c") {
+            compress = true;
+        } else {
+            positional.push_back(argument);
+        }
+    }
+
+    if (positional.size() != 2) {
+        std::cerr << "Usage: vortex_bundle_scripts [--compress] <script-directory> <bundle.vpak>" << std::endl;
+        return 1;
+    }
+
+    Py_Initialize();
+    bool success = ScriptBundle::build(positional[0], positional[1], compress);
+    Py_Finalize();
+    return success ? 0 : 1;
+}
@@ -0,0 +1,132 @@
+// vortex_pack - builds, lists and extracts .vpak asset archives
+//
+// Usage: vortex_pack create [--compress] <archive.vpak> <file-or-directory>...
+//        vortex_pack list <archive.vpak>
+//        vortex_pack extract <archive.vpak> <directory>
+//
+// Directories are added recursively. Entries keep the path they were given
+// on the command line ("shaders" adds "shaders/basic.vert.spv", ...), which
+// is the path the engine's virtual file system resolves.
+
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "engine/utils/asset_archive.h"
+#include "engine/utils/file_utils.h"
+
+using namespace VortexEngine;
+namespace fs = std::filesystem;
+
+namespace {
+
+void printUsage() {
+    std::cerr << "Usage: vortex_pack create [--compress] <archive.vpak> <file-or-directory>..." << std::endl;
+    std::cerr << "       vortex_pack list <archive.vpak>" << std::endl;
+    std::cerr << "       vortex_pack extract <archive.vpak> <directory>" << std::endl;
+}
+
+int createArchive(const std::vector<std::string>& arguments) {
+    bool compress = false;
+    std::vector<std::string> positional;
+    for (const auto& argument : arguments) {
+        if (argument == "--compress" || argument == "-c") {
+            compress = true;
+        } else {
+            positional.push_back(argument);
+        }
+    }
+
+    if (positional.size() < 2) {
+        printUsage();
+        return 1;
+    }
+
+    ArchiveWriter writer;
+    for (size_t i = 1; i < positional.size(); ++i) {
+        const std::string& input = positional[i];
+        std::error_code ec;
+
+        if (fs::is_directory(input, ec)) {
+            for (const auto& item : fs::recursive_directory_iterator(input)) {
+                if (!item.is_regular_file()) {
+                    continue;
+                }
+                std::string entryPath = (fs::path(input) / fs::relative(item.path(), input)).generic_string();
+                if (!writer.addFile(entryPath, item.path().string(), compress)) {
+                    return 1;
+                }
+            }
+        } else if (fs::is_regular_file(input, ec)) {
+            if (!writer.addFile(input, input, compress)) {
+                return 1;
+            }
+        } else {
+            std::cerr << "No such file or directory: " << input << std::endl;
+            return 1;
+        }
+    }
+
+    if (!writer.write(positional[0])) {
+        return 1;
+    }
+
+    std::cout << "Packed " << writer.getEntryCount() << " files into " << positional[0] << std::endl;
+    return 0;
+}
+
+int listArchive(const std::string& path) {
+    AssetArchive archive;
+    if (!archive.open(path)) {
+        return 1;
+    }
+
+    uint64_t totalSize = 0;
+    uint64_t totalStored = 0;
+    for (const auto& entry : archive.getEntries()) {
+        std::cout << std::setw(12) << entry.size << std::setw(12) << entry.storedSize
+                  << (entry.compression == VPak::Compression::LZ4 ? "  lz4   " : "  store ")
+                  << archive.getEntryPath(entry) << std::endl;
+        totalSize += entry.size;
+        totalStored += entry.storedSize;
+    }
+
+    std::cout << archive.getEntryCount() << " files, " << totalSize << " bytes (" << totalStored << " stored)" << std::endl;
+    return 0;
+}
+
+int extractArchive(const std::string& path, const std::string& destination) {
+    FileResult result = FileUtils::extractArchive(path, destination);
+    if (result != FileResult::Success) {
+        std::cerr << "Failed to extract " << path << std::endl;
+        return 1;
+    }
+    return 0;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    if (argc < 3) {
+        printUsage();
+        return 1;
+    }
+
+    std::string command = argv[1];
+    std::vector<std::string> arguments(argv + 2, argv + argc);
+
+    if (command == "create") {
+        return createArchive(arguments);
+    }
+    if (command == "list") {
+        return listArchive(arguments[0]);
+    }
+    if (command == "extract" && arguments.size() == 2) {
+        return extractArchive(arguments[0], arguments[1]);
+    }
+
+    printUsage();
+    return 1;
+}